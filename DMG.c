@@ -1,14 +1,18 @@
-// DMG.c : This file contains the 'main' function. Program execution begins and ends there.
+// DMG.c : Maps the DMG, reads its trailer and expands partitions.
 //
 //   Date:18-09-2021 
 
 #include <stdio.h>
-#include <zlib.h>
 #include <errno.h>
 #include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "dmgParser.h"
-#include "apfs.h"
-#include "pList.h"
+#include "crc32.h"
+#include "stats.h"
+#include "inflate.h"
 
 //Portable endianness conversion
 #if defined(WIN32) || defined(__WIN32) ||defined(__WIN32__) || defined(__NT__) ||defined(_WIN64)    
@@ -20,259 +24,404 @@
 #include <endian.h>
 #endif
 
-#define INFLATE_BUF_LEN 4096
-#define ENTRY_TYPE_ZLIB	0x80000005
+#define READAHEAD_LEN   (8 << 20)
 
-command_line_args args;
+/*
+   Input Parameters: dmg_image*, char*
+   Return Type:      int
+Description: Maps the whole DMG read-only. Every later read (trailer, plist,
+chunks) is served straight from the mapping, so the data is never copied
+into private buffers and the page cache is reused across runs. Returns 0,
+or DMG_EOPEN, DMG_ESIZE or DMG_EMAP with errno kept from the failed call.
 
-FILE* readImageFile(FILE* stream, char* dmg_path)
+ */
+int readImageFile(dmg_image* image, char* dmg_path)
 {
-#if defined(WIN32) || defined(__WIN32) ||defined(__WIN32__) || defined(__NT__) ||defined(_WIN64)   
-        size_t bufferSize;
-        errno_t e=_dupenv_s(&dmg_path, &bufferSize,"bigandsmall");
+        struct stat st;
+        int ret = 0, saved;
 
-        if (e || dmg_path == nullptr)
-                printf("The path is not found.");     
-#endif
+        memset(image, 0, sizeof(*image));
+        image->fd = -1;
 
-        stream = fopen(dmg_path, "r");
+        image->syscalls += 2;
+        if ((image->fd = open(dmg_path, O_RDONLY)) < 0 || fstat(image->fd, &st) < 0)
+                ret = DMG_EOPEN;
 
-        if (stream == 0)
-        {
-                printf("Failed to open the file '%s'\n", dmg_path);
+        if (ret == 0) {
+                image->size = st.st_size;
+                image->mtime = st.st_mtime;
+
+                if (image->size < sizeof(UDIFResourceFile))
+                        ret = DMG_ESIZE;
         }
 
-        return stream;
-}
+        if (ret == 0) {
+                image->data = mmap(NULL, image->size, PROT_READ, MAP_PRIVATE, image->fd, 0);
+                image->syscalls++;
 
-FILE* parseDMGTrailer(FILE* stream, UDIFResourceFile* dmgTrailer)
-{
-        int trailerSize = 512;
+                if (image->data == MAP_FAILED) {
+                        image->data = NULL;
+                        ret = DMG_EMAP;
+                }
+        }
 
-        if (fseek(stream, -trailerSize, SEEK_END)) {
-                printf("Couldn't seek to the desired position in the file.\n");
+        if (ret < 0) {
+                saved = errno;
+                closeImageFile(image);
+                errno = saved;
         }
-        else {
-                int bytesRead = fread(dmgTrailer, trailerSize, 1, stream);
+
+        return ret;
+}
+
+const char* dmgStrerror(int error)
+{
+        switch (error) {
+                case 0:                 return "Success";
+                case DMG_EOPEN:         return "Unable to open the file";
+                case DMG_ESIZE:         return "The file is too small to be a DMG";
+                case DMG_EMAP:          return "Unable to map the file";
+                case DMG_ENOTUDIF:      return "No koly trailer found, this is not a UDIF disk image";
+                case DMG_EPLIST:        return "The plist is malformed or lies outside of the file";
+                case DMG_ENOMEM:        return "Out of memory";
+                case DMG_EINFLATE:      return "A chunk failed to inflate";
+                case DMG_EWRITE:        return "Unable to write the output file";
+                case DMG_ECHECKSUM:     return "Checksum mismatch";
+                case DMG_EFORK:         return "The data fork lies outside of the file";
+                default:                return "Unknown error";
         }
+}
 
-        return stream;
+void closeImageFile(dmg_image* image)
+{
+        if (image->data)
+                munmap((void*)image->data, image->size);
+        if (image->fd >= 0)
+                close(image->fd);
+
+        image->data = NULL;
+        image->fd = -1;
 }
 
-FILE* readXMLOffset(FILE* stream, UDIFResourceFile* dmgTrailer, char** plist)
+// Returns a pointer to [offset, offset + len) of the image, or NULL if it lies outside the file
+const uint8_t* imageRange(dmg_image* image, uint64_t offset, uint64_t len)
 {
-        fseek(stream, be64toh(dmgTrailer->XMLOffset), SEEK_SET);     // Seek to the offset of xml.   
-        *plist = (char*)malloc(be64toh(dmgTrailer->XMLLength));      // Allocate memory to plist char array.
-        fread(*plist, be64toh(dmgTrailer->XMLLength), 1, stream);    // Read the xml.
+        if (offset > image->size || len > image->size - offset)
+                return NULL;
 
-        return stream;
+        return image->data + offset;
 }
 
-BLKXTable* decodeDataBlk(const char* data)
+// Hints the kernel about how a range of the mapping is going to be read
+void adviseImageRange(dmg_image* image, uint64_t offset, uint64_t len, int advice)
 {
-        size_t decode_size = strlen(data);
-        unsigned char* decoded_data = base64_decode(data, decode_size, &decode_size);
+        uint64_t page = sysconf(_SC_PAGESIZE);
+        uint64_t start = offset & ~(page - 1);
 
-        BLKXTable* dataBlk = NULL;
-        dataBlk = (BLKXTable*)decoded_data;
+        if (offset >= image->size || len == 0)
+                return;
+        if (len > image->size - offset)
+                len = image->size - offset;
 
-        return dataBlk;
+        madvise((void*)(image->data + start), offset + len - start, advice);
+        image->syscalls++;
 }
 
-int decompress_to_file(char *compressed, unsigned long comp_size, char* filename)
+// Copies the koly trailer out of the mapping; DMG_ENOTUDIF when there is none
+int parseDMGTrailer(dmg_image* image, UDIFResourceFile* dmgTrailer)
 {
-        z_stream inflate_stream = {0};
-        FILE *output_buf = NULL;
-        char decompressed[INFLATE_BUF_LEN] = {0};
-        unsigned long remaining = 0;
-        int ret = 0;
+        int trailerSize = sizeof(UDIFResourceFile);
 
-        inflate_stream.zalloc = Z_NULL;
-        inflate_stream.zfree  = Z_NULL;
-        inflate_stream.opaque = Z_NULL;
+        memcpy(dmgTrailer, image->data + image->size - trailerSize, trailerSize);
 
-        inflate_stream.next_in  = compressed;
-        inflate_stream.avail_in = comp_size;
+        return memcmp(dmgTrailer->Signature, "koly", 4) == 0 ? 0 : DMG_ENOTUDIF;
+}
 
-        if ( (ret = inflateInit(&inflate_stream)) != Z_OK ) {
-                printf("Error Initializing Inflate! [Ecode - %d]\n", ret);
-                return -1;
-        }
+// Returns the plist inside the mapping, NULL when it lies outside of the file; it is not NUL-terminated
+const char* readXMLOffset(dmg_image* image, UDIFResourceFile* dmgTrailer)
+{
+        return (const char*)imageRange(image, be64toh(dmgTrailer->XMLOffset), be64toh(dmgTrailer->XMLLength));
+}
+
+/* Inflate state, output buffer and output file shared by every chunk of a partition */
+typedef struct {
+        void *inflater;         // Backend state, see inflateBackendInit
+        uint8_t *buffer;        // Large enough for the biggest expanded chunk
+        uint64_t bufferLen;
+        int fd;                 // -1 when only the checksum is computed
+        uint64_t position;      // Expanded bytes accounted for in crc
+        uint32_t crc;
+} dmg_expander;
+
+/*
+   Input Parameters: dmg_expander*, dmg_partition*, char*
+   Return Type:      int
+Description: Sets up the state reused across the chunks: one inflate backend
+state, one output buffer sized from the largest chunk's
+SectorCount so every chunk inflates in a single call, and one output file
+descriptor. A NULL filename expands the partition for its checksum only.
+
+ */
+static int openExpander(dmg_expander* expander, dmg_partition* part, char* filename)
+{
+        memset(expander, 0, sizeof(*expander));
+        expander->fd = -1;
 
-        inflate_stream.next_out  = decompressed;
-        inflate_stream.avail_out = INFLATE_BUF_LEN;
+        for (uint32_t i = 0; i < part->NumberOfChunks; ++i) {
+                uint64_t expanded = (uint64_t)part->Chunks[i].SectorCount * SECTOR_SIZE;
 
-        if ((output_buf = fopen(filename, "a")) == NULL) {
-                printf("Unable to create file decompressed!\n");
-                ret = -1;
-                goto inflate_end;
+                if (part->Chunks[i].EntryType == ENTRY_TYPE_ZLIB && expanded > expander->bufferLen)
+                        expander->bufferLen = expanded;
         }
 
-        while ((ret = inflate(&inflate_stream,  Z_FINISH )) != Z_STREAM_END) {
-                if ((ret == Z_OK || ret == Z_BUF_ERROR ) && inflate_stream.avail_out == 0) {
-                        if (fwrite(decompressed, 1, INFLATE_BUF_LEN, output_buf) == 0) {
-                                printf("Error Writing to output file!\n");
-                                goto close;
-                        }
+        if (expander->bufferLen && (expander->buffer = (uint8_t*)malloc(expander->bufferLen)) == NULL)
+                return DMG_ENOMEM;
 
-                        memset(decompressed, 0, sizeof(decompressed));
-                        inflate_stream.next_out  = decompressed;
-                        inflate_stream.avail_out = INFLATE_BUF_LEN;
-                }
-                else {
-                        printf("Error Inflating! [Code - %d]\n", ret);
-                        goto close;
-                }
+        if ((expander->inflater = inflateBackendInit()) == NULL) {
+                free(expander->buffer);
+                return DMG_EINFLATE;
         }
 
-        remaining = inflate_stream.total_out % INFLATE_BUF_LEN;
-        if (remaining == 0 && inflate_stream.total_out > 0)
-                remaining = INFLATE_BUF_LEN;
+        if (filename != NULL && (expander->fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0) {
+                inflateBackendEnd(expander->inflater);
+                free(expander->buffer);
+                return DMG_EWRITE;
+        }
+
+        return 0;
+}
+
+static int closeExpander(dmg_expander* expander)
+{
+        int ret = 0;
+
+        if (expander->fd >= 0 && close(expander->fd) < 0)
+                ret = DMG_EWRITE;
 
-        if (fwrite(decompressed, 1, remaining, output_buf) == 0)
-                printf("Error Writing to output file!\n");
+        // The open() of the output and its close()
+        if (expander->fd >= 0)
+                STATS_ADD(STATS_SYSCALLS, 2);
+
+        inflateBackendEnd(expander->inflater);
+        free(expander->buffer);
 
-close:
-        fclose(output_buf);
-inflate_end:
-        inflateEnd (&inflate_stream);
         return ret;
 }
 
-
-// This function will be called by printdmgBlocks
-void readDataBlks(BLKXTable* dataBlk, FILE* stream, char* filename)
+static int write_at(dmg_expander* expander, const uint8_t *data, uint64_t len, uint64_t offset)
 {
-        int sectorSize = 512;
-        uint8_t* compressedBlk = NULL; 
+        while (len > 0) {
+                ssize_t written = pwrite(expander->fd, data, len, offset);
 
-        for (int noOfChunks = 0; noOfChunks < (be32toh(dataBlk->NumberOfBlockChunks)); noOfChunks++)
-        {
-                fseek(stream, be64toh(dataBlk->chunk[noOfChunks].CompressedOffset), SEEK_SET);
+                STATS_ADD(STATS_SYSCALLS, 1);
 
-                compressedBlk = (uint8_t*)malloc(be64toh(dataBlk->chunk[noOfChunks].CompressedLength));
-                size_t result=fread(compressedBlk, 1, be64toh(dataBlk->chunk[noOfChunks].CompressedLength), stream);
+                if (written <= 0)
+                        return DMG_EWRITE;
 
-                //Only supports zlib compression
-                //To-Do: support other compression types
-                if (be32toh(dataBlk->chunk[noOfChunks].EntryType) == ENTRY_TYPE_ZLIB) {
-                        if (decompress_to_file(compressedBlk, result, filename) < 0) {
-                                printf("Failed to decompress block\n");
-                        }
-                }
+                STATS_ADD(STATS_BYTES_WRITTEN, written);
+                data += written;
+                offset += written;
+                len -= written;
         }
+
+        return 0;
 }
 
-int checkCommandLineArguments(char** argv, int argc)
+// Sectors that no chunk covers read back as zeros and count as such in the checksum
+static void account(dmg_expander* expander, const uint8_t *data, uint64_t len, uint64_t offset)
 {
-        int result = 0, i = 0;
-
-        if (argc < 2 || argc > 6) {
-                printf("Invalid number of arguments!\n");
-                result = 1;
-        } else if (argc == 2) {
-                args.fs_structure = 1;
-                args.volume = 1;
-                args.volume_ID = 1026;
-        } else {
-                switch (argv[2][1]) {
-                        case 'c':
-                        case 'C':
-                                if (argc == 3) {
-                                        args.container = 1;
-                                } else {
-                                        printf("Container Superblock takes no arguments\n");
-                                        result = 1;
-                                }
-                                break;
-                        case 'v':
-                        case 'V':
-                                if (argc == 3) {
-                                        args.volume = 1;
-                                } else {
-                                        args.volume = 1;
-                                        /* Make sure that argument contains nothing but digits */
-                                        if (argv[3]) {
-                                                if(strspn(argv[3], "0123456789") != strlen(argv[3])) {
-                                                        printf("Volume id has to be an interger!\n");
-                                                        result = 1;
-                                                } else {
-                                                        args.volume_ID = atoi(argv[3]);
-                                                }
-                                        }
-                                        if (argv[4]) {
-                                                if ((strcmp(argv[4], "-fs") == 0) || (strcmp(argv[4], "-FS") == 0)) {
-                                                        args.fs_structure = 2;
-                                                } else {
-                                                        printf("Please use \"-fs\" to see the file system structure\n");
-                                                        result = 1;
-                                                }
-                                        }
-                                }
-                                break;
-                        default:
-                                printf("Invalid parameter!\n");
-                                result = 1;
-                }
-        }
+        if (offset > expander->position)
+                expander->crc = crc32Zeros(expander->crc, offset - expander->position);
 
-        for (i = 1; i < argc; ++i)
-                if (strcmp(argv[i], "-d") == 0)
-                        args.debug_mode = 1;
+        expander->crc = data ? crc32Update(expander->crc, data, len) : crc32Zeros(expander->crc, len);
+        expander->position = offset + len;
+}
 
-        return result;
+// Inflates one zlib chunk into the pooled buffer and writes it at its sector offset
+int decompress_to_file(dmg_expander* expander, const uint8_t *compressed, unsigned long comp_size, uint64_t expanded, uint64_t offset)
+{
+        size_t produced = 0;
+        int ret = inflateBackendChunk(expander->inflater, compressed, comp_size, expander->buffer, expanded, &produced);
+
+        account(expander, expander->buffer, produced, offset);
+
+        if (ret < 0)
+                ret = DMG_EINFLATE;
+        if (expander->fd >= 0 && write_at(expander, expander->buffer, produced, offset) < 0)
+                ret = DMG_EWRITE;
+
+        return ret;
 }
 
-void printUsage(char **argv)
+// Writes len bytes at offset; a NULL buffer leaves a hole that reads as zeros
+int copy_to_file(dmg_expander* expander, const uint8_t *data, uint64_t len, uint64_t offset)
 {
-        printf("Usage :\n\n%s <DMG_FILE>     	         	Prints the Disk Image Structure\n \
-                        -c                      Container Superblock Information\n \
-                        -v [ Volume ID ]        All Vol SuperBlock Information | Specified Volume's Information \n \
-                        -f <file_name>          Displays file content\n \
-                        -v <Volume_ID> -fs      Displays File system Structure\n \
-                        -d			Debug Mode\n", argv[0]);	
+        account(expander, data, len, offset);
+
+        if (data == NULL || expander->fd < 0)
+                return 0;
+
+        return write_at(expander, data, len, offset);
 }
 
-int main(int argc, char** argv)
+/*
+   Input Parameters: dmg_partition*, dmg_image*, char*
+   Return Type:      int
+Description: Expands every chunk of the partition into the given file, each at
+its own sector offset. zlib chunks are inflated and raw chunks copied straight
+from the mapping. Zero and free chunks are left as holes, and the file is
+sized to the partition at the end. The stored range is advised as sequential
+and the next READAHEAD_LEN bytes are prefetched as the chunks are consumed.
+The CRC-32 of the expanded data is computed as it is written and checked
+against the partition's checksum when the blkx table carries one. A NULL
+filename only computes the checksum. Returns 0 or a DMG_E* code; the CRC
+and the chunks that had to be written as zeros go to *result, which may be
+NULL.
+
+ */
+int readDataBlks(dmg_partition* part, dmg_image* image, char* filename, dmg_expansion* result)
 {
-        FILE* stream = NULL;
-        UDIFResourceFile dmgTrailer;
-        char *plist;
-
-        // check command line arguments 
-        if (checkCommandLineArguments( argv , argc) == 1) {
-                printUsage(argv);
-                return 1;
+        dmg_expander expander;
+        dmg_expansion local;
+        uint64_t first = UINT64_MAX, last = 0, advised = 0;
+        uint64_t size = part->SectorCount * SECTOR_SIZE;
+        int ret, err;
+
+        if (result == NULL)
+                result = &local;
+        memset(result, 0, sizeof(*result));
+
+        if ((ret = openExpander(&expander, part, filename)) < 0)
+                return ret;
+
+        STATS_START(STATS_INFLATE);
+
+        for (uint32_t noOfChunks = 0; noOfChunks < part->NumberOfChunks; noOfChunks++) {
+                dmg_chunk *chunk = &part->Chunks[noOfChunks];
+
+                if (chunk->CompressedLength == 0)
+                        continue;
+                if (chunk->CompressedOffset < first)
+                        first = chunk->CompressedOffset;
+                if (chunk->CompressedOffset + chunk->CompressedLength > last)
+                        last = chunk->CompressedOffset + chunk->CompressedLength;
         }
 
-        stream = readImageFile(stream, argv[1]);
-        parseDMGTrailer(stream, &dmgTrailer);      // reference of dmgTrailer is passed.
-        readXMLOffset(stream,&dmgTrailer,&plist);  //reference of dmgTrailer and plist is passed
-        char* apfsData = parsePlist(plist, stream);  //Parse the pList and find the APFS data block
+        if (first < last)
+                adviseImageRange(image, first, last - first, MADV_SEQUENTIAL);
 
-        if (apfsData != NULL)
+        for (uint32_t noOfChunks = 0; noOfChunks < part->NumberOfChunks; noOfChunks++)
         {
-                char *filename = "APFS Image Decompressed";
+                dmg_chunk *chunk = &part->Chunks[noOfChunks];
+                uint64_t expanded = (uint64_t)chunk->SectorCount * SECTOR_SIZE;
+                uint64_t offset = chunk->SectorNumber * SECTOR_SIZE;
+                const uint8_t* compressedBlk = NULL;
 
-                dprintf("\nDecompressing DMG file...\n\n");
+                if (offset + expanded > size)
+                        size = offset + expanded;
 
-                //Decompress the APFS data blocks
-                BLKXTable* dataBlk = NULL;
-                dataBlk = decodeDataBlk(apfsData);   // decode the data block.
-                readDataBlks(dataBlk, stream, filename);    // loop through the chunks to decompress each.
+                STATS_ADD(STATS_CHUNKS, 1);
 
-                //Parse the APFS image
-                parse_APFS(filename);
-        }
-        else
-        {
-                printf("Failed to parse the DMG pList\n");
+                if (chunk->EntryType == ENTRY_TYPE_ZERO || chunk->EntryType == ENTRY_TYPE_IGNORE) {
+                        copy_to_file(&expander, NULL, expanded, offset);
+                        continue;
+                }
+
+                //To-Do: support other compression types
+                if (chunk->EntryType == ENTRY_TYPE_ZLIB || chunk->EntryType == ENTRY_TYPE_RAW)
+                        compressedBlk = imageRange(image, chunk->CompressedOffset, chunk->CompressedLength);
+
+                if (compressedBlk == NULL) {
+                        result->zeroed++;
+                        copy_to_file(&expander, NULL, expanded, offset);
+                        continue;
+                }
+
+                STATS_ADD(STATS_BYTES_READ, chunk->CompressedLength);
+
+                // Keep the prefetch window ahead of the chunk being inflated
+                if (chunk->CompressedOffset + chunk->CompressedLength > advised) {
+                        adviseImageRange(image, chunk->CompressedOffset, READAHEAD_LEN, MADV_WILLNEED);
+                        advised = chunk->CompressedOffset + READAHEAD_LEN;
+                }
+
+                if (chunk->EntryType == ENTRY_TYPE_ZLIB) {
+                        if ((err = decompress_to_file(&expander, compressedBlk, chunk->CompressedLength, expanded, offset)) < 0 && ret == 0)
+                                ret = err;
+                } else if ((err = copy_to_file(&expander, compressedBlk, chunk->CompressedLength, offset)) < 0 && ret == 0) {
+                        ret = err;
+                }
         }
 
-        free(apfsData);
-        free(plist);
+        // Trailing holes still belong to the partition
+        if (size > expander.position)
+                account(&expander, NULL, size - expander.position, expander.position);
 
-        printf("\n");
+        if (expander.fd >= 0 && ftruncate(expander.fd, size) < 0 && ret == 0)
+                ret = DMG_EWRITE;
+        STATS_ADD(STATS_SYSCALLS, expander.fd >= 0);
 
-        return 0;
+        if ((err = closeExpander(&expander)) < 0 && ret == 0)
+                ret = err;
+
+        STATS_STOP(STATS_INFLATE);
+
+        result->crc = expander.crc;
+        if (ret == 0 && be32toh(part->Checksum.ChecksumType) == UDIF_CHECKSUM_CRC32 &&
+            expander.crc != be32toh(part->Checksum.Checksum[0]))
+                ret = DMG_ECHECKSUM;
+
+        return ret;
+}
+
+static void* forkCheckThread(void *arg)
+{
+        dmg_fork_check *check = (dmg_fork_check*)arg;
+
+        check->crc = crc32Update(0, check->fork, check->length);
+        return NULL;
+}
+
+/*
+   Input Parameters: dmg_fork_check*, dmg_image*, UDIFResourceFile*
+   Return Type:      void
+Description: Starts the CRC-32 of the data fork on a thread of its own, so it
+is read alongside the partition being expanded instead of in a pass of its
+own. Nothing is started when the koly trailer carries no CRC-32 or the fork
+lies outside of the file; a thread that cannot be created leaves the sum to
+finishForkCheck.
+
+ */
+void startForkCheck(dmg_fork_check* check, dmg_image* image, UDIFResourceFile* dmgTrailer)
+{
+        uint64_t offset = be64toh(dmgTrailer->DataForkOffset);
+
+        memset(check, 0, sizeof(*check));
+        check->length = be64toh(dmgTrailer->DataForkLength);
+        check->fork = imageRange(image, offset, check->length);
+        check->type = be32toh(dmgTrailer->DataChecksumType);
+        check->expected = be32toh(dmgTrailer->DataChecksum[0]);
+
+        if (check->fork == NULL || check->type != UDIF_CHECKSUM_CRC32)
+                return;
+
+        adviseImageRange(image, offset, check->length, MADV_SEQUENTIAL);
+        check->threaded = pthread_create(&check->thread, NULL, forkCheckThread, check) == 0;
+}
+
+// Waits for the data fork's CRC-32; 0 when it matches or is not a CRC-32, else DMG_EFORK or DMG_ECHECKSUM
+int finishForkCheck(dmg_fork_check* check)
+{
+        if (check->fork == NULL)
+                return DMG_EFORK;
+        if (check->type != UDIF_CHECKSUM_CRC32)
+                return 0;
+
+        if (check->threaded)
+                pthread_join(check->thread, NULL);
+        else
+                forkCheckThread(check);
+        check->threaded = 0;
+
+        return check->crc == check->expected ? 0 : DMG_ECHECKSUM;
 }
@@ -1,62 +1,34 @@
 
+#define _GNU_SOURCE
 #include <time.h>
+#include <errno.h>
+#include <limits.h>
 #include <endian.h>
 #include <sys/stat.h>
 #include <string.h>
 #include <unistd.h>
+#include <fcntl.h>
+#include <sys/xattr.h>
+#include <sys/ioctl.h>
+#include <linux/fs.h>
 #include "apfs.h"
+#include "stats.h"
+#include "libapfsspy.h"
 
-/* Path to store files in DMG
-TODO: add this to input struct */
-char path[1024];
-
-/* TODO: make dynamic map */
-
-struct parent_directory {
-        int list[1024];
-        int idx;
-        int level;
-} parents;
-
-int parse_blk_header(FILE *apfs)
-{
-        APFS_BH block_header = {0};
-        unsigned int size = 0;
-
-        if ((size = fread(&block_header, 1, sizeof(block_header), apfs)) < 0) {
-                printf("Error reading from APFS File! [%d] size = %lu\n", size, sizeof(block_header));
-                return -1;
-        }
-        return 0;
-}
-
-/*
-   Input Parameters: FILE* 
-   Return Type:      btree_node_phys_t
-Description: Function reads the bTree Node.
- */
-btree_node_phys_t readAndPrintBtree(FILE* apfs)
-{
-        btree_node_phys_t btree;
-        unsigned int sizeofTree = 0;
-        if ((sizeofTree = fread(&btree, 1, sizeof(btree), apfs)) < 0) {
-                printf("Error reading from apfs File! [%d] size = %lu\n", sizeofTree, sizeof(btree));
-                return btree;
-        }
-        return btree;
-}
+#define FS_COPY_BLOCKS          256     // Blocks copyExtent reads at a time
+#define CHECKPOINT_LIST_MAX     64      // Older container superblocks -c lists
 
 /*
-   Input Parameters: APFS_BH, uint32_t 
+   Input Parameters: APFS_BH, uint64_t 
    Return Type:      void
 Description: Function prints the Header of container superblock,
 Called to print the older versions of container superblock.
 
  */
-void printContainerHeader(APFS_BH block_header,uint32_t containerAddress)
+void printContainerHeader(APFS_BH block_header,uint64_t containerAddress)
 {
         printf("\n");
-        printf("Container SuperBlock 	Address: %x		\n",containerAddress);
+        printf("Container SuperBlock 	Address: %lx		\n",containerAddress);
         printf("Checksum           			%lu\n",  block_header.checksum);
         printf("Block ID            			%lu\n",  block_header.block_id);
         printf("Version/TransactionID			%lu\n",  block_header.version);
@@ -90,17 +62,17 @@ void print_blk_header(obj_phys_t obj)
 }
 
 /*
-   Input Parameters: apfs_superblock_t, uint32_t , uint32_t 
+   Input Parameters: apfs_superblock_t, uint64_t , uint32_t 
    Return Type:      void
 Description: Function prints the structure of volume superblock,
 starting address and size.
 
  */
-void printVolumeSuperBlock(apfs_superblock_t volumeSuperBlock, uint32_t volumeSuperBlkAddress, uint32_t sizeOfVolBlk)
+void printVolumeSuperBlock(apfs_superblock_t volumeSuperBlock, uint64_t volumeSuperBlkAddress, uint32_t sizeOfVolBlk)
 {
 
         printf("\n");
-        printf("Volume SuperBlock 	Address: %x		Size: %d\n",volumeSuperBlkAddress,sizeOfVolBlk);
+        printf("Volume SuperBlock 	Address: %lx		Size: %d\n",volumeSuperBlkAddress,sizeOfVolBlk);
         print_blk_header(volumeSuperBlock.apfs_o);
         printf("Magic Number        			%s\n", (char*) &volumeSuperBlock.apfs_magic);
         printf("FS INdex            			%u\n", volumeSuperBlock.apfs_fs_index);
@@ -144,16 +116,16 @@ void printVolumeSuperBlock(apfs_superblock_t volumeSuperBlock, uint32_t volumeSu
 }
 
 /*
-   Input Parameters: APFS_SuperBlk, uint32_t , uint32_t 
+   Input Parameters: APFS_SuperBlk, uint64_t , uint32_t, APFS_BH 
    Return Type:      void
 Description: Function prints the structure of container superblock,
 starting address and size.
 
  */
-void printContainerSuperBlock(APFS_SuperBlk containerSuperBlk, uint32_t containerAddress, uint32_t sizeOfContainer,APFS_BH block_header)
+void printContainerSuperBlock(APFS_SuperBlk containerSuperBlk, uint64_t containerAddress, uint32_t sizeOfContainer,APFS_BH block_header)
 {
         printf("\n");
-        printf("Latest Container SuperBlock 	Address: %x		Size: %d\n",containerAddress,sizeOfContainer);
+        printf("Latest Container SuperBlock 	Address: %lx		Size: %d\n",containerAddress,sizeOfContainer);
         printf(" ##### BLOCK Header #####\n");
         printf("Checksum           			%lu\n",  block_header.checksum);
         printf("Block ID            			%lu\n",  block_header.block_id);
@@ -202,898 +174,818 @@ void printContainerSuperBlock(APFS_SuperBlk containerSuperBlk, uint32_t containe
         printf("MappingTreeIdent      			%lu\n", containerSuperBlk.MappingTreeIdent);
         printf("OtherFlags          			%lu\n", containerSuperBlk.OtherFlags);
         printf("JumpstartEFI        			%lu\n", containerSuperBlk.JumpstartEFI);
-        printf("FusionUuid             			%u\n", containerSuperBlk.FusionUuid);
+        printf("FusionUuid             			");
+        for (int i = 0; i < 16; ++i) {
+                printf("%0x", containerSuperBlk.FusionUuid[i]);
+        }
+        printf("\n");
+
+}
+
+// Prints where the checkpoint stored one of the container's ephemeral objects
+static void printEphemeralObject(apfs_ctx *ctx, const char *name, uint64_t oid)
+{
+        uint64_t paddr;
+        uint32_t size;
 
+        if (apfs_ephemeral_find(ctx, oid, &paddr, &size) < 0)
+                printf("%-20s			%lu (not in the checkpoint map)\n", name, oid);
+        else
+                printf("%-20s			%lu at block %lu, %u bytes\n", name, oid, paddr, size);
 }
 
 /*
-   Input Parameters: FILE*, argv 
-   Return Type:      APFS_SuperBlk
-Description: Function finds the latest container superblock.
-It loops through the checkpoint array in reverse, since the array is sorted,
-the latest superblock's detail is found in the beginning of the loop.
-Loop continues to fetch the older versions of container superblock.
+   Input Parameters: apfs_ctx*
+   Return Type:      int
+Description: Prints the container superblock of the checkpoint the context
+uses, with the ephemeral objects its checkpoint maps hold. The headers of
+the older valid superblocks of the descriptor area are listed before it,
+newest first.
 
  */
-APFS_SuperBlk findValidSuperBlock(FILE *apfs)
+int printContainer(apfs_ctx *ctx)
 {
+        apfs_container_info info;
+        uint64_t xids[CHECKPOINT_LIST_MAX], paddr;
         APFS_SuperBlk containerSuperBlk;
-        APFS_BH block_header_chkMap = {0};
-        APFS_SuperBlk validContainerSuperBlk;
-        APFS_BH valid_block_header_chkMap = {0};
-        uint32_t containerSize=0,recentValidSuperblock =0,validSuperBlockAddress =0;
+        APFS_BH block_header;
+        uint8_t *block;
+        int count, ret;
+
+        apfs_container_info_get(ctx, &info);
+        if ((block = malloc(info.block_size)) == NULL)
+                return APFS_ENOMEM;
+
+        count = apfs_checkpoint_list(ctx, xids, CHECKPOINT_LIST_MAX);
+        for (int i = (count < CHECKPOINT_LIST_MAX ? count : CHECKPOINT_LIST_MAX) - 1; i >= 0; --i) {
+                if (xids[i] == info.xid || apfs_checkpoint_superblock(ctx, xids[i], &paddr) < 0 ||
+                    apfs_block_read(ctx, paddr, 1, block) < 0)
+                        continue;
+                memcpy(&block_header, block, sizeof(block_header));
+                printContainerHeader(block_header, paddr * info.block_size);
+        }
 
-        int size=fread(&containerSuperBlk,1,sizeof(containerSuperBlk),apfs);
-        // Descriptor base addresss is virtual.
-        uint64_t checkpointMappingArray= containerSuperBlk.DescriptorBase* containerSuperBlk.BlockSize;
-        fseek(apfs,checkpointMappingArray,SEEK_SET);  // Checkpoint Mapping Array
+        if ((ret = apfs_block_read(ctx, info.superblock, 1, block)) == 0) {
+                memcpy(&block_header, block, sizeof(block_header));
+                memcpy(&containerSuperBlk, block + sizeof(block_header), sizeof(containerSuperBlk));
+                printContainerSuperBlock(containerSuperBlk, info.superblock * info.block_size,
+                                         sizeof(containerSuperBlk), block_header);
+
+                printf(" ##### Ephemeral objects: %u #####\n", info.ephemeral_count);
+                if (containerSuperBlk.SpaceManagerIdent)
+                        printEphemeralObject(ctx, "SpaceManager", containerSuperBlk.SpaceManagerIdent);
+                if (containerSuperBlk.ReaperIdent)
+                        printEphemeralObject(ctx, "Reaper", containerSuperBlk.ReaperIdent);
+        }
 
-        //Now fread the checkpoint mapping array. It i a super block array of size 4096 bytes.
-        //Need to read the header to get checksum and xid.
+        free(block);
+        return ret;
+}
 
-        for(int checkpointMappingItr = (containerSuperBlk.DescriptorBlocks) - 1;checkpointMappingItr >= 0;checkpointMappingItr--)
-        {
-                fseek(apfs,checkpointMappingItr*containerSuperBlk.BlockSize,SEEK_CUR);
+// Reads the superblock of volume index and prints it; 0 or a negative APFS_E* code
+static int printVolume(apfs_ctx *ctx, uint32_t index, uint32_t blockSize, uint8_t *block)
+{
+        apfs_volume_info info;
+        apfs_superblock_t volumeSuperBlock;
+        int ret;
 
+        if ((ret = apfs_volume_info_get(ctx, index, &info)) < 0 ||
+            (ret = apfs_block_read(ctx, info.superblock, 1, block)) < 0)
+                return ret;
 
-                if ((size = fread(&block_header_chkMap, 1, sizeof(block_header_chkMap), apfs)) < 0) 
-                {
-                        printf("Error reading block_header_chkMap! size = %lu\n",sizeof(block_header_chkMap));
-                        return containerSuperBlk;
-                }
+        memcpy(&volumeSuperBlock, block, sizeof(volumeSuperBlock));
+        printVolumeSuperBlock(volumeSuperBlock, info.superblock * blockSize, sizeof(volumeSuperBlock));
+        return 0;
+}
 
-                if(block_header_chkMap.block_type == 1)
-                {
-                        if(block_header_chkMap.version > recentValidSuperblock)
-                        {
-                                recentValidSuperblock=block_header_chkMap.version;
-                                //Now check for checksum;
+/*
+   Input Parameters: apfs_ctx*, uint64_t oid, uint32_t* index
+   Return Type:      int
+Description: Prints the volume superblock with identifier oid and stores its
+position in the container's volume array in index; with oid 0 every volume
+superblock is printed. Returns APFS_ENOENT when there is no such volume.
 
-                                validSuperBlockAddress = ftell(apfs) - 32;
-                                valid_block_header_chkMap = block_header_chkMap;
-                                containerSize=fread(&validContainerSuperBlk,1,sizeof(validContainerSuperBlk),apfs);
-                        }
-                        else{
-                                if(args.container == 1)
-                                        printContainerHeader(block_header_chkMap,ftell(apfs) - 32);
-                        }
+ */
+int printVolumeSuperBlocks(apfs_ctx *ctx, uint64_t oid, uint32_t *index)
+{
+        apfs_container_info container;
+        apfs_volume_info info;
+        uint8_t *block;
+        int ret = 0;
+
+        apfs_container_info_get(ctx, &container);
+        if ((block = malloc(container.block_size)) == NULL)
+                return APFS_ENOMEM;
+
+        for (*index = 0; *index < container.volume_count; ++*index) {
+                if (oid == 0) {
+                        if ((ret = printVolume(ctx, *index, container.block_size, block)) < 0)
+                                printf("Volume %u is unreadable: %s\n", *index, apfs_strerror(ret));
+                        continue;
                 }
-                else
-                {
-                        fseek(apfs,checkpointMappingArray,SEEK_SET);
-
+                if (apfs_volume_info_get(ctx, *index, &info) == 0 && info.oid == oid) {
+                        ret = printVolume(ctx, *index, container.block_size, block);
+                        break;
                 }
         }
-        if(args.container == 1)
-                printContainerSuperBlock(containerSuperBlk,validSuperBlockAddress,containerSize,valid_block_header_chkMap);
-        return validContainerSuperBlk;
+
+        if (oid != 0 && *index == container.volume_count) {
+                printf(" Volume ID %lu does not exist!!", oid);
+                ret = APFS_ENOENT;
+        }
+
+        free(block);
+        return oid == 0 ? 0 : ret;
 }
 
 /*
-   Input Parameters: FILE ,APFS_SuperBlk , int
-   Return Type:      omap_phys_t
-Description: Function takes the container superblock and omap id as the parameter,
-and seeks to the omap structure's address, reads the structure and returns it, 
-to be used by findValidVolumeSuperBlock
-
+ * Open addressing tables of the FS-Tree walk. Every slot starts with its
+ * uint64_t key, 0 for an empty slot, and the tables grow to keep at most
+ * half of the slots used.
  */
-omap_phys_t parseValidContainerSuperBlock(FILE *apfs,APFS_SuperBlk containerSuperBlk, int ObjectsMapIdent )
-{	
-        omap_phys_t omapStructure;
-        //fseek to the omap address.
-        fseek(apfs,ObjectsMapIdent * containerSuperBlk.BlockSize,SEEK_SET);
-        unsigned int sizeofOmapStructure = 0;
-        if ((sizeofOmapStructure = fread(&omapStructure, 1, sizeof(omapStructure), apfs)) < 0) {
-                printf("Error reading from apfs File! [%d] size = %lu\n", sizeofOmapStructure, sizeof(omapStructure));
-                return omapStructure;
-        }
-        return omapStructure;
+struct fs_table {
+        void *slots;
+        size_t slotSize;
+        uint32_t capacity;              // Power of two, at least twice count
+        uint32_t count;
+};
+
+static inline uint64_t* tableKey(const struct fs_table *table, uint32_t slot)
+{
+        return (uint64_t*)((uint8_t*)table->slots + (size_t)slot * table->slotSize);
 }
 
-void seekNprint(uint64_t blk_num, uint64_t len, FILE *apfs, char *filename)
+static uint32_t tableSlot(uint32_t capacity, uint64_t key)
 {
-        FILE *op = NULL;
-        uint64_t readb = 0;
-        char buff[BLK_SIZE] = {0};
-        int i = 0, read_size = (BLK_SIZE < len ) ? BLK_SIZE : len;
+        return ((key * 0xff51afd7ed558ccdULL) >> 32) & (capacity - 1);
+}
 
-        if (args.fs_structure != 2) {
-                dprintf("FS Options = %d, Skipping file creation\n", args.fs_structure);
-                return;
-        }
+static void* tableFind(const struct fs_table *table, uint64_t key)
+{
+        uint32_t slot;
 
-        if ((op = fopen(filename, "a")) == NULL) {
-                dprintf("Unable to open %s\n", filename);
-                return;
-        }
+        if (table->count == 0)
+                return NULL;
 
-        if (fseek(apfs, blk_num * BLK_SIZE, SEEK_SET)) {
-                printf("Error Seeking to Extend Block!\n");
-                goto end;
-        }
+        for (slot = tableSlot(table->capacity, key); *tableKey(table, slot);
+             slot = (slot + 1) & (table->capacity - 1))
+                if (*tableKey(table, slot) == key)
+                        return tableKey(table, slot);
+        return NULL;
+}
 
-        do {
-                if (((readb += fread(buff, 1, read_size, apfs)) > 0)) {
-                        if (fwrite(buff, 1, read_size, op) == 0) {
-                                printf("Error writing to file!\n");
-                                break;
-                        }
-                        /* Read remaining if less than BLK SIZE */
-                        read_size = (BLK_SIZE < (len - readb)) ? BLK_SIZE : (len - readb);
-                } else {
-                        printf("Error reading from Extend! Readb = %lu\n", readb);
+/*
+   Input Parameters: struct fs_table*, uint64_t key
+   Return Type:      void*
+Description: Returns the slot of key, a new zeroed one holding only the key
+when it was not in the table yet. Returns NULL when out of memory.
+
+ */
+static void* tableAdd(struct fs_table *table, uint64_t key)
+{
+        uint64_t *found = tableFind(table, key);
+        uint32_t slot;
+
+        if (found != NULL)
+                return found;
+
+        if ((table->count + 1) * 2 > table->capacity) {
+                struct fs_table grown = *table;
+
+                grown.capacity = table->capacity ? table->capacity * 2 : 64;
+                if ((grown.slots = calloc(grown.capacity, table->slotSize)) == NULL)
+                        return NULL;
+
+                for (uint32_t i = 0; i < table->capacity; ++i) {
+                        if (*tableKey(table, i) == 0)
+                                continue;
+                        for (slot = tableSlot(grown.capacity, *tableKey(table, i)); *tableKey(&grown, slot);
+                             slot = (slot + 1) & (grown.capacity - 1))
+                                ;
+                        memcpy(tableKey(&grown, slot), tableKey(table, i), table->slotSize);
                 }
-        } while (readb < len);
+                free(table->slots);
+                *table = grown;
+        }
 
-        dprintf("Added %lu Bytes to %s\n", readb, filename);
-end:
-        fclose(op);
-        return;
+        for (slot = tableSlot(table->capacity, key); *tableKey(table, slot);
+             slot = (slot + 1) & (table->capacity - 1))
+                ;
+        *tableKey(table, slot) = key;
+        table->count++;
+        return tableKey(table, slot);
 }
 
-int is_parent(int id)
+static void tableFree(struct fs_table *table)
 {
-        int i = 0;
+        free(table->slots);
+        table->slots = NULL;
+        table->capacity = table->count = 0;
+}
 
-        for (; i < parents.idx; ++i)
-                if (parents.list[i] == id)
-                        return 1;
+/* Directories met by the FS-Tree walk, by inode number */
+typedef struct {
+        uint64_t ino;
+        int depth;                      // 0 for the root
+        char *path;                     // Where it is extracted to
+} fs_directory;
+
+/* Files extracted with hard links or clones, by inode number */
+typedef struct {
+        uint64_t ino;
+        char *path;
+} fs_extracted;
+
+/* Extents of cloned files already written, by physical block */
+typedef struct {
+        uint64_t paddr;
+        uint64_t ino;                   // The file holding it, in extractedFiles
+        uint64_t logical;
+        uint64_t length;                // Bytes written, cut to the file's size
+} fs_written_extent;
+
+/* One listing (and with -fs extraction) of a volume, handed to every apfs_walk callback */
+typedef struct {
+        apfs_ctx *ctx;
+        apfs_volume *volume;
+        int extract;
+        uint32_t blockSize;
+        uint8_t *buffer;                // FS_COPY_BLOCKS blocks for copyExtent
+        struct fs_table directories;
+        struct fs_table extractedFiles;
+        struct fs_table writtenExtents;
+} fs_walk;
+
+static void walkFree(fs_walk *walk)
+{
+        for (uint32_t i = 0; i < walk->directories.capacity; ++i)
+                free(((fs_directory*)walk->directories.slots)[i].path);
+        tableFree(&walk->directories);
+
+        for (uint32_t i = 0; i < walk->extractedFiles.capacity; ++i)
+                free(((fs_extracted*)walk->extractedFiles.slots)[i].path);
+        tableFree(&walk->extractedFiles);
+        tableFree(&walk->writtenExtents);
+        free(walk->buffer);
+}
+
+// Returns dir/name in a string of its own, to be freed; NULL when out of memory
+static char* joinPath(const char *dir, const char *name)
+{
+        size_t len = strlen(dir) + 1 + strlen(name) + 1;
+        char *path = malloc(len);
+
+        if (path != NULL)
+                snprintf(path, len, "%s/%s", dir, name);
+        return path;
+}
+
+static fs_directory* findDirectory(fs_walk *walk, uint64_t ino)
+{
+        return tableFind(&walk->directories, ino);
+}
+
+// Remembers a directory and the path it is extracted to; -1 when out of memory
+static int addDirectory(fs_walk *walk, uint64_t ino, int depth, const char *dirPath)
+{
+        fs_directory *dir = tableAdd(&walk->directories, ino);
+
+        if (dir == NULL)
+                return -1;
+        if (dir->path != NULL)
+                return 0;
+        if ((dir->path = strdup(dirPath)) == NULL)
+                return -1;
+        dir->depth = depth;
         return 0;
 }
 
-void handle_drec(char *dirName, j_drec_val_t dir)
+/* Copies len bytes from block paddr of the container to op, at logical offset logical */
+static void copyExtent(fs_walk *walk, uint64_t paddr, uint64_t logical, uint64_t len, FILE *op)
 {
-        /* Skip Private Directory */
-        if (dir.file_id == PRIV_DIR_INO_NUM) {
-                return;
+        uint64_t copied = 0;
+        int ret;
+
+        STATS_START(STATS_EXTENT_COPY);
+
+        if (fseek(op, logical, SEEK_SET)) {
+                printf("Error Seeking to Extend Block!\n");
+                goto end;
         }
 
-        if ((dir.flags & DREC_TYPE_MASK) == DT_DIR) {
-                if (dir.file_id == ROOT_DIR_INO_NUM) {
-                        dirName = path;
-                }
+        while (copied < len) {
+                uint64_t blocks = (len - copied + walk->blockSize - 1) / walk->blockSize;
+                size_t n;
 
-                if (args.fs_structure == 2) {
-                        if (mkdir(dirName, S_IRWXU) == -1) {
-                                printf("Directory %s is already present!\n", dirName);
-                                exit(0);
-                        }
+                if (blocks > FS_COPY_BLOCKS)
+                        blocks = FS_COPY_BLOCKS;
+                n = len - copied < blocks * walk->blockSize ? len - copied : blocks * walk->blockSize;
+
+                if ((ret = apfs_block_read(walk->ctx, paddr + copied / walk->blockSize, blocks, walk->buffer)) < 0) {
+                        printf("Error reading from Extend! Readb = %lu: %s\n", copied, apfs_strerror(ret));
+                        break;
+                }
+                if (fwrite(walk->buffer, 1, n, op) != n) {
+                        printf("Error writing to file!\n");
+                        break;
                 }
+                copied += n;
+        }
 
-                parents.list[parents.idx++] = dir.file_id;
+        dprintf("Added %lu Bytes at %lu\n", copied, logical);
+end:
+        STATS_STOP(STATS_EXTENT_COPY);
+}
 
-                if (dir.file_id != ROOT_DIR_INO_NUM)
-                        printf(ANSI_COLOR_CYAN "%s/\t" ANSI_COLOR_RESET, ToUp(dirName));
-        } else {
+/*
+ * Extended attributes of extracted files. Linux only takes unprivileged
+ * attributes in the "user." namespace, so an attribute is set there; when
+ * the file system refuses it, or with --xattr-sidecar, its value is written
+ * to <path>.xattrs/<name> instead.
+ */
+static FILE* xattrSidecar(const char *path, const char *name)
+{
+        size_t len = strlen(path) + strlen(".xattrs");
+        char *sidecar;
+        FILE *op;
+
+        if (strcmp(name, ".") == 0 || strcmp(name, "..") == 0)
+                name = "_";
+        if ((sidecar = malloc(len + 1 + strlen(name) + 1)) == NULL) {
+                printf("Out of memory writing extended attribute %s of %s\n", name, path);
+                return NULL;
+        }
 
-                printf(ANSI_COLOR_CYAN "%s\t" ANSI_COLOR_RESET, dirName);
+        sprintf(sidecar, "%s.xattrs", path);
+        if (mkdir(sidecar, S_IRWXU) == -1 && errno != EEXIST) {
+                free(sidecar);
+                return NULL;
         }
-}
 
-void parseFSObjects(uint8_t fileObjectType,FILE* apfs,uint16_t keyLength,int valueStartAddressforfstree
-                , uint16_t valueOffset, uint16_t valueLength, struct fs_obj *obj)
-{       
-        char *filename = NULL;
-        uint64_t file_size = 0;
-        int i = 0;
+        sprintf(sidecar + len, "/%s", name);
+        for (char *c = sidecar + len + 1; *c; ++c)
+                if (*c == '/')
+                        *c = '_';
 
-        if(APFS_TYPE_ANY == fileObjectType)
-        {
-                //("The objtype is APFS_TYPE_ANY\n");
-        }else if(APFS_TYPE_SNAP_METADATA == fileObjectType){
-                //("The objtype is APFS_TYPE_SNAP_METADATA\n");
-        }else if(APFS_TYPE_EXTENT ==fileObjectType){
-                //("The objtype is APFS_TYPE_EXTENT\n");
-        }else if(APFS_TYPE_INODE ==fileObjectType){
-                //("The objtype is APFS_TYPE_INODE\n");
-                j_inode_val_t inode = {0};
-                xf_blob_t blob = {0};
-                if (fseek(apfs, valueStartAddressforfstree - valueOffset, SEEK_SET)) {
-                        printf("Failed to seek to INDOE val!\n");
-                        return;
-                }
+        if ((op = statsFopen(sidecar, "w")) == NULL)
+                printf("Unable to open %s\n", sidecar);
+        free(sidecar);
+        return op;
+}
+
+// Sets an attribute on fd, or on path when fd is -1, falling back to a sidecar file
+static void xattrWrite(int fd, const char *path, const char *name, const uint8_t *data, size_t len)
+{
+        char attr[16 + 256];
+        FILE *op;
 
-                if (fread(&inode, 1, sizeof(inode), apfs) < 0) {
-                        printf("Error reading INODE!\n");
+        if (!args.xattr_sidecar) {
+                snprintf(attr, sizeof(attr), "user.%s", name);
+                if ((fd == -1 ? setxattr(path, attr, data, len, 0) : fsetxattr(fd, attr, data, len, 0)) == 0)
                         return;
-                }
+                dprintf("Unable to set %s on %s, writing it beside\n", attr, path);
+        }
 
-                if ((obj->prev_oid != inode.private_id) && (inode.parent_id != obj->prev_parent)) {
-                        if (parents.level > 1) {
-                                parents.level--;
-                                if (args.fs_structure == 2) {
-                                        if (chdir("./..") == -1) {
-                                                printf("Error changing to parent directory\n");
-                                                return;
-                                        }
-                                }
-                                printf("\n");
-                        }
-                }
+        if ((op = xattrSidecar(path, name)) == NULL)
+                return;
+        if (fwrite(data, 1, len, op) != len)
+                printf("Error writing extended attribute %s of %s\n", name, path);
+        fclose(op);
+}
 
-                dprintf(" Private ID: %lu\n", inode.private_id);
-                dprintf(" Create time: %lu\n", inode.create_time);
-                dprintf(" MOD Time: %lu\n", inode.mod_time);
-                dprintf(" Change Time: %lu\n", inode.change_time);
-                dprintf(" Access Time: %lu\n", inode.access_time);
-                dprintf(" Internal Flags: %0x\n", inode.internal_flags);
-                dprintf(" Number of Children/links: %d\n", inode.nchildren);
-                dprintf(" Default Protection Class: %0x\n", inode.default_protection_class);
-                dprintf(" BSD Flags: %0x\n", inode.bsd_flags);
-                dprintf(" Owner: %u\n", inode.owner);
-                dprintf(" Group: %u\n", inode.group);
-                dprintf(" Mode: %u\n", inode.mode);
-                dprintf(" Uncompressed size: %lu\n", inode.uncompressed_size);
-
-                if (fread(&blob, 1, sizeof(blob), apfs) < 0) {
-                        printf("Error reading INODE XF BLOBS!\n");
-                        return;
-                }
+/*
+   Input Parameters: fs_walk*, uint64_t ino, apfs_xattr*, int fd, char* path
+   Return Type:      void
+Description: Writes the value of an extended attribute kept in a data
+stream. Values up to XATTR_SIZE_MAX are read into memory and set on the
+file; larger ones go straight to a sidecar file, read with apfs_pread.
 
-                dprintf("Num Extends %u\n", blob.xf_num_exts);
-                dprintf("Used Data %u\n", blob.xf_used_data);
+ */
+static void extractXattrStream(fs_walk *walk, uint64_t ino, const apfs_xattr *xattr, int fd, const char *path)
+{
+        uint64_t offset = 0;
+        apfs_file *file;
+        int64_t got;
+        FILE *op;
 
-                x_field_t *xfields = calloc (sizeof(x_field_t),  blob.xf_num_exts);
+        if (xattr->size <= XATTR_SIZE_MAX && !args.xattr_sidecar) {
+                uint8_t *value = calloc(1, xattr->size ? xattr->size : 1);
 
-                if (fread(xfields, sizeof(x_field_t), blob.xf_num_exts, apfs) < 0) {
-                        printf("Error reading INODE X FIELDS!\n");
+                if (value == NULL) {
+                        printf("Out of memory reading extended attribute %s of %s\n", xattr->name, path);
                         return;
                 }
+                if ((got = apfs_getxattr(walk->volume, ino, xattr->name, value, xattr->size)) < 0)
+                        printf("Error reading extended attribute %s of %s: %s\n", xattr->name, path,
+                               apfs_strerror((int)got));
+                else
+                        xattrWrite(fd, path, xattr->name, value, xattr->size);
+                free(value);
+                return;
+        }
 
-                for (i = 0; i < blob.xf_num_exts; ++i) {
-                        dprintf("[%d] Type %u\n", i, xfields[i].x_type);
-                        dprintf("[%d] TFlags %0x\n", i, xfields[i].x_flags);
-                        dprintf("[%d] TSize %u\n", i, xfields[i].x_size);
-
-                        if (INO_EXT_TYPE_NAME == xfields[i].x_type) {
-                                filename = malloc (xfields[i].x_size);
-                                if (fread(filename, 1, xfields[i].x_size, apfs) < 0) {
-                                        printf("Error Reading File name from INODE!\n");
-                                } else {
-                                        if (is_parent(inode.private_id)) {
-                                                if (inode.private_id == ROOT_DIR_INO_NUM) {
-                                                        free(filename);
-                                                        filename = path;
-                                                }
-
-                                                if (args.fs_structure == 2) {
-                                                        if (chdir(filename) == -1) {
-                                                                printf("Error changing to %s directory\n", filename);
-                                                                return;
-                                                        }
-                                                }
-
-                                                printf("%*s" ANSI_COLOR_RESET, parents.level * 8, "");
-                                                printf(ANSI_COLOR_RED "\n%*s:\n", ++parents.level * 8, ToUp(filename));
-                                                printf("%*s" ANSI_COLOR_RESET, parents.level * 8, "");
-                                                obj->prev_parent = inode.private_id;
-                                        }
-
-                                }
-
-                                obj->filename = filename;
-                                dprintf("Filename - %s\n", filename);
-
-                        } else if (INO_EXT_TYPE_DSTREAM == xfields[i].x_type) {
-                                j_dstream_t dstream = {0};
-
-                                if (fread(&dstream, sizeof(j_dstream_t), 1, apfs) < 0) {
-                                        printf("Error reading dstream from INODE!\n");
-                                } else {
-                                        dprintf("DATA STREAM:\n");
-                                        file_size = le64toh(dstream.size);
-                                        dprintf("Size %lu %lu\n", file_size, dstream.size);
-                                        dprintf("Allocated Size %lu\n", dstream.alloced_size);
-                                        dprintf("T Bytes Written %lu\n", dstream.total_bytes_written);
-                                        dprintf("T Bytes Read %lu\n", dstream.total_bytes_read);
-                                }
-                        }
-                }
-                free(xfields);
-        }else if(APFS_TYPE_XATTR ==fileObjectType){
-                j_xattr_key_t fileObjectkey_xattr ={0};
-                //("The objtype is APFS_TYPE_XATTR\n");
-        }else if(APFS_TYPE_SIBLING_LINK ==fileObjectType){
-                //("The objtype is APFS_TYPE_SIBLING_LINK\n");
-        }else if(APFS_TYPE_DSTREAM_ID ==fileObjectType){
-                //("The objtype is APFS_TYPE_DSTREAM_ID\n");
-        }else if(APFS_TYPE_CRYPTO_STATE ==fileObjectType){
-                //("The objtype is APFS_TYPE_CRYPTO_STATE\n");
-        }else if(APFS_TYPE_FILE_EXTENT ==fileObjectType){
-                //("The objtype is APFS_TYPE_FILE_EXTENT\n");
-
-                j_file_extent_val_t extend = {0};
-
-                if (fseek(apfs, valueStartAddressforfstree - valueOffset, SEEK_SET)) {
-                        printf("Failed to seek to INDOE val!\n");
-                        return;
-                }
+        if ((got = apfs_xattr_open(walk->volume, ino, xattr->name, &file)) < 0) {
+                printf("Error reading extended attribute %s of %s: %s\n", xattr->name, path, apfs_strerror((int)got));
+                return;
+        }
+        if ((op = xattrSidecar(path, xattr->name)) == NULL) {
+                apfs_file_close(file);
+                return;
+        }
 
-                if (fread(&extend, 1, sizeof(extend), apfs) < 0) {
-                        printf("Error Reading Extend!\n");
-                        return;
+        STATS_START(STATS_EXTENT_COPY);
+        while ((got = apfs_pread(file, walk->buffer, (uint64_t)FS_COPY_BLOCKS * walk->blockSize, offset)) > 0) {
+                if (fwrite(walk->buffer, 1, got, op) != (size_t)got) {
+                        got = APFS_EIO;
+                        break;
                 }
-
-                dprintf("Length = %lu\n", extend.len_and_flags & J_FILE_EXTENT_LEN_MASK);
-                dprintf("Flags = %lu\n", (extend.len_and_flags & J_FILE_EXTENT_FLAG_MASK) >> J_FILE_EXTENT_FLAG_SHIFT);
-                dprintf("Phy Block Num = %0x\n", extend.phys_block_num);
-                dprintf("Crypto ID = %0x\n", extend.crypto_id);
-                seekNprint(extend.phys_block_num, extend.len_and_flags & J_FILE_EXTENT_LEN_MASK, apfs, obj->filename);
-
-        }else if(APFS_TYPE_DIR_REC ==fileObjectType){
-
-                dprintf("The objtype is APFS_TYPE_DIR_REC %0x\n", ftell(apfs));
-
-                j_drec_hashed_key_t fileObjectkey_dir={0};
-                j_drec_val_t  fileObject_dir_value={0};
-                char dirName[keyLength - 12];
-                int result = fread(&fileObjectkey_dir,1,4,apfs);
-
-                dprintf("The result of fread is %d",result);
-                fread(&dirName,1,sizeof(dirName),apfs);
-                dirName[keyLength - 12]='\0';
-
-                /* Print the contents of the directory key */
-                dprintf(" The directory length is :%d\n",fileObjectkey_dir.name_len_and_hash & J_DREC_LEN_MASK);
-
-                fseek(apfs,valueStartAddressforfstree - valueOffset,SEEK_SET);
-                fread(&fileObject_dir_value,1,valueLength,apfs);
-
-                handle_drec(dirName, fileObject_dir_value);
-
-                dprintf("The directory name is: %s\n", dirName);
-                dprintf("file id is  %lu\n",fileObject_dir_value.file_id);
-                dprintf("The date added is %lu\n",fileObject_dir_value.date_added);
-                dprintf("The flags for the directory are %x\n",fileObject_dir_value.flags & DREC_TYPE_MASK);
-        }else if(APFS_TYPE_DIR_STATS ==fileObjectType){
-                //("The objtype is APFS_TYPE_DIR_STATS\n");
-                j_dir_stats_key_t fileObjectkey_dirStat={0};
-        }else if(APFS_TYPE_SNAP_NAME ==fileObjectType){
-                //("The objtype is APFS_TYPE_SNAP_NAME\n");
-        }else if(APFS_TYPE_SIBLING_MAP ==fileObjectType){
-                //("The objtype is APFS_TYPE_SIBLING_MAP\n");
-        }else if(APFS_TYPE_FILE_INFO ==fileObjectType){
-                //("The objtype is APFS_TYPE_FILE_INFO\n");
-        }else if(APFS_TYPE_MAX ==fileObjectType){
-                //("The objtype is APFS_TYPE_MAX\n");
+                offset += got;
         }
+        STATS_STOP(STATS_EXTENT_COPY);
+
+        if (got < 0)
+                printf("Error reading extended attribute %s of %s: %s\n", xattr->name, path, apfs_strerror((int)got));
+        fclose(op);
+        apfs_file_close(file);
 }
 
+/* Applies the extended attributes of obj to the file open as fd (-1 to go by path) */
+static void extractXattrs(fs_walk *walk, const apfs_object *obj, int fd, const char *path)
+{
+        for (uint32_t i = 0; i < obj->xattr_count; ++i) {
+                const apfs_xattr *xattr = &obj->xattrs[i];
+
+                dprintf("Extended attribute %s, %lu bytes%s\n", xattr->name, xattr->size,
+                        xattr->stream ? " in a data stream" : "");
+
+                if (xattr->stream == 0)
+                        xattrWrite(fd, path, xattr->name, xattr->data, xattr->size);
+                else
+                        extractXattrStream(walk, obj->st.ino, xattr, fd, path);
+        }
+}
 
 /*
- * Compares two arrays by byte
- *
- * Returns -1 if the first array is larger
- * Returns 0  if the arrays are identical
- * Returns 1  if the second array is larger
+ * Hard links and clones. A file with more than one link is extracted once,
+ * at its inode's own name, and every other directory entry becomes a hard
+ * link to it. The extents of cloned files are remembered by physical block,
+ * so a later clone sharing one takes it with FICLONERANGE where the file
+ * system shares blocks, or copies it in the kernel from the file already
+ * written, rather than reading it from the image again.
  */
-int compArray(uint8_t* firstArray, int firstArrayLen, uint8_t* secondArray, int secondArrayLen)
+
+// Remembers where a file with hard links or clones went; -1 when out of memory
+static int addExtracted(fs_walk *walk, uint64_t ino, const char *path)
 {
-        //Compare the array lengths
-        if (firstArrayLen > secondArrayLen)
+        fs_extracted *file = tableAdd(&walk->extractedFiles, ino);
+
+        if (file == NULL)
                 return -1;
-        else if (firstArrayLen < secondArrayLen)
-                return 1;
+        if (file->path == NULL && (file->path = strdup(path)) == NULL)
+                return -1;
+        return 0;
+}
+
+/* Makes dirPath/name a hard link to the extracted file ino, if that is another path */
+static void linkFile(fs_walk *walk, uint64_t ino, const char *dirPath, const char *name)
+{
+        const fs_extracted *file = tableFind(&walk->extractedFiles, ino);
+        char *linkName;
+
+        if (file == NULL || file->path == NULL)
+                return;
 
-        //Compare the bytes of the array
-        for (int index = 0; index < firstArrayLen; index++)
-        {
-                if (firstArray[index] > secondArray[index])
-                        return -1;
-                else if (firstArray[index] < secondArray[index])
-                        return 1;
+        if ((linkName = joinPath(dirPath, name)) == NULL) {
+                printf("Out of memory linking %s/%s\n", dirPath, name);
+                return;
         }
 
-        return 0;
+        if (strcmp(linkName, file->path) != 0) {
+                if (link(file->path, linkName) == 0)
+                        dprintf("Linked %s to %s\n", linkName, file->path);
+                else if (errno != EEXIST)
+                        printf("Error linking %s to %s\n", linkName, file->path);
+        }
+        free(linkName);
 }
 
 /*
- * Searches for the given key in the BTree
- *
- * Parameters
- * 
- * FILE apfsImage:		A file stream for the APFS disk image
- * uint32_t blockSize:	Typically 4096
- * uint64_t bNodeAddr:	The physical address of the B-Tree
- * uint8_t* searchKey:	A byte array containing the search key
- * uint searchKeyLen:	The length of the key byte array
- * uint8_t* returnVal:  An allocated byte array to store the result in
- * uint returnValueLen:	The expected length of the return value
- * uint64_t& nextBNode:	An address to the next layer in the BTree. May be a physical or virtual address.
- *
- * Return Value
- * 
- * -1:	Key not found or value length doesn't match.
- *  0:	Key found, value is stored in returnValue.
- *  1:	Node is internal and the key may be in a child node. Address to the next BNode is stored in nextBNode.
- *
- * Populates returnVal with:
- * NULL if the value is not found or valueLen does not match the actual value length.
- * The value if it is found.
+   Input Parameters: fs_walk*, apfs_object_extent*, uint64_t len, FILE* op
+   Return Type:      int
+Description: Writes len bytes of extent to op from a file extracted earlier
+that holds the same physical blocks: cloned when the file system can share
+them, copied from that file otherwise. Returns 1 when done, 0 when the
+extent has to be read from the image.
+
  */
-int searchBTree(FILE *apfsImage, uint32_t blockSize, uint64_t bNodeAddr,  uint8_t *searchKey,
-	            uint searchKeyLen, uint8_t *returnVal, uint returnValueLen, uint64_t *nextBNode)
+static int cloneExtent(fs_walk *walk, const apfs_object_extent *extent, uint64_t len, FILE *op)
 {
-	//Seek to the B-Tree node
-	fseek(apfsImage, bNodeAddr, SEEK_SET);
-
-	//Read the node struct
-	btree_node_phys_t bNodeStruct;
-	fread(&bNodeStruct, 1, sizeof(bNodeStruct), apfsImage);
-
-	//Read node flags
-	int rootNode = bNodeStruct.btn_flags & 1;
-	int leafNode = (bNodeStruct.btn_flags >> 1) & 1;
-	int fixedSize = (bNodeStruct.btn_flags >> 2) & 1;
-
-	//The table of contents always starts 56 bytes into the structure
-	//The node header is 32 bytes and the preceeding fields of the body are 24 bytes
-	int tableStartAddr = bNodeAddr + 56;
-	//The key area starts after the table of contents (and grows downward)
-	int keyStartAddr = tableStartAddr + bNodeStruct.btn_table_space.len;
-
-	//The value area starts at the end of the node (and grows upward)
-	int valueStartAddr = bNodeAddr + blockSize;
-
-	//If the node is the root, account for the info trailer 
-	if (rootNode)
-		valueStartAddr -= sizeof(btree_info_t);
-
-
-	//Create pointers for both a fixed length and variable length table of contents
-	toc_entry_fixed_t *tableEntriesFixed = NULL;
-	toc_entry_varlen_t *tableEntriesVarLen = NULL;
-
-	//Seek to the table of contents
-	fseek(apfsImage, tableStartAddr, SEEK_SET);
-
-	//Read the table of contents into an array
-	if (fixedSize)
-	{
-		int tableSize = bNodeStruct.btn_nkeys * sizeof(toc_entry_fixed_t);
-		tableEntriesFixed = malloc(tableSize);
-		fread(tableEntriesFixed, 1, tableSize, apfsImage);
-	}
-	else
-	{
-		int tableSize = bNodeStruct.btn_nkeys * sizeof(toc_entry_varlen_t);
-		tableEntriesVarLen = malloc(tableSize);
-		fread(tableEntriesVarLen, 1, tableSize, apfsImage);
-	}
-
-	//Iterate through the table
-	//Start from the end so that the first match is the latest version, since the B-Tree is sorted
-	int maxTocIndex = bNodeStruct.btn_nkeys - 1;
-
-	for (int entry_index = maxTocIndex; entry_index >= 0; entry_index--)
-	{
-		uint16_t keyOff, dataOff, keyLen, dataLen;
-
-		//Find the offset and length of the key and value
-		if (fixedSize)
-		{
-			keyOff = tableEntriesFixed[entry_index].key_off;
-			dataOff = tableEntriesFixed[entry_index].data_off;
-			//Set the key length to the search key length in case the user
-			//only wants to compare a portion of the key
-			keyLen = searchKeyLen;
-			dataLen = returnValueLen;
-		}
-		else
-		{
-			keyOff = tableEntriesVarLen[entry_index].key_off;
-			dataOff = tableEntriesVarLen[entry_index].data_off;
-			keyLen = tableEntriesVarLen[entry_index].key_len;
-			dataLen = tableEntriesVarLen[entry_index].data_len;
-		}
-
-		//Read the key
-		uint8_t key[keyLen];
-		int keyAddr = keyStartAddr + keyOff;
-		fseek(apfsImage, keyAddr, SEEK_SET);
-		fread(&key, 1, keyLen, apfsImage);
-
-		//Compare the two key arrays
-		int keyComp = compArray(searchKey, searchKeyLen, key, keyLen);
-
-		//If this node is not a leaf, get the address to the next layer
-		if (!leafNode)
-		{
-			//If the search key is larger than or equal to this entry, go to its child node
-			if (keyComp == -1 || keyComp == 0)
-			{
-				int valueAddr = valueStartAddr - dataOff;
-				fseek(apfsImage, valueAddr, SEEK_SET);
-				fread(nextBNode, 1, sizeof(uint64_t), apfsImage);
-
-				return 1;
-			}
-		}
-		//If this node is a leaf, find the search key
-		else
-		{
-			//If the keys match, return the value
-			if(keyComp == 0)
-			{
-				//Return -1 if the value length does not match the expected length
-				if (returnValueLen != dataLen)
-					return -1;
-
-				//Read the value
-				int valueAddr = valueStartAddr - dataOff;
-				fseek(apfsImage, valueAddr, SEEK_SET);
-				fread(returnVal, 1, dataLen, apfsImage);
-
-				return 0;
-			}
-		}
-	}
-
-	//If no matches were found, the key is not in the B-Tree
-	return -1;
+        const fs_written_extent *written = tableFind(&walk->writtenExtents, extent->paddr);
+        const fs_extracted *source;
+        struct file_clone_range range;
+        loff_t from, to;
+        int fd;
+
+        if (written == NULL || written->length < len ||
+            (source = tableFind(&walk->extractedFiles, written->ino)) == NULL || source->path == NULL)
+                return 0;
+        if ((fd = open(source->path, O_RDONLY)) == -1)
+                return 0;
+
+        fflush(op);
+        range.src_fd = fd;
+        range.src_offset = written->logical;
+        range.src_length = len;
+        range.dest_offset = extent->logical;
+        if (ioctl(fileno(op), FICLONERANGE, &range) == 0) {
+                dprintf("Cloned %lu Bytes at %lu from %s\n", len, extent->logical, source->path);
+                close(fd);
+                return 1;
+        }
+
+        from = written->logical;
+        to = extent->logical;
+        while (to < (loff_t)(extent->logical + len)) {
+                ssize_t copied = copy_file_range(fd, &from, fileno(op), &to, extent->logical + len - to, 0);
+
+                if (copied <= 0)
+                        break;
+        }
+        close(fd);
+
+        if (to != (loff_t)(extent->logical + len))
+                return 0;
+        dprintf("Copied %lu Bytes at %lu from %s\n", len, extent->logical, source->path);
+        return 1;
 }
 
+// Remembers an extent of a cloned file just written; -1 when out of memory
+static int addWrittenExtent(fs_walk *walk, uint64_t ino, const apfs_object_extent *extent, uint64_t len)
+{
+        fs_written_extent *written = tableAdd(&walk->writtenExtents, extent->paddr);
 
-/*
- * Searches an Omap for the physical address of the object corresponding to the given virtual address
- *
- * Parameters
- * 
- * FILE apfsImage:		A file stream for the APFS disk image
- * uint32_t blockSize:	Typically 4096
- * uint64_t omapAddr:	The physical address of the OMap
- * uint64_t oid:		The virtual address of the object to search for
- *
- * Return Value
- * 
- *  0 if the OID is not found
- *  The physical address of the object if the OID is found
- */
-uint64_t searchOmap(FILE *apfsImage, uint32_t blockSize, uint64_t omapAddr, uint64_t oid)
+        if (written == NULL)
+                return -1;
+        if (written->ino == 0) {
+                written->ino = ino;
+                written->logical = extent->logical;
+                written->length = len;
+        }
+        return 0;
+}
+
+/* Lists a directory entry and, for a subdirectory, remembers (and creates) its path */
+static void handle_drec(fs_walk *walk, const fs_directory *parent, const apfs_dirent *child)
 {
-	//Omap keys are supposed to be 16 bytes (oid and xid)
-	//We will ignore the xid and only pass the 8 byte oid
-	uint keyLen = 8;
-	//The return value is as 16 byte tApFS_0B_ObjectsMap_Value_t struct
-	uint valLen = 16;
-	uint64_t nextBNode;
-	tApFS_0B_ObjectsMap_Value_t returnVal;
-
-	//Search the B-Tree for the key
-	int result = searchBTree(apfsImage, blockSize, omapAddr, (uint8_t*)(&oid), keyLen, (uint8_t*)(&returnVal), valLen, &nextBNode);
-
-	//Key not found
-	if (result == -1)
-		return 0;
-	//Key found
-	else if (result == 0)
-		return returnVal.Address;
-	//Key in lower level of B-Tree
-	else if (result == 1)
-	{
-		//Convert the virtual B-Node address to a physical one
-		nextBNode *= blockSize;
-		return searchOmap(apfsImage, blockSize, nextBNode, oid);
-	}
+        char display[APFS_NAME_LEN];
+
+        /* Skip Private Directory */
+        if (child->ino == PRIV_DIR_INO_NUM || child->ino == ROOT_DIR_INO_NUM) {
+                return;
+        }
+
+        if (child->type == DT_DIR) {
+                char *dirName = joinPath(parent->path, child->name);
+
+                if (dirName == NULL) {
+                        printf("Out of memory remembering directory %s/%s\n", parent->path, child->name);
+                        return;
+                }
+                if (walk->extract) {
+                        if (mkdir(dirName, S_IRWXU) == -1) {
+                                printf("Directory %s is already present!\n", dirName);
+                                exit(0);
+                        }
+                }
+
+                if (addDirectory(walk, child->ino, parent->depth + 1, dirName) == -1)
+                        printf("Out of memory remembering directory %s\n", dirName);
+                free(dirName);
+
+                printf(ANSI_COLOR_CYAN "%s/\t" ANSI_COLOR_RESET, ToUp(child->name, display, sizeof(display)));
+        } else {
+                /* A file met before through another of its links */
+                if (walk->extract && walk->extractedFiles.count)
+                        linkFile(walk, child->ino, parent->path, child->name);
+
+                printf(ANSI_COLOR_CYAN "%s\t" ANSI_COLOR_RESET, child->name);
+        }
 }
 
 /*
-   Input Parameters: FILE* , uint64_t ,APFS_SuperBlk ,command_line_args
-   Return Type:      apfs_superblock_t
-Description: Function seeks to the physical address of volume superblock ,
-and prints the details of volume superblock.
-If -v option is given : Details of all Volumes are printed.
-If -v <Vol Id> is given :  ONly that particular Vol Id's details are printed.
+   Input Parameters: fs_walk*, apfs_object*, fs_directory* parent
+   Return Type:      void
+Description: Writes a file's data stream next to its directory entry, cut
+to the stream's size, with its extended attributes. A file with hard links
+is then linked from the directories already extracted that hold one; the
+extents of a cloned file are taken from a clone written before when they
+are shared.
 
  */
-apfs_superblock_t readAndPrintVolumeSuperBlock(FILE* apfs, uint64_t volumeSBAdress,APFS_SuperBlk containerSuperBlk,command_line_args args)
+static void extractFile(fs_walk *walk, const apfs_object *obj, const fs_directory *parent)
 {
-        apfs_superblock_t volumeSuperBlock;
-        // Go to the Address of Volume Super Block and print it.
-        fseek(apfs,volumeSBAdress * containerSuperBlk.BlockSize,SEEK_SET);
-        unsigned int sizeofVolSuperBlock = 0;
-        uint32_t volumeSuperBlkAddress =ftell(apfs);
-        if ((sizeofVolSuperBlock = fread(&volumeSuperBlock, 1, sizeof(volumeSuperBlock), apfs)) < 0) {
-                printf("Error reading from apfs File! [%d] size = %lu\n", sizeofVolSuperBlock, sizeof(volumeSuperBlock));
-                return volumeSuperBlock;
+        char *filename;
+        uint64_t size = obj->st.size;
+        int linked = obj->link_count > 1 || obj->st.nlink > 1;
+        int cloned = (obj->st.internal_flags & (INODE_WAS_CLONED | INODE_WAS_EVER_CLONED)) != 0;
+        FILE *op = NULL;
+
+        if ((filename = joinPath(parent->path, obj->name)) == NULL) {
+                printf("Out of memory extracting %s/%s\n", parent->path, obj->name);
+                return;
+        }
+        if ((op = statsFopen(filename, "w")) == NULL) {
+                dprintf("Unable to open %s\n", filename);
+                free(filename);
+                return;
+        }
+
+        if ((linked || cloned) && addExtracted(walk, obj->st.ino, filename) == -1)
+                printf("Out of memory remembering %s\n", filename);
+
+        for (uint32_t i = 0; i < obj->extent_count; ++i) {
+                const apfs_object_extent *extent = &obj->extents[i];
+                uint64_t len = extent->length;
+
+                if (extent->logical >= size)
+                        break;
+                if (len > size - extent->logical)
+                        len = size - extent->logical;
+
+                dprintf("Length = %lu\n", extent->length);
+                dprintf("Phy Block Num = %0lx\n", extent->paddr);
+
+                /* Holes are left to the file system */
+                if (extent->paddr == 0 || (cloned && cloneExtent(walk, extent, len, op)))
+                        continue;
+
+                copyExtent(walk, extent->paddr, extent->logical, len, op);
+                if (cloned && addWrittenExtent(walk, obj->st.ino, extent, len) == -1)
+                        printf("Out of memory remembering the extents of %s\n", filename);
         }
-        if(args.volume == 1 && args.volume_ID == 0 && args.fs_structure != 1)
-                printVolumeSuperBlock(volumeSuperBlock,volumeSuperBlkAddress, sizeofVolSuperBlock);
-        else if (args.volume == 1 && args.volume_ID != 0 )
-        {
-                if(args.volume_ID == volumeSuperBlock.apfs_o.o_oid && args.fs_structure != 1)
-                        printVolumeSuperBlock(volumeSuperBlock,volumeSuperBlkAddress, sizeofVolSuperBlock);
-                return volumeSuperBlock;
+
+        fflush(op);
+        if (ftruncate(fileno(op), size) == -1)
+                printf("Error setting the size of %s\n", filename);
+
+        extractXattrs(walk, obj, fileno(op), filename);
+        fclose(op);
+
+        for (uint32_t i = 0; linked && i < obj->link_count; ++i) {
+                const fs_directory *dir = findDirectory(walk, obj->links[i].parent);
+
+                if (dir != NULL)
+                        linkFile(walk, obj->st.ino, dir->path, obj->links[i].name);
         }
-        return volumeSuperBlock;
+        free(filename);
 }
 
 /*
-   Input Parameters: FILE* , omap_phys_t ,APFS_SuperBlk ,command_line_args
-   Return Type:      apfs_superblock_t
-Description: 
+   Input Parameters: apfs_object*, void* (the fs_walk)
+   Return Type:      int
+Description: Called by apfs_walk once per inode, with all of its records. A
+directory's inode prints its heading and its entries are listed; with -fs
+a file is written into the directory its inode names as parent. Paths come
+from the directory table rather than the working directory, so the order
+the objects arrive in does not matter beyond parents coming before their
+children.
 
  */
-
-apfs_superblock_t findValidVolumeSuperBlock(FILE *apfs,omap_phys_t omapStructure,APFS_SuperBlk containerSuperBlk)
+static int parseFSObjects(const apfs_object *obj, void *arg)
 {
-	apfs_superblock_t volumeSuperBlock;
-	// go to tree adress
-	uint64_t omapAddrPhys = omapStructure.om_tree_oid * containerSuperBlk.BlockSize;
-	int startOfValueSection = 0;
-
-	uint64_t volumeSBAdress=0;
-	uint64_t oid = 0;
-	if(args.volume == 1 && args.volume_ID != 0 )
-	{
-		oid = args.volume_ID;
-		volumeSBAdress = searchOmap(apfs, containerSuperBlk.BlockSize, omapAddrPhys, oid);
-		if(volumeSBAdress == 0)
-		{
-			printf(" Volume ID %lu does not exist!!",oid);
-			return volumeSuperBlock;
-		}
-	    volumeSuperBlock = readAndPrintVolumeSuperBlock(apfs,volumeSBAdress,containerSuperBlk,args);
-	
-	}else if(args.volume == 1 && args.volume_ID == 0 ){
-		for(int noOfVolItr =0;noOfVolItr < NX_MAX_FILE_SYSTEMS;noOfVolItr++)
-		{
-			if(containerSuperBlk.VolumesIdents[noOfVolItr] == 0)
-				break;
-			else
-			{
-				oid = containerSuperBlk.VolumesIdents[noOfVolItr];
-				volumeSBAdress = searchOmap(apfs, containerSuperBlk.BlockSize, omapAddrPhys, oid);
-				volumeSuperBlock = readAndPrintVolumeSuperBlock(apfs,volumeSBAdress,containerSuperBlk,args);
-			}
-		}
-	}
-
-	return volumeSuperBlock;
-}
+        fs_walk *walk = (fs_walk*)arg;
+        const fs_directory *dir = findDirectory(walk, obj->st.ino);
+        const fs_directory *parent;
+        const apfs_stat_t *st = &obj->st;
+
+        dprintf(" Private ID: %lu\n", st->private_id);
+        dprintf(" Create time: %lu\n", st->create_time);
+        dprintf(" MOD Time: %lu\n", st->mod_time);
+        dprintf(" Change Time: %lu\n", st->change_time);
+        dprintf(" Access Time: %lu\n", st->access_time);
+        dprintf(" Internal Flags: %0lx\n", st->internal_flags);
+        dprintf(" Number of Children/links: %d\n", S_ISDIR(st->mode) ? st->nchildren : st->nlink);
+        dprintf(" BSD Flags: %0x\n", st->bsd_flags);
+        dprintf(" Owner: %u\n", st->uid);
+        dprintf(" Group: %u\n", st->gid);
+        dprintf(" Mode: %u\n", st->mode);
+        if (st->sparse_bytes)
+                dprintf(" Sparse bytes: %lu\n", st->sparse_bytes);
+        if (st->rdev)
+                dprintf(" Device: %u\n", st->rdev);
+        if (st->document_id)
+                dprintf(" Document ID: %u\n", st->document_id);
+        dprintf("Filename - %s\n", obj->name);
+        dprintf("Extents %u, extended attributes %u, entries %u\n", obj->extent_count, obj->xattr_count,
+                obj->child_count);
+
+        if (dir != NULL) {
+                char display[APFS_NAME_LEN];
+
+                if (dir->depth > 0) {
+                        printf("%*s" ANSI_COLOR_RESET, (dir->depth - 1) * 8, "");
+                        printf(ANSI_COLOR_RED "\n%*s:\n", dir->depth * 8, ToUp(obj->name, display, sizeof(display)));
+                        printf("%*s" ANSI_COLOR_RESET, dir->depth * 8, "");
+                }
 
-uint64_t parseAPFSVolumeBlock(FILE *apfs, apfs_superblock_t volumeSuperBlock,APFS_SuperBlk containerSuperBlk,command_line_args args)
-{
-	// Go to omap id
-	fseek(apfs,volumeSuperBlock.apfs_omap_oid * containerSuperBlk.BlockSize,SEEK_SET);
-	omap_phys_t omapStructureVol;			
-	unsigned int sizeofOmapStructure = 0;
-
-	/* Initialize volume path */
-	snprintf(path, sizeof(path), "%s", volumeSuperBlock.apfs_volname);
-
-	if ((sizeofOmapStructure = fread(&omapStructureVol, 1, sizeof(omapStructureVol), apfs)) < 0) {
-		printf("Error reading from apfs File! [%d] size = %lu\n", sizeofOmapStructure, sizeof(omapStructureVol));
-	}
-
-	if (args.fs_structure != 1) {
-		dprintf("Parsed the OMAP Structure of Volume Super Block of Size = %u\n", sizeofOmapStructure);
-		dprintf("Tree oid is: %lu\n",omapStructureVol.om_tree_oid);	
-	}
-	// Go to B tree.
-	fseek(apfs,	omapStructureVol.om_tree_oid * containerSuperBlk.BlockSize,SEEK_SET);
-
-	btree_node_phys_t omapBTree;
-	int startOfOmapBtree = ftell(apfs);
-        dprintf(" EndOfVolumeBTree is: %d",startOfOmapBtree);
-	omapBTree = readAndPrintBtree(apfs);
-
-	// Now for the table length loop to get the key value pairs.
-	// Check if the kv flag is set to determine if it is kvoff or kloc
-	kvoff_t keyValueStruct[omapBTree.btn_table_space.len/4] ;
-	for(int i=0;i<omapBTree.btn_table_space.len;i=i+4)
-	{
-		unsigned int sizeofkvoff_t = 0;
-		sizeofkvoff_t=fread(&keyValueStruct,1,4,apfs);
-		if(keyValueStruct->k !=0 || keyValueStruct->v != 0)
-		{
-			dprintf("Parsed sizeofkvoff_t of table of COntents! Size = %u\n", sizeofkvoff_t);
-			dprintf("btn_data_first_key = %" PRIu16"\n",keyValueStruct->k);	
-			dprintf("btn_data_first_val = %d\n", keyValueStruct->v);	
-		}
-
-
-	}
-	fseek(apfs,16,SEEK_CUR);
-	int keyStartAddress = ftell(apfs);
-	tApFS_0B_ObjectsMap_Key_t key;
-	tApFS_0B_ObjectsMap_Value_t value;
-	fread(&key,1,16,apfs);
-	if (args.fs_structure != 1)
-		dprintf("The oid and xid are %lu and %lu\n",key.ObjectIdent,key.Transaction);
-
-	// check if it is root node or leaf node
-	// find the info address for root node.
-	int startOfBTreeInfo = startOfOmapBtree + 4096 - 56;
-	dprintf(" startOfBTreeInfo is: %d\n",startOfBTreeInfo);
-	fseek(apfs,startOfBTreeInfo,SEEK_SET);
-	fread(&value,1,16,apfs);
-        dprintf("The flag size and physicall address are %u, %u and %x and in decimal %d\n",value.Flags,value.Size,value.Address,value.Address);
-
-	return startOfOmapBtree;
-}
+                for (uint32_t i = 0; i < obj->child_count; ++i)
+                        handle_drec(walk, dir, &obj->children[i]);
 
-/* Anirudh's Version (Old)
- * Assumes FS Tree is only one node
- */
+                if (walk->extract && dir->depth > 0 && obj->xattr_count) {
+                        int fd = open(dir->path, O_RDONLY | O_DIRECTORY);
 
-// void parseFSTree(FILE* apfs,btree_node_phys_t fsBtree,int endOfOmapBtreeBtree, command_line_args args)
-// {
-// 	struct fs_obj obj = {0};
-// 	uint64_t cur = 0;
-
-// 	// Now for the table length loop to get the key value pairs.
-// 	// Check if the kv flag is set to determine if it is kvoff or kloc
-// 	kvloc_t keyValueStructure[fsBtree.btn_table_space.len/8] ;
-
-// 	for(int i=0;i<fsBtree.btn_table_space.len/8; i++)
-// 	{
-// 		unsigned int sizeofkvloc_t = 0;
-// 		sizeofkvloc_t=fread(&keyValueStructure[i],1,8,apfs);
-// 		if(keyValueStructure[i].k.len !=0 || keyValueStructure[i].v.len != 0)
-// 		{
-// 			//printf("Parsed sizeofkvoff_t of table of COntents! Size = %u\n", sizeofkvloc_t);
-// 			//printf("The first offset using array is %" PRIu16"\n",keyValueStructure[i].k.off);
-// 			//printf("The first offset using array is %" PRIu16"\n",keyValueStructure[i].k.len);		
-
-// 			//printf("btn_data_first_val offset= %d\n",  keyValueStructure[i].v.off);	
-// 			//printf("btn_data_first_val length= %d\n",  keyValueStructure[i].v.len);	
-// 		}
-// 	}
-
-// 	int keyStartAddressBtreeBtree = ftell(apfs);
-// 	int valueStartAddressforfstree = endOfOmapBtreeBtree - 40;
-// 	if (args.fs_structure != 1)
-// 		printf("The size of keyvaluestruct is %d\n",sizeof(keyValueStructure));
-// 	//printf("The fsBtree.btn_table_space.len/8 is %d\n",fsBtree.btn_table_space.len/8);
-// 	for(int h=0;h < (fsBtree.btn_table_space.len/8);h++)
-// 	{
-
-// 		uint64_t j_key_header=0;
-
-// 		fseek(apfs,keyStartAddressBtreeBtree,SEEK_SET);	   
-// 		fseek(apfs,keyValueStructure[h].k.off,SEEK_CUR);
-
-// 		fread(&j_key_header,1,8,apfs);
-// 		// Accessing the object typede
-// 		uint8_t objType=0;
-// 		objType=(j_key_header & OBJ_TYPE_MASK) >> OBJ_TYPE_SHIFT;
-// 		cur = j_key_header & OBJ_ID_MASK;
-		
-// 		//printf("##############################################################3\n");
-// 		//printf("The object Type is: %d & ID is %lu (at %0x)\n",objType, cur, ftell(apfs));
-// 		parseFSObjects(objType, apfs, keyValueStructure[h].k.len, valueStartAddressforfstree
-// 				, keyValueStructure[h].v.off, keyValueStructure[h].v.len, &obj);
-// 		obj.prev_oid = cur;
-		
-// 	}//for the table of contents
-// 	printf("\n");
-// }
+                        extractXattrs(walk, obj, fd, dir->path);
+                        if (fd != -1)
+                                close(fd);
+                }
+                return 0;
+        }
 
+        if (walk->extract && !S_ISDIR(st->mode) && (parent = findDirectory(walk, st->parent_ino)) != NULL)
+                extractFile(walk, obj, parent);
+
+        return 0;
+}
 
 /*
- * Visits and calls the parseFSObject on each node of the FS-Tree
- *
- * Parameters
- * 
- * FILE apfsImage:		A file stream for the APFS disk image
- * uint32_t blockSize:	Typically 4096
- * uint64_t fsTreeAddr:	The physical address of the FS-Tree root node
+   Input Parameters: apfs_ctx*, uint32_t index, int extract
+   Return Type:      int
+Description: Lists the file system of volume index in one apfs_walk, and
+with extract set writes it out below the working directory, which stands
+for the root directory.
+
  */
-void parseFSTree(FILE *apfsImage, uint32_t blockSize, uint64_t omapAddr, uint64_t fsTreeAddr, command_line_args args)
+int parseFSTree(apfs_ctx *ctx, uint32_t index, int extract)
 {
-	struct fs_obj obj = {0};
-	uint64_t cur = 0;
-
-	//Seek to the B-Tree node
-	fseek(apfsImage, fsTreeAddr, SEEK_SET);
-
-	//Read the node struct
-	btree_node_phys_t bNodeStruct;
-	fread(&bNodeStruct, 1, sizeof(bNodeStruct), apfsImage);
-
-	//Read node flags
-	int rootNode = bNodeStruct.btn_flags & 1;
-	int leafNode = (bNodeStruct.btn_flags >> 1) & 1;
-	int fixedSize = (bNodeStruct.btn_flags >> 2) & 1;
-
-	//The table of contents always starts 56 bytes into the structure
-	//The node header is 32 bytes and the preceeding fields of the body are 24 bytes
-	int tableStartAddr = fsTreeAddr + 56;
-	//The key area starts after the table of contents (and grows downward)
-	int keyStartAddr = tableStartAddr + bNodeStruct.btn_table_space.len;
-
-	//The value area starts at the end of the node (and grows upward)
-	int valueStartAddr = fsTreeAddr + blockSize;
-
-	//If the node is the root, account for the info trailer 
-	if (rootNode)
-		valueStartAddr -= sizeof(btree_info_t);
-
-	//Seek to the table of contents
-	fseek(apfsImage, tableStartAddr, SEEK_SET);
-
-	//Read the table of contents into an array
-	int tableSize = bNodeStruct.btn_nkeys * sizeof(toc_entry_varlen_t);
-	toc_entry_varlen_t tableEntriesVarLen[bNodeStruct.btn_nkeys];
-	fread(&tableEntriesVarLen, 1, tableSize, apfsImage);
-
-	//Iterate through the table
-	for (int entry_index = 0; entry_index < bNodeStruct.btn_nkeys; entry_index++)
-	{
-		//Find the offset and length of the key and value
-		uint16_t keyOff = tableEntriesVarLen[entry_index].key_off;
-		uint16_t dataOff = tableEntriesVarLen[entry_index].data_off;
-		uint16_t keyLen = tableEntriesVarLen[entry_index].key_len;
-		uint16_t dataLen = tableEntriesVarLen[entry_index].data_len;
-
-		int valueAddr = valueStartAddr - dataOff;
-
-		//If this node is not a leaf, recurse to all children
-		if (!leafNode)
-		{
-			//Read the OID of the B-Node in the next layer
-			uint64_t nextBNodeOID;
-			fseek(apfsImage, valueAddr, SEEK_SET);
-			fread(&nextBNodeOID, 1, sizeof(uint64_t), apfsImage);
-
-			//Convert the OID to a physical address
-			uint64_t nextBNodeAddr = searchOmap(apfsImage, blockSize, omapAddr, nextBNodeOID) * blockSize;
-
-			//Recurse to all decendent nodes
-			parseFSTree(apfsImage, blockSize, omapAddr, nextBNodeAddr, args);
-		}
-		//If this node is a leaf, parse the FS object
-		else
-		{
-			//Read the key
-			uint64_t j_key_header = 0;
-			int keyAddr = keyStartAddr + keyOff;
-			fseek(apfsImage, keyAddr, SEEK_SET);
-			fread(&j_key_header, 1, sizeof(uint64_t), apfsImage);
-
-			//Parse the key header flags
-			uint8_t objType = (j_key_header & OBJ_TYPE_MASK) >> OBJ_TYPE_SHIFT;
-			cur = j_key_header & OBJ_ID_MASK;
-
-			parseFSObjects(objType, apfsImage, keyLen, valueStartAddr, dataOff, dataLen, &obj);
-			obj.prev_oid = cur;
-		}
-	}
+        apfs_container_info container;
+        fs_walk walk;
+        int ret;
+
+        memset(&walk, 0, sizeof(walk));
+        walk.directories.slotSize = sizeof(fs_directory);
+        walk.extractedFiles.slotSize = sizeof(fs_extracted);
+        walk.writtenExtents.slotSize = sizeof(fs_written_extent);
+
+        apfs_container_info_get(ctx, &container);
+        walk.ctx = ctx;
+        walk.extract = extract;
+        walk.blockSize = container.block_size;
+
+        if ((ret = apfs_volume_open(ctx, index, &walk.volume)) < 0)
+                return ret;
+
+        //The root directory is extracted to the working directory
+        if ((walk.buffer = malloc((size_t)FS_COPY_BLOCKS * walk.blockSize)) == NULL ||
+            addDirectory(&walk, ROOT_DIR_INO_NUM, 0, ".") == -1)
+                ret = APFS_ENOMEM;
+        else
+                ret = apfs_walk(walk.volume, parseFSObjects, &walk);
+        printf("\n");
+
+        walkFree(&walk);
+        apfs_volume_close(walk.volume);
+        return ret;
 }
 
-void parse_APFS(char* filename)
+/*
+   Input Parameters: apfs_ctx*
+   Return Type:      int
+Description: Serves -c, -v and -fs on an open container: prints the
+container superblock, the volume superblocks asked for and the file
+system of the selected volume, as the command line asks.
+
+ */
+int parse_APFS(apfs_ctx *ctx)
 {
-	FILE *apfs = NULL;
-	APFS_SuperBlk containerSuperBlk;
-	omap_phys_t omapStructure;
-	apfs_superblock_t volumeSuperBlock;
-	int endOfOmapBtreeBtree=0;
-	APFS_SuperBlk super_blk = {0};
-	unsigned int size = 0;
-
-	if (NULL == (apfs = fopen (filename, "r")) ) {
-		printf("Unable to parse APFS: Error opening file %s!\n", filename);
-		return;
-	}
-
-	if (parse_blk_header(apfs)) {
-		printf("Unable to parse APFS: Failed to parse Block header\n");
-		return;
-	}
-
-	containerSuperBlk=findValidSuperBlock(apfs);
-	omapStructure = parseValidContainerSuperBlock(apfs,containerSuperBlk, containerSuperBlk.ObjectsMapIdent);
-	volumeSuperBlock=findValidVolumeSuperBlock(apfs,omapStructure,containerSuperBlk);
-	uint64_t omapAddr = parseAPFSVolumeBlock(apfs,volumeSuperBlock,containerSuperBlk,args);
-
-	//Find the address of the file system
-	uint32_t blockSize = containerSuperBlk.BlockSize;
-	// uint64_t omapAddr = volumeSuperBlock.apfs_omap_oid * blockSize;
-	uint64_t fsTreeOID = volumeSuperBlock.apfs_root_tree_oid;
-	uint64_t fsTreeAddr = searchOmap(apfs, blockSize, omapAddr, fsTreeOID) * blockSize;
-
-	//parse all file system objects
-        if (args.fs_structure != 0)
-                parseFSTree(apfs, blockSize, omapAddr, fsTreeAddr, args);
+        uint32_t index;
+        int ret = 0;
+
+        if (args.container == 1 && (ret = printContainer(ctx)) < 0)
+                return ret;
+
+        if (args.volume == 0)
+                return 0;
+
+        STATS_START(STATS_VOLUME);
+        if (args.fs_structure == 1) {
+                apfs_volume_info info;
+
+                //Listing only: find the volume without printing its superblock
+                for (index = 0; (ret = apfs_volume_info_get(ctx, index, &info)) == 0 && info.oid != args.volume_ID; ++index)
+                        ;
+                if (ret == APFS_ENOENT)
+                        printf(" Volume ID %u does not exist!!", args.volume_ID);
+        } else {
+                ret = printVolumeSuperBlocks(ctx, args.volume_ID, &index);
+        }
+        STATS_STOP(STATS_VOLUME);
+
+        //parse all file system objects
+        if (ret == 0 && args.fs_structure != 0) {
+                STATS_START(STATS_FS_WALK);
+                ret = parseFSTree(ctx, index, args.fs_structure == 2);
+                STATS_STOP(STATS_FS_WALK);
+        }
+
+        return ret;
 }
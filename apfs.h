@@ -1,3 +1,4 @@
+#pragma once
 #include <stdint.h>
 #include <string.h>
 #include <inttypes.h>
@@ -7,10 +8,14 @@
 
 #define MAX_CKSUM_SIZE 8
 
+#define NX_MAGIC	0x4253584E	/* 'NXSB' */
+#define APFS_MAGIC	0x42535041	/* 'APSB' */
+
 #define BLK_SIZE	4096
 
 #define APFS_MAX_HIST 8
 #define APFS_VOLNAME_LEN 256
+#define APFS_NAME_LEN 1024	/* Longest UTF-8 file name, with its NUL */
 #define APFS_MODIFIED_NAMELEN 32
 #define NX_MAX_FILE_SYSTEMS 100
 
@@ -70,7 +75,7 @@
 #define DT_WHT 14
 
 /* Debug Print API*/
-#define dprintf(f_, ...) if (args.debug_mode) printf((f_), ##__VA_ARGS__)
+#define dprintf(f_, ...) do { if (args.debug_mode) printf((f_), ##__VA_ARGS__); } while (0)
 
 /* ANSI Colours for printing */
 #define ANSI_COLOR_RED     "\x1b[31m"
@@ -81,16 +86,16 @@
 #define ANSI_COLOR_CYAN    "\x1b[34m"
 #define ANSI_COLOR_RESET   "\x1b[0m"
 
-static char * ToUp ( char *p )
+/* Copies src to dst upper-cased, for headings; src is left as it is */
+static char * ToUp ( const char *src, char *dst, size_t size )
 {
-	char *str = p;
-
-	while( *p )
-	{
-		*p=toupper( *p );
-		p++;
-	}
-	return str;
+	size_t i;
+
+	for (i = 0; src[i] && i + 1 < size; i++)
+		dst[i] = toupper( (unsigned char)src[i] );
+	if (size)
+		dst[i] = '\0';
+	return dst;
 }
 
 typedef uint8_t  tApFS_Uuid;
@@ -101,6 +106,7 @@ typedef uint64_t tApFS_BTreeKey;
 
 typedef uint64_t oid_t;
 typedef uint64_t xid_t;
+typedef uint64_t paddr_t;
 
 typedef uint32_t cp_key_class_t;
 typedef uint32_t cp_key_os_version_t;
@@ -217,16 +223,23 @@ struct tApFS_10_SnapshotMetaTree_Value
 	uint64_t      LastModifiedTime;  // Snapshot last modified time (in nanoseconds from midnight 01/01/1970)
 	uint64_t      iNum;              
 	uint32_t      ExtentRefTreeType; // Type of B-tree that stores extent information
+	uint32_t      Flags;             // Snapshot flags
 	uint16_t      NameLength;        // Snapshot name length (including end of line character)
 	uint8_t       Name[];            // Snapshot name (ending with 0)
 };
 
+typedef struct tApFS_10_SnapshotMetaTree_Value tApFS_10_SnapshotMetaTree_Value_t;
+
 struct tApFS_13_ObjectsMapSnapshot_Value
 {
 	uint32_t      Flags;    // Snapshot flags
 	uint32_t      Padding;  // Reserved (for adjustment)
 	tApFS_Ident Reserved; // Reserved
 };
+typedef struct tApFS_13_ObjectsMapSnapshot_Value tApFS_13_ObjectsMapSnapshot_Value_t;
+
+#define OMAP_SNAPSHOT_DELETED	0x00000001
+#define OMAP_SNAPSHOT_REVERTED	0x00000002
 
 struct tApFS_15_FusionMiddleTree_Value
 {
@@ -248,7 +261,7 @@ typedef struct apfs_super_block {
 	uint32_t 		DescriptorBlocks 	/* Amount of blocks used by descriptor */;
 	uint32_t 		DataBlocks 		/* Amount of blocks used by data */;
 	tApFS_Address 		DescriptorBase 		/* Descriptor base address or physical object Id with address tree */;
-	int 			DataBase 		/* Data base address or physical object Id with address tree */;
+	tApFS_Address 		DataBase 		/* Data base address or physical object Id with address tree */;
 	uint32_t 		DescriptorNext 		/* Next descriptor index */;
 	uint32_t 		DataNext 		/* Next data index */;
 	uint32_t 		DescriptorIndex 	/* Index of first valid element in descriptor segment */;
@@ -266,7 +279,7 @@ typedef struct apfs_super_block {
 	tApFS_Ident 		MappingTreeIdent 	/* Physical object identifier of the tree used to track objects to be moved from locked storage */;
 	uint64_t 		OtherFlags 		/* Other container functions' bitmap */;
 	tApFS_Address 		JumpstartEFI 		/* Physical object Id with EFI-driver data */;
-	tApFS_Uuid 		FusionUuid 		/* Fusion container UUID or zero for non-Fusion containers */;
+	tApFS_Uuid 		FusionUuid[16] 		/* Fusion container UUID or zero for non-Fusion containers */;
 	tApFS_BlockRange 	KeyLocker 		/* Container Key Tag Location */;
 	uint64_t 		EphemeralInfo[4] 	/* Fields' array used to manage ephemeral data */;
 	tApFS_Ident 		ReservedForTesting1;
@@ -304,6 +317,78 @@ typedef struct checkpoint_map_phys {
 	checkpoint_mapping_t cpm_map[];
 }checkPoint_Map;
 
+#define CHECKPOINT_MAP_LAST	0x00000001
+
+// Space manager
+#define SD_MAIN		0
+#define SD_TIER2	1
+#define SD_COUNT	2
+#define SFQ_COUNT	3
+
+struct spaceman_device {
+	uint64_t sm_block_count;
+	uint64_t sm_chunk_count;
+	uint32_t sm_cib_count;
+	uint32_t sm_cab_count;		// 0 when sm_addr_offset points at the CIB addresses directly
+	uint64_t sm_free_count;
+	uint32_t sm_addr_offset;	// Offset of the CAB (or CIB) address array in the space manager
+	uint32_t sm_reserved;
+	uint64_t sm_reserved2;
+};
+typedef struct spaceman_device spaceman_device_t;
+
+struct spaceman_phys {
+	obj_phys_t sm_o;
+	uint32_t sm_block_size;
+	uint32_t sm_blocks_per_chunk;
+	uint32_t sm_chunks_per_cib;
+	uint32_t sm_cibs_per_cab;
+	spaceman_device_t sm_dev[SD_COUNT];
+	uint32_t sm_flags;
+	uint32_t sm_ip_bm_tx_multiplier;
+	uint64_t sm_ip_block_count;
+	uint32_t sm_ip_bm_size_in_blocks;
+	uint32_t sm_ip_bm_block_count;
+	paddr_t sm_ip_bm_base;
+	paddr_t sm_ip_base;
+	uint64_t sm_fs_reserve_block_count;
+	uint64_t sm_fs_reserve_alloc_count;
+	struct tApFS_09_SpaceManagerFreeQueue_Value sm_fq[SFQ_COUNT];
+	uint16_t sm_ip_bm_free_head;
+	uint16_t sm_ip_bm_free_tail;
+	uint32_t sm_ip_bm_xid_offset;
+	uint32_t sm_ip_bitmap_offset;
+	uint32_t sm_ip_bm_free_next_offset;
+	uint32_t sm_version;
+	uint32_t sm_struct_size;
+};
+typedef struct spaceman_phys spaceman_phys_t;
+
+struct chunk_info {
+	uint64_t ci_xid;
+	uint64_t ci_addr;		// First block of the chunk
+	uint32_t ci_block_count;
+	uint32_t ci_free_count;
+	paddr_t ci_bitmap_addr;		// 0 when every block of the chunk is free
+};
+typedef struct chunk_info chunk_info_t;
+
+struct chunk_info_block {
+	obj_phys_t cib_o;
+	uint32_t cib_index;
+	uint32_t cib_chunk_info_count;
+	chunk_info_t cib_chunk_info[];
+};
+typedef struct chunk_info_block chunk_info_block_t;
+
+struct cib_addr_block {
+	obj_phys_t cab_o;
+	uint32_t cab_index;
+	uint32_t cab_cib_count;
+	paddr_t cab_cib_addr[];
+};
+typedef struct cib_addr_block cib_addr_block_t;
+
 struct omap_phys {
 	obj_phys_t om_o;
 	uint32_t om_flags;
@@ -454,6 +539,10 @@ struct apfs_superblock {
 };
 typedef struct apfs_superblock apfs_superblock_t;
 
+// Volumes with either feature key directory entries by name hash (j_drec_hashed_key_t), others by name (j_drec_key_t)
+#define APFS_INCOMPAT_CASE_INSENSITIVE		0x00000001
+#define APFS_INCOMPAT_NORMALIZATION_INSENSITIVE	0x00000008
+
 typedef enum {
 	APFS_TYPE_ANY = 0,
 	APFS_TYPE_SNAP_METADATA = 1,
@@ -512,6 +601,10 @@ struct j_inode_val {
 } __attribute__((packed));
 typedef struct j_inode_val j_inode_val_t;
 
+// Inode internal_flags telling clones apart; their extents may be shared with other inodes
+#define INODE_WAS_CLONED	0x00000004
+#define INODE_WAS_EVER_CLONED	0x00000008
+
 struct xf_blob {
 	uint16_t xf_num_exts;
 	uint16_t xf_used_data;
@@ -563,6 +656,26 @@ typedef enum {
 	RESERVED_10 = 0x0010
 } dir_rec_flags;
 
+// Sibling link 5, one per hard link of an inode, keyed by the inode
+struct j_sibling_key {
+	j_key_t hdr;
+	uint64_t sibling_id;
+} __attribute__((packed));
+typedef struct j_sibling_key j_sibling_key_t;
+
+struct j_sibling_val {
+	uint64_t parent_id;
+	uint16_t name_len;
+	uint8_t name[0];
+} __attribute__((packed));
+typedef struct j_sibling_val j_sibling_val_t;
+
+// Sibling map 12, keyed by the sibling identifier
+struct j_sibling_map_val {
+	uint64_t file_id;
+} __attribute__((packed));
+typedef struct j_sibling_map_val j_sibling_map_val_t;
+
 // Directory Stat 
 struct j_dir_stats_key {
 	j_key_t hdr;
@@ -585,6 +698,12 @@ struct j_xattr_key {
 } __attribute__((packed));
 typedef struct j_xattr_key j_xattr_key_t;
 
+// Snapshot name 11, the key is laid out like an extended attribute's
+struct j_snap_name_val {
+	uint64_t snap_xid;
+} __attribute__((packed));
+typedef struct j_snap_name_val j_snap_name_val_t;
+
 struct j_xattr_val {
 	uint16_t flags;
 	uint16_t xdata_len;
@@ -592,6 +711,20 @@ struct j_xattr_val {
 } __attribute__((packed));
 typedef struct j_xattr_val j_xattr_val_t;
 
+#define XATTR_DATA_STREAM	0x0001
+#define XATTR_DATA_EMBEDDED	0x0002
+#define XATTR_FILE_SYSTEM_OWNED	0x0004
+
+// A symbolic link's target, NUL-terminated
+#define SYMLINK_EA_NAME		"com.apple.fs.symlink"
+
+// Value of an extended attribute too large to embed
+struct j_xattr_dstream {
+	uint64_t xattr_obj_id;
+	j_dstream_t dstream;
+} __attribute__((packed));
+typedef struct j_xattr_dstream j_xattr_dstream_t;
+
 struct j_file_extent_val {
 	uint64_t len_and_flags;
 	uint64_t phys_block_num;
@@ -599,24 +732,13 @@ struct j_file_extent_val {
 } __attribute__((packed));
 typedef struct j_file_extent_val j_file_extent_val_t;
 
-struct fs_obj {
-	char *filename;	 /* Filename */
-	uint64_t prev_parent;
-	uint64_t prev_oid;
-};
-
 //Function Declarations
 
 extern command_line_args args;
 
-void parse_APFS(char*);	
-APFS_SuperBlk findValidSuperBlock( FILE *);
-omap_phys_t parseValidContainerSuperBlock( FILE *,APFS_SuperBlk , int);
-apfs_superblock_t findValidVolumeSuperBlock( FILE *,omap_phys_t,APFS_SuperBlk);
-btree_node_phys_t readAndPrintBtree(FILE*);
-int compArray(uint8_t*, int, uint8_t*, int);
-int searchBTree(FILE*, uint32_t, uint64_t,  uint8_t*, uint, uint8_t*, uint, uint64_t*);
-uint64_t searchOmap(FILE*, uint32_t, uint64_t, uint64_t);
-apfs_superblock_t readAndPrintVolumeSuperBlock(FILE*, uint64_t,APFS_SuperBlk,command_line_args);
+int parse_APFS(struct apfs_ctx*);
+int printContainer(struct apfs_ctx*);
+int printVolumeSuperBlocks(struct apfs_ctx*, uint64_t, uint32_t*);
+int parseFSTree(struct apfs_ctx*, uint32_t, int);
 
 
@@ -0,0 +1,1053 @@
+// apfspy.c : The APFSpy command line. Program execution begins and ends here.
+//
+//   Every mode reads the container through libapfsspy: -c, -v and -fs print
+//   and extract it with apfs.c, in place or from the --cache-dir copy of the
+//   expanded partition; --volumes, --ls, --stat and -f are served below.
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "dmgParser.h"
+#include "apfs.h"
+#include "cache.h"
+#include "crc32.h"
+#include "stats.h"
+#include "inflate.h"
+#include "libapfsspy.h"
+#include "popcount.h"
+#include "carve.h"
+#include "hash.h"
+
+//Portable endianness conversion
+#if defined(WIN32) || defined(__WIN32) ||defined(__WIN32__) || defined(__NT__) ||defined(_WIN64)    
+#include <Windows.h>
+#define be64toh(x) _byteswap_uint64(x)    
+#elif __linux__
+#include <endian.h>
+#elif __unix__ // all unixes not caught above
+#include <endian.h>
+#endif
+
+#define BENCHMARK_RUNS  3
+#define CAT_BUFFER_LEN  (1 << 20)
+
+command_line_args args;
+
+/*
+   Input Parameters: dmg_image*, dmg_partition*
+   Return Type:      int
+Description: Expands the partition BENCHMARK_RUNS times without writing it out
+and reports the best throughput of the inflate backend this build uses. The
+first run also faults the stored chunks into the page cache.
+
+ */
+int benchmarkPartition(dmg_image* image, dmg_partition* part)
+{
+        double best = 0;
+        uint64_t expanded = part->SectorCount * SECTOR_SIZE;
+
+        for (int run = 0; run < BENCHMARK_RUNS; ++run) {
+                struct timespec start, end;
+                double seconds;
+                int ret;
+
+                clock_gettime(CLOCK_MONOTONIC, &start);
+                if ((ret = readDataBlks(part, image, NULL, NULL)) < 0) {
+                        printf("Partition %u: %s\n", part->ID, dmgStrerror(ret));
+                        return -1;
+                }
+                clock_gettime(CLOCK_MONOTONIC, &end);
+
+                seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+                if (run == 0 || seconds < best)
+                        best = seconds;
+        }
+
+        printf("%s: partition %u, %.1f MB expanded from %.1f MB stored in %.3f s, %.1f MB/s\n",
+               inflateBackendName(), part->ID, expanded / 1e6, part->CompressedBytes / 1e6, best,
+               best > 0 ? expanded / 1e6 / best : 0);
+
+        return 0;
+}
+
+static const char* verifyResult(uint32_t type, uint32_t expected, uint32_t computed)
+{
+        if (type != UDIF_CHECKSUM_CRC32)
+                return "not checked (no CRC-32)";
+        return expected == computed ? "OK" : "MISMATCH";
+}
+
+/*
+   Input Parameters: dmg_image*, UDIFResourceFile*, dmg_partition_table*, dmg_partition*
+   Return Type:      int
+Description: Checks the master checksum from the koly trailer, then expands the
+given partition (every partition when NULL) to check its own checksum while
+the CRC-32 of the data fork is computed alongside. Returns the number of
+mismatches.
+
+ */
+int verifyImage(dmg_image* image, UDIFResourceFile* dmgTrailer, dmg_partition_table* partitions, dmg_partition* only)
+{
+        uint32_t type, crc = 0, failures = 0;
+        dmg_fork_check fork;
+
+        printf("Checksums (%s)\n", crc32Implementation());
+
+        // The data fork holds the stored, compressed chunks
+        startForkCheck(&fork, image, dmgTrailer);
+
+        // The master checksum covers the partition checksums, in plist order
+        crc = 0;
+        for (uint32_t i = 0; i < partitions->Count; ++i)
+                crc = crc32Update(crc, &partitions->Partitions[i].Checksum.Checksum[0], sizeof(uint32_t));
+
+        type = be32toh(dmgTrailer->ChecksumType);
+        printf("  Master:      %s\n", verifyResult(type, be32toh(dmgTrailer->Checksum[0]), crc));
+        failures += type == UDIF_CHECKSUM_CRC32 && crc != be32toh(dmgTrailer->Checksum[0]);
+
+        for (uint32_t i = 0; i < partitions->Count; ++i) {
+                dmg_partition *part = &partitions->Partitions[i];
+                dmg_expansion expansion;
+                int ret;
+
+                if (only != NULL && part != only)
+                        continue;
+
+                if (be32toh(part->Checksum.ChecksumType) != UDIF_CHECKSUM_CRC32) {
+                        printf("  Partition %u: %s\n", part->ID, verifyResult(UDIF_CHECKSUM_NONE, 0, 0));
+                        continue;
+                }
+
+                // readDataBlks computes and checks the checksum as it expands
+                if ((ret = readDataBlks(part, image, NULL, &expansion)) == DMG_ECHECKSUM) {
+                        printf("  Partition %u: MISMATCH (expected %08x, computed %08x)\n", part->ID,
+                               be32toh(part->Checksum.Checksum[0]), expansion.crc);
+                        failures++;
+                } else if (ret < 0) {
+                        printf("  Partition %u: %s\n", part->ID, dmgStrerror(ret));
+                        failures++;
+                } else {
+                        printf("  Partition %u: OK\n", part->ID);
+                }
+        }
+
+        if (finishForkCheck(&fork) == DMG_EFORK) {
+                printf("  Data fork:   lies outside of the file\n");
+                failures++;
+        } else {
+                printf("  Data fork:   %s\n", verifyResult(fork.type, fork.expected, fork.crc));
+                failures += fork.type == UDIF_CHECKSUM_CRC32 && fork.crc != fork.expected;
+        }
+
+        return failures;
+}
+
+// Waits for the data fork's CRC-32 started before a partition was expanded; 1 when it does not match
+static int reportForkCheck(dmg_fork_check *fork)
+{
+        int ret = finishForkCheck(fork);
+
+        if (ret == DMG_ECHECKSUM)
+                printf("Data fork checksum MISMATCH (expected %08x, computed %08x)\n", fork->expected, fork->crc);
+        else if (ret < 0)
+                printf("Data fork: %s\n", dmgStrerror(ret));
+
+        return ret < 0;
+}
+
+int isNumber(const char *arg)
+{
+        return arg[0] != '\0' && strspn(arg, "0123456789") == strlen(arg);
+}
+
+static const char* fileTypeName(uint16_t mode)
+{
+        if (S_ISDIR(mode))
+                return "directory";
+        if (S_ISLNK(mode))
+                return "symlink";
+        if (S_ISREG(mode))
+                return "file";
+        return "special";
+}
+
+static int printVolumes(apfs_ctx *ctx)
+{
+        apfs_container_info container;
+        apfs_volume_info info;
+        int ret;
+
+        apfs_container_info_get(ctx, &container);
+        printf("Container: block size %u, %lu blocks, transaction %lu\n\n",
+               container.block_size, container.block_count, container.xid);
+        printf("  %-5s %-8s %-32s %6s %10s %12s %10s %10s  %s\n",
+               "Index", "OID", "Name", "Role", "Files", "Directories", "Symlinks", "Snapshots", "Case");
+
+        for (uint32_t i = 0; i < container.volume_count; ++i) {
+                if ((ret = apfs_volume_info_get(ctx, i, &info)) < 0) {
+                        printf("  %-5u unreadable: %s\n", i, apfs_strerror(ret));
+                        continue;
+                }
+                printf("  %-5u %-8lu %-32s %6u %10lu %12lu %10lu %10lu  %s\n", info.index, info.oid, info.name,
+                       info.role, info.num_files, info.num_directories, info.num_symlinks, info.num_snapshots,
+                       info.case_insensitive ? "insensitive" : "sensitive");
+        }
+
+        return 0;
+}
+
+static int printSpaceRun(uint64_t first, uint64_t count, int used, void *arg)
+{
+        uint32_t blockSize = *(uint32_t*)arg;
+
+        printf("  %-4s %12lu %12lu %12lu  %.1f MB\n", used ? "used" : "free", first, first + count - 1, count,
+               count * (double)blockSize / 1e6);
+        return 0;
+}
+
+static int printSpaceMap(apfs_ctx *ctx)
+{
+        apfs_container_info container;
+        apfs_space_info space;
+        int ret;
+
+        apfs_container_info_get(ctx, &container);
+        if ((ret = apfs_space_info_get(ctx, &space)) < 0)
+                return ret;
+
+        printf("Space manager: %lu blocks in %lu chunks of %u (%u chunk-info blocks, %u address blocks)\n",
+               space.block_count, space.chunk_count, space.blocks_per_chunk, space.cib_count, space.cab_count);
+        printf("Used %lu, free %lu (the space manager records %lu free%s), counted with %s popcount\n\n",
+               space.used_blocks, space.free_blocks, space.recorded_free,
+               space.recorded_free == space.free_blocks ? "" : ", MISMATCH", popcountImplementation());
+        printf("  %-4s %12s %12s %12s\n", "", "First", "Last", "Blocks");
+
+        return apfs_space_extents(ctx, printSpaceRun, &container.block_size);
+}
+
+static int stopAtFirst(const apfs_xattr *xattr, void *arg)
+{
+        (void)xattr;
+        *(int*)arg = 1;
+        return 1;
+}
+
+// Marked with @ after the type when the entry has extended attributes, as ls -l does
+static int printDirectoryEntry(const apfs_dirent *entry, void *arg)
+{
+        apfs_volume *volume = (apfs_volume*)arg;
+        apfs_stat_t st;
+        int xattrs = 0;
+
+        if (apfs_stat(volume, entry->ino, &st) < 0)
+                memset(&st, 0, sizeof(st));
+        apfs_listxattr(volume, entry->ino, stopAtFirst, &xattrs);
+
+        printf("%c%c %06o %10lu %12lu  %s\n", entry->type == DT_DIR ? 'd' : entry->type == DT_LNK ? 'l' : '-',
+               xattrs ? '@' : ' ', st.mode & 07777, entry->ino, st.size, entry->name);
+        return 0;
+}
+
+static int printXattr(const apfs_xattr *xattr, void *arg)
+{
+        (void)arg;
+        if (xattr->stream)
+                printf("Extended attribute      %s, %lu bytes in data stream %lu\n", xattr->name, xattr->size, xattr->stream);
+        else
+                printf("Extended attribute      %s, %lu bytes\n", xattr->name, xattr->size);
+        return 0;
+}
+
+static void printStat(apfs_stat_t *st)
+{
+        printf("Inode                   %lu\n", st->ino);
+        printf("Parent                  %lu\n", st->parent_ino);
+        printf("Type                    %s\n", fileTypeName(st->mode));
+        printf("Mode                    %06o\n", st->mode);
+        printf("Owner                   %u:%u\n", st->uid, st->gid);
+        if (S_ISDIR(st->mode))
+                printf("Children                %u\n", st->nchildren);
+        else
+                printf("Links                   %u\n", st->nlink);
+        printf("Size                    %lu\n", st->size);
+        printf("Allocated               %lu\n", st->alloced_size);
+        if (st->sparse_bytes)
+                printf("Sparse bytes            %lu\n", st->sparse_bytes);
+        if (S_ISCHR(st->mode) || S_ISBLK(st->mode))
+                printf("Device                  %u, %u\n", st->rdev >> 24, st->rdev & 0xffffff);
+        if (st->document_id)
+                printf("Document ID             %u\n", st->document_id);
+        printf("Data stream             %lu\n", st->private_id);
+        printf("BSD flags               %#x\n", st->bsd_flags);
+        printf("Created                 %lu\n", st->create_time);
+        printf("Modified                %lu\n", st->mod_time);
+        printf("Changed                 %lu\n", st->change_time);
+        printf("Accessed                %lu\n", st->access_time);
+}
+
+// Writes the file's contents to stdout; the reads are sequential, so apfs_pread reads ahead
+static int catFile(apfs_volume *volume, uint64_t ino)
+{
+        uint8_t *buffer = (uint8_t*)malloc(CAT_BUFFER_LEN);
+        uint64_t offset = 0;
+        apfs_file *file;
+        int64_t got;
+
+        if (buffer == NULL)
+                return APFS_ENOMEM;
+
+        if ((got = apfs_file_open(volume, ino, &file)) < 0) {
+                free(buffer);
+                return (int)got;
+        }
+
+        while ((got = apfs_pread(file, buffer, CAT_BUFFER_LEN, offset)) > 0) {
+                if (fwrite(buffer, 1, got, stdout) != (size_t)got) {
+                        got = APFS_EIO;
+                        break;
+                }
+                offset += got;
+        }
+
+        apfs_file_close(file);
+        free(buffer);
+        return got < 0 ? (int)got : 0;
+}
+
+// Position of the volume given with -v in the container's volume array, the first one otherwise
+static int selectVolumeIndex(apfs_ctx *ctx, uint32_t *index)
+{
+        apfs_volume_info info;
+        int ret = 0;
+
+        *index = 0;
+
+        if (args.volume_ID) {
+                while ((ret = apfs_volume_info_get(ctx, *index, &info)) == 0 && info.oid != args.volume_ID)
+                        (*index)++;
+                if (ret == APFS_ENOENT)
+                        printf("Volume %u not found, use --volumes to list them\n", args.volume_ID);
+        }
+
+        return ret;
+}
+
+static int selectVolume(apfs_ctx *ctx, apfs_volume **volume)
+{
+        uint32_t index;
+        int ret;
+
+        *volume = NULL;
+
+        return (ret = selectVolumeIndex(ctx, &index)) < 0 ? ret : apfs_volume_open(ctx, index, volume);
+}
+
+static int printSnapshot(const apfs_snapshot_info *info, void *arg)
+{
+        (void)arg;
+
+        printf("  %-10lu %-32s %20lu %12lu\n", info->xid, info->name, info->create_time, info->superblock);
+        return 0;
+}
+
+// Swaps the volume for the snapshot given with --snapshot, by name or by transaction
+static int selectSnapshot(apfs_volume **volume)
+{
+        apfs_volume *snapshot;
+        uint64_t xid;
+        int ret;
+
+        if (isNumber(args.snapshot))
+                xid = strtoull(args.snapshot, NULL, 10);
+        else if ((ret = apfs_snapshot_find(*volume, args.snapshot, &xid)) < 0)
+                return ret;
+
+        if ((ret = apfs_snapshot_open(*volume, xid, &snapshot)) < 0)
+                return ret;
+
+        apfs_volume_close(*volume);
+        *volume = snapshot;
+        return APFS_OK;
+}
+
+/*
+   Input Parameters: char*
+   Return Type:      int
+Description: Serves --volumes, --list-snapshots, --ls, --stat and -f through
+libapfsspy, reading the container straight out of the DMG (or a raw image)
+without expanding it. The volume is the one given with -v, or the first one;
+--snapshot reads it as of one of its snapshots.
+
+ */
+int runLibraryCommand(char *path)
+{
+        apfs_ctx *ctx;
+        apfs_volume *volume = NULL;
+        apfs_stat_t st;
+        char *subject = args.path ? args.path : path;
+        uint64_t ino;
+        int ret;
+
+        if ((ret = apfs_open(path, args.partition, &ctx)) < 0) {
+                printf("Unable to open the APFS container: %s\n", apfs_strerror(ret));
+                return 1;
+        }
+
+        if (args.list_volumes) {
+                ret = printVolumes(ctx);
+                goto end;
+        }
+
+        if (args.space_map) {
+                subject = "Space manager";
+                ret = printSpaceMap(ctx);
+                goto end;
+        }
+
+        if ((ret = selectVolume(ctx, &volume)) < 0)
+                goto end;
+
+        if (args.list_snapshots) {
+                printf("  %-10s %-32s %20s %12s\n", "XID", "Name", "Created", "Superblock");
+                ret = apfs_snapshot_list(volume, printSnapshot, NULL);
+                goto end;
+        }
+
+        if (args.snapshot && (ret = selectSnapshot(&volume)) < 0) {
+                subject = args.snapshot;
+                goto end;
+        }
+
+        if ((ret = apfs_lookup_path(volume, args.path, &ino)) < 0 || (ret = apfs_stat(volume, ino, &st)) < 0)
+                goto end;
+
+        if (args.list_directory && S_ISDIR(st.mode)) {
+                ret = apfs_readdir(volume, ino, printDirectoryEntry, volume);
+        } else if (args.list_directory) {
+                apfs_dirent entry = { ino, 0, S_ISLNK(st.mode) ? DT_LNK : DT_REG, args.path };
+
+                ret = printDirectoryEntry(&entry, volume);
+        } else if (args.show_inode) {
+                printStat(&st);
+                ret = apfs_listxattr(volume, ino, printXattr, NULL);
+        } else {
+                ret = catFile(volume, ino);
+        }
+
+end:
+        if (ret < 0)
+                printf("%s: %s\n", subject, apfs_strerror(ret));
+
+        apfs_volume_close(volume);
+        statsMergeContext(ctx);
+        apfs_close(ctx);
+
+        return ret < 0 ? 1 : 0;
+}
+
+static void printCarveHit(const carve_hit *hit)
+{
+        const apfs_carved *record = &hit->record;
+
+        if (hit->signature) {
+                printf("Signature %-8s block %lu offset %u\n", hit->signature, hit->block, hit->offset);
+        } else if (record->kind == APFS_CARVE_INODE) {
+                printf("\nOrphaned inode in block %lu (node %lu, transaction %lu)\n", hit->block, record->node_oid,
+                       record->node_xid);
+                printStat((apfs_stat_t*)&record->st);
+                printf("\n");
+        } else {
+                printf("Orphaned extent in block %lu (node %lu, transaction %lu): stream %lu logical %lu length %lu "
+                       "block %lu\n", hit->block, record->node_oid, record->node_xid, record->stream, record->logical,
+                       record->length, record->paddr);
+        }
+}
+
+/*
+   Input Parameters: char*
+   Return Type:      int
+Description: Serves --carve: prints the inode and extent records of FS tree
+nodes nothing references any more, and the file signatures found in the free
+blocks, then a summary of what was scanned.
+
+ */
+int runCarve(char *path)
+{
+        int threads = args.threads > 0 ? args.threads : (int)sysconf(_SC_NPROCESSORS_ONLN);
+        carve_hit *hits;
+        carve_stats stats;
+        uint64_t count;
+        int ret;
+
+        ret = carveContainer(path, args.partition, threads, &hits, &count, &stats);
+        statsMerge(&stats.io);
+
+        for (uint64_t i = 0; i < count; ++i)
+                printCarveHit(&hits[i]);
+
+        printf("\n%lu blocks scanned (%lu free%s), %lu orphaned nodes, %lu records, %lu signatures (%s matcher)\n",
+               stats.blocks_scanned, stats.free_blocks, stats.free_known ? "" : ", no space manager",
+               stats.orphan_nodes, stats.records, stats.signatures, signatureImplementation());
+
+        free(hits);
+        return ret < 0 ? 1 : 0;
+}
+
+/*
+   Input Parameters: char*
+   Return Type:      int
+Description: Serves --hash: one JSON line per regular file of the volume with
+the digests asked for, read in place by -j threads. The summary goes to
+stderr so that stdout stays JSON lines.
+
+ */
+int runHash(char *path)
+{
+        int threads = args.threads > 0 ? args.threads : (int)sysconf(_SC_NPROCESSORS_ONLN);
+        hash_stats stats;
+        uint32_t index;
+        apfs_ctx *ctx;
+        int ret;
+
+        if ((ret = apfs_open(path, args.partition, &ctx)) < 0) {
+                printf("Unable to open the APFS container: %s\n", apfs_strerror(ret));
+                return 1;
+        }
+        ret = selectVolumeIndex(ctx, &index);
+        statsMergeContext(ctx);
+        apfs_close(ctx);
+        if (ret < 0)
+                return 1;
+
+        ret = hashVolume(path, args.partition, index, threads, args.hash, stdout, &stats);
+        statsMerge(&stats.io);
+        fflush(stdout);
+
+        fprintf(stderr, "%lu files, %.1f MiB in %.2f s (%.1f MiB/s), %lu unreadable;", stats.files,
+                stats.bytes / 1048576.0, stats.seconds, stats.seconds > 0 ? stats.bytes / 1048576.0 / stats.seconds : 0,
+                stats.errors);
+        for (int a = 0; a < DIGEST_COUNT; ++a)
+                if (args.hash & (1u << a))
+                        fprintf(stderr, " %s %s", digestName(a), digestImplementation(a));
+        fprintf(stderr, "\n");
+
+        return ret < 0 ? 1 : 0;
+}
+
+/* The two sides of a diff, so that a change can be described from the side that has it */
+typedef struct {
+        apfs_volume *from;
+        apfs_volume *to;
+} diff_sides;
+
+static int printChange(uint64_t ino, int change, void *arg)
+{
+        diff_sides *sides = (diff_sides*)arg;
+        apfs_stat_t st;
+
+        // A changed data stream whose identifier is not an inode (a clone) has no attributes
+        if (apfs_stat(change == APFS_DIFF_REMOVED ? sides->from : sides->to, ino, &st) < 0) {
+                printf("%c %10lu  %-9s\n", change == APFS_DIFF_MODIFIED ? 'M' : change == APFS_DIFF_ADDED ? 'A' : 'R',
+                       ino, "-");
+                return 0;
+        }
+
+        printf("%c %10lu  %-9s %12lu  parent %lu\n", change == APFS_DIFF_MODIFIED ? 'M' : change == APFS_DIFF_ADDED ? 'A' : 'R',
+               ino, fileTypeName(st.mode), st.size, st.parent_ino);
+        return 0;
+}
+
+// Opens one side of a diff, listing the checkpoints the image has when the wanted one is not among them
+static int openDiffSide(char *path, uint64_t xid, apfs_ctx **ctx, apfs_volume **volume)
+{
+        uint64_t xids[64];
+        int ret, count;
+
+        *volume = NULL;
+
+        if ((ret = apfs_open_checkpoint(path, args.partition, xid, ctx)) == APFS_ENOENT && xid &&
+            apfs_open(path, args.partition, ctx) == 0) {
+                count = apfs_checkpoint_list(*ctx, xids, 64);
+                printf("%s has no checkpoint %lu, it has:", path, xid);
+                for (int i = 0; i < count && i < 64; ++i)
+                        printf(" %lu", xids[i]);
+                printf("\n");
+                statsMergeContext(*ctx);
+                apfs_close(*ctx);
+                *ctx = NULL;
+                return ret;
+        }
+
+        if (ret < 0 || (ret = selectVolume(*ctx, volume)) < 0)
+                printf("%s: %s\n", path, apfs_strerror(ret));
+
+        return ret;
+}
+
+/*
+   Input Parameters: char*
+   Return Type:      int
+Description: Serves --diff-xid and --diff: lists the inodes that were added,
+removed or modified between two checkpoints of the image, or between the
+image and a later capture of it. Subtrees both sides share are skipped, so
+only the changed part of the FS tree is read.
+
+ */
+int runDiff(char *path)
+{
+        apfs_ctx *fromCtx = NULL, *toCtx = NULL;
+        apfs_diff_stats stats;
+        diff_sides sides = { NULL, NULL };
+        int ret;
+
+        if ((ret = openDiffSide(path, args.diff_from, &fromCtx, &sides.from)) < 0 ||
+            (ret = openDiffSide(args.diff_image ? args.diff_image : path, args.diff_to, &toCtx, &sides.to)) < 0)
+                goto end;
+
+        if (args.diff_image)
+                printf("Changes from %s to %s\n\n", path, args.diff_image);
+        else
+                printf("Changes from transaction %lu to %lu\n\n", args.diff_from, args.diff_to);
+
+        if ((ret = apfs_diff(sides.from, sides.to, printChange, &sides, &stats)) < 0) {
+                printf("Diff failed: %s\n", apfs_strerror(ret));
+                goto end;
+        }
+
+        printf("\n%lu added, %lu removed, %lu modified; %lu nodes read, %lu shared subtrees skipped\n",
+               stats.added, stats.removed, stats.modified, stats.nodes_read, stats.subtrees_shared);
+
+end:
+        apfs_volume_close(sides.from);
+        apfs_volume_close(sides.to);
+        statsMergeContext(fromCtx);
+        statsMergeContext(toCtx);
+        apfs_close(fromCtx);
+        apfs_close(toCtx);
+
+        return ret < 0 ? 1 : 0;
+}
+
+/*
+   Input Parameters: char*, int
+   Return Type:      int
+Description: Serves -c, -v and -fs: opens the container, in place in the
+DMG or from the expanded copy --cache-dir keeps, and prints or extracts it
+with parse_APFS.
+
+ */
+int runParser(char *path, int partition)
+{
+        apfs_ctx *ctx;
+        int ret;
+
+        if ((ret = apfs_open(path, partition, &ctx)) < 0) {
+                printf("Unable to parse APFS: %s\n", apfs_strerror(ret));
+                return 1;
+        }
+
+        if ((ret = parse_APFS(ctx)) < 0 && ret != APFS_ENOENT)
+                printf("Unable to parse APFS: %s\n", apfs_strerror(ret));
+
+        statsMergeContext(ctx);
+        apfs_close(ctx);
+        return ret < 0 ? 1 : 0;
+}
+
+int checkCommandLineArguments(char** argv, int argc)
+{
+        int result = 0, i = 0, mode = 0;
+
+        if (argc < 2) {
+                printf("Invalid number of arguments!\n");
+                return 1;
+        }
+
+        args.partition = -1;
+
+        for (i = 2; i < argc && result == 0; ++i) {
+                if (strcmp(argv[i], "-d") == 0) {
+                        args.debug_mode = 1;
+                } else if (strcmp(argv[i], "-l") == 0 || strcmp(argv[i], "-L") == 0) {
+                        args.list_partitions = 1;
+                        mode = 1;
+                } else if (strcmp(argv[i], "-p") == 0 || strcmp(argv[i], "-P") == 0) {
+                        if (i + 1 < argc && isNumber(argv[i + 1])) {
+                                args.partition = atoi(argv[++i]);
+                        } else {
+                                printf("Partition id has to be an interger!\n");
+                                result = 1;
+                        }
+                } else if (strcmp(argv[i], "-x") == 0 || strcmp(argv[i], "-X") == 0) {
+                        if (i + 1 < argc) {
+                                args.export_file = argv[++i];
+                                mode = 1;
+                        } else {
+                                printf("Export takes an output file name\n");
+                                result = 1;
+                        }
+                } else if (strcmp(argv[i], "--export-raw") == 0 || strcmp(argv[i], "--export-map") == 0) {
+                        if (i + 1 < argc) {
+                                if (argv[i][9] == 'r')
+                                        args.export_raw = argv[++i];
+                                else
+                                        args.export_map = argv[++i];
+                                mode = 1;
+                        } else {
+                                printf("%s takes an output file name\n", argv[i]);
+                                result = 1;
+                        }
+                } else if (strcmp(argv[i], "-j") == 0) {
+                        if (i + 1 < argc && isNumber(argv[i + 1])) {
+                                args.threads = atoi(argv[++i]);
+                        } else {
+                                printf("The thread count has to be an interger!\n");
+                                result = 1;
+                        }
+                } else if (strcmp(argv[i], "--stats") == 0) {
+                        args.stats = STATS_TABLE;
+                } else if (strcmp(argv[i], "--stats=json") == 0) {
+                        args.stats = STATS_JSON;
+                } else if (strcmp(argv[i], "--benchmark") == 0) {
+                        args.benchmark = 1;
+                        mode = 1;
+                } else if (strcmp(argv[i], "--verify") == 0) {
+                        args.verify = 1;
+                        mode = 1;
+                } else if (strcmp(argv[i], "--volumes") == 0) {
+                        args.list_volumes = 1;
+                        mode = 1;
+                } else if (strcmp(argv[i], "--ls") == 0 || strcmp(argv[i], "--stat") == 0 ||
+                           strcmp(argv[i], "-f") == 0 || strcmp(argv[i], "-F") == 0) {
+                        if (i + 1 < argc) {
+                                args.list_directory = argv[i][2] == 'l';
+                                args.show_inode = argv[i][2] == 's';
+                                args.file = argv[i][2] == '\0';
+                                args.path = argv[++i];
+                                mode = 1;
+                        } else {
+                                printf("%s takes a path inside the volume\n", argv[i]);
+                                result = 1;
+                        }
+                } else if (strcmp(argv[i], "--space-map") == 0) {
+                        args.space_map = 1;
+                        mode = 1;
+                } else if (strcmp(argv[i], "--carve") == 0) {
+                        args.carve = 1;
+                        mode = 1;
+                } else if (strcmp(argv[i], "--hash") == 0) {
+                        if (i + 1 < argc && digestParse(argv[i + 1], &args.hash) == 0) {
+                                i++;
+                                mode = 1;
+                        } else {
+                                printf("--hash takes a list of md5, sha1, sha256 and blake3, e.g. sha256,blake3\n");
+                                result = 1;
+                        }
+                } else if (strcmp(argv[i], "--skip-free") == 0) {
+                        args.skip_free = 1;
+                } else if (strcmp(argv[i], "--xattr-sidecar") == 0) {
+                        args.xattr_sidecar = 1;
+                } else if (strcmp(argv[i], "--list-snapshots") == 0) {
+                        args.list_snapshots = 1;
+                        mode = 1;
+                } else if (strcmp(argv[i], "--snapshot") == 0) {
+                        if (i + 1 < argc) {
+                                args.snapshot = argv[++i];
+                        } else {
+                                printf("--snapshot takes a snapshot name or transaction id\n");
+                                result = 1;
+                        }
+                } else if (strcmp(argv[i], "--diff-xid") == 0) {
+                        if (i + 2 < argc && isNumber(argv[i + 1]) && isNumber(argv[i + 2])) {
+                                args.diff_from = strtoull(argv[++i], NULL, 10);
+                                args.diff_to = strtoull(argv[++i], NULL, 10);
+                                mode = 1;
+                        } else {
+                                printf("--diff-xid takes two transaction ids\n");
+                                result = 1;
+                        }
+                } else if (strcmp(argv[i], "--diff") == 0) {
+                        if (i + 1 < argc) {
+                                args.diff_image = argv[++i];
+                                mode = 1;
+                        } else {
+                                printf("--diff takes the image to compare with\n");
+                                result = 1;
+                        }
+                } else if (strcmp(argv[i], "--cache-dir") == 0) {
+                        if (i + 1 < argc) {
+                                args.cache_dir = argv[++i];
+                        } else {
+                                printf("--cache-dir takes a directory\n");
+                                result = 1;
+                        }
+                } else if (strcmp(argv[i], "-c") == 0 || strcmp(argv[i], "-C") == 0) {
+                        if (mode) {
+                                printf("Container Superblock takes no arguments\n");
+                                result = 1;
+                        }
+                        args.container = 1;
+                        mode = 1;
+                } else if (strcmp(argv[i], "-v") == 0 || strcmp(argv[i], "-V") == 0) {
+                        args.volume = 1;
+                        mode = 1;
+                        /* An optional volume id, then an optional -fs */
+                        if (i + 1 < argc && argv[i + 1][0] != '-') {
+                                if (!isNumber(argv[i + 1])) {
+                                        printf("Volume id has to be an interger!\n");
+                                        result = 1;
+                                } else {
+                                        args.volume_ID = atoi(argv[++i]);
+                                }
+                        }
+                        if (result == 0 && args.volume_ID && i + 1 < argc &&
+                            ((strcmp(argv[i + 1], "-fs") == 0) || (strcmp(argv[i + 1], "-FS") == 0))) {
+                                args.fs_structure = 2;
+                                i++;
+                        }
+                } else if ((strcmp(argv[i], "-fs") == 0) || (strcmp(argv[i], "-FS") == 0)) {
+                        printf("Please use \"-v <Volume_ID> -fs\" to see the file system structure\n");
+                        result = 1;
+                } else {
+                        printf("Invalid parameter!\n");
+                        result = 1;
+                }
+        }
+
+        /* A snapshot on its own lists its root directory */
+        if (result == 0 && args.snapshot && !args.path && !args.list_snapshots) {
+                args.list_directory = 1;
+                args.path = "/";
+                mode = 1;
+        }
+
+        /* No mode given: print the file system structure of the default volume */
+        if (result == 0 && mode == 0) {
+                args.fs_structure = 1;
+                args.volume = 1;
+                args.volume_ID = 1026;
+        }
+
+        return result;
+}
+
+void printUsage(char **argv)
+{
+        printf("Usage :\n\n%s <DMG_FILE>     	         	Prints the Disk Image Structure\n \
+                        -c                      Container Superblock Information\n \
+                        -v [ Volume ID ]        All Vol SuperBlock Information | Specified Volume's Information \n \
+                        -f <path>               Displays file content\n \
+                        --ls <path>             Lists a directory of the volume\n \
+                        --stat <path>           Prints the inode of a file or directory\n \
+                        --volumes               Lists the volumes of the container\n \
+                        --list-snapshots        Lists the snapshots of the volume\n \
+                        --space-map             Lists the used and free extents of the container\n \
+                        --carve                 Recovers records of orphaned FS tree nodes and file signatures in free space\n \
+                        --hash <digests>        Prints md5, sha1, sha256 and/or blake3 digests of every file as JSON lines\n \
+                        --snapshot <name|xid>   Reads --ls, --stat and -f from a snapshot\n \
+                        --diff-xid <A> <B>      Lists the inodes changed between two checkpoints\n \
+                        --diff <DMG_FILE>       Lists the inodes changed in a later image of the container\n \
+                        -v <Volume_ID> -fs      Displays File system Structure\n \
+                        --xattr-sidecar         Writes extended attributes -fs extracts to <path>.xattrs/<name>\n \
+                        -l                      Lists the partitions of the DMG\n \
+                        -p <Partition_ID>       Selects the partition to parse (default: first Apple_APFS)\n \
+                        -x <out_file>           Exports the selected partition, decompressed\n \
+                        --export-raw <out_file> Exports it as a sparse image, inflating in parallel\n \
+                        --export-map <out_file> Writes a JSON map of its chunks (- for stdout)\n \
+                        -j <threads>            Threads of --export-raw, --carve and --hash (default: one per CPU)\n \
+                        --skip-free             Leaves the chunks --export-raw finds free in the space manager as holes\n \
+                        --cache-dir <dir>       Reuses expanded partitions across runs\n \
+                        --verify                Checks the data fork, master and partition CRC-32 checksums\n \
+                        --benchmark             Reports the inflate throughput on the selected partition\n \
+                        --stats[=json]          Prints per-phase timings and I/O counters at exit\n \
+                        -d			Debug Mode\n", argv[0]);	
+}
+
+int main(int argc, char** argv)
+{
+        dmg_image image;
+        UDIFResourceFile dmgTrailer;
+        dmg_partition_table partitions;
+        dmg_partition *part = NULL;
+        const char *plist;
+        dmg_cache cache;
+        int result = 0, forkMismatch = 0, ret;
+
+        // check command line arguments 
+        if (checkCommandLineArguments( argv , argc) == 1) {
+                printUsage(argv);
+                return 1;
+        }
+
+        statsInit(args.stats);
+
+        //These read the container in place, without expanding the partition
+        if (args.list_volumes || args.list_snapshots || args.space_map || args.path)
+                return runLibraryCommand(argv[1]);
+        if (args.diff_to || args.diff_image)
+                return runDiff(argv[1]);
+        if (args.carve)
+                return runCarve(argv[1]);
+        if (args.hash)
+                return runHash(argv[1]);
+
+        STATS_START(STATS_MAP);
+        if ((ret = readImageFile(&image, argv[1])) < 0)
+        {
+                if (ret == DMG_ESIZE)
+                        printf("%s: %s\n", argv[1], dmgStrerror(ret));
+                else
+                        printf("%s: %s [%s]\n", argv[1], dmgStrerror(ret), strerror(errno));
+                return 1;
+        }
+
+        //The trailer and the plist are read in place from the mapping
+        if ((ret = parseDMGTrailer(&image, &dmgTrailer)) < 0 ||
+            (plist = readXMLOffset(&image, &dmgTrailer)) == NULL)
+        {
+                printf("%s: %s\n", argv[1], dmgStrerror(ret < 0 ? ret : DMG_EPLIST));
+                closeImageFile(&image);
+                return 1;
+        }
+        STATS_STOP(STATS_MAP);
+
+        //Decode every partition of the pList
+        STATS_START(STATS_PLIST);
+        if ((ret = buildPartitionTable(plist, be64toh(dmgTrailer.XMLLength), &partitions)) < 0)
+        {
+                printf("Failed to parse the DMG pList: %s\n", dmgStrerror(ret));
+                closeImageFile(&image);
+                return 1;
+        }
+        STATS_STOP(STATS_PLIST);
+
+        if (partitions.Skipped)
+                printf("Skipped %u blkx entries that are not whole mish tables or have chunks out of range\n", partitions.Skipped);
+
+        if (args.partition >= 0)
+                part = getPartition(&partitions, args.partition);
+        else
+                part = findPartitionByName(&partitions, "Apple_APFS");
+
+        if (args.list_partitions)
+        {
+                printPartitionTable(&partitions);
+        }
+        else if (args.verify)
+        {
+                STATS_START(STATS_VERIFY);
+                result = verifyImage(&image, &dmgTrailer, &partitions, args.partition >= 0 ? part : NULL) ? 1 : 0;
+                STATS_STOP(STATS_VERIFY);
+        }
+        else if (part == NULL)
+        {
+                printf("Partition not found, use -l to list the partitions\n");
+        }
+        else if (args.benchmark)
+        {
+                result = benchmarkPartition(&image, part) < 0 ? 1 : 0;
+        }
+        else if (args.export_raw || args.export_map)
+        {
+                if (args.export_map && exportMap(part, args.export_map) < 0)
+                        result = 1;
+
+                if (args.export_raw)
+                {
+                        int threads = args.threads > 0 ? args.threads : (int)sysconf(_SC_NPROCESSORS_ONLN);
+                        apfs_ctx *space = NULL;
+                        int ret;
+
+                        //The container is opened a second time, through the library, for its free-block set
+                        if (args.skip_free && (ret = apfs_open(argv[1], (int)(part - partitions.Partitions), &space)) < 0)
+                                printf("Not skipping free space: %s\n", apfs_strerror(ret));
+                        else if (space && (ret = apfs_range_used(space, 0, 1)) < 0)
+                        {
+                                printf("Not skipping free space: %s\n", apfs_strerror(ret));
+                                apfs_close(space);
+                                space = NULL;
+                        }
+
+                        dmg_fork_check fork;
+
+                        startForkCheck(&fork, &image, &dmgTrailer);
+                        if (exportRaw(part, &image, args.export_raw, threads, space) < 0)
+                                result = 1;
+                        else
+                                printf("Exported partition %u (%s) to %s\n", part->ID, part->Name, args.export_raw);
+                        if (reportForkCheck(&fork))
+                                result = 1;
+                        statsMergeContext(space);
+                        apfs_close(space);
+                }
+        }
+        else if (args.cache_dir && openCache(&cache, args.cache_dir, &image, &dmgTrailer, part) < 0)
+        {
+                result = 1;
+        }
+        else if (args.export_file)
+        {
+                dmg_expansion expansion = { 0, 0 };
+                dmg_fork_check fork;
+                int expanded = !(args.cache_dir && cacheHasImage(&cache, part));
+
+                if (!expanded)
+                {
+                        result = copyCachedImage(&cache, args.export_file) == 0 ? 0 : 1;
+                }
+                else
+                {
+                        startForkCheck(&fork, &image, &dmgTrailer);
+                        if ((ret = readDataBlks(part, &image, args.export_file, &expansion)) < 0)
+                        {
+                                printf("Unable to export partition %u to %s: %s\n", part->ID, args.export_file, dmgStrerror(ret));
+                                result = 1;
+                        }
+                }
+
+                if (expansion.zeroed)
+                        printf("%u chunks of an unsupported type or outside of the file were written as zeros\n",
+                               expansion.zeroed);
+                if (result == 0)
+                        printf("Exported partition %u (%s) to %s\n", part->ID, part->Name, args.export_file);
+                if (expanded && reportForkCheck(&fork))
+                        result = 1;
+        }
+        else if (args.cache_dir)
+        {
+                //Expand the partition once, later runs read the cached copy
+                if (cacheHasImage(&cache, part))
+                {
+                        dprintf("\nUsing cached image %s\n\n", cache.image);
+                }
+                else
+                {
+                        dmg_fork_check fork;
+
+                        dprintf("\nDecompressing DMG file into %s...\n\n", cache.image);
+                        startForkCheck(&fork, &image, &dmgTrailer);
+                        if (cacheStoreImage(&cache, part, &image) < 0)
+                                result = 1;
+                        forkMismatch = reportForkCheck(&fork);
+                }
+
+                if (result == 0)
+                        result = runParser(cache.image, APFS_PARTITION_AUTO) || forkMismatch;
+        }
+        else
+        {
+                result = runParser(argv[1], (int)(part - partitions.Partitions));
+        }
+
+        freePartitionTable(&partitions);
+        STATS_ADD(STATS_SYSCALLS, image.syscalls);
+        closeImageFile(&image);
+
+        printf("\n");
+
+        return result;
+}
@@ -0,0 +1,483 @@
+// apfsspy-fuse.c : Mounts an APFS volume from a DMG (or a raw image) read-only.
+//
+//   Built on libapfsspy with the FUSE low-level API, so requests arrive keyed
+//   by inode number and map straight onto the volume's FS tree. Chunks of the
+//   DMG are inflated only when a block inside them is read. The session runs
+//   single-threaded: the library context is used by one thread at a time.
+
+#define FUSE_USE_VERSION 34
+#include <fuse_lowlevel.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <limits.h>
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include "libapfsspy.h"
+
+#define FUSE_ATTR_TIMEOUT       86400.0 // The image never changes under the mount
+#define INODE_CACHE_SLOTS       65536
+#define NEGATIVE_CACHE_SLOTS    4096
+#define NEGATIVE_NAME_LEN       256     // Longer names are not cached
+
+/* Direct mapped cache of inode attributes */
+typedef struct {
+        uint64_t ino;                   // 0 for an empty slot
+        apfs_stat_t st;
+} inode_slot;
+
+/* Direct mapped cache of names known not to exist in a directory */
+typedef struct {
+        uint64_t parent;                // 0 for an empty slot
+        char name[NEGATIVE_NAME_LEN];
+} negative_slot;
+
+/* A directory listing, taken at opendir so readdir offsets stay stable */
+typedef struct {
+        struct {
+                uint64_t ino;
+                uint16_t type;
+                char *name;
+        } *entries;
+        uint32_t count;
+        uint32_t capacity;
+} dir_listing;
+
+typedef struct {
+        apfs_ctx *ctx;
+        apfs_volume *volume;
+        inode_slot *inodes;
+        negative_slot *negatives;
+        uint64_t inodeHits;
+        uint64_t negativeHits;
+} mount_state;
+
+static int fuseError(int ret)
+{
+        switch (ret) {
+                case APFS_ENOENT:       return ENOENT;
+                case APFS_ENOTDIR:      return ENOTDIR;
+                case APFS_EISDIR:       return EISDIR;
+                case APFS_ENOMEM:       return ENOMEM;
+                case APFS_EINVAL:       return EINVAL;
+                case APFS_EUNSUPPORTED: return EOPNOTSUPP;
+                default:                return EIO;
+        }
+}
+
+// FUSE calls the root 1, APFS calls it 2; inode 1 is the root's parent and never shows up below it
+static uint64_t apfsIno(fuse_ino_t ino)
+{
+        return ino == FUSE_ROOT_ID ? APFS_ROOT_INO : ino;
+}
+
+static fuse_ino_t fuseIno(uint64_t ino)
+{
+        return ino == APFS_ROOT_INO ? FUSE_ROOT_ID : ino;
+}
+
+static uint64_t hashName(uint64_t parent, const char *name)
+{
+        uint64_t hash = 1469598103934665603ULL ^ parent;
+
+        while (*name)
+                hash = (hash ^ (unsigned char)*name++) * 1099511628211ULL;
+        return hash;
+}
+
+static int statInode(mount_state *state, uint64_t ino, apfs_stat_t *st)
+{
+        inode_slot *slot = &state->inodes[ino % INODE_CACHE_SLOTS];
+        int ret;
+
+        if (slot->ino == ino) {
+                state->inodeHits++;
+                *st = slot->st;
+                return APFS_OK;
+        }
+
+        if ((ret = apfs_stat(state->volume, ino, st)) < 0)
+                return ret;
+
+        slot->ino = ino;
+        slot->st = *st;
+        return APFS_OK;
+}
+
+static void fillStat(const apfs_stat_t *in, struct stat *out)
+{
+        memset(out, 0, sizeof(*out));
+        out->st_ino = fuseIno(in->ino);
+        out->st_mode = in->mode;
+        out->st_nlink = S_ISDIR(in->mode) ? 2 : (in->nlink ? in->nlink : 1);
+        out->st_uid = in->uid;
+        out->st_gid = in->gid;
+        out->st_size = in->size;
+        out->st_blksize = 4096;
+        out->st_blocks = (in->alloced_size + 511) / 512;
+        out->st_atim.tv_sec = in->access_time / 1000000000ULL;
+        out->st_atim.tv_nsec = in->access_time % 1000000000ULL;
+        out->st_mtim.tv_sec = in->mod_time / 1000000000ULL;
+        out->st_mtim.tv_nsec = in->mod_time % 1000000000ULL;
+        out->st_ctim.tv_sec = in->change_time / 1000000000ULL;
+        out->st_ctim.tv_nsec = in->change_time % 1000000000ULL;
+}
+
+/*
+ * Resolves one name. Misses are remembered in the negative dentry cache
+ * and also handed to the kernel as a negative entry (inode 0) so repeated
+ * probes for missing files (e.g. by a shell's PATH search) stay cheap.
+ */
+static void fsLookup(fuse_req_t req, fuse_ino_t parent, const char *name)
+{
+        mount_state *state = (mount_state*)fuse_req_userdata(req);
+        negative_slot *negative = &state->negatives[hashName(parent, name) % NEGATIVE_CACHE_SLOTS];
+        struct fuse_entry_param entry;
+        apfs_stat_t st;
+        uint64_t ino;
+        int ret;
+
+        memset(&entry, 0, sizeof(entry));
+        entry.attr_timeout = FUSE_ATTR_TIMEOUT;
+        entry.entry_timeout = FUSE_ATTR_TIMEOUT;
+
+        if (negative->parent == parent && strcmp(negative->name, name) == 0) {
+                state->negativeHits++;
+                fuse_reply_entry(req, &entry);
+                return;
+        }
+
+        ret = apfs_lookup(state->volume, apfsIno(parent), name, &ino);
+        if (ret == APFS_ENOENT) {
+                if (strlen(name) < NEGATIVE_NAME_LEN) {
+                        negative->parent = parent;
+                        strcpy(negative->name, name);
+                }
+                fuse_reply_entry(req, &entry);
+                return;
+        }
+
+        if (ret < 0 || (ret = statInode(state, ino, &st)) < 0) {
+                fuse_reply_err(req, fuseError(ret));
+                return;
+        }
+
+        entry.ino = fuseIno(ino);
+        fillStat(&st, &entry.attr);
+        fuse_reply_entry(req, &entry);
+}
+
+static void fsGetattr(fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi)
+{
+        mount_state *state = (mount_state*)fuse_req_userdata(req);
+        struct stat attr;
+        apfs_stat_t st;
+        int ret;
+
+        (void)fi;
+
+        if ((ret = statInode(state, apfsIno(ino), &st)) < 0) {
+                fuse_reply_err(req, fuseError(ret));
+                return;
+        }
+
+        fillStat(&st, &attr);
+        fuse_reply_attr(req, &attr, FUSE_ATTR_TIMEOUT);
+}
+
+// A symlink's target is the value of its com.apple.fs.symlink attribute, NUL included
+static void fsReadlink(fuse_req_t req, fuse_ino_t ino)
+{
+        mount_state *state = (mount_state*)fuse_req_userdata(req);
+        char target[PATH_MAX + 1];
+        int64_t got;
+
+        if ((got = apfs_getxattr(state->volume, apfsIno(ino), APFS_SYMLINK_XATTR, target, PATH_MAX)) < 0) {
+                fuse_reply_err(req, got == APFS_ENOENT ? EINVAL : fuseError((int)got));
+                return;
+        }
+        if (got > PATH_MAX) {
+                fuse_reply_err(req, ENAMETOOLONG);
+                return;
+        }
+
+        target[got] = '\0';
+        fuse_reply_readlink(req, target);
+}
+
+static int listingAdd(dir_listing *listing, uint64_t ino, uint16_t type, const char *name)
+{
+        if (listing->count == listing->capacity) {
+                uint32_t capacity = listing->capacity ? listing->capacity * 2 : 64;
+                void *grown = realloc(listing->entries, capacity * sizeof(*listing->entries));
+
+                if (grown == NULL)
+                        return APFS_ENOMEM;
+                listing->entries = grown;
+                listing->capacity = capacity;
+        }
+
+        if ((listing->entries[listing->count].name = strdup(name)) == NULL)
+                return APFS_ENOMEM;
+
+        listing->entries[listing->count].ino = ino;
+        listing->entries[listing->count].type = type;
+        listing->count++;
+        return APFS_OK;
+}
+
+static int listingCallback(const apfs_dirent *entry, void *arg)
+{
+        return listingAdd((dir_listing*)arg, fuseIno(entry->ino), entry->type, entry->name) < 0;
+}
+
+static void listingFree(dir_listing *listing)
+{
+        for (uint32_t i = 0; i < listing->count; ++i)
+                free(listing->entries[i].name);
+        free(listing->entries);
+        free(listing);
+}
+
+static void fsOpendir(fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi)
+{
+        mount_state *state = (mount_state*)fuse_req_userdata(req);
+        dir_listing *listing = (dir_listing*)calloc(1, sizeof(dir_listing));
+        apfs_stat_t st;
+        int ret;
+
+        if (listing == NULL) {
+                fuse_reply_err(req, ENOMEM);
+                return;
+        }
+
+        if ((ret = statInode(state, apfsIno(ino), &st)) < 0 ||
+            (ret = listingAdd(listing, ino, DT_DIR, ".")) < 0 ||
+            (ret = listingAdd(listing, fuseIno(st.parent_ino), DT_DIR, "..")) < 0 ||
+            (ret = apfs_readdir(state->volume, apfsIno(ino), listingCallback, listing)) < 0) {
+                listingFree(listing);
+                fuse_reply_err(req, fuseError(ret));
+                return;
+        }
+
+        fi->fh = (uint64_t)(uintptr_t)listing;
+        fi->keep_cache = 1;
+        fuse_reply_open(req, fi);
+}
+
+static void fsReaddir(fuse_req_t req, fuse_ino_t ino, size_t size, off_t off, struct fuse_file_info *fi)
+{
+        dir_listing *listing = (dir_listing*)(uintptr_t)fi->fh;
+        char *buffer = (char*)malloc(size);
+        size_t used = 0;
+
+        (void)ino;
+
+        if (buffer == NULL) {
+                fuse_reply_err(req, ENOMEM);
+                return;
+        }
+
+        // The offset handed back for an entry is the index of the next one
+        for (uint32_t i = off; i < listing->count; ++i) {
+                struct stat attr;
+                size_t len;
+
+                memset(&attr, 0, sizeof(attr));
+                attr.st_ino = listing->entries[i].ino;
+                attr.st_mode = (uint32_t)listing->entries[i].type << 12;
+
+                len = fuse_add_direntry(req, buffer + used, size - used, listing->entries[i].name, &attr, i + 1);
+                if (len > size - used)
+                        break;
+                used += len;
+        }
+
+        fuse_reply_buf(req, buffer, used);
+        free(buffer);
+}
+
+static void fsReleasedir(fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi)
+{
+        (void)ino;
+
+        listingFree((dir_listing*)(uintptr_t)fi->fh);
+        fuse_reply_err(req, 0);
+}
+
+static void fsOpen(fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi)
+{
+        mount_state *state = (mount_state*)fuse_req_userdata(req);
+        apfs_file *file;
+        int ret;
+
+        if ((fi->flags & O_ACCMODE) != O_RDONLY) {
+                fuse_reply_err(req, EROFS);
+                return;
+        }
+
+        // The extent map is loaded here once, every read of this handle searches it
+        if ((ret = apfs_file_open(state->volume, apfsIno(ino), &file)) < 0) {
+                fuse_reply_err(req, fuseError(ret));
+                return;
+        }
+
+        fi->fh = (uint64_t)(uintptr_t)file;
+        fi->keep_cache = 1;
+        fuse_reply_open(req, fi);
+}
+
+static void fsRead(fuse_req_t req, fuse_ino_t ino, size_t size, off_t off, struct fuse_file_info *fi)
+{
+        apfs_file *file = (apfs_file*)(uintptr_t)fi->fh;
+        char *buffer = (char*)malloc(size ? size : 1);
+        int64_t got;
+
+        (void)ino;
+
+        if (buffer == NULL) {
+                fuse_reply_err(req, ENOMEM);
+                return;
+        }
+
+        if ((got = apfs_pread(file, buffer, size, off)) < 0)
+                fuse_reply_err(req, fuseError((int)got));
+        else
+                fuse_reply_buf(req, buffer, got);
+
+        free(buffer);
+}
+
+static void fsRelease(fuse_req_t req, fuse_ino_t ino, struct fuse_file_info *fi)
+{
+        (void)ino;
+
+        apfs_file_close((apfs_file*)(uintptr_t)fi->fh);
+        fuse_reply_err(req, 0);
+}
+
+static void fsStatfs(fuse_req_t req, fuse_ino_t ino)
+{
+        mount_state *state = (mount_state*)fuse_req_userdata(req);
+        apfs_container_info info;
+        struct statvfs stats;
+
+        (void)ino;
+
+        apfs_container_info_get(state->ctx, &info);
+        memset(&stats, 0, sizeof(stats));
+        stats.f_bsize = info.block_size;
+        stats.f_frsize = info.block_size;
+        stats.f_blocks = info.block_count;
+        stats.f_namemax = 255;
+        stats.f_flag = ST_RDONLY;
+
+        fuse_reply_statfs(req, &stats);
+}
+
+static const struct fuse_lowlevel_ops operations = {
+        .lookup         = fsLookup,
+        .getattr        = fsGetattr,
+        .readlink       = fsReadlink,
+        .opendir        = fsOpendir,
+        .readdir        = fsReaddir,
+        .releasedir     = fsReleasedir,
+        .open           = fsOpen,
+        .read           = fsRead,
+        .release        = fsRelease,
+        .statfs         = fsStatfs,
+};
+
+static void fuseUsage(char *name)
+{
+        printf("Usage :\n\n%s <DMG_FILE> <mountpoint> {Options} [FUSE options]\n \
+                        -p <Partition_ID>       Selects the partition (default: first Apple_APFS)\n \
+                        -v <Volume_ID>          Mounts the volume with this OID (default: the first one)\n \
+                        -f                      Stays in the foreground\n", name);
+}
+
+/*
+ * Opens the image and the volume, then hands the remaining arguments (the
+ * mountpoint and any FUSE options) to libfuse. The mount is always read-only.
+ */
+int main(int argc, char **argv)
+{
+        struct fuse_args fuseArgs = FUSE_ARGS_INIT(0, NULL);
+        struct fuse_cmdline_opts opts;
+        struct fuse_session *session;
+        mount_state state;
+        apfs_volume_info info;
+        int partition = APFS_PARTITION_AUTO, ret = 1;
+        uint64_t volumeOid = 0;
+        uint32_t index = 0;
+
+        memset(&state, 0, sizeof(state));
+        memset(&opts, 0, sizeof(opts));
+
+        if (argc < 3) {
+                fuseUsage(argv[0]);
+                return 1;
+        }
+
+        fuse_opt_add_arg(&fuseArgs, argv[0]);
+        for (int i = 2; i < argc; ++i) {
+                if (strcmp(argv[i], "-p") == 0 && i + 1 < argc)
+                        partition = atoi(argv[++i]);
+                else if (strcmp(argv[i], "-v") == 0 && i + 1 < argc)
+                        volumeOid = strtoull(argv[++i], NULL, 10);
+                else
+                        fuse_opt_add_arg(&fuseArgs, argv[i]);
+        }
+        fuse_opt_add_arg(&fuseArgs, "-oro,fsname=apfsspy,subtype=apfs");
+
+        if (fuse_parse_cmdline(&fuseArgs, &opts) != 0 || opts.mountpoint == NULL) {
+                fuseUsage(argv[0]);
+                fuse_opt_free_args(&fuseArgs);
+                return 1;
+        }
+
+        if ((ret = apfs_open(argv[1], partition, &state.ctx)) < 0) {
+                printf("Unable to open %s: %s\n", argv[1], apfs_strerror(ret));
+                goto end;
+        }
+
+        if (volumeOid) {
+                while ((ret = apfs_volume_info_get(state.ctx, index, &info)) == 0 && info.oid != volumeOid)
+                        index++;
+        }
+
+        state.inodes = (inode_slot*)calloc(INODE_CACHE_SLOTS, sizeof(inode_slot));
+        state.negatives = (negative_slot*)calloc(NEGATIVE_CACHE_SLOTS, sizeof(negative_slot));
+        if (ret < 0 || (ret = apfs_volume_open(state.ctx, index, &state.volume)) < 0 ||
+            state.inodes == NULL || state.negatives == NULL) {
+                printf("Unable to open the volume: %s\n", apfs_strerror(ret < 0 ? ret : APFS_ENOMEM));
+                goto end;
+        }
+
+        ret = 1;
+        if ((session = fuse_session_new(&fuseArgs, &operations, sizeof(operations), &state)) == NULL)
+                goto end;
+
+        if (fuse_set_signal_handlers(session) == 0) {
+                if (fuse_session_mount(session, opts.mountpoint) == 0) {
+                        fuse_daemonize(opts.foreground);
+                        ret = fuse_session_loop(session) ? 1 : 0;
+                        fuse_session_unmount(session);
+                }
+                fuse_remove_signal_handlers(session);
+        }
+        fuse_session_destroy(session);
+
+end:
+        apfs_volume_close(state.volume);
+        apfs_close(state.ctx);
+        free(state.inodes);
+        free(state.negatives);
+        free(opts.mountpoint);
+        fuse_opt_free_args(&fuseArgs);
+
+        return ret < 0 ? 1 : ret;
+}
@@ -12,22 +12,29 @@ static char encoding_table[] = { 'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H',
                                 'w', 'x', 'y', 'z', '0', '1', '2', '3',
                                 '4', '5', '6', '7', '8', '9', '+', '/' };
 
-static char* decoding_table = NULL;
+// Sextet of every byte, BAD for those outside the alphabet
+#define BAD 0xff
+static const unsigned char decoding_table[256] = {
+        BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD,
+        BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD,
+        BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD,  62, BAD, BAD, BAD,  63,
+         52,  53,  54,  55,  56,  57,  58,  59,  60,  61, BAD, BAD, BAD, BAD, BAD, BAD,
+        BAD,   0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,
+         15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25, BAD, BAD, BAD, BAD, BAD,
+        BAD,  26,  27,  28,  29,  30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,
+         41,  42,  43,  44,  45,  46,  47,  48,  49,  50,  51, BAD, BAD, BAD, BAD, BAD,
+        BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD,
+        BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD,
+        BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD,
+        BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD,
+        BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD,
+        BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD,
+        BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD,
+        BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD, BAD
+};
+#undef BAD
 static int mod_table[] = { 0, 2, 1 };
 
-void build_decoding_table() {
-
-    decoding_table = (char*)malloc(256);
-
-    for (int i = 0; i < 64; i++)
-        decoding_table[(unsigned char)encoding_table[i]] = i;
-}
-
-
-void base64_cleanup() {
-    free(decoding_table);
-}
-
 char* base64_encode(const char* data,
     size_t input_length,
     size_t* output_length) {
@@ -62,8 +69,6 @@ char* base64_encode(const char* data,
     size_t input_length,
     size_t* output_length) {
 
-    if (decoding_table == NULL) build_decoding_table();
-
     if (input_length % 4 != 0) return NULL;
 
     *output_length = input_length / 4 * 3;
@@ -75,19 +80,69 @@ char* base64_encode(const char* data,
 
     for (int i = 0, j = 0; i < input_length;) {
 
-        uint32_t sextet_a = data[i] == '=' ? 0 & i++ : decoding_table[data[i++]];
-        uint32_t sextet_b = data[i] == '=' ? 0 & i++ : decoding_table[data[i++]];
-        uint32_t sextet_c = data[i] == '=' ? 0 & i++ : decoding_table[data[i++]];
-        uint32_t sextet_d = data[i] == '=' ? 0 & i++ : decoding_table[data[i++]];
+        uint32_t sextet_a = data[i] == '=' ? 0 & i++ : decoding_table[(unsigned char)data[i++]];
+        uint32_t sextet_b = data[i] == '=' ? 0 & i++ : decoding_table[(unsigned char)data[i++]];
+        uint32_t sextet_c = data[i] == '=' ? 0 & i++ : decoding_table[(unsigned char)data[i++]];
+        uint32_t sextet_d = data[i] == '=' ? 0 & i++ : decoding_table[(unsigned char)data[i++]];
 
         uint32_t triple = (sextet_a << 3 * 6)
             + (sextet_b << 2 * 6)
             + (sextet_c << 1 * 6)
             + (sextet_d << 0 * 6);
 
+        // Reject bytes outside the alphabet rather than decode them as bits
+        if ((sextet_a | sextet_b | sextet_c | sextet_d) > 63) {
+            free(decoded_data);
+            return NULL;
+        }
+
         if (j < *output_length) decoded_data[j++] = (triple >> 2 * 8) & 0xFF;
         if (j < *output_length) decoded_data[j++] = (triple >> 1 * 8) & 0xFF;
         if (j < *output_length) decoded_data[j++] = (triple >> 0 * 8) & 0xFF;
     }
     return decoded_data;
 }
+
+
+// Decodes base64 text that may be broken up by whitespace (as in plist <data>
+// elements) directly into the output buffer, without a stripped copy. Bytes
+// outside the alphabet are skipped.
+// The output must hold at least input_length / 4 * 3 + 3 bytes.
+size_t base64_decode_ws(const char* data,
+    size_t input_length,
+    unsigned char* decoded_data) {
+
+    uint32_t triple = 0;
+    int sextets = 0;
+    size_t j = 0;
+
+    for (size_t i = 0; i < input_length; i++) {
+        unsigned char c = data[i];
+
+        if (c == '=')
+            break;
+        // Whitespace and any other byte outside the alphabet carry no bits
+        if (decoding_table[c] > 63)
+            continue;
+
+        triple = (triple << 6) | decoding_table[c];
+
+        if (++sextets == 4) {
+            decoded_data[j++] = (triple >> 2 * 8) & 0xFF;
+            decoded_data[j++] = (triple >> 1 * 8) & 0xFF;
+            decoded_data[j++] = (triple >> 0 * 8) & 0xFF;
+            triple = 0;
+            sextets = 0;
+        }
+    }
+
+    // Trailing group: two sextets give one byte, three give two
+    if (sextets == 2) {
+        decoded_data[j++] = (triple >> 4) & 0xFF;
+    } else if (sextets == 3) {
+        decoded_data[j++] = (triple >> 10) & 0xFF;
+        decoded_data[j++] = (triple >> 2) & 0xFF;
+    }
+
+    return j;
+}
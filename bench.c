@@ -0,0 +1,338 @@
+// bench.c : Times the stages of APFSpy on DMG images and reports them as JSON.
+//
+//   Every stage is run separately so a regression can be pinned to one of
+//   them: trailer and plist parsing, inflating the APFS partition, inode
+//   lookups, the FS-Tree walk and file extraction. The last three read the
+//   expanded partition through libapfsspy and apfs.c, without the CLI in
+//   apfspy.c, and console output is sent to /dev/null while a stage is being
+//   timed.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <ftw.h>
+#include <time.h>
+#include <unistd.h>
+#include <limits.h>
+#include <sys/stat.h>
+#include "dmgParser.h"
+#include "apfs.h"
+#include "crc32.h"
+#include "inflate.h"
+#include "stats.h"
+#include "libapfsspy.h"
+
+#define BENCH_DEFAULT_RUNS      5
+#define BENCH_MAX_INODES        (1 << 20)
+
+/* Best and mean wall time of one stage over all runs */
+typedef struct {
+        double best;
+        double total;
+        int runs;
+} bench_timer;
+
+/* Inode numbers of the first volume, looked up one by one in the lookup stage */
+typedef struct {
+        apfs_ctx *ctx;
+        apfs_volume *volume;
+        uint64_t *inos;
+        uint32_t count;
+} bench_inodes;
+
+// Parser options, owned by apfspy.c in the CLI
+command_line_args args;
+
+static int quiet = -1, console = -1;
+
+static double now(void)
+{
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void timerAdd(bench_timer *timer, double seconds)
+{
+        if (timer->runs == 0 || seconds < timer->best)
+                timer->best = seconds;
+        timer->total += seconds;
+        timer->runs++;
+}
+
+// The parser reports on stdout; keep it out of the timings and the JSON
+static void silence(void)
+{
+        fflush(stdout);
+        dup2(quiet, STDOUT_FILENO);
+}
+
+static void restore(void)
+{
+        fflush(stdout);
+        dup2(console, STDOUT_FILENO);
+}
+
+static void printTimer(FILE *out, const char *name, bench_timer *timer, const char *unit, double amount, int last)
+{
+        double mean = timer->runs ? timer->total / timer->runs : 0;
+
+        fprintf(out, "      \"%s\": { \"best_s\": %.6f, \"mean_s\": %.6f, \"runs\": %d", name, timer->best, mean, timer->runs);
+        if (unit != NULL)
+                fprintf(out, ", \"%s\": %.1f", unit, timer->best > 0 ? amount / timer->best : 0);
+        fprintf(out, " }%s\n", last ? "" : ",");
+}
+
+static int removeEntry(const char *path, const struct stat *st, int flag, struct FTW *ftw)
+{
+        return remove(path);
+}
+
+static int collectInode(const apfs_object *obj, void *arg)
+{
+        bench_inodes *inodes = (bench_inodes*)arg;
+
+        if (inodes->count < BENCH_MAX_INODES)
+                inodes->inos[inodes->count++] = obj->st.ino;
+        return 0;
+}
+
+// Opens the first volume of the expanded image and lists its inodes once, the timed runs only look them up
+static int openInodes(bench_inodes *inodes, const char *image)
+{
+        memset(inodes, 0, sizeof(*inodes));
+
+        if (apfs_open(image, APFS_PARTITION_AUTO, &inodes->ctx) < 0 ||
+            apfs_volume_open(inodes->ctx, 0, &inodes->volume) < 0 ||
+            (inodes->inos = malloc(BENCH_MAX_INODES * sizeof(uint64_t))) == NULL)
+                return -1;
+
+        return apfs_walk(inodes->volume, collectInode, inodes) < 0 ? -1 : 0;
+}
+
+static void closeInodes(bench_inodes *inodes)
+{
+        apfs_volume_close(inodes->volume);
+        apfs_close(inodes->ctx);
+        free(inodes->inos);
+}
+
+// Opens the expanded image and runs parse_APFS on it, as the CLI does
+static int parseImage(const char *image)
+{
+        apfs_ctx *ctx;
+        int ret;
+
+        if ((ret = apfs_open(image, APFS_PARTITION_AUTO, &ctx)) < 0)
+                return ret;
+        ret = parse_APFS(ctx);
+        apfs_close(ctx);
+
+        return ret;
+}
+
+/*
+   Input Parameters: char*, int, FILE*, int*
+   Return Type:      int
+Description: Runs every stage on one DMG and appends its JSON object to out,
+counting the objects written so far in printed.
+
+ */
+static int benchImage(char *dmgPath, int runs, FILE *out, int *printed)
+{
+        bench_timer parse = {0}, inflate = {0}, lookup = {0}, walk = {0}, extract = {0};
+        char workDir[] = "/tmp/apfspy-bench.XXXXXX";
+        char image[PATH_MAX], extractDir[PATH_MAX];
+        dmg_image dmg;
+        UDIFResourceFile dmgTrailer;
+        dmg_partition_table partitions;
+        dmg_partition *part;
+        bench_inodes inodes;
+        const char *plist;
+        int cwd, ret = -1;
+
+        if (mkdtemp(workDir) == NULL || (cwd = open(".", O_RDONLY)) < 0) {
+                fprintf(stderr, "Unable to create a work directory\n");
+                return -1;
+        }
+        snprintf(image, sizeof(image), "%s/apfs.img", workDir);
+
+        silence();
+
+        // Trailer and plist
+        for (int run = 0; run < runs; ++run) {
+                double start = now();
+
+                if (readImageFile(&dmg, dmgPath) < 0)
+                        goto end;
+                if (parseDMGTrailer(&dmg, &dmgTrailer) < 0 || (plist = readXMLOffset(&dmg, &dmgTrailer)) == NULL ||
+                    buildPartitionTable(plist, be64toh(dmgTrailer.XMLLength), &partitions) < 0) {
+                        closeImageFile(&dmg);
+                        goto end;
+                }
+
+                timerAdd(&parse, now() - start);
+
+                if (run + 1 < runs) {
+                        freePartitionTable(&partitions);
+                        closeImageFile(&dmg);
+                }
+        }
+
+        if ((part = findPartitionByName(&partitions, "Apple_APFS")) == NULL)
+                goto close;
+
+        // Expanding the APFS partition to a file
+        for (int run = 0; run < runs; ++run) {
+                double start = now();
+
+                if (readDataBlks(part, &dmg, image, NULL) < 0)
+                        goto close;
+                timerAdd(&inflate, now() - start);
+        }
+
+        // Inode lookups, each one through the omap and the FS-Tree
+        if (openInodes(&inodes, image) < 0) {
+                closeInodes(&inodes);
+                goto close;
+        }
+
+        for (int run = 0; run < runs; ++run) {
+                apfs_stat_t st;
+                double start = now();
+
+                for (uint32_t i = 0; i < inodes.count; ++i)
+                        apfs_stat(inodes.volume, inodes.inos[i], &st);
+                timerAdd(&lookup, now() - start);
+        }
+
+        closeInodes(&inodes);
+
+        // FS-Tree walk, listing only
+        args.volume = 1;
+        args.volume_ID = 1026;
+        for (int run = 0; run < runs; ++run) {
+                double start;
+
+                args.fs_structure = 1;
+
+                start = now();
+                if (parseImage(image) < 0)
+                        goto close;
+                timerAdd(&walk, now() - start);
+        }
+
+        // Extraction, each run into an empty directory
+        for (int run = 0; run < runs; ++run) {
+                double start;
+
+                snprintf(extractDir, sizeof(extractDir), "%s/extract", workDir);
+                if (mkdir(extractDir, S_IRWXU) == -1 || chdir(extractDir) == -1)
+                        goto close;
+
+                args.fs_structure = 2;
+
+                start = now();
+                if (parseImage(image) < 0)
+                        goto close;
+                timerAdd(&extract, now() - start);
+
+                if (fchdir(cwd) == -1)
+                        goto close;
+                nftw(extractDir, removeEntry, 16, FTW_DEPTH | FTW_PHYS);
+        }
+
+        ret = 0;
+
+close:
+        freePartitionTable(&partitions);
+        closeImageFile(&dmg);
+end:
+        restore();
+
+        if (fchdir(cwd) == -1)
+                ret = -1;
+        close(cwd);
+        nftw(workDir, removeEntry, 16, FTW_DEPTH | FTW_PHYS);
+
+        if (ret < 0) {
+                fprintf(stderr, "Benchmark of %s failed\n", dmgPath);
+                return -1;
+        }
+
+        fprintf(out, "%s    {\n", (*printed)++ ? ",\n" : "");
+        fprintf(out, "      \"image\": ");
+        printJsonString(out, dmgPath);
+        fprintf(out, ",\n");
+        fprintf(out, "      \"dmg_bytes\": %lu,\n", dmg.size);
+        fprintf(out, "      \"stored_bytes\": %lu,\n", part->CompressedBytes);
+        fprintf(out, "      \"expanded_bytes\": %lu,\n", part->SectorCount * SECTOR_SIZE);
+        fprintf(out, "      \"chunks\": %u,\n", part->NumberOfChunks);
+        fprintf(out, "      \"inodes\": %u,\n", inodes.count);
+        printTimer(out, "parse", &parse, NULL, 0, 0);
+        printTimer(out, "inflate", &inflate, "expanded_mb_s", part->SectorCount * SECTOR_SIZE / 1e6, 0);
+        printTimer(out, "inode_lookup", &lookup, "lookups_s", inodes.count, 0);
+        printTimer(out, "fs_walk", &walk, NULL, 0, 0);
+        printTimer(out, "extract", &extract, NULL, 0, 1);
+        fprintf(out, "    }");
+
+        return 0;
+}
+
+static void benchUsage(char *prog)
+{
+        printf("Usage :\n\n%s <DMG_FILE>... {Options}\n \
+                        -r <runs>               Runs per stage (default %d)\n \
+                        -o <file>               Writes the JSON results to file instead of stdout\n", prog, BENCH_DEFAULT_RUNS);
+}
+
+int main(int argc, char **argv)
+{
+        int runs = BENCH_DEFAULT_RUNS, opt, failures = 0, printed = 0;
+        FILE *out = stdout;
+        char *outPath = NULL;
+
+        while ((opt = getopt(argc, argv, "r:o:h")) != -1) {
+                switch (opt) {
+                        case 'r': runs = atoi(optarg); break;
+                        case 'o': outPath = optarg; break;
+                        default:
+                                benchUsage(argv[0]);
+                                return 1;
+                }
+        }
+
+        if (optind >= argc || runs < 1) {
+                benchUsage(argv[0]);
+                return 1;
+        }
+
+        if ((quiet = open("/dev/null", O_WRONLY)) < 0 || (console = dup(STDOUT_FILENO)) < 0) {
+                fprintf(stderr, "Unable to redirect the parser output\n");
+                return 1;
+        }
+
+        if (outPath != NULL && (out = fopen(outPath, "w")) == NULL) {
+                fprintf(stderr, "Unable to create %s\n", outPath);
+                return 1;
+        }
+
+        fprintf(out, "{\n");
+        fprintf(out, "  \"inflate_backend\": \"%s\",\n", inflateBackendName());
+        fprintf(out, "  \"crc32\": \"%s\",\n", crc32Implementation());
+        fprintf(out, "  \"runs\": %d,\n", runs);
+        fprintf(out, "  \"results\": [\n");
+
+        for (int i = optind; i < argc; ++i)
+                failures += benchImage(argv[i], runs, out, &printed) < 0;
+
+        fprintf(out, "\n  ]\n}\n");
+
+        if (out != stdout)
+                fclose(out);
+
+        return failures ? 1 : 0;
+}
@@ -0,0 +1,130 @@
+// cache.c : On-disk cache of expanded partitions.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <limits.h>
+#include <sys/stat.h>
+#include "cache.h"
+#include "stats.h"
+
+#define CACHE_COPY_BUFFER       (1 << 20)
+
+/*
+   Input Parameters: dmg_cache*, char*, dmg_image*, UDIFResourceFile*, dmg_partition*
+   Return Type:      int
+Description: Creates the cache directory if needed and derives the entry
+paths for the given partition of the image.
+
+ */
+int openCache(dmg_cache *cache, const char *dir, dmg_image *image, UDIFResourceFile *dmgTrailer, dmg_partition *part)
+{
+        char segment[33];
+
+        memset(cache, 0, sizeof(*cache));
+
+        if (mkdir(dir, S_IRWXU) == -1 && errno != EEXIST) {
+                printf("Unable to create cache directory %s [%s]\n", dir, strerror(errno));
+                return -1;
+        }
+
+        // Extraction changes the working directory, keep absolute paths
+        if (realpath(dir, cache->dir) == NULL) {
+                printf("Unable to resolve cache directory %s [%s]\n", dir, strerror(errno));
+                return -1;
+        }
+
+        for (int i = 0; i < 16; ++i)
+                snprintf(segment + 2 * i, 3, "%02x", dmgTrailer->SegmentID[i]);
+
+        snprintf(cache->key, sizeof(cache->key), "%s-%lu-%ld-p%u", segment, image->size, image->mtime, part->ID);
+        snprintf(cache->image, sizeof(cache->image), "%s/%s.img", cache->dir, cache->key);
+
+        return 0;
+}
+
+// An entry is only trusted if it has the exact size of the expanded partition
+int cacheHasImage(dmg_cache *cache, dmg_partition *part)
+{
+        struct stat st;
+        int hit = stat(cache->image, &st) == 0 && (uint64_t)st.st_size == part->SectorCount * SECTOR_SIZE;
+
+        STATS_ADD(hit ? STATS_CACHE_HITS : STATS_CACHE_MISSES, 1);
+        return hit;
+}
+
+/*
+ * Expands the partition into the cache
+ *
+ * The image is written under a temporary name and renamed into place once
+ * complete, so an interrupted run never leaves a truncated entry behind.
+ */
+int cacheStoreImage(dmg_cache *cache, dmg_partition *part, dmg_image *image)
+{
+        char tmp[CACHE_PATH_LEN + 16];
+        int ret;
+
+        snprintf(tmp, sizeof(tmp), "%s.%d.tmp", cache->image, getpid());
+
+        if ((ret = readDataBlks(part, image, tmp, NULL)) < 0 || rename(tmp, cache->image) == -1) {
+                printf("Unable to store %s in the cache: %s\n", cache->key, ret < 0 ? dmgStrerror(ret) : strerror(errno));
+                unlink(tmp);
+                return -1;
+        }
+
+        return 0;
+}
+
+// Copies from offset to the end of in through a buffer, for file systems
+// that copy_file_range does not support
+static int copyBuffered(int in, int out, off_t offset)
+{
+        uint8_t *buffer = malloc(CACHE_COPY_BUFFER);
+        ssize_t got;
+
+        if (buffer == NULL)
+                return -1;
+
+        while ((got = pread(in, buffer, CACHE_COPY_BUFFER, offset)) > 0) {
+                for (ssize_t done = 0, written; done < got; done += written)
+                        if ((written = pwrite(out, buffer + done, got - done, offset + done)) <= 0) {
+                                free(buffer);
+                                return -1;
+                        }
+                offset += got;
+        }
+
+        free(buffer);
+        return got == 0 ? 0 : -1;
+}
+
+// Copies a cached partition to the given file without touching the DMG
+int copyCachedImage(dmg_cache *cache, const char *filename)
+{
+        int in = -1, out = -1, ret = -1;
+        loff_t inOffset = 0, outOffset = 0;
+        ssize_t copied;
+
+        if ((in = open(cache->image, O_RDONLY)) < 0 ||
+            (out = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0) {
+                printf("Unable to copy %s to %s\n", cache->image, filename);
+                goto end;
+        }
+
+        while ((copied = copy_file_range(in, &inOffset, out, &outOffset, 1 << 30, 0)) > 0)
+                ;
+        if (copied < 0 && (errno == EXDEV || errno == ENOSYS || errno == EINVAL || errno == EOPNOTSUPP))
+                copied = copyBuffered(in, out, inOffset);
+        ret = copied == 0 ? 0 : -1;
+
+end:
+        if (in >= 0)
+                close(in);
+        if (out >= 0)
+                close(out);
+        return ret;
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include <stdint.h>
+#include "dmgParser.h"
+
+/*
+ * Persistent cache of expanded partitions.
+ *
+ * Entries live in a user supplied directory and are keyed by the DMG's
+ * identity: the koly SegmentID, the file size and its mtime, plus the
+ * partition ID. Each entry holds the expanded partition (<key>.img), so later
+ * runs on the same image read the container from it without decompressing.
+ */
+
+#define CACHE_PATH_LEN 4096
+
+typedef struct {
+        char dir[CACHE_PATH_LEN];       // Absolute path of the cache directory
+        char key[128];
+        char image[CACHE_PATH_LEN];     // <dir>/<key>.img
+} dmg_cache;
+
+int openCache(dmg_cache*, const char*, dmg_image*, UDIFResourceFile*, dmg_partition*);
+int cacheHasImage(dmg_cache*, dmg_partition*);
+int cacheStoreImage(dmg_cache*, dmg_partition*, dmg_image*);
+int copyCachedImage(dmg_cache*, const char*);
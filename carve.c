@@ -0,0 +1,378 @@
+// carve.c : Recovers data the live file system no longer references.
+//
+//   Every block of the container is read once. Blocks holding a B-tree node
+//   of an FS tree that no omap points at any more give back their inode and
+//   extent records through apfs_carve_node; blocks the space manager marks
+//   free are also searched for file signatures. Each thread opens its own
+//   context and claims runs of blocks from a shared counter, the hits are
+//   sorted by position once they have all joined.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "carve.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CARVE_HAVE_X86 1
+#endif
+
+#define CARVE_RUN_BLOCKS        256     // Blocks claimed and read at a time
+#define CARVE_MAX_THREADS       64
+
+typedef struct {
+        const char *name;
+        const uint8_t *bytes;
+        size_t len;
+} carve_signature;
+
+/* At least four bytes each, so random data rarely matches */
+static const carve_signature signatures[] = {
+        { "jpeg",   (const uint8_t*)"\xff\xd8\xff\xe0", 4 },
+        { "jpeg",   (const uint8_t*)"\xff\xd8\xff\xe1", 4 },
+        { "jpeg",   (const uint8_t*)"\xff\xd8\xff\xdb", 4 },
+        { "png",    (const uint8_t*)"\x89PNG\r\n\x1a\n", 8 },
+        { "gif",    (const uint8_t*)"GIF87a", 6 },
+        { "gif",    (const uint8_t*)"GIF89a", 6 },
+        { "pdf",    (const uint8_t*)"%PDF-", 5 },
+        { "zip",    (const uint8_t*)"PK\x03\x04", 4 },
+        { "sqlite", (const uint8_t*)"SQLite format 3", 16 },
+        { "bplist", (const uint8_t*)"bplist00", 8 },
+        { "xml",    (const uint8_t*)"<?xml ", 6 },
+        { "macho",  (const uint8_t*)"\xcf\xfa\xed\xfe", 4 },
+};
+
+#define SIGNATURE_COUNT (sizeof(signatures) / sizeof(signatures[0]))
+
+/* Nonzero for every byte a signature above starts with; keep the two in step */
+static const uint8_t signatureFirst[256] = {
+        [0xff] = 1, [0x89] = 1, ['G'] = 1, ['%'] = 1, ['P'] = 1,
+        ['S'] = 1, ['b'] = 1, ['<'] = 1, [0xcf] = 1,
+};
+
+// Reports every signature that starts at data[i]
+static int signatureVerify(const uint8_t *data, size_t len, size_t i, signature_cb callback, void *arg)
+{
+        int ret;
+
+        for (size_t s = 0; s < SIGNATURE_COUNT; ++s)
+                if (i + signatures[s].len <= len && memcmp(data + i, signatures[s].bytes, signatures[s].len) == 0 &&
+                    (ret = callback(signatures[s].name, i, arg)) != 0)
+                        return ret;
+
+        return 0;
+}
+
+static int signatureScanPortable(const uint8_t *data, size_t len, size_t from, signature_cb callback, void *arg)
+{
+        int ret;
+
+        for (size_t i = from; i < len; ++i)
+                if (signatureFirst[data[i]] && (ret = signatureVerify(data, len, i, callback, arg)) != 0)
+                        return ret;
+
+        return 0;
+}
+
+#ifdef CARVE_HAVE_X86
+/*
+ * Tests 32 positions at a time against the first two bytes of every
+ * signature at once; only positions where some pair matches are compared
+ * in full.
+ */
+__attribute__((target("avx2,bmi")))
+static int signatureScanAvx2(const uint8_t *data, size_t len, signature_cb callback, void *arg)
+{
+        __m256i firsts[SIGNATURE_COUNT], seconds[SIGNATURE_COUNT];
+        size_t i = 0;
+        int ret;
+
+        for (size_t s = 0; s < SIGNATURE_COUNT; ++s) {
+                firsts[s] = _mm256_set1_epi8((char)signatures[s].bytes[0]);
+                seconds[s] = _mm256_set1_epi8((char)signatures[s].bytes[1]);
+        }
+
+        for (; i + 33 <= len; i += 32) {
+                __m256i a = _mm256_loadu_si256((const __m256i*)(data + i));
+                __m256i b = _mm256_loadu_si256((const __m256i*)(data + i + 1));
+                __m256i hits = _mm256_setzero_si256();
+                uint32_t mask;
+
+                for (size_t s = 0; s < SIGNATURE_COUNT; ++s)
+                        hits = _mm256_or_si256(hits, _mm256_and_si256(_mm256_cmpeq_epi8(a, firsts[s]),
+                                                                      _mm256_cmpeq_epi8(b, seconds[s])));
+
+                for (mask = (uint32_t)_mm256_movemask_epi8(hits); mask; mask = _blsr_u32(mask))
+                        if ((ret = signatureVerify(data, len, i + __builtin_ctz(mask), callback, arg)) != 0)
+                                return ret;
+        }
+
+        return signatureScanPortable(data, len, i, callback, arg);
+}
+
+static int signatureAvx2(void)
+{
+        static int supported = -1;
+
+        if (supported < 0) {
+                __builtin_cpu_init();
+                supported = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("bmi");
+        }
+
+        return supported;
+}
+#endif
+
+/*
+   Input Parameters: uint8_t*, size_t, signature_cb, void*
+   Return Type:      int
+Description: Calls callback with the name and the offset of every file
+signature in the buffer, in order. The AVX2 path is used when the CPU has it.
+
+ */
+int signatureScan(const uint8_t *data, size_t len, signature_cb callback, void *arg)
+{
+#ifdef CARVE_HAVE_X86
+        if (signatureAvx2())
+                return signatureScanAvx2(data, len, callback, arg);
+#endif
+        return signatureScanPortable(data, len, 0, callback, arg);
+}
+
+const char* signatureImplementation(void)
+{
+#ifdef CARVE_HAVE_X86
+        if (signatureAvx2())
+                return "avx2";
+#endif
+        return "portable";
+}
+
+/* State shared by the carving threads */
+typedef struct {
+        uint64_t blockCount;
+        uint32_t blockSize;
+        uint64_t next;                  // Next run to claim, taken atomically
+        pthread_mutex_t lock;
+        carve_hit *hits;
+        uint64_t count;
+        uint64_t capacity;
+        carve_stats stats;
+        int failed;
+} carve_job;
+
+/* One thread, with its own context so that reads need no locking */
+typedef struct {
+        carve_job *job;
+        pthread_t thread;
+        apfs_ctx *ctx;
+        uint64_t first;                 // Block the scanned buffer starts at
+        carve_stats stats;
+} carve_worker;
+
+static int addHit(carve_job *job, const carve_hit *hit)
+{
+        int ret = 0;
+
+        pthread_mutex_lock(&job->lock);
+        if (job->count == job->capacity) {
+                uint64_t capacity = job->capacity ? job->capacity * 2 : 256;
+                carve_hit *grown = (carve_hit*)realloc(job->hits, capacity * sizeof(carve_hit));
+
+                if (grown == NULL)
+                        ret = -1;
+                else {
+                        job->hits = grown;
+                        job->capacity = capacity;
+                }
+        }
+        if (ret == 0)
+                job->hits[job->count++] = *hit;
+        pthread_mutex_unlock(&job->lock);
+
+        return ret;
+}
+
+static int recordHit(const apfs_carved *record, void *arg)
+{
+        carve_worker *worker = (carve_worker*)arg;
+        carve_hit hit = { record->block, 0, NULL, *record };
+
+        worker->stats.records++;
+        return addHit(worker->job, &hit);
+}
+
+static int signatureHit(const char *name, size_t offset, void *arg)
+{
+        carve_worker *worker = (carve_worker*)arg;
+        carve_hit hit;
+
+        memset(&hit, 0, sizeof(hit));
+        hit.block = worker->first + offset / worker->job->blockSize;
+        hit.offset = offset % worker->job->blockSize;
+        hit.signature = name;
+
+        worker->stats.signatures++;
+        return addHit(worker->job, &hit);
+}
+
+static void* carveWorker(void *arg)
+{
+        carve_worker *worker = (carve_worker*)arg;
+        carve_job *job = worker->job;
+        uint32_t blockSize = job->blockSize;
+        uint8_t *buffer = (uint8_t*)malloc((uint64_t)CARVE_RUN_BLOCKS * blockSize);
+
+        if (buffer == NULL) {
+                __atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+                return NULL;
+        }
+
+        for (;;) {
+                uint64_t first = __atomic_fetch_add(&job->next, CARVE_RUN_BLOCKS, __ATOMIC_RELAXED);
+                uint64_t count, freeRun = 0;
+
+                if (first >= job->blockCount)
+                        break;
+
+                count = job->blockCount - first < CARVE_RUN_BLOCKS ? job->blockCount - first : CARVE_RUN_BLOCKS;
+                if (apfs_block_read(worker->ctx, first, count, buffer) < 0) {
+                        printf("Unable to read blocks %lu to %lu\n", first, first + count - 1);
+                        __atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+                        continue;
+                }
+                worker->stats.blocks_scanned += count;
+
+                for (uint64_t b = 0; b <= count; ++b) {
+                        int isFree = b < count && job->stats.free_known && apfs_range_used(worker->ctx, first + b, 1) == 0;
+                        int orphan;
+
+                        // Runs of free blocks are searched in one go, so that signatures may span blocks
+                        if (!isFree && freeRun > 0) {
+                                worker->first = first + b - freeRun;
+                                worker->stats.free_blocks += freeRun;
+                                if (signatureScan(buffer + (b - freeRun) * blockSize, freeRun * blockSize, signatureHit, worker) < 0)
+                                        __atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+                                freeRun = 0;
+                        }
+                        if (b == count)
+                                break;
+                        freeRun += isFree;
+
+                        if ((orphan = apfs_carve_node(worker->ctx, buffer + b * blockSize, first + b, recordHit, worker)) < 0)
+                                __atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+                        else if (orphan)
+                                worker->stats.orphan_nodes++;
+                }
+        }
+
+        free(buffer);
+        return NULL;
+}
+
+static int hitCompare(const void *a, const void *b)
+{
+        const carve_hit *x = (const carve_hit*)a, *y = (const carve_hit*)b;
+
+        if (x->block != y->block)
+                return x->block < y->block ? -1 : 1;
+        if (x->offset != y->offset)
+                return x->offset < y->offset ? -1 : 1;
+        if (x->record.kind != y->record.kind)
+                return x->record.kind < y->record.kind ? -1 : 1;
+        return x->record.st.ino < y->record.st.ino ? -1 : x->record.st.ino > y->record.st.ino ? 1 :
+               x->record.logical < y->record.logical ? -1 : x->record.logical > y->record.logical;
+}
+
+/*
+   Input Parameters: char*, int, int, carve_hit**, uint64_t*, carve_stats*
+   Return Type:      int
+Description: Carves the container of the image with the given number of
+threads, each on its own context. Records of orphaned FS tree nodes are
+looked for in every block. Signatures are only looked for in the blocks the
+space manager marks free, so in none when the container has no space manager
+(live files would match). The hits come back sorted by block and offset, in
+an array the caller frees.
+
+ */
+int carveContainer(const char *path, int partition, int threads, carve_hit **hits, uint64_t *count, carve_stats *stats)
+{
+        carve_worker workers[CARVE_MAX_THREADS];
+        apfs_container_info info;
+        apfs_space_info space;
+        carve_job job;
+        apfs_ctx *ctx;
+        int started = 0, ret;
+
+        *hits = NULL;
+        *count = 0;
+        memset(stats, 0, sizeof(*stats));
+
+        if ((ret = apfs_open(path, partition, &ctx)) < 0) {
+                printf("Unable to open the APFS container: %s\n", apfs_strerror(ret));
+                return -1;
+        }
+
+        memset(&job, 0, sizeof(job));
+        apfs_container_info_get(ctx, &info);
+        job.blockSize = info.block_size;
+        job.blockCount = info.block_count;
+        job.stats.free_known = apfs_space_info_get(ctx, &space) == 0;
+        if (job.stats.free_known && space.block_count < job.blockCount)
+                job.blockCount = space.block_count;
+        pthread_mutex_init(&job.lock, NULL);
+
+        if (threads < 1)
+                threads = 1;
+        if (threads > CARVE_MAX_THREADS)
+                threads = CARVE_MAX_THREADS;
+
+        for (int i = 0; i < threads; ++i) {
+                memset(&workers[i], 0, sizeof(workers[i]));
+                workers[i].job = &job;
+
+                // The first thread reuses the context the space manager was loaded into
+                if (i == 0)
+                        workers[i].ctx = ctx;
+                else if (apfs_open(path, partition, &workers[i].ctx) < 0)
+                        break;
+
+                if (pthread_create(&workers[i].thread, NULL, carveWorker, &workers[i]) != 0) {
+                        if (i > 0)
+                                apfs_close(workers[i].ctx);
+                        break;
+                }
+                started++;
+        }
+
+        if (started == 0) {
+                printf("Unable to start the carving threads\n");
+                job.failed = 1;
+        }
+
+        for (int i = 0; i < started; ++i) {
+                pthread_join(workers[i].thread, NULL);
+                job.stats.blocks_scanned += workers[i].stats.blocks_scanned;
+                job.stats.free_blocks += workers[i].stats.free_blocks;
+                job.stats.orphan_nodes += workers[i].stats.orphan_nodes;
+                job.stats.records += workers[i].stats.records;
+                job.stats.signatures += workers[i].stats.signatures;
+                if (i > 0) {
+                        apfs_stats_add(workers[i].ctx, &job.stats.io);
+                        apfs_close(workers[i].ctx);
+                }
+        }
+
+        apfs_stats_add(ctx, &job.stats.io);
+        apfs_close(ctx);
+        pthread_mutex_destroy(&job.lock);
+
+        if (job.count)
+                qsort(job.hits, job.count, sizeof(carve_hit), hitCompare);
+        *hits = job.hits;
+        *count = job.count;
+        *stats = job.stats;
+
+        return job.failed ? -1 : 0;
+}
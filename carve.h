@@ -0,0 +1,29 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include "libapfsspy.h"
+
+/* One carved item: a record of an orphaned node, or a file signature */
+typedef struct {
+        uint64_t block;
+        uint32_t offset;                // Within the block, for signatures
+        const char *signature;          // NULL for a carved record
+        apfs_carved record;
+} carve_hit;
+
+typedef struct {
+        uint64_t blocks_scanned;
+        uint64_t free_blocks;           // Scanned for signatures too
+        uint64_t orphan_nodes;
+        uint64_t records;
+        uint64_t signatures;
+        int free_known;                 // 0 when the container has no readable space manager
+        apfs_stats io;                  // Summed over the contexts of every thread
+} carve_stats;
+
+// Called once per signature found; a non-zero return stops the scan
+typedef int (*signature_cb)(const char*, size_t, void*);
+
+int signatureScan(const uint8_t*, size_t, signature_cb, void*);
+const char* signatureImplementation(void);
+int carveContainer(const char*, int, int, carve_hit**, uint64_t*, carve_stats*);
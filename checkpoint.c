@@ -0,0 +1,94 @@
+// checkpoint.c : Table of the ephemeral objects a checkpoint map describes.
+//
+//   libapfsspy decodes the checkpoint map blocks of the selected checkpoint
+//   once, when the container is opened, and then resolves ephemeral
+//   identifiers through ephemeralMapFind.
+
+#include <stdlib.h>
+#include <string.h>
+#include "checkpoint.h"
+
+static uint32_t ephemeralSlot(const ephemeral_map *map, uint64_t oid)
+{
+        return ((oid * 0xff51afd7ed558ccdULL) >> 32) & (map->capacity - 1);
+}
+
+static void ephemeralPut(ephemeral_map *map, const ephemeral_object *object)
+{
+        uint32_t slot = ephemeralSlot(map, object->oid);
+
+        while (map->slots[slot].oid && map->slots[slot].oid != object->oid)
+                slot = (slot + 1) & (map->capacity - 1);
+
+        if (map->slots[slot].oid == 0)
+                map->count++;
+
+        map->slots[slot] = *object;
+}
+
+/*
+   Input Parameters: ephemeral_map*, checkPoint_Map*, uint32_t
+   Return Type:      int
+Description: Adds the mappings of one checkpoint map block to the table,
+growing it to keep at most half of the slots used. A later mapping of the
+same identifier replaces the earlier one. Mappings past the end of the block
+are ignored. Returns the number of mappings added or -1 when out of memory.
+
+ */
+int ephemeralMapAdd(ephemeral_map *map, const checkPoint_Map *cpm, uint32_t blockSize)
+{
+        uint32_t count = cpm->cpm_count, added = 0;
+
+        if (sizeof(checkPoint_Map) + (uint64_t)count * sizeof(checkpoint_mapping_t) > blockSize)
+                count = (blockSize - sizeof(checkPoint_Map)) / sizeof(checkpoint_mapping_t);
+
+        for (uint32_t i = 0; i < count; ++i) {
+                const checkpoint_mapping_t *mapping = &cpm->cpm_map[i];
+                ephemeral_object object = { mapping->cpm_oid, mapping->cpm_paddr, mapping->cpm_size, mapping->cpm_type };
+
+                if (mapping->cpm_oid == 0)
+                        continue;
+
+                if ((map->count + 1) * 2 > map->capacity) {
+                        ephemeral_object *old = map->slots;
+                        uint32_t oldCapacity = map->capacity;
+                        ephemeral_object *grown = calloc(oldCapacity ? oldCapacity * 2 : 64, sizeof(ephemeral_object));
+
+                        if (grown == NULL)
+                                return -1;
+
+                        map->slots = grown;
+                        map->capacity = oldCapacity ? oldCapacity * 2 : 64;
+                        map->count = 0;
+
+                        for (uint32_t j = 0; j < oldCapacity; ++j)
+                                if (old[j].oid)
+                                        ephemeralPut(map, &old[j]);
+                        free(old);
+                }
+
+                ephemeralPut(map, &object);
+                added++;
+        }
+
+        return added;
+}
+
+// Returns the ephemeral object with the given identifier, NULL when the checkpoint has none
+const ephemeral_object* ephemeralMapFind(const ephemeral_map *map, uint64_t oid)
+{
+        if (map->count == 0 || oid == 0)
+                return NULL;
+
+        for (uint32_t slot = ephemeralSlot(map, oid); map->slots[slot].oid; slot = (slot + 1) & (map->capacity - 1))
+                if (map->slots[slot].oid == oid)
+                        return &map->slots[slot];
+
+        return NULL;
+}
+
+void ephemeralMapFree(ephemeral_map *map)
+{
+        free(map->slots);
+        memset(map, 0, sizeof(*map));
+}
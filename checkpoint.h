@@ -0,0 +1,26 @@
+#pragma once
+#include <stdint.h>
+#include "apfs.h"
+
+/*
+ * Ephemeral objects of one checkpoint (the space manager, the reaper, ...)
+ * by identifier. The checkpoint map blocks the checkpoint wrote are decoded
+ * once into an open addressing table, so each lookup is a hash probe.
+ */
+
+typedef struct {
+        uint64_t oid;                   // 0 for an empty slot
+        uint64_t paddr;
+        uint32_t size;                  // Bytes the object takes
+        uint32_t type;
+} ephemeral_object;
+
+typedef struct {
+        ephemeral_object *slots;
+        uint32_t capacity;              // Power of two, at least twice count
+        uint32_t count;
+} ephemeral_map;
+
+int ephemeralMapAdd(ephemeral_map*, const checkPoint_Map*, uint32_t);
+const ephemeral_object* ephemeralMapFind(const ephemeral_map*, uint64_t);
+void ephemeralMapFree(ephemeral_map*);
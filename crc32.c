@@ -0,0 +1,247 @@
+// crc32.c : CRC-32 of the UDIF data fork and of expanded partitions.
+//
+//   Buffers of 64 bytes and more are folded 512 bits at a time with PCLMULQDQ
+//   and reduced with a Barrett step, the same scheme zlib-ng and Chromium use.
+//   The tail, and CPUs without carry-less multiply, go through zlib's table
+//   driven crc32_z(). CRC-32C, for the APFS name hash, uses the SSE4.2 CRC32
+//   instruction, or a bitwise loop on CPUs without it.
+
+#include <string.h>
+#include <zlib.h>
+#include "crc32.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define CRC32_HAVE_PCLMUL 1
+#endif
+
+#ifdef CRC32_HAVE_PCLMUL
+/*
+ * Folds len bytes (len >= 64 and a multiple of 16) into the raw, inverted
+ * CRC register. The constants are x^(k) mod P(x), bit reflected, for the
+ * fold distances of 512, 128 and 64 bits, followed by the Barrett constants.
+ */
+__attribute__((target("pclmul,sse4.1")))
+static uint32_t crc32Pclmul(uint32_t crc, const uint8_t *buf, size_t len)
+{
+        static const uint64_t k1k2[2] __attribute__((aligned(16))) = { 0x0154442bd4, 0x01c6e41596 };
+        static const uint64_t k3k4[2] __attribute__((aligned(16))) = { 0x01751997d0, 0x00ccaa009e };
+        static const uint64_t k5k0[2] __attribute__((aligned(16))) = { 0x0163cd6124, 0x0000000000 };
+        static const uint64_t poly[2] __attribute__((aligned(16))) = { 0x01db710641, 0x01f7011641 };
+        __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+        x1 = _mm_loadu_si128((const __m128i*)(buf + 0x00));
+        x2 = _mm_loadu_si128((const __m128i*)(buf + 0x10));
+        x3 = _mm_loadu_si128((const __m128i*)(buf + 0x20));
+        x4 = _mm_loadu_si128((const __m128i*)(buf + 0x30));
+
+        x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(crc));
+        x0 = _mm_load_si128((const __m128i*)k1k2);
+
+        buf += 64;
+        len -= 64;
+
+        // Four lanes of 128 bits, each folded 512 bits forward
+        while (len >= 64) {
+                x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+                x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+                x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+                x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+                x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+                x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+                x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+                x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+                y5 = _mm_loadu_si128((const __m128i*)(buf + 0x00));
+                y6 = _mm_loadu_si128((const __m128i*)(buf + 0x10));
+                y7 = _mm_loadu_si128((const __m128i*)(buf + 0x20));
+                y8 = _mm_loadu_si128((const __m128i*)(buf + 0x30));
+
+                x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+                x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+                x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+                x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+
+                buf += 64;
+                len -= 64;
+        }
+
+        // Fold the four lanes into one
+        x0 = _mm_load_si128((const __m128i*)k3k4);
+
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+        // Remaining 128 bit blocks
+        while (len >= 16) {
+                x2 = _mm_loadu_si128((const __m128i*)buf);
+
+                x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+                x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+                x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+                buf += 16;
+                len -= 16;
+        }
+
+        // 128 bits down to 64
+        x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+        x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+        x1 = _mm_srli_si128(x1, 8);
+        x1 = _mm_xor_si128(x1, x2);
+
+        x0 = _mm_loadl_epi64((const __m128i*)k5k0);
+
+        x2 = _mm_srli_si128(x1, 4);
+        x1 = _mm_and_si128(x1, x3);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_xor_si128(x1, x2);
+
+        // Barrett reduction to 32 bits
+        x0 = _mm_load_si128((const __m128i*)poly);
+
+        x2 = _mm_and_si128(x1, x3);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+        x2 = _mm_and_si128(x2, x3);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x1 = _mm_xor_si128(x1, x2);
+
+        return _mm_extract_epi32(x1, 1);
+}
+
+static int crc32HavePclmul(void)
+{
+        static int supported = -1;
+
+        if (supported < 0) {
+                __builtin_cpu_init();
+                supported = __builtin_cpu_supports("pclmul") && __builtin_cpu_supports("sse4.1");
+        }
+
+        return supported;
+}
+#endif
+
+uint32_t crc32Update(uint32_t crc, const void *data, size_t len)
+{
+        const uint8_t *buf = (const uint8_t*)data;
+
+#ifdef CRC32_HAVE_PCLMUL
+        if (len >= 64 && crc32HavePclmul()) {
+                size_t folded = len & ~(size_t)15;
+
+                crc = ~crc32Pclmul(~crc, buf, folded);
+                buf += folded;
+                len -= folded;
+        }
+#endif
+
+        return len ? crc32_z(crc, buf, len) : crc;
+}
+
+#ifdef CRC32_HAVE_PCLMUL
+__attribute__((target("sse4.2")))
+static uint32_t crc32cSse42(uint32_t crc, const uint8_t *buf, size_t len)
+{
+#ifdef __x86_64__
+        uint64_t crc64 = crc;
+
+        for (; len >= 8; buf += 8, len -= 8) {
+                uint64_t word;
+
+                memcpy(&word, buf, sizeof(word));
+                crc64 = _mm_crc32_u64(crc64, word);
+        }
+        crc = (uint32_t)crc64;
+#endif
+        for (; len; ++buf, --len)
+                crc = _mm_crc32_u8(crc, *buf);
+
+        return crc;
+}
+
+static int crc32cHaveSse42(void)
+{
+        static int supported = -1;
+
+        if (supported < 0) {
+                __builtin_cpu_init();
+                supported = __builtin_cpu_supports("sse4.2");
+        }
+
+        return supported;
+}
+#endif
+
+uint32_t crc32cUpdate(uint32_t crc, const void *data, size_t len)
+{
+        const uint8_t *buf = (const uint8_t*)data;
+
+#ifdef CRC32_HAVE_PCLMUL
+        if (crc32cHaveSse42())
+                return crc32cSse42(crc, buf, len);
+#endif
+
+        for (; len; ++buf, --len) {
+                crc ^= *buf;
+                for (int bit = 0; bit < 8; ++bit)
+                        crc = (crc >> 1) ^ (0x82f63b78 & -(crc & 1));
+        }
+
+        return crc;
+}
+
+/*
+ * Multiplies a and b modulo P(x), both bit reflected (x^0 in the top bit), as
+ * zlib's crc32_combine() does
+ */
+static uint32_t crc32MultModP(uint32_t a, uint32_t b)
+{
+        uint32_t m = (uint32_t)1 << 31, p = 0;
+
+        for (; m; m >>= 1) {
+                if (a & m)
+                        p ^= b;
+                b = b & 1 ? (b >> 1) ^ 0xedb88320 : b >> 1;
+        }
+
+        return p;
+}
+
+/*
+ * CRC of a run of zero bytes, for zero and free chunks that are never stored.
+ * Feeding n zero bytes multiplies the register by x^(8n) mod P(x); the power
+ * is built by squaring, so a run of any length costs at most 128 products.
+ */
+uint32_t crc32Zeros(uint32_t crc, uint64_t len)
+{
+        uint32_t power = (uint32_t)1 << 23;     // x^8, one zero byte
+        uint32_t op = (uint32_t)1 << 31;        // x^0
+
+        for (; len; len >>= 1) {
+                if (len & 1)
+                        op = crc32MultModP(power, op);
+                power = crc32MultModP(power, power);
+        }
+
+        return ~crc32MultModP(op, ~crc);
+}
+
+const char* crc32Implementation(void)
+{
+#ifdef CRC32_HAVE_PCLMUL
+        if (crc32HavePclmul())
+                return "pclmul";
+#endif
+        return "zlib";
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+// UDIF checksum types (UDIFChecksum.ChecksumType)
+#define UDIF_CHECKSUM_NONE      0
+#define UDIF_CHECKSUM_CRC32     2
+
+/*
+ * CRC-32 (ISO-HDLC, the zlib polynomial) with the same calling convention as
+ * zlib's crc32(): start from 0 and feed the running value back in.
+ * Carry-less multiply folding is used when the CPU supports it.
+ */
+uint32_t crc32Update(uint32_t, const void*, size_t);
+uint32_t crc32Zeros(uint32_t, uint64_t);
+const char* crc32Implementation(void);
+
+/*
+ * CRC-32C (Castagnoli) register update, without the initial and final
+ * inversions: APFS seeds it with ~0 and keeps the raw register for the
+ * directory entry name hash. Uses the SSE4.2 CRC32 instruction when present.
+ */
+uint32_t crc32cUpdate(uint32_t, const void*, size_t);
@@ -0,0 +1,737 @@
+// digest.c : MD5, SHA-1, SHA-256 and BLAKE3 over streamed data.
+//
+//   MD5, SHA-1 and SHA-256 share the 64-byte block buffering and the length
+//   padding; each has a function compressing whole blocks, and SHA-1 and
+//   SHA-256 have a second one built on the SHA extensions (SHA-NI), chosen
+//   once at run time. BLAKE3 keeps its chunk state and the stack of subtree
+//   chaining values as the reference implementation lays them out; with
+//   AVX2, runs of eight whole chunks are compressed together, one per lane.
+
+#include <string.h>
+#include "digest.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#include <cpuid.h>
+#define DIGEST_HAVE_X86 1
+#endif
+
+typedef void (*digest_blocks)(uint32_t*, const uint8_t*, size_t);
+
+static const char *names[DIGEST_COUNT] = { "md5", "sha1", "sha256", "blake3" };
+static const size_t sizes[DIGEST_COUNT] = { 16, 20, 32, 32 };
+
+static inline uint32_t rotl(uint32_t x, int n)
+{
+        return (x << n) | (x >> (32 - n));
+}
+
+static inline uint32_t rotr(uint32_t x, int n)
+{
+        return (x >> n) | (x << (32 - n));
+}
+
+static inline uint32_t load32be(const uint8_t *p)
+{
+        return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static inline uint32_t load32le(const uint8_t *p)
+{
+        return p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+/* ---------------------------------------------------------------------- */
+/* MD5                                                                    */
+/* ---------------------------------------------------------------------- */
+
+static const uint32_t md5K[64] = {
+        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613, 0xfd469501,
+        0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193, 0xa679438e, 0x49b40821,
+        0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d, 0x02441453, 0xd8a1e681, 0xe7d3fbc8,
+        0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed, 0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a,
+        0xfffa3942, 0x8771f681, 0x6d9d6122, 0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70,
+        0x289b7ec6, 0xeaa127fa, 0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665,
+        0xf4292244, 0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb, 0xeb86d391,
+};
+
+static const uint8_t md5Shift[16] = { 7, 12, 17, 22, 5, 9, 14, 20, 4, 11, 16, 23, 6, 10, 15, 21 };
+
+static void md5Blocks(uint32_t *h, const uint8_t *data, size_t blocks)
+{
+        for (; blocks; --blocks, data += 64) {
+                uint32_t m[16], a = h[0], b = h[1], c = h[2], d = h[3];
+
+                for (int i = 0; i < 16; ++i)
+                        m[i] = load32le(data + 4 * i);
+
+                for (int i = 0; i < 64; ++i) {
+                        uint32_t f, g, t;
+
+                        if (i < 16) {
+                                f = (b & c) | (~b & d);
+                                g = i;
+                        } else if (i < 32) {
+                                f = (d & b) | (~d & c);
+                                g = (5 * i + 1) & 15;
+                        } else if (i < 48) {
+                                f = b ^ c ^ d;
+                                g = (3 * i + 5) & 15;
+                        } else {
+                                f = c ^ (b | ~d);
+                                g = (7 * i) & 15;
+                        }
+
+                        t = d;
+                        d = c;
+                        c = b;
+                        b = b + rotl(a + f + md5K[i] + m[g], md5Shift[(i >> 4) * 4 + (i & 3)]);
+                        a = t;
+                }
+
+                h[0] += a;
+                h[1] += b;
+                h[2] += c;
+                h[3] += d;
+        }
+}
+
+/* ---------------------------------------------------------------------- */
+/* SHA-1                                                                  */
+/* ---------------------------------------------------------------------- */
+
+static void sha1BlocksPortable(uint32_t *h, const uint8_t *data, size_t blocks)
+{
+        for (; blocks; --blocks, data += 64) {
+                uint32_t w[80], a = h[0], b = h[1], c = h[2], d = h[3], e = h[4];
+
+                for (int i = 0; i < 16; ++i)
+                        w[i] = load32be(data + 4 * i);
+                for (int i = 16; i < 80; ++i)
+                        w[i] = rotl(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+
+                for (int i = 0; i < 80; ++i) {
+                        uint32_t f, k, t;
+
+                        if (i < 20) {
+                                f = (b & c) | (~b & d);
+                                k = 0x5a827999;
+                        } else if (i < 40) {
+                                f = b ^ c ^ d;
+                                k = 0x6ed9eba1;
+                        } else if (i < 60) {
+                                f = (b & c) | (b & d) | (c & d);
+                                k = 0x8f1bbcdc;
+                        } else {
+                                f = b ^ c ^ d;
+                                k = 0xca62c1d6;
+                        }
+
+                        t = rotl(a, 5) + f + e + k + w[i];
+                        e = d;
+                        d = c;
+                        c = rotl(b, 30);
+                        b = a;
+                        a = t;
+                }
+
+                h[0] += a;
+                h[1] += b;
+                h[2] += c;
+                h[3] += d;
+                h[4] += e;
+        }
+}
+
+#ifdef DIGEST_HAVE_X86
+/*
+ * Four rounds per SHA1RNDS4. The message schedule runs three groups ahead:
+ * SHA1MSG1, a XOR and SHA1MSG2 each add one of the older words to the
+ * group that is being built.
+ */
+__attribute__((target("sha,sse4.1")))
+static void sha1BlocksShani(uint32_t *h, const uint8_t *data, size_t blocks)
+{
+        const __m128i mask = _mm_set_epi64x(0x0001020304050607ULL, 0x08090a0b0c0d0e0fULL);
+        __m128i abcd = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)h), 0x1b);
+        __m128i e0 = _mm_set_epi32(h[4], 0, 0, 0);
+
+        for (; blocks; --blocks, data += 64) {
+                __m128i abcdSave = abcd, e0Save = e0, e1 = e0, w[4];
+
+                for (int i = 0; i < 4; ++i)
+                        w[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 16 * i)), mask);
+
+                for (int g = 0; g < 20; ++g) {
+                        __m128i m = w[g & 3];
+
+                        if (g == 0) {
+                                e0 = _mm_add_epi32(e0, m);
+                                e1 = abcd;
+                        } else if (g & 1) {
+                                e1 = _mm_sha1nexte_epu32(e1, m);
+                                e0 = abcd;
+                        } else {
+                                e0 = _mm_sha1nexte_epu32(e0, m);
+                                e1 = abcd;
+                        }
+
+                        if (g >= 3 && g <= 18)
+                                w[(g + 1) & 3] = _mm_sha1msg2_epu32(w[(g + 1) & 3], m);
+
+                        // The round function is an immediate, one per group of twenty rounds
+                        switch (g / 5) {
+                        case 0: abcd = _mm_sha1rnds4_epu32(abcd, (g & 1) ? e1 : e0, 0); break;
+                        case 1: abcd = _mm_sha1rnds4_epu32(abcd, (g & 1) ? e1 : e0, 1); break;
+                        case 2: abcd = _mm_sha1rnds4_epu32(abcd, (g & 1) ? e1 : e0, 2); break;
+                        default: abcd = _mm_sha1rnds4_epu32(abcd, (g & 1) ? e1 : e0, 3); break;
+                        }
+
+                        if (g >= 1 && g <= 16)
+                                w[(g + 3) & 3] = _mm_sha1msg1_epu32(w[(g + 3) & 3], m);
+                        if (g >= 2 && g <= 17)
+                                w[(g + 2) & 3] = _mm_xor_si128(w[(g + 2) & 3], m);
+                }
+
+                e0 = _mm_sha1nexte_epu32(e0, e0Save);
+                abcd = _mm_add_epi32(abcd, abcdSave);
+        }
+
+        _mm_storeu_si128((__m128i*)h, _mm_shuffle_epi32(abcd, 0x1b));
+        h[4] = _mm_extract_epi32(e0, 3);
+}
+#endif
+
+/* ---------------------------------------------------------------------- */
+/* SHA-256                                                                */
+/* ---------------------------------------------------------------------- */
+
+static const uint32_t sha256K[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+// Also the BLAKE3 IV
+static const uint32_t sha256IV[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+};
+
+static void sha256BlocksPortable(uint32_t *h, const uint8_t *data, size_t blocks)
+{
+        for (; blocks; --blocks, data += 64) {
+                uint32_t w[64], s[8];
+
+                for (int i = 0; i < 16; ++i)
+                        w[i] = load32be(data + 4 * i);
+                for (int i = 16; i < 64; ++i) {
+                        uint32_t s0 = rotr(w[i - 15], 7) ^ rotr(w[i - 15], 18) ^ (w[i - 15] >> 3);
+                        uint32_t s1 = rotr(w[i - 2], 17) ^ rotr(w[i - 2], 19) ^ (w[i - 2] >> 10);
+
+                        w[i] = w[i - 16] + s0 + w[i - 7] + s1;
+                }
+
+                memcpy(s, h, sizeof(s));
+                for (int i = 0; i < 64; ++i) {
+                        uint32_t t1 = s[7] + (rotr(s[4], 6) ^ rotr(s[4], 11) ^ rotr(s[4], 25)) +
+                                      ((s[4] & s[5]) ^ (~s[4] & s[6])) + sha256K[i] + w[i];
+                        uint32_t t2 = (rotr(s[0], 2) ^ rotr(s[0], 13) ^ rotr(s[0], 22)) +
+                                      ((s[0] & s[1]) ^ (s[0] & s[2]) ^ (s[1] & s[2]));
+
+                        memmove(s + 1, s, 7 * sizeof(uint32_t));
+                        s[4] += t1;
+                        s[0] = t1 + t2;
+                }
+
+                for (int i = 0; i < 8; ++i)
+                        h[i] += s[i];
+        }
+}
+
+#ifdef DIGEST_HAVE_X86
+/*
+ * Two rounds per SHA256RNDS2, on the state split into ABEF and CDGH. The
+ * next group of four message words is finished with SHA256MSG1 one group
+ * ahead and SHA256MSG2 (plus the word seven back) right before it is used.
+ */
+__attribute__((target("sha,sse4.1")))
+static void sha256BlocksShani(uint32_t *h, const uint8_t *data, size_t blocks)
+{
+        const __m128i mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+        __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&h[0]), 0xb1);       // CDAB
+        __m128i state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i*)&h[4]), 0x1b);   // EFGH
+        __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);                                   // ABEF
+
+        state1 = _mm_blend_epi16(state1, tmp, 0xf0);                                        // CDGH
+
+        for (; blocks; --blocks, data += 64) {
+                __m128i abefSave = state0, cdghSave = state1, w[4];
+
+                for (int i = 0; i < 4; ++i)
+                        w[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(data + 16 * i)), mask);
+
+                for (int g = 0; g < 16; ++g) {
+                        __m128i msg = _mm_add_epi32(w[g & 3], _mm_loadu_si128((const __m128i*)&sha256K[4 * g]));
+
+                        state1 = _mm_sha256rnds2_epu32(state1, state0, msg);
+                        if (g >= 3 && g <= 14) {
+                                __m128i next = _mm_add_epi32(w[(g + 1) & 3], _mm_alignr_epi8(w[g & 3], w[(g + 3) & 3], 4));
+
+                                w[(g + 1) & 3] = _mm_sha256msg2_epu32(next, w[g & 3]);
+                        }
+                        state0 = _mm_sha256rnds2_epu32(state0, state1, _mm_shuffle_epi32(msg, 0x0e));
+                        if (g >= 1 && g <= 12)
+                                w[(g + 3) & 3] = _mm_sha256msg1_epu32(w[(g + 3) & 3], w[g & 3]);
+                }
+
+                state0 = _mm_add_epi32(state0, abefSave);
+                state1 = _mm_add_epi32(state1, cdghSave);
+        }
+
+        tmp = _mm_shuffle_epi32(state0, 0x1b);                                              // FEBA
+        state1 = _mm_shuffle_epi32(state1, 0xb1);                                           // DCHG
+        _mm_storeu_si128((__m128i*)&h[0], _mm_blend_epi16(tmp, state1, 0xf0));              // DCBA
+        _mm_storeu_si128((__m128i*)&h[4], _mm_alignr_epi8(state1, tmp, 8));                 // HGFE
+}
+
+static int shaExtensions(void)
+{
+        static int supported = -1;
+
+        if (supported < 0) {
+                unsigned int eax, ebx, ecx, edx;
+
+                __builtin_cpu_init();
+                supported = __get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) && (ebx & (1u << 29)) &&
+                            __builtin_cpu_supports("sse4.1");
+        }
+
+        return supported;
+}
+#endif
+
+static digest_blocks blockFunction(int algorithm)
+{
+        if (algorithm == DIGEST_MD5)
+                return md5Blocks;
+#ifdef DIGEST_HAVE_X86
+        if (shaExtensions())
+                return algorithm == DIGEST_SHA1 ? sha1BlocksShani : sha256BlocksShani;
+#endif
+        return algorithm == DIGEST_SHA1 ? sha1BlocksPortable : sha256BlocksPortable;
+}
+
+/* ---------------------------------------------------------------------- */
+/* BLAKE3                                                                 */
+/* ---------------------------------------------------------------------- */
+
+#define BLAKE3_CHUNK_LEN        1024
+#define BLAKE3_CHUNK_START      1
+#define BLAKE3_CHUNK_END        2
+#define BLAKE3_PARENT           4
+#define BLAKE3_ROOT             8
+
+static const uint8_t blake3Permutation[16] = { 2, 6, 3, 10, 7, 0, 4, 13, 1, 11, 12, 5, 9, 14, 15, 8 };
+
+static inline void blake3G(uint32_t *s, int a, int b, int c, int d, uint32_t x, uint32_t y)
+{
+        s[a] = s[a] + s[b] + x;
+        s[d] = rotr(s[d] ^ s[a], 16);
+        s[c] = s[c] + s[d];
+        s[b] = rotr(s[b] ^ s[c], 12);
+        s[a] = s[a] + s[b] + y;
+        s[d] = rotr(s[d] ^ s[a], 8);
+        s[c] = s[c] + s[d];
+        s[b] = rotr(s[b] ^ s[c], 7);
+}
+
+// The first eight words of the compression output, which is all a chaining value or a 32-byte hash needs
+static void blake3Compress(const uint32_t cv[8], const uint8_t block[64], uint64_t counter, uint32_t blockLen,
+                           uint32_t flags, uint32_t out[8])
+{
+        uint32_t s[16], m[16], permuted[16];
+
+        for (int i = 0; i < 16; ++i)
+                m[i] = load32le(block + 4 * i);
+
+        memcpy(s, cv, 8 * sizeof(uint32_t));
+        memcpy(s + 8, sha256IV, 4 * sizeof(uint32_t));
+        s[12] = (uint32_t)counter;
+        s[13] = (uint32_t)(counter >> 32);
+        s[14] = blockLen;
+        s[15] = flags;
+
+        for (int round = 0; round < 7; ++round) {
+                blake3G(s, 0, 4, 8, 12, m[0], m[1]);
+                blake3G(s, 1, 5, 9, 13, m[2], m[3]);
+                blake3G(s, 2, 6, 10, 14, m[4], m[5]);
+                blake3G(s, 3, 7, 11, 15, m[6], m[7]);
+                blake3G(s, 0, 5, 10, 15, m[8], m[9]);
+                blake3G(s, 1, 6, 11, 12, m[10], m[11]);
+                blake3G(s, 2, 7, 8, 13, m[12], m[13]);
+                blake3G(s, 3, 4, 9, 14, m[14], m[15]);
+
+                for (int i = 0; i < 16; ++i)
+                        permuted[i] = m[blake3Permutation[i]];
+                memcpy(m, permuted, sizeof(m));
+        }
+
+        for (int i = 0; i < 8; ++i)
+                out[i] = s[i] ^ s[i + 8];
+}
+
+static void blake3Parent(const uint32_t left[8], const uint32_t right[8], uint32_t flags, uint32_t out[8])
+{
+        uint8_t block[64];
+
+        for (int i = 0; i < 8; ++i) {
+                for (int j = 0; j < 4; ++j) {
+                        block[4 * i + j] = left[i] >> (8 * j);
+                        block[32 + 4 * i + j] = right[i] >> (8 * j);
+                }
+        }
+
+        blake3Compress(sha256IV, block, 0, 64, BLAKE3_PARENT | flags, out);
+}
+
+static void blake3ChunkReset(blake3_state *b, uint64_t counter)
+{
+        memcpy(b->cv, sha256IV, sizeof(b->cv));
+        b->counter = counter;
+        b->blockLen = 0;
+        b->blocksCompressed = 0;
+}
+
+// Chaining value (or, with BLAKE3_ROOT and no parents, the hash) of the chunk in progress
+static void blake3ChunkOutput(const blake3_state *b, uint32_t flags, uint32_t out[8])
+{
+        uint8_t block[64] = { 0 };
+
+        memcpy(block, b->block, b->blockLen);
+        flags |= BLAKE3_CHUNK_END | (b->blocksCompressed == 0 ? BLAKE3_CHUNK_START : 0);
+        blake3Compress(b->cv, block, b->counter, b->blockLen, flags, out);
+}
+
+// Merges the finished chunk into the stack: one parent per trailing zero bit of the chunk count
+static void blake3AddChunk(blake3_state *b, uint32_t cv[8], uint64_t chunks)
+{
+        while ((chunks & 1) == 0) {
+                blake3Parent(b->stack[--b->stackLen], cv, 0, cv);
+                chunks >>= 1;
+        }
+
+        memcpy(b->stack[b->stackLen++], cv, 8 * sizeof(uint32_t));
+}
+
+#ifdef DIGEST_HAVE_X86
+#define BLAKE3_LANES            8
+
+__attribute__((target("avx2")))
+static inline __m256i rotr256(__m256i x, int n)
+{
+        return _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - n));
+}
+
+__attribute__((target("avx2")))
+static inline void blake3G8(__m256i *s, int a, int b, int c, int d, __m256i x, __m256i y)
+{
+        s[a] = _mm256_add_epi32(_mm256_add_epi32(s[a], s[b]), x);
+        s[d] = rotr256(_mm256_xor_si256(s[d], s[a]), 16);
+        s[c] = _mm256_add_epi32(s[c], s[d]);
+        s[b] = rotr256(_mm256_xor_si256(s[b], s[c]), 12);
+        s[a] = _mm256_add_epi32(_mm256_add_epi32(s[a], s[b]), y);
+        s[d] = rotr256(_mm256_xor_si256(s[d], s[a]), 8);
+        s[c] = _mm256_add_epi32(s[c], s[d]);
+        s[b] = rotr256(_mm256_xor_si256(s[b], s[c]), 7);
+}
+
+/*
+ * Eight whole chunks at once, one per 32-bit lane: every state word is a
+ * vector holding that word of the eight compressions. The chaining values
+ * come out in cvs[chunk][word].
+ */
+__attribute__((target("avx2")))
+static void blake3Chunks8Avx2(const uint8_t *data, uint64_t counter, uint32_t cvs[BLAKE3_LANES][8])
+{
+        const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+        const __m256i stride = _mm256_mullo_epi32(lanes, _mm256_set1_epi32(BLAKE3_CHUNK_LEN / 4));
+        __m256i cv[8], counterLow, counterHigh;
+        uint8_t schedule[7][16];
+        uint32_t words[8][BLAKE3_LANES];
+
+        for (int i = 0; i < 16; ++i)
+                schedule[0][i] = i;
+        for (int r = 1; r < 7; ++r)
+                for (int i = 0; i < 16; ++i)
+                        schedule[r][i] = schedule[r - 1][blake3Permutation[i]];
+
+        for (int i = 0; i < 8; ++i)
+                cv[i] = _mm256_set1_epi32(sha256IV[i]);
+
+        // Chunk counters of the eight lanes, with the carry into the high words
+        counterLow = _mm256_add_epi32(_mm256_set1_epi32((uint32_t)counter), lanes);
+        counterHigh = _mm256_set1_epi32((uint32_t)(counter >> 32));
+        counterHigh = _mm256_sub_epi32(counterHigh, _mm256_cmpgt_epi32(_mm256_xor_si256(_mm256_set1_epi32((uint32_t)counter), _mm256_set1_epi32((int)0x80000000)),
+                                                                       _mm256_xor_si256(counterLow, _mm256_set1_epi32((int)0x80000000))));
+
+        for (int block = 0; block < BLAKE3_CHUNK_LEN / 64; ++block) {
+                uint32_t flags = (block == 0 ? BLAKE3_CHUNK_START : 0) | (block == 15 ? BLAKE3_CHUNK_END : 0);
+                __m256i m[16], s[16];
+
+                for (int i = 0; i < 16; ++i)
+                        m[i] = _mm256_i32gather_epi32((const int*)(data + block * 64 + 4 * i), stride, 4);
+
+                for (int i = 0; i < 8; ++i)
+                        s[i] = cv[i];
+                for (int i = 0; i < 4; ++i)
+                        s[8 + i] = _mm256_set1_epi32(sha256IV[i]);
+                s[12] = counterLow;
+                s[13] = counterHigh;
+                s[14] = _mm256_set1_epi32(64);
+                s[15] = _mm256_set1_epi32(flags);
+
+                for (int r = 0; r < 7; ++r) {
+                        const uint8_t *w = schedule[r];
+
+                        blake3G8(s, 0, 4, 8, 12, m[w[0]], m[w[1]]);
+                        blake3G8(s, 1, 5, 9, 13, m[w[2]], m[w[3]]);
+                        blake3G8(s, 2, 6, 10, 14, m[w[4]], m[w[5]]);
+                        blake3G8(s, 3, 7, 11, 15, m[w[6]], m[w[7]]);
+                        blake3G8(s, 0, 5, 10, 15, m[w[8]], m[w[9]]);
+                        blake3G8(s, 1, 6, 11, 12, m[w[10]], m[w[11]]);
+                        blake3G8(s, 2, 7, 8, 13, m[w[12]], m[w[13]]);
+                        blake3G8(s, 3, 4, 9, 14, m[w[14]], m[w[15]]);
+                }
+
+                for (int i = 0; i < 8; ++i)
+                        cv[i] = _mm256_xor_si256(s[i], s[i + 8]);
+        }
+
+        for (int i = 0; i < 8; ++i)
+                _mm256_storeu_si256((__m256i*)words[i], cv[i]);
+        for (int lane = 0; lane < BLAKE3_LANES; ++lane)
+                for (int i = 0; i < 8; ++i)
+                        cvs[lane][i] = words[i][lane];
+}
+
+static int blake3Avx2(void)
+{
+        static int supported = -1;
+
+        if (supported < 0) {
+                __builtin_cpu_init();
+                supported = __builtin_cpu_supports("avx2");
+        }
+
+        return supported;
+}
+#endif
+
+static void blake3Update(blake3_state *b, const uint8_t *data, size_t len)
+{
+        while (len) {
+                size_t take;
+
+                if (b->blocksCompressed * 64 + b->blockLen == BLAKE3_CHUNK_LEN) {
+                        uint32_t cv[8];
+
+                        blake3ChunkOutput(b, 0, cv);
+                        blake3AddChunk(b, cv, b->counter + 1);
+                        blake3ChunkReset(b, b->counter + 1);
+                }
+
+#ifdef DIGEST_HAVE_X86
+                // Whole chunks with more input after them cannot be the root, eight go through AVX2 at once
+                if (b->blocksCompressed == 0 && b->blockLen == 0 && len > BLAKE3_LANES * BLAKE3_CHUNK_LEN &&
+                    blake3Avx2()) {
+                        uint32_t cvs[BLAKE3_LANES][8];
+
+                        blake3Chunks8Avx2(data, b->counter, cvs);
+                        for (int lane = 0; lane < BLAKE3_LANES; ++lane)
+                                blake3AddChunk(b, cvs[lane], b->counter + lane + 1);
+                        blake3ChunkReset(b, b->counter + BLAKE3_LANES);
+                        data += BLAKE3_LANES * BLAKE3_CHUNK_LEN;
+                        len -= BLAKE3_LANES * BLAKE3_CHUNK_LEN;
+                        continue;
+                }
+#endif
+
+                // A full block is only compressed once more input follows, the last one takes CHUNK_END
+                if (b->blockLen == 64) {
+                        blake3Compress(b->cv, b->block, b->counter, 64,
+                                       b->blocksCompressed == 0 ? BLAKE3_CHUNK_START : 0, b->cv);
+                        b->blocksCompressed++;
+                        b->blockLen = 0;
+                }
+
+                take = 64 - b->blockLen;
+                if (take > len)
+                        take = len;
+                memcpy(b->block + b->blockLen, data, take);
+                b->blockLen += take;
+                data += take;
+                len -= take;
+        }
+}
+
+static void blake3Final(const blake3_state *b, uint8_t *out)
+{
+        uint32_t cv[8];
+
+        if (b->stackLen == 0) {
+                blake3ChunkOutput(b, BLAKE3_ROOT, cv);
+        } else {
+                blake3ChunkOutput(b, 0, cv);
+                for (uint32_t i = b->stackLen; i > 0; --i)
+                        blake3Parent(b->stack[i - 1], cv, i == 1 ? BLAKE3_ROOT : 0, cv);
+        }
+
+        for (int i = 0; i < 8; ++i)
+                for (int j = 0; j < 4; ++j)
+                        out[4 * i + j] = cv[i] >> (8 * j);
+}
+
+/* ---------------------------------------------------------------------- */
+
+/*
+   Input Parameters: char* list, unsigned* mask
+   Return Type:      int
+Description: Parses a comma separated list of digest names (md5, sha1,
+sha256, blake3) into a mask of 1 << DIGEST_*. Returns -1 for an unknown or
+empty name.
+
+ */
+int digestParse(const char *list, unsigned *mask)
+{
+        *mask = 0;
+
+        while (*list) {
+                size_t len = strcspn(list, ",");
+                int found = -1;
+
+                for (int i = 0; i < DIGEST_COUNT; ++i)
+                        if (strlen(names[i]) == len && strncmp(list, names[i], len) == 0)
+                                found = i;
+                if (found < 0)
+                        return -1;
+
+                *mask |= 1u << found;
+                list += len + (list[len] == ',');
+        }
+
+        return *mask ? 0 : -1;
+}
+
+const char* digestName(int algorithm)
+{
+        return names[algorithm];
+}
+
+size_t digestSize(int algorithm)
+{
+        return sizes[algorithm];
+}
+
+const char* digestImplementation(int algorithm)
+{
+#ifdef DIGEST_HAVE_X86
+        if ((algorithm == DIGEST_SHA1 || algorithm == DIGEST_SHA256) && shaExtensions())
+                return "sha-ni";
+        if (algorithm == DIGEST_BLAKE3 && blake3Avx2())
+                return "avx2";
+#endif
+        return "portable";
+}
+
+void digestInit(digest_ctx *ctx, int algorithm)
+{
+        static const uint32_t md5IV[4] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476 };
+        static const uint32_t sha1IV[5] = { 0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0 };
+
+        memset(ctx, 0, sizeof(*ctx));
+        ctx->algorithm = algorithm;
+
+        if (algorithm == DIGEST_MD5)
+                memcpy(ctx->md.h, md5IV, sizeof(md5IV));
+        else if (algorithm == DIGEST_SHA1)
+                memcpy(ctx->md.h, sha1IV, sizeof(sha1IV));
+        else if (algorithm == DIGEST_SHA256)
+                memcpy(ctx->md.h, sha256IV, sizeof(sha256IV));
+        else
+                blake3ChunkReset(&ctx->blake3, 0);
+}
+
+void digestUpdate(digest_ctx *ctx, const void *data, size_t len)
+{
+        const uint8_t *in = (const uint8_t*)data;
+        digest_blocks blocks;
+
+        if (ctx->algorithm == DIGEST_BLAKE3) {
+                blake3Update(&ctx->blake3, in, len);
+                return;
+        }
+
+        blocks = blockFunction(ctx->algorithm);
+        ctx->md.length += len;
+
+        if (ctx->md.used) {
+                size_t take = 64 - ctx->md.used < len ? 64 - ctx->md.used : len;
+
+                memcpy(ctx->md.block + ctx->md.used, in, take);
+                ctx->md.used += take;
+                in += take;
+                len -= take;
+                if (ctx->md.used < 64)
+                        return;
+                blocks(ctx->md.h, ctx->md.block, 1);
+                ctx->md.used = 0;
+        }
+
+        // Whole blocks straight from the caller's buffer
+        if (len >= 64) {
+                blocks(ctx->md.h, in, len / 64);
+                in += len & ~(size_t)63;
+                len &= 63;
+        }
+
+        memcpy(ctx->md.block, in, len);
+        ctx->md.used = len;
+}
+
+// Writes digestSize(algorithm) bytes to out
+void digestFinal(digest_ctx *ctx, uint8_t *out)
+{
+        uint64_t bits = ctx->md.length * 8;
+        digest_blocks blocks;
+        uint8_t pad[72] = { 0x80 };
+        size_t padLen;
+
+        if (ctx->algorithm == DIGEST_BLAKE3) {
+                blake3Final(&ctx->blake3, out);
+                return;
+        }
+
+        // 0x80, zeros up to 56 mod 64, then the length in bits (little endian for MD5)
+        blocks = blockFunction(ctx->algorithm);
+        padLen = (ctx->md.used < 56 ? 56 : 120) - ctx->md.used;
+        for (int i = 0; i < 8; ++i)
+                pad[padLen + i] = ctx->algorithm == DIGEST_MD5 ? bits >> (8 * i) : bits >> (56 - 8 * i);
+
+        memcpy(ctx->md.block + ctx->md.used, pad, 64 - ctx->md.used);
+        blocks(ctx->md.h, ctx->md.block, 1);
+        if (padLen + 8 > 64 - ctx->md.used)
+                blocks(ctx->md.h, pad + 64 - ctx->md.used, 1);
+
+        for (size_t i = 0; i < sizes[ctx->algorithm] / 4; ++i) {
+                uint32_t word = ctx->md.h[i];
+
+                for (int j = 0; j < 4; ++j)
+                        out[4 * i + j] = ctx->algorithm == DIGEST_MD5 ? word >> (8 * j) : word >> (24 - 8 * j);
+        }
+}
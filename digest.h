@@ -0,0 +1,44 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Message digests of file contents: MD5, SHA-1, SHA-256 and BLAKE3, fed
+ * incrementally. SHA-1 and SHA-256 use the SHA extensions and BLAKE3 uses
+ * AVX2 when the CPU has them.
+ */
+
+enum { DIGEST_MD5, DIGEST_SHA1, DIGEST_SHA256, DIGEST_BLAKE3, DIGEST_COUNT };
+
+#define DIGEST_MAX_SIZE         32
+
+typedef struct {
+        uint32_t cv[8];                 // Chaining value of the chunk so far
+        uint64_t counter;               // Index of the chunk
+        uint8_t block[64];
+        uint32_t blockLen;
+        uint32_t blocksCompressed;
+        uint32_t stackLen;
+        uint32_t stack[54][8];          // Subtree chaining values waiting for a sibling
+} blake3_state;
+
+typedef struct {
+        int algorithm;
+        union {
+                struct {
+                        uint32_t h[8];
+                        uint64_t length;        // Bytes fed
+                        uint8_t block[64];
+                        uint32_t used;
+                } md;                   // MD5, SHA-1 and SHA-256
+                blake3_state blake3;
+        };
+} digest_ctx;
+
+int digestParse(const char*, unsigned*);
+const char* digestName(int);
+size_t digestSize(int);
+const char* digestImplementation(int);
+void digestInit(digest_ctx*, int);
+void digestUpdate(digest_ctx*, const void*, size_t);
+void digestFinal(digest_ctx*, uint8_t*);
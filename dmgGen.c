@@ -0,0 +1,1205 @@
+// dmgGen.c : Synthesizes APFS containers wrapped in UDIF (DMG) images.
+//
+//   The benchmark suite uses it to build reproducible inputs with a chosen
+//   number of files, directories, tree depth, file sizes and chunk encoding.
+//   Every on-disk structure is written through the definitions in apfs.h and
+//   dmgParser.h so that the generator and the parser share one layout.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <zlib.h>
+#include <endian.h>
+#include "apfs.h"
+#include "unicode.h"
+
+#define GEN_SECTOR_SIZE         512
+#define GEN_XID                 5
+#define GEN_VOLUME_OID          1026
+#define GEN_FS_ROOT_OID         1028
+#define GEN_EXTENT_BLOCKS       16
+#define GEN_SPACEMAN_OID        1024
+
+#define OBJ_PHYSICAL            0x40000000
+#define OBJ_EPHEMERAL           0x80000000
+
+#define BTNODE_ROOT             0x0001
+#define BTNODE_LEAF             0x0002
+#define BTNODE_FIXED_KV_SIZE    0x0004
+#define BTOFF_INVALID           0xffff
+
+#define BTREE_PHYSICAL          0x0010
+
+#define CHUNK_TYPE_ZERO         0x00000000
+#define CHUNK_TYPE_RAW          0x00000001
+#define CHUNK_TYPE_IGNORE       0x00000002
+#define CHUNK_TYPE_ZLIB         0x80000005
+#define CHUNK_TYPE_TERMINATOR   0xffffffff
+
+enum gen_compression { GEN_ZLIB, GEN_RAW, GEN_MIXED };
+
+struct gen_opts {
+        uint32_t files;
+        uint32_t dirs;
+        uint32_t depth;
+        uint64_t file_size;
+        uint32_t chunk_sectors;
+        enum gen_compression compression;
+        uint64_t seed;
+        int case_insensitive;
+        int unhashed;                   /* Normalization-sensitive, entries keyed by name alone */
+        int unicode_names;
+        int xattrs;
+        int links;
+        int streams;                    /* Data streams with identifiers of their own */
+        int symlinks;
+        char *raw_out;
+        char *dmg_out;
+};
+
+/* One FS-tree or omap record before it is packed into a node */
+struct gen_rec {
+        uint64_t oid;
+        uint8_t type;
+        uint32_t hash;
+        uint64_t secondary;
+        const char *name;
+        uint16_t klen;
+        uint16_t vlen;
+        uint8_t key[APFS_VOLNAME_LEN + 16];
+        uint8_t val[256];
+};
+
+struct gen_image {
+        uint8_t *blocks;
+        uint8_t *is_data;               /* File data blocks, which carry no object header */
+        uint64_t block_count;
+        uint64_t next_block;
+        uint64_t next_virtual_oid;
+        struct gen_rec *omap;
+        uint32_t omap_count;
+        uint32_t omap_cap;
+};
+
+struct gen_inode {
+        uint64_t ino;
+        uint64_t parent;
+        uint32_t level;
+        int is_dir;
+        uint64_t size;
+        char name[32];
+        uint64_t link_parent;           /* Directory of a second hard link, 0 for none */
+        char link_name[32];
+        int clone;                      /* Shares the extents of the file before it */
+        uint64_t internal_flags;
+        uint64_t stream;                /* private_id, the inode number unless given its own */
+        char target[32];                /* A symbolic link's target, empty for other files */
+};
+
+static uint64_t rng_state;
+
+static uint64_t gen_rand(void)
+{
+        rng_state ^= rng_state << 13;
+        rng_state ^= rng_state >> 7;
+        rng_state ^= rng_state << 17;
+        return rng_state;
+}
+
+/* Fletcher-64 as used by obj_phys_t.o_cksum */
+static uint64_t fletcher64(const uint8_t *data, size_t len)
+{
+        uint64_t sum1 = 0, sum2 = 0, c1, c2;
+        const uint32_t *words = (const uint32_t*)data;
+
+        for (size_t i = 0; i < len / 4; ++i) {
+                sum1 = (sum1 + le32toh(words[i])) % 0xffffffff;
+                sum2 = (sum2 + sum1) % 0xffffffff;
+        }
+
+        c1 = 0xffffffff - ((sum1 + sum2) % 0xffffffff);
+        c2 = 0xffffffff - ((sum1 + c1) % 0xffffffff);
+
+        return (c2 << 32) | c1;
+}
+
+/* Raw CRC-32C register (no final inversion), as used for the drec name hash */
+static uint32_t crc32c_raw(uint32_t crc, const uint8_t *data, size_t len)
+{
+        for (size_t i = 0; i < len; ++i) {
+                crc ^= data[i];
+                for (int bit = 0; bit < 8; ++bit)
+                        crc = (crc >> 1) ^ (0x82F63B78 & -(crc & 1));
+        }
+        return crc;
+}
+
+/* The hash covers the name's code points after normalization (and case folding) */
+static uint32_t drec_hash(const char *name, int case_insensitive)
+{
+        uint32_t cps[256 * UNICODE_EXPANSION], crc = 0xffffffff;
+        size_t count = unicodeNormalize(name, strlen(name), case_insensitive, cps, sizeof(cps) / sizeof(cps[0]));
+
+        for (size_t i = 0; i < count && i < sizeof(cps) / sizeof(cps[0]); ++i) {
+                uint8_t utf32[4] = { cps[i] & 0xff, (cps[i] >> 8) & 0xff, (cps[i] >> 16) & 0xff, cps[i] >> 24 };
+                crc = crc32c_raw(crc, utf32, sizeof(utf32));
+        }
+
+        return crc & 0x3fffff;
+}
+
+static uint8_t* gen_block(struct gen_image *img, uint64_t blk)
+{
+        return img->blocks + blk * BLK_SIZE;
+}
+
+static uint64_t gen_alloc(struct gen_image *img, uint64_t count)
+{
+        uint64_t blk = img->next_block;
+
+        img->next_block += count;
+        if (img->next_block > img->block_count) {
+                printf("Container is too small for the requested tree!\n");
+                exit(1);
+        }
+
+        return blk;
+}
+
+static void gen_obj_header(uint8_t *block, uint64_t oid, uint32_t type, uint32_t subtype)
+{
+        obj_phys_t *obj = (obj_phys_t*)block;
+
+        obj->o_oid = oid;
+        obj->o_xid = GEN_XID;
+        obj->o_type = type;
+        obj->o_subtype = subtype;
+}
+
+static void gen_omap_add(struct gen_image *img, uint64_t oid, uint64_t paddr)
+{
+        struct gen_rec *rec;
+
+        if (img->omap_count == img->omap_cap) {
+                img->omap_cap = img->omap_cap ? img->omap_cap * 2 : 64;
+                img->omap = realloc(img->omap, img->omap_cap * sizeof(*img->omap));
+        }
+
+        rec = &img->omap[img->omap_count++];
+        memset(rec, 0, sizeof(*rec));
+        rec->oid = oid;
+
+        tApFS_0B_ObjectsMap_Key_t key = { oid, GEN_XID };
+        tApFS_0B_ObjectsMap_Value_t val = { 0, BLK_SIZE, paddr };
+        memcpy(rec->key, &key, sizeof(key));
+        memcpy(rec->val, &val, sizeof(val));
+        rec->klen = sizeof(key);
+        rec->vlen = sizeof(val);
+}
+
+static int rec_compare(const void *a, const void *b)
+{
+        const struct gen_rec *ra = a, *rb = b;
+
+        if (ra->oid != rb->oid)
+                return ra->oid < rb->oid ? -1 : 1;
+        if (ra->type != rb->type)
+                return ra->type < rb->type ? -1 : 1;
+        if (ra->hash != rb->hash)
+                return ra->hash < rb->hash ? -1 : 1;
+        if (ra->name && rb->name)
+                return strcmp(ra->name, rb->name);
+        if (ra->secondary != rb->secondary)
+                return ra->secondary < rb->secondary ? -1 : 1;
+        return 0;
+}
+
+/* Bytes a record occupies in a node of the given kind */
+static uint32_t rec_space(const struct gen_rec *rec, int fixed, uint16_t vlen)
+{
+        if (fixed)
+                return sizeof(kvoff_t) + rec->klen + vlen;
+        return sizeof(kvloc_t) + ((rec->klen + 7) & ~7) + ((vlen + 7) & ~7);
+}
+
+/*
+ * Writes one B-tree node holding recs[0..n) at block blk.
+ * Index nodes store the 8 byte child identifiers in children[].
+ */
+static void gen_write_node(struct gen_image *img, uint64_t blk, uint64_t oid, uint32_t storage,
+                           uint32_t subtype, int fixed, int is_root, uint16_t level,
+                           struct gen_rec *recs, uint32_t n, uint64_t *children, uint64_t total_keys,
+                           uint64_t total_nodes)
+{
+        uint8_t *block = gen_block(img, blk);
+        btree_node_phys_t *node = (btree_node_phys_t*)block;
+        uint32_t toc_len = n * (fixed ? sizeof(kvoff_t) : sizeof(kvloc_t));
+        uint8_t *toc = block + sizeof(btree_node_phys_t);
+        uint8_t *keys = toc + toc_len;
+        uint8_t *val_end = block + BLK_SIZE - (is_root ? sizeof(btree_info_t) : 0);
+        uint32_t key_used = 0, val_used = 0, longest_key = 0, longest_val = 0;
+
+        gen_obj_header(block, oid, storage | (is_root ? eApFS_ObjectType_02_BTreeRoot : eApFS_ObjectType_03_BTreeNode), subtype);
+
+        node->btn_flags = (is_root ? BTNODE_ROOT : 0) | (level == 0 ? BTNODE_LEAF : 0) | (fixed ? BTNODE_FIXED_KV_SIZE : 0);
+        node->btn_level = level;
+        node->btn_nkeys = n;
+        node->btn_table_space.off = 0;
+        node->btn_table_space.len = toc_len;
+        node->btn_key_free_list.off = BTOFF_INVALID;
+        node->btn_val_free_list.off = BTOFF_INVALID;
+
+        for (uint32_t i = 0; i < n; ++i) {
+                const uint8_t *val = level == 0 ? recs[i].val : (const uint8_t*)&children[i];
+                uint16_t vlen = level == 0 ? recs[i].vlen : sizeof(uint64_t);
+
+                memcpy(keys + key_used, recs[i].key, recs[i].klen);
+                val_used += fixed ? vlen : ((vlen + 7) & ~7);
+                memcpy(val_end - val_used, val, vlen);
+
+                if (fixed) {
+                        kvoff_t *entry = (kvoff_t*)toc + i;
+                        entry->k = key_used;
+                        entry->v = val_used;
+                        key_used += recs[i].klen;
+                } else {
+                        kvloc_t *entry = (kvloc_t*)toc + i;
+                        entry->k.off = key_used;
+                        entry->k.len = recs[i].klen;
+                        entry->v.off = val_used;
+                        entry->v.len = vlen;
+                        key_used += (recs[i].klen + 7) & ~7;
+                }
+
+                if (recs[i].klen > longest_key)
+                        longest_key = recs[i].klen;
+                if (vlen > longest_val)
+                        longest_val = vlen;
+        }
+
+        node->btn_free_space.off = key_used;
+        node->btn_free_space.len = (val_end - keys) - key_used - val_used;
+
+        if (is_root) {
+                btree_info_t *info = (btree_info_t*)(block + BLK_SIZE - sizeof(btree_info_t));
+                info->bt_fixed.bt_flags = storage == OBJ_PHYSICAL ? BTREE_PHYSICAL : 0;
+                info->bt_fixed.bt_node_size = BLK_SIZE;
+                info->bt_fixed.bt_key_size = fixed ? recs[0].klen : 0;
+                info->bt_fixed.bt_val_size = fixed ? sizeof(tApFS_0B_ObjectsMap_Value_t) : 0;
+                info->bt_longest_key = longest_key;
+                info->bt_longest_val = longest_val;
+                info->bt_key_count = total_keys;
+                info->bt_node_count = total_nodes;
+        }
+}
+
+/*
+ * Packs the sorted records into a B-tree and returns the root's identifier.
+ * Virtual trees (the FS tree) get their nodes registered in the volume omap;
+ * physical trees (omaps, extent-ref and snapshot trees) use block numbers.
+ */
+static uint64_t gen_btree(struct gen_image *img, struct gen_rec *recs, uint32_t n, int fixed,
+                          uint32_t storage, uint32_t subtype)
+{
+        uint32_t level_count = n, level = 0;
+        uint64_t total_nodes = 0;
+        struct gen_rec *level_recs = recs;
+        uint64_t *children = NULL;
+        uint32_t root_space = BLK_SIZE - sizeof(btree_node_phys_t) - sizeof(btree_info_t);
+        uint32_t node_space = BLK_SIZE - sizeof(btree_node_phys_t);
+
+        for (;;) {
+                uint32_t need = 0, vlen;
+
+                for (uint32_t i = 0; i < level_count; ++i) {
+                        vlen = level == 0 ? level_recs[i].vlen : sizeof(uint64_t);
+                        need += rec_space(&level_recs[i], fixed, vlen);
+                }
+
+                if (need <= root_space) {
+                        uint64_t blk = gen_alloc(img, 1);
+                        uint64_t oid = storage == OBJ_PHYSICAL ? blk : img->next_virtual_oid++;
+
+                        if (storage != OBJ_PHYSICAL)
+                                gen_omap_add(img, oid, blk);
+
+                        gen_write_node(img, blk, oid, storage, subtype, fixed, 1, level,
+                                       level_recs, level_count, children, n, total_nodes + 1);
+                        free(children);
+                        if (level_recs != recs)
+                                free(level_recs);
+                        return oid;
+                }
+
+                /* Split this level into nodes and build the parent level from their first keys */
+                struct gen_rec *parents = calloc(level_count, sizeof(*parents));
+                uint64_t *parent_children = calloc(level_count, sizeof(uint64_t));
+                uint32_t parent_count = 0, start = 0;
+
+                while (start < level_count) {
+                        uint32_t used = 0, end = start;
+
+                        while (end < level_count) {
+                                vlen = level == 0 ? level_recs[end].vlen : sizeof(uint64_t);
+                                if (used + rec_space(&level_recs[end], fixed, vlen) > node_space)
+                                        break;
+                                used += rec_space(&level_recs[end], fixed, vlen);
+                                end++;
+                        }
+
+                        uint64_t blk = gen_alloc(img, 1);
+                        uint64_t oid = storage == OBJ_PHYSICAL ? blk : img->next_virtual_oid++;
+
+                        if (storage != OBJ_PHYSICAL)
+                                gen_omap_add(img, oid, blk);
+
+                        gen_write_node(img, blk, oid, storage, subtype, fixed, 0, level,
+                                       level_recs + start, end - start, children ? children + start : NULL, 0, 0);
+                        total_nodes++;
+
+                        parents[parent_count] = level_recs[start];
+                        parent_children[parent_count++] = oid;
+                        start = end;
+                }
+
+                free(children);
+                if (level_recs != recs)
+                        free(level_recs);
+
+                level_recs = parents;
+                children = parent_children;
+                level_count = parent_count;
+                level++;
+        }
+}
+
+static void rec_push(struct gen_rec **recs, uint32_t *count, uint32_t *cap, struct gen_rec *rec)
+{
+        if (*count == *cap) {
+                *cap = *cap ? *cap * 2 : 256;
+                *recs = realloc(*recs, *cap * sizeof(**recs));
+        }
+        (*recs)[(*count)++] = *rec;
+}
+
+static void rec_set_key_header(struct gen_rec *rec, uint64_t oid, uint8_t type)
+{
+        uint64_t hdr = (oid & OBJ_ID_MASK) | ((uint64_t)type << OBJ_TYPE_SHIFT);
+
+        rec->oid = oid;
+        rec->type = type;
+        memcpy(rec->key, &hdr, sizeof(hdr));
+        rec->klen = sizeof(hdr);
+}
+
+/* Appends the inode record, with its name and data stream extended fields */
+static void gen_inode_rec(struct gen_rec *rec, struct gen_inode *ino, uint64_t nchildren)
+{
+        j_inode_val_t *val = (j_inode_val_t*)rec->val;
+        xf_blob_t *blob = (xf_blob_t*)val->xfields;
+        x_field_t *fields = (x_field_t*)blob->xf_data;
+        uint16_t name_len = strlen(ino->name) + 1;
+        uint16_t nfields = ino->is_dir || ino->target[0] ? 1 : 2;
+        uint8_t *data = (uint8_t*)(fields + nfields);
+        uint16_t used = 0;
+
+        memset(rec, 0, sizeof(*rec));
+        rec_set_key_header(rec, ino->ino, APFS_TYPE_INODE);
+
+        val->parent_id = ino->parent;
+        val->private_id = ino->stream ? ino->stream : ino->ino;
+        val->create_time = val->mod_time = val->change_time = val->access_time = 1600000000ULL * 1000000000ULL;
+        val->internal_flags = ino->internal_flags;
+        val->nchildren = ino->is_dir ? nchildren : ino->link_parent ? 2 : 1;
+        val->owner = 99;
+        val->group = 99;
+        val->mode = ino->is_dir ? (S_IFDIR | 0755) : ino->target[0] ? (S_IFLNK | 0755) : (S_IFREG | 0644);
+        val->uncompressed_size = 0;
+
+        fields[0].x_type = INO_EXT_TYPE_NAME;
+        fields[0].x_flags = 0x2;
+        fields[0].x_size = name_len;
+        memcpy(data + used, ino->name, name_len);
+        used += (name_len + 7) & ~7;
+
+        if (nfields == 2) {
+                j_dstream_t dstream = { ino->size, (ino->size + BLK_SIZE - 1) & ~(uint64_t)(BLK_SIZE - 1), 0, ino->size, 0 };
+
+                fields[1].x_type = INO_EXT_TYPE_DSTREAM;
+                fields[1].x_flags = 0x20;
+                fields[1].x_size = sizeof(dstream);
+                memcpy(data + used, &dstream, sizeof(dstream));
+                used += sizeof(dstream);
+        }
+
+        blob->xf_num_exts = nfields;
+        blob->xf_used_data = used;
+        rec->vlen = sizeof(j_inode_val_t) + sizeof(xf_blob_t) + nfields * sizeof(x_field_t) + used;
+}
+
+/* Appends the entry naming ino in directory parent, keyed by name alone on an unhashed volume */
+static void gen_drec_rec(struct gen_rec *rec, struct gen_inode *ino, uint64_t parent, const char *name,
+                         struct gen_opts *opts)
+{
+        j_drec_val_t *val = (j_drec_val_t*)rec->val;
+        uint32_t name_len = strlen(name) + 1;
+
+        memset(rec, 0, sizeof(*rec));
+        rec_set_key_header(rec, parent, APFS_TYPE_DIR_REC);
+        rec->name = name;
+
+        if (opts->unhashed) {
+                j_drec_key_t *key = (j_drec_key_t*)rec->key;
+
+                key->name_len = name_len;
+                memcpy(key->name, name, name_len);
+                rec->klen = sizeof(j_drec_key_t) + name_len;
+        } else {
+                j_drec_hashed_key_t *key = (j_drec_hashed_key_t*)rec->key;
+
+                rec->hash = drec_hash(name, opts->case_insensitive);
+                key->name_len_and_hash = (rec->hash << J_DREC_HASH_SHIFT) | name_len;
+                memcpy(key->name, name, name_len);
+                rec->klen = sizeof(j_drec_hashed_key_t) + name_len;
+        }
+
+        val->file_id = ino->ino;
+        val->date_added = 1600000000ULL * 1000000000ULL;
+        val->flags = ino->is_dir ? DT_DIR : ino->target[0] ? DT_LNK : DT_REG;
+        rec->vlen = sizeof(j_drec_val_t);
+}
+
+/* Appends a hard link's sibling link, under the inode, and its sibling map */
+static void gen_sibling_recs(struct gen_rec **recs, uint32_t *count, uint32_t *cap, uint64_t ino,
+                             uint64_t sibling, uint64_t parent, const char *name)
+{
+        j_sibling_val_t *val;
+        j_sibling_map_val_t map = { ino };
+        struct gen_rec rec;
+        uint16_t name_len = strlen(name) + 1;
+
+        memset(&rec, 0, sizeof(rec));
+        rec_set_key_header(&rec, ino, APFS_TYPE_SIBLING_LINK);
+        rec.secondary = sibling;
+        memcpy(rec.key + rec.klen, &sibling, sizeof(sibling));
+        rec.klen += sizeof(sibling);
+        val = (j_sibling_val_t*)rec.val;
+        val->parent_id = parent;
+        val->name_len = name_len;
+        memcpy(val->name, name, name_len);
+        rec.vlen = sizeof(j_sibling_val_t) + name_len;
+        rec_push(recs, count, cap, &rec);
+
+        memset(&rec, 0, sizeof(rec));
+        rec_set_key_header(&rec, sibling, APFS_TYPE_SIBLING_MAP);
+        memcpy(rec.val, &map, sizeof(map));
+        rec.vlen = sizeof(map);
+        rec_push(recs, count, cap, &rec);
+}
+
+/* Fills a file's data blocks with compressible, position-dependent text */
+static void gen_file_data(uint8_t *dst, uint64_t ino, uint64_t offset, uint64_t len)
+{
+        char line[64];
+
+        for (uint64_t pos = 0; pos < len; pos += sizeof(line)) {
+                uint64_t n = len - pos < sizeof(line) ? len - pos : sizeof(line);
+
+                snprintf(line, sizeof(line), "%08lx:%012lx APFSpy synthetic payload %08lx\n",
+                         ino, offset + pos, (unsigned long)(gen_rand() & 0xffff));
+                memset(line + strlen(line), '.', sizeof(line) - strlen(line));
+                line[sizeof(line) - 1] = '\n';
+                memcpy(dst + pos, line, n);
+        }
+}
+
+/* Appends an extended attribute record; a NULL data makes it point at the data stream stream */
+static void gen_xattr_rec(struct gen_rec *rec, uint64_t oid, const char *name, const void *data, uint16_t len,
+                          uint64_t stream, uint64_t size)
+{
+        j_xattr_key_t *key = (j_xattr_key_t*)rec->key;
+        j_xattr_val_t *val = (j_xattr_val_t*)rec->val;
+        uint16_t name_len = strlen(name) + 1;
+
+        memset(rec, 0, sizeof(*rec));
+        rec_set_key_header(rec, oid, APFS_TYPE_XATTR);
+        rec->name = name;
+        key->name_len = name_len;
+        memcpy(key->name, name, name_len);
+        rec->klen = sizeof(j_xattr_key_t) + name_len;
+
+        if (data != NULL) {
+                val->flags = XATTR_DATA_EMBEDDED;
+                val->xdata_len = len;
+                memcpy(val->xdata, data, len);
+        } else {
+                j_xattr_dstream_t dstream = { stream, { size, (size + BLK_SIZE - 1) & ~(uint64_t)(BLK_SIZE - 1), 0, size, 0 } };
+
+                val->flags = XATTR_DATA_STREAM;
+                val->xdata_len = sizeof(dstream);
+                memcpy(val->xdata, &dstream, sizeof(dstream));
+        }
+        rec->vlen = sizeof(j_xattr_val_t) + val->xdata_len;
+}
+
+/* Appends the reference count and the extents of a data stream, filling its blocks */
+static void gen_stream_recs(struct gen_image *img, struct gen_rec **recs, uint32_t *count, uint32_t *cap,
+                            uint64_t oid, uint64_t size)
+{
+        struct gen_rec rec;
+        uint64_t blocks = (size + BLK_SIZE - 1) / BLK_SIZE;
+        uint32_t refcnt = 1;
+
+        memset(&rec, 0, sizeof(rec));
+        rec_set_key_header(&rec, oid, APFS_TYPE_DSTREAM_ID);
+        memcpy(rec.val, &refcnt, sizeof(refcnt));
+        rec.vlen = sizeof(refcnt);
+        rec_push(recs, count, cap, &rec);
+
+        /* GEN_EXTENT_BLOCKS blocks at most per extent */
+        for (uint64_t done = 0; done < blocks; done += GEN_EXTENT_BLOCKS) {
+                uint64_t len = blocks - done < GEN_EXTENT_BLOCKS ? blocks - done : GEN_EXTENT_BLOCKS;
+                uint64_t phys = gen_alloc(img, len);
+                uint64_t logical = done * BLK_SIZE;
+                uint64_t bytes = size - logical < len * BLK_SIZE ? size - logical : len * BLK_SIZE;
+                j_file_extent_val_t extent = { bytes, phys, 0 };
+
+                gen_file_data(gen_block(img, phys), oid, logical, bytes);
+                memset(img->is_data + phys, 1, len);
+
+                memset(&rec, 0, sizeof(rec));
+                rec_set_key_header(&rec, oid, APFS_TYPE_FILE_EXTENT);
+                rec.secondary = logical;
+                memcpy(rec.key + rec.klen, &logical, sizeof(logical));
+                rec.klen += sizeof(logical);
+                memcpy(rec.val, &extent, sizeof(extent));
+                rec.vlen = sizeof(extent);
+                rec_push(recs, count, cap, &rec);
+        }
+}
+
+/* Appends the data stream records of a clone, pointing at the extents of recs[first..end) */
+static void gen_clone_recs(struct gen_rec **recs, uint32_t *count, uint32_t *cap, uint64_t oid,
+                           uint32_t first, uint32_t end)
+{
+        for (uint32_t r = first; r < end; ++r) {
+                struct gen_rec rec = (*recs)[r];
+                uint64_t hdr;
+
+                memcpy(&hdr, rec.key, sizeof(hdr));
+                hdr = (hdr & ~OBJ_ID_MASK) | (oid & OBJ_ID_MASK);
+                memcpy(rec.key, &hdr, sizeof(hdr));
+                rec.oid = oid;
+                rec_push(recs, count, cap, &rec);
+        }
+}
+
+static void gen_fs_tree(struct gen_image *img, struct gen_opts *opts, apfs_superblock_t *vsb)
+{
+        uint32_t count = opts->dirs + opts->files + 2, rec_count = 0, rec_cap = 0;
+        struct gen_inode *inodes = calloc(count, sizeof(*inodes));
+        uint64_t *nchildren = calloc(count, sizeof(uint64_t));
+        struct gen_rec *recs = NULL, rec;
+        uint64_t next_oid = MIN_USER_INO_NUM + opts->dirs + opts->files;
+        uint32_t stream_first = 0, stream_end = 0, symlinks = 0;
+        uint32_t i;
+
+        /* Root and private directory */
+        inodes[0] = (struct gen_inode){ ROOT_DIR_INO_NUM, ROOT_DIR_PARENT, 0, 1, 0, "root" };
+        inodes[1] = (struct gen_inode){ PRIV_DIR_INO_NUM, ROOT_DIR_PARENT, 0, 1, 0, "private-dir" };
+
+        /* Directories hang off any directory that is still above the requested depth */
+        for (i = 0; i < opts->dirs; ++i) {
+                struct gen_inode *dir = &inodes[2 + i];
+                struct gen_inode *parent;
+
+                do {
+                        uint32_t pick = gen_rand() % (i + 1);
+                        parent = pick == 0 ? &inodes[0] : &inodes[2 + pick - 1];
+                } while (parent->level >= opts->depth);
+
+                dir->ino = MIN_USER_INO_NUM + i;
+                dir->parent = parent->ino;
+                dir->level = parent->level + 1;
+                dir->is_dir = 1;
+                snprintf(dir->name, sizeof(dir->name), "dir%04u", i);
+        }
+
+        for (i = 0; i < opts->files; ++i) {
+                struct gen_inode *file = &inodes[2 + opts->dirs + i];
+                uint32_t pick = gen_rand() % (opts->dirs + 1);
+
+                file->ino = MIN_USER_INO_NUM + opts->dirs + i;
+                file->parent = pick == 0 ? ROOT_DIR_INO_NUM : inodes[2 + pick - 1].ino;
+                file->size = opts->file_size ? opts->file_size / 2 + gen_rand() % opts->file_size : 0;
+                // Precomposed letters, an upper case Greek one and a Hangul syllable, all stored in NFC
+                snprintf(file->name, sizeof(file->name), opts->unicode_names ? "f\u00efl\u00e9%05u-\u03a9\u03bc\u03ad-\ud55c.txt" : "file%05u.txt", i);
+        }
+
+        /* A second link to every fourth file, in any directory, and a clone of every fourth but one */
+        for (i = 0; opts->links && i < opts->files; ++i) {
+                struct gen_inode *file = &inodes[2 + opts->dirs + i];
+
+                if (i % 4 == 1) {
+                        uint32_t pick = gen_rand() % (opts->dirs + 1);
+
+                        file->link_parent = pick == 0 ? ROOT_DIR_INO_NUM : inodes[2 + pick - 1].ino;
+                        snprintf(file->link_name, sizeof(file->link_name), "link%05u.txt", i);
+                } else if (i % 4 == 3 && file[-1].size) {
+                        file->clone = 1;
+                        file->size = file[-1].size;
+                        file->internal_flags = INODE_WAS_CLONED;
+                        file[-1].internal_flags |= INODE_WAS_EVER_CLONED;
+                }
+        }
+
+        /* Every eighth file, one no link or clone touches, becomes a symbolic link to the file before it */
+        for (i = 4; opts->symlinks && i < opts->files; i += 8) {
+                struct gen_inode *file = &inodes[2 + opts->dirs + i];
+
+                snprintf(file->target, sizeof(file->target), "%s", file[-1].name);
+                file->size = 0;
+                symlinks++;
+        }
+
+        /* Every other file keeps its data in a stream identified apart from its inode */
+        for (i = 0; opts->streams && i < opts->files; i += 2)
+                if (!inodes[2 + opts->dirs + i].target[0])
+                        inodes[2 + opts->dirs + i].stream = next_oid++;
+
+        for (i = 2; i < count; ++i)
+                for (uint32_t p = 0; p < count; ++p) {
+                        if (inodes[p].is_dir && inodes[p].ino == inodes[i].parent)
+                                nchildren[p]++;
+                        if (inodes[p].is_dir && inodes[p].ino == inodes[i].link_parent)
+                                nchildren[p]++;
+                }
+
+        for (i = 0; i < count; ++i) {
+                struct gen_inode *ino = &inodes[i];
+
+                gen_inode_rec(&rec, ino, nchildren[i]);
+                rec_push(&recs, &rec_count, &rec_cap, &rec);
+
+                if (i >= 2) {
+                        gen_drec_rec(&rec, ino, ino->parent, ino->name, opts);
+                        rec_push(&recs, &rec_count, &rec_cap, &rec);
+                }
+
+                if (ino->link_parent) {
+                        gen_drec_rec(&rec, ino, ino->link_parent, ino->link_name, opts);
+                        rec_push(&recs, &rec_count, &rec_cap, &rec);
+                        gen_sibling_recs(&recs, &rec_count, &rec_cap, ino->ino, next_oid++, ino->parent, ino->name);
+                        gen_sibling_recs(&recs, &rec_count, &rec_cap, ino->ino, next_oid++, ino->link_parent, ino->link_name);
+                }
+
+                if (ino->target[0]) {
+                        gen_xattr_rec(&rec, ino->ino, SYMLINK_EA_NAME, ino->target, strlen(ino->target) + 1, 0, 0);
+                        ((j_xattr_val_t*)rec.val)->flags |= XATTR_FILE_SYSTEM_OWNED;
+                        rec_push(&recs, &rec_count, &rec_cap, &rec);
+                }
+
+                if (ino->is_dir || ino->size == 0)
+                        continue;
+
+                if (ino->clone) {
+                        gen_clone_recs(&recs, &rec_count, &rec_cap, ino->stream ? ino->stream : ino->ino,
+                                       stream_first, stream_end);
+                        continue;
+                }
+
+                stream_first = rec_count;
+                gen_stream_recs(img, &recs, &rec_count, &rec_cap, ino->stream ? ino->stream : ino->ino, ino->size);
+                stream_end = rec_count;
+        }
+
+        /*
+         * Finder info on every directory, a quarantine flag on every third file
+         * and, on every fifth, a resource fork in a data stream of its own
+         */
+        for (i = 2; opts->xattrs && i < count; ++i) {
+                static const char quarantine[] = "0083;5f5e1000;Safari;";
+                uint8_t finder[32] = { 'T', 'E', 'X', 'T', 't', 't', 'x', 't' };
+                struct gen_inode *ino = &inodes[i];
+
+                if (ino->is_dir) {
+                        gen_xattr_rec(&rec, ino->ino, "com.apple.FinderInfo", finder, sizeof(finder), 0, 0);
+                        rec_push(&recs, &rec_count, &rec_cap, &rec);
+                        continue;
+                }
+                if (i % 3 == 0) {
+                        gen_xattr_rec(&rec, ino->ino, "com.apple.quarantine", quarantine, sizeof(quarantine) - 1, 0, 0);
+                        rec_push(&recs, &rec_count, &rec_cap, &rec);
+                }
+                if (i % 5 == 0) {
+                        uint64_t size = 2 * BLK_SIZE + 123 * (i % 7);
+
+                        gen_xattr_rec(&rec, ino->ino, "com.apple.ResourceFork", NULL, 0, next_oid, size);
+                        rec_push(&recs, &rec_count, &rec_cap, &rec);
+                        gen_stream_recs(img, &recs, &rec_count, &rec_cap, next_oid++, size);
+                }
+        }
+
+        qsort(recs, rec_count, sizeof(*recs), rec_compare);
+        vsb->apfs_root_tree_oid = gen_btree(img, recs, rec_count, 0, 0, eApFS_ObjectType_0E_FileSystemTree);
+        vsb->apfs_num_files = opts->files - symlinks;
+        vsb->apfs_num_symlinks = symlinks;
+        vsb->apfs_num_directories = opts->dirs + 2;
+        vsb->apfs_next_obj_id = next_oid;
+
+        free(recs);
+        free(inodes);
+        free(nchildren);
+}
+
+static uint64_t gen_omap(struct gen_image *img, struct gen_rec *entries, uint32_t count)
+{
+        uint64_t blk = gen_alloc(img, 1);
+        omap_phys_t *omap = (omap_phys_t*)gen_block(img, blk);
+
+        qsort(entries, count, sizeof(*entries), rec_compare);
+
+        gen_obj_header((uint8_t*)omap, blk, OBJ_PHYSICAL | eApFS_ObjectType_0B_ObjectsMap, 0);
+        omap->om_tree_type = OBJ_PHYSICAL | eApFS_ObjectType_02_BTreeRoot;
+        omap->om_snapshot_tree_type = OBJ_PHYSICAL | eApFS_ObjectType_02_BTreeRoot;
+        omap->om_tree_oid = gen_btree(img, entries, count, 1, OBJ_PHYSICAL, eApFS_ObjectType_0B_ObjectsMap);
+
+        return blk;
+}
+
+static uint64_t gen_empty_tree(struct gen_image *img, uint32_t subtype)
+{
+        return gen_btree(img, NULL, 0, 0, OBJ_PHYSICAL, subtype);
+}
+
+/*
+ * Fills the space manager allocated by gen_container: one chunk-info block
+ * whose chunks each have a bitmap block, with blocks 0 to next_block marked
+ * in use. Chunks past next_block keep a bitmap of zeros.
+ */
+static void gen_spaceman(struct gen_image *img, uint64_t sm_blk, uint64_t cib_blk, uint64_t bitmap_blk, uint32_t chunks)
+{
+        spaceman_phys_t *sm = (spaceman_phys_t*)gen_block(img, sm_blk);
+        chunk_info_block_t *cib = (chunk_info_block_t*)gen_block(img, cib_blk);
+        uint64_t blocks_per_chunk = BLK_SIZE * 8;
+
+        gen_obj_header((uint8_t*)sm, GEN_SPACEMAN_OID, OBJ_EPHEMERAL | eApFS_ObjectType_05_SpaceManager, 0);
+        sm->sm_block_size = BLK_SIZE;
+        sm->sm_blocks_per_chunk = blocks_per_chunk;
+        sm->sm_chunks_per_cib = (BLK_SIZE - sizeof(chunk_info_block_t)) / sizeof(chunk_info_t);
+        sm->sm_cibs_per_cab = (BLK_SIZE - sizeof(cib_addr_block_t)) / sizeof(uint64_t);
+        sm->sm_dev[SD_MAIN].sm_block_count = img->block_count;
+        sm->sm_dev[SD_MAIN].sm_chunk_count = chunks;
+        sm->sm_dev[SD_MAIN].sm_cib_count = 1;
+        sm->sm_dev[SD_MAIN].sm_free_count = img->block_count - img->next_block;
+        sm->sm_dev[SD_MAIN].sm_addr_offset = (sizeof(spaceman_phys_t) + 7) & ~7;
+        memcpy((uint8_t*)sm + sm->sm_dev[SD_MAIN].sm_addr_offset, &cib_blk, sizeof(cib_blk));
+        sm->sm_struct_size = sizeof(spaceman_phys_t);
+
+        gen_obj_header((uint8_t*)cib, cib_blk, OBJ_PHYSICAL | eApFS_ObjectType_07_SpaceManagerCIB, 0);
+        cib->cib_chunk_info_count = chunks;
+
+        for (uint32_t i = 0; i < chunks; ++i) {
+                chunk_info_t *ci = &cib->cib_chunk_info[i];
+                uint8_t *bits = gen_block(img, bitmap_blk + i);
+                uint64_t first = i * blocks_per_chunk, used = 0;
+
+                ci->ci_xid = GEN_XID;
+                ci->ci_addr = first;
+                ci->ci_block_count = img->block_count - first < blocks_per_chunk ? img->block_count - first : blocks_per_chunk;
+                ci->ci_bitmap_addr = bitmap_blk + i;
+
+                for (uint64_t b = first; b < img->next_block && b < first + ci->ci_block_count; ++b, ++used)
+                        bits[(b - first) / 8] |= 1 << ((b - first) % 8);
+                ci->ci_free_count = ci->ci_block_count - used;
+                img->is_data[bitmap_blk + i] = 1;
+        }
+}
+
+/* Lays out the whole container: superblock, checkpoint, omaps, volume, FS tree and file data */
+static void gen_container(struct gen_image *img, struct gen_opts *opts)
+{
+        uint8_t *nx_block, *cp_block;
+        APFS_SuperBlk *nx;
+        apfs_superblock_t *vsb;
+        checkPoint_Map *cpm;
+        uint64_t vsb_blk, sm_blk, cib_blk, bitmap_blk, desc_base = 1;
+        uint32_t desc_blocks = 2, chunks = (img->block_count + BLK_SIZE * 8 - 1) / (BLK_SIZE * 8);
+
+        img->next_block = desc_base + desc_blocks;
+        img->next_virtual_oid = GEN_FS_ROOT_OID;
+
+        /* The space manager is filled last, once every block is allocated */
+        if (chunks > (BLK_SIZE - sizeof(chunk_info_block_t)) / sizeof(chunk_info_t)) {
+                printf("Container is too large for one chunk-info block!\n");
+                exit(1);
+        }
+        sm_blk = gen_alloc(img, 1);
+        cib_blk = gen_alloc(img, 1);
+        bitmap_blk = gen_alloc(img, chunks);
+
+        /* Volume superblock first so that its fields can be filled as the trees get built */
+        vsb_blk = gen_alloc(img, 1);
+        vsb = (apfs_superblock_t*)gen_block(img, vsb_blk);
+        gen_obj_header((uint8_t*)vsb, GEN_VOLUME_OID, eApFS_ObjectType_0D_FileSystem, 0);
+        vsb->apfs_magic = 0x42535041;      /* APSB */
+        vsb->apfs_incompatible_features = (opts->unhashed ? 0 : APFS_INCOMPAT_NORMALIZATION_INSENSITIVE) |
+                (opts->case_insensitive ? APFS_INCOMPAT_CASE_INSENSITIVE : 0);
+        vsb->apfs_root_tree_type = eApFS_ObjectType_02_BTreeRoot;
+        vsb->apfs_extentref_tree_type = OBJ_PHYSICAL | eApFS_ObjectType_02_BTreeRoot;
+        vsb->apfs_snap_meta_tree_type = OBJ_PHYSICAL | eApFS_ObjectType_02_BTreeRoot;
+        vsb->apfs_last_mod_time = 1600000000ULL * 1000000000ULL;
+        snprintf((char*)vsb->apfs_volname, sizeof(vsb->apfs_volname), "apfsBench");
+        memcpy(vsb->apfs_formatted_by.id, "dmgGen", 6);
+
+        gen_fs_tree(img, opts, vsb);
+        vsb->apfs_extentref_tree_oid = gen_empty_tree(img, eApFS_ObjectType_0F_BlockReferenceTree);
+        vsb->apfs_snap_meta_tree_oid = gen_empty_tree(img, eApFS_ObjectType_10_SnapshotMetaTree);
+        vsb->apfs_omap_oid = gen_omap(img, img->omap, img->omap_count);
+        vsb->apfs_fs_alloc_count = img->next_block;
+
+        /* Container omap: just the volume */
+        img->omap_count = 0;
+        gen_omap_add(img, GEN_VOLUME_OID, vsb_blk);
+
+        nx_block = gen_block(img, 0);
+        nx = (APFS_SuperBlk*)(nx_block + sizeof(obj_phys_t));
+        gen_obj_header(nx_block, 1, OBJ_EPHEMERAL | eApFS_ObjectType_01_SuperBlock, 0);
+        nx->MagicNumber = 0x4253584E;      /* NXSB */
+        nx->BlockSize = BLK_SIZE;
+        nx->BlocksCount = img->block_count;
+        for (int i = 0; i < 16; ++i)
+                nx->Uuid[i] = gen_rand();
+        nx->NextTransaction = GEN_XID + 1;
+        nx->NextIdent = img->next_virtual_oid;
+        nx->DescriptorBlocks = desc_blocks;
+        nx->DescriptorBase = desc_base;
+        nx->DescriptorIndex = 0;
+        nx->DescriptorLength = desc_blocks;
+        nx->ObjectsMapIdent = gen_omap(img, img->omap, img->omap_count);
+        nx->SpaceManagerIdent = GEN_SPACEMAN_OID;
+        nx->MaximumVolumes = NX_MAX_FILE_SYSTEMS;
+        nx->VolumesIdents[0] = GEN_VOLUME_OID;
+
+        gen_spaceman(img, sm_blk, cib_blk, bitmap_blk, chunks);
+
+        /* Checkpoint: a mapping block for the space manager followed by the superblock copy */
+        cp_block = gen_block(img, desc_base);
+        cpm = (checkPoint_Map*)cp_block;
+        gen_obj_header(cp_block, desc_base, OBJ_PHYSICAL | eApFS_ObjectType_0C_CheckPointMap, 0);
+        cpm->cpm_flags = CHECKPOINT_MAP_LAST;
+        cpm->cpm_count = 1;
+        cpm->cpm_map[0].cpm_type = OBJ_EPHEMERAL | eApFS_ObjectType_05_SpaceManager;
+        cpm->cpm_map[0].cpm_size = BLK_SIZE;
+        cpm->cpm_map[0].cpm_oid = GEN_SPACEMAN_OID;
+        cpm->cpm_map[0].cpm_paddr = sm_blk;
+
+        memcpy(gen_block(img, desc_base + 1), nx_block, BLK_SIZE);
+
+        for (uint64_t blk = 0; blk < img->next_block; ++blk) {
+                uint8_t *block = gen_block(img, blk);
+                obj_phys_t *obj = (obj_phys_t*)block;
+                uint64_t cksum;
+
+                if (obj->o_type == 0 || img->is_data[blk])
+                        continue;
+                cksum = fletcher64(block + MAX_CKSUM_SIZE, BLK_SIZE - MAX_CKSUM_SIZE);
+                memcpy(obj->o_cksum, &cksum, sizeof(cksum));
+        }
+}
+
+/* ---------------------------------------------------------------------- */
+/* DMG wrapping                                                           */
+/* ---------------------------------------------------------------------- */
+
+struct gen_partition {
+        const char *name;
+        uint64_t first_sector;
+        uint64_t sector_count;
+        const uint8_t *data;            /* NULL for free space */
+        uint8_t *blkx;
+        size_t blkx_len;
+};
+
+static int is_zero(const uint8_t *data, size_t len)
+{
+        for (size_t i = 0; i < len; ++i)
+                if (data[i])
+                        return 0;
+        return 1;
+}
+
+/* Writes the partition's chunks to the data fork and builds its mish table */
+static void gen_write_partition(FILE *out, struct gen_partition *part, struct gen_opts *opts, uint32_t id)
+{
+        uint64_t chunk_count = (part->sector_count + opts->chunk_sectors - 1) / opts->chunk_sectors;
+        size_t len = sizeof(BLKXTable) + (chunk_count + 1) * sizeof(BLKXChunkEntry);
+        BLKXTable *blkx = calloc(1, len);
+        uLong crc = crc32(0, Z_NULL, 0);
+        uint64_t chunk;
+
+        memcpy(&blkx->Signature, "mish", 4);
+        blkx->Version = htobe32(1);
+        blkx->SectorNumber = htobe64(part->first_sector);
+        blkx->SectorCount = htobe64(part->sector_count);
+        blkx->BuffersNeeded = htobe32(opts->chunk_sectors);
+        blkx->BlockDescriptors = htobe32(id);
+        blkx->checksum.ChecksumType = htobe32(2);
+        blkx->checksum.ChecksumSize = htobe32(32);
+        blkx->NumberOfBlockChunks = htobe32(chunk_count + 1);
+
+        for (chunk = 0; chunk < chunk_count; ++chunk) {
+                BLKXChunkEntry *entry = &blkx->chunk[chunk];
+                uint64_t sector = chunk * opts->chunk_sectors;
+                uint64_t sectors = part->sector_count - sector < opts->chunk_sectors ? part->sector_count - sector : opts->chunk_sectors;
+                uint64_t bytes = sectors * GEN_SECTOR_SIZE;
+                const uint8_t *data = part->data ? part->data + sector * GEN_SECTOR_SIZE : NULL;
+                uint32_t type;
+                uint64_t offset = ftell(out), written = 0;
+
+                if (data)
+                        crc = crc32(crc, data, bytes);
+                else {
+                        uint8_t zero[GEN_SECTOR_SIZE] = {0};
+                        for (uint64_t s = 0; s < sectors; ++s)
+                                crc = crc32(crc, zero, sizeof(zero));
+                }
+
+                if (data == NULL) {
+                        type = CHUNK_TYPE_IGNORE;
+                } else if (is_zero(data, bytes)) {
+                        type = CHUNK_TYPE_ZERO;
+                } else {
+                        int compress_chunk = opts->compression == GEN_ZLIB ||
+                                (opts->compression == GEN_MIXED && (chunk & 1) == 0);
+                        uLongf comp_len = compressBound(bytes);
+                        uint8_t *comp = malloc(comp_len);
+
+                        if (compress_chunk && compress2(comp, &comp_len, data, bytes, 6) == Z_OK && comp_len < bytes) {
+                                type = CHUNK_TYPE_ZLIB;
+                                written = fwrite(comp, 1, comp_len, out);
+                        } else {
+                                type = CHUNK_TYPE_RAW;
+                                written = fwrite(data, 1, bytes, out);
+                        }
+                        free(comp);
+                }
+
+                entry->EntryType = htobe32(type);
+                entry->SectorNumber = htobe64(sector);
+                entry->SectorCount = htobe64(sectors);
+                entry->CompressedOffset = htobe64(offset);
+                entry->CompressedLength = htobe64(written);
+        }
+
+        blkx->chunk[chunk].EntryType = htobe32(CHUNK_TYPE_TERMINATOR);
+        blkx->chunk[chunk].SectorNumber = htobe64(part->sector_count);
+        blkx->chunk[chunk].CompressedOffset = htobe64(ftell(out));
+
+        blkx->checksum.Checksum[0] = htobe32(crc);
+        part->blkx = (uint8_t*)blkx;
+        part->blkx_len = len;
+}
+
+static void gen_write_plist(FILE *out, struct gen_partition *parts, int count)
+{
+        fprintf(out, "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+                "<!DOCTYPE plist PUBLIC \"-//Apple//DTD PLIST 1.0//EN\" \"http://www.apple.com/DTDs/PropertyList-1.0.dtd\">\n"
+                "<plist version=\"1.0\">\n<dict>\n\t<key>resource-fork</key>\n\t<dict>\n\t\t<key>blkx</key>\n\t\t<array>\n");
+
+        for (int i = 0; i < count; ++i) {
+                size_t encoded_len = 0;
+                char *encoded = base64_encode((const char*)parts[i].blkx, parts[i].blkx_len, &encoded_len);
+
+                fprintf(out, "\t\t\t<dict>\n\t\t\t\t<key>Attributes</key>\n\t\t\t\t<string>0x0050</string>\n"
+                        "\t\t\t\t<key>CFName</key>\n\t\t\t\t<string>%s</string>\n"
+                        "\t\t\t\t<key>Data</key>\n\t\t\t\t<data>\n", parts[i].name);
+
+                for (size_t pos = 0; pos < encoded_len; pos += 52)
+                        fprintf(out, "\t\t\t\t%.*s\n", (int)(encoded_len - pos < 52 ? encoded_len - pos : 52), encoded + pos);
+
+                fprintf(out, "\t\t\t\t</data>\n\t\t\t\t<key>ID</key>\n\t\t\t\t<string>%d</string>\n"
+                        "\t\t\t\t<key>Name</key>\n\t\t\t\t<string>%s</string>\n\t\t\t</dict>\n", i - 1, parts[i].name);
+                free(encoded);
+        }
+
+        fprintf(out, "\t\t</array>\n\t</dict>\n</dict>\n</plist>\n");
+}
+
+static int gen_write_dmg(struct gen_image *img, struct gen_opts *opts)
+{
+        uint64_t apfs_sectors = img->block_count * BLK_SIZE / GEN_SECTOR_SIZE;
+        uint8_t *mbr = calloc(1, GEN_SECTOR_SIZE), *gpt = calloc(34, GEN_SECTOR_SIZE);
+        UDIFResourceFile koly = {0};
+        uLong master_crc = crc32(0, Z_NULL, 0), data_crc = crc32(0, Z_NULL, 0);
+        FILE *out;
+
+        /* Just enough of the MBR and GPT for the partitions to carry real bytes */
+        mbr[510] = 0x55;
+        mbr[511] = 0xAA;
+        memcpy(gpt, "EFI PART", 8);
+
+        struct gen_partition parts[] = {
+                { "Protective Master Boot Record (MBR : 0)", 0, 1, mbr },
+                { "GPT Header (Primary GPT Header : 1)", 1, 1, gpt },
+                { "GPT Partition Data (Primary GPT Table : 2)", 2, 32, gpt + GEN_SECTOR_SIZE },
+                { " (Apple_Free : 3)", 34, 6, NULL },
+                { "disk image (Apple_APFS : 4)", 40, apfs_sectors, img->blocks },
+                { "GPT Partition Data (Backup GPT Table : 5)", 40 + apfs_sectors, 32, gpt + GEN_SECTOR_SIZE },
+                { "GPT Header (Backup GPT Header : 6)", 72 + apfs_sectors, 1, gpt },
+        };
+        int count = sizeof(parts) / sizeof(parts[0]);
+
+        if ((out = fopen(opts->dmg_out, "w+")) == NULL) {
+                printf("Unable to create %s\n", opts->dmg_out);
+                return 1;
+        }
+
+        for (int i = 0; i < count; ++i) {
+                gen_write_partition(out, &parts[i], opts, i);
+                master_crc = crc32(master_crc, (const Bytef*)&((BLKXTable*)parts[i].blkx)->checksum.Checksum[0], 4);
+        }
+
+        uint64_t data_len = ftell(out);
+        uint8_t buf[65536];
+        size_t n;
+
+        fseek(out, 0, SEEK_SET);
+        while ((n = fread(buf, 1, sizeof(buf), out)) > 0)
+                data_crc = crc32(data_crc, buf, n);
+        fseek(out, 0, SEEK_END);
+
+        gen_write_plist(out, parts, count);
+        uint64_t xml_len = ftell(out) - data_len;
+
+        memcpy(koly.Signature, "koly", 4);
+        koly.Version = htobe32(4);
+        koly.HeaderSize = htobe32(sizeof(koly));
+        koly.Flags = htobe32(1);
+        koly.DataForkLength = htobe64(data_len);
+        koly.SegmentNumber = htobe32(1);
+        koly.SegmentCount = htobe32(1);
+        for (int i = 0; i < 16; ++i)
+                koly.SegmentID[i] = gen_rand();
+        koly.DataChecksumType = htobe32(2);
+        koly.DataChecksumSize = htobe32(32);
+        koly.DataChecksum[0] = htobe32(data_crc);
+        koly.XMLOffset = htobe64(data_len);
+        koly.XMLLength = htobe64(xml_len);
+        koly.ChecksumType = htobe32(2);
+        koly.ChecksumSize = htobe32(32);
+        koly.Checksum[0] = htobe32(master_crc);
+        koly.ImageVariant = htobe32(1);
+        koly.SectorCount = htobe64(73 + apfs_sectors);
+
+        fwrite(&koly, 1, sizeof(koly), out);
+        fclose(out);
+
+        for (int i = 0; i < count; ++i)
+                free(parts[i].blkx);
+        free(mbr);
+        free(gpt);
+
+        return 0;
+}
+
+static void gen_usage(char *prog)
+{
+        printf("Usage :\n\n%s <out.dmg> {Options}\n \
+                        -n <count>              Number of files (default 64)\n \
+                        -D <count>              Number of directories (default 8)\n \
+                        -t <depth>              Maximum directory depth (default 3)\n \
+                        -s <bytes>              Average file size (default 16384)\n \
+                        -c zlib|raw|mixed       Chunk encoding (default zlib)\n \
+                        -k <sectors>            Sectors per chunk (default 2048)\n \
+                        -S <seed>               Random seed\n \
+                        -i                      Case-insensitive volume\n \
+                        -N                      Normalization-sensitive volume, directory entries keyed by name alone\n \
+                        -u                      Non-ASCII file names\n \
+                        -x                      Extended attributes, embedded and in data streams\n \
+                        -l                      Hard links and clones\n \
+                        -P                      Every other file's data stream gets an identifier of its own\n \
+                        -L                      Symbolic links\n \
+                        -r <file>               Also write the raw APFS container\n", prog);
+}
+
+int main(int argc, char **argv)
+{
+        struct gen_opts opts = { 64, 8, 3, 16384, 2048, GEN_ZLIB, 0x5eed, 0, 0, 0, 0, 0, 0, 0, NULL, NULL };
+        struct gen_image img = {0};
+        uint64_t data_blocks;
+        int opt;
+
+        while ((opt = getopt(argc, argv, "n:D:t:s:c:k:S:iNuxlPLr:h")) != -1) {
+                switch (opt) {
+                        case 'n': opts.files = strtoul(optarg, NULL, 0); break;
+                        case 'D': opts.dirs = strtoul(optarg, NULL, 0); break;
+                        case 't': opts.depth = strtoul(optarg, NULL, 0); break;
+                        case 's': opts.file_size = strtoull(optarg, NULL, 0); break;
+                        case 'k': opts.chunk_sectors = strtoul(optarg, NULL, 0); break;
+                        case 'S': opts.seed = strtoull(optarg, NULL, 0); break;
+                        case 'i': opts.case_insensitive = 1; break;
+                        case 'N': opts.unhashed = 1; break;
+                        case 'u': opts.unicode_names = 1; break;
+                        case 'x': opts.xattrs = 1; break;
+                        case 'l': opts.links = 1; break;
+                        case 'P': opts.streams = 1; break;
+                        case 'L': opts.symlinks = 1; break;
+                        case 'r': opts.raw_out = optarg; break;
+                        case 'c':
+                                if (strcmp(optarg, "raw") == 0)
+                                        opts.compression = GEN_RAW;
+                                else if (strcmp(optarg, "mixed") == 0)
+                                        opts.compression = GEN_MIXED;
+                                else
+                                        opts.compression = GEN_ZLIB;
+                                break;
+                        default:
+                                gen_usage(argv[0]);
+                                return 1;
+                }
+        }
+
+        /* Case-insensitive volumes always hash names */
+        if (opts.case_insensitive)
+                opts.unhashed = 0;
+
+        if (optind >= argc || opts.depth == 0 || opts.chunk_sectors == 0) {
+                gen_usage(argv[0]);
+                return 1;
+        }
+
+        opts.dmg_out = argv[optind];
+        rng_state = opts.seed ? opts.seed : 1;
+
+        /* Data blocks plus metadata, rounded up with some free space at the end */
+        data_blocks = opts.files * ((opts.file_size * 3 / 2) / BLK_SIZE + 1);
+        if (opts.xattrs)
+                data_blocks += (opts.files / 5 + 1) * 3;        /* Resource forks */
+        img.block_count = ((data_blocks + (opts.files + opts.dirs) / 8 + 256) + 255) & ~255ULL;
+        img.blocks = calloc(img.block_count, BLK_SIZE);
+        img.is_data = calloc(img.block_count, 1);
+
+        gen_container(&img, &opts);
+
+        if (opts.raw_out) {
+                FILE *raw = fopen(opts.raw_out, "w");
+                if (raw == NULL || fwrite(img.blocks, BLK_SIZE, img.block_count, raw) != img.block_count)
+                        printf("Unable to write %s\n", opts.raw_out);
+                if (raw)
+                        fclose(raw);
+        }
+
+        if (gen_write_dmg(&img, &opts))
+                return 1;
+
+        printf("Wrote %s: %u files, %u directories, %lu blocks (%lu used)\n",
+               opts.dmg_out, opts.files, opts.dirs, img.block_count, img.next_block);
+
+        free(img.blocks);
+        free(img.is_data);
+        free(img.omap);
+        return 0;
+}
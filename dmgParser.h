@@ -4,6 +4,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
+#include <pthread.h>
 
 //Structues copied from newosxbook.com
 //https://web.archive.org/web/20130317050948/http://newosxbook.com/DMG.html
@@ -86,6 +87,86 @@ typedef struct {
 }BLKXTable;
 #pragma pack()
 
+#define SECTOR_SIZE 512
+
+/* BLKXChunkEntry.EntryType values */
+#define ENTRY_TYPE_ZERO         0x00000000      // Zero-filled sectors, no data stored
+#define ENTRY_TYPE_RAW          0x00000001      // Stored uncompressed
+#define ENTRY_TYPE_IGNORE       0x00000002      // Free space, reads as zeros
+#define ENTRY_TYPE_ADC          0x80000004
+#define ENTRY_TYPE_ZLIB         0x80000005
+#define ENTRY_TYPE_BZIP2        0x80000006
+#define ENTRY_TYPE_LZFSE        0x80000007
+#define ENTRY_TYPE_LZMA         0x80000008
+#define ENTRY_TYPE_COMMENT      0x7ffffffe
+#define ENTRY_TYPE_TERMINATOR   0xffffffff
+
+// A BLKXChunkEntry decoded to host byte order
+typedef struct {
+    uint64_t SectorNumber;      // Start sector, relative to the partition
+    uint64_t CompressedOffset;  // Absolute offset of the chunk in the DMG
+    uint32_t SectorCount;       // Number of sectors in this chunk
+    uint32_t CompressedLength;  // Bytes stored in the data fork
+    uint32_t EntryType;         // ENTRY_TYPE_*
+}dmg_chunk;
+
+// One blkx entry of the plist, with its chunks sorted by sector
+typedef struct {
+    char     Name[256];         // CFName (or Name) from the plist
+    uint32_t ID;                // Position in the blkx array
+    uint64_t SectorNumber;      // First disk sector of the partition
+    uint64_t SectorCount;       // Size of the partition in sectors
+    uint64_t DataOffset;        // Added to every chunk's CompressedOffset
+    uint64_t CompressedBytes;   // Bytes the partition occupies in the data fork
+    UDIFChecksum Checksum;      // Checksum of the expanded partition, as stored (big-endian)
+    uint32_t NumberOfChunks;
+    dmg_chunk *Chunks;
+}dmg_partition;
+
+typedef struct {
+    uint32_t Count;
+    uint32_t Skipped;           // blkx entries left out: not a mish table, a truncated one, or chunks out of range
+    dmg_partition *Partitions;
+}dmg_partition_table;
+
+// A DMG mapped read-only in memory
+typedef struct {
+    int fd;
+    const uint8_t *data;        // Mapping of the whole file
+    uint64_t size;
+    int64_t mtime;
+    uint64_t syscalls;          // Made on it so far: open, fstat, mmap, madvise
+}dmg_image;
+
+// What readDataBlks found while expanding a partition
+typedef struct {
+    uint32_t crc;               // CRC-32 of the expanded partition
+    uint32_t zeroed;            // Chunks written as zeros: unsupported types, or stored outside of the file
+}dmg_expansion;
+
+// The data fork's CRC-32, computed on a thread of its own while a partition expands
+typedef struct {
+    const uint8_t *fork;        // NULL when the fork lies outside of the file
+    uint64_t length;
+    uint32_t type;              // DataChecksumType of the koly trailer
+    uint32_t expected;
+    uint32_t crc;               // Set by finishForkCheck
+    int threaded;
+    pthread_t thread;
+}dmg_fork_check;
+
+/* Errors returned by the DMG functions, see dmgStrerror */
+#define DMG_EOPEN       -1      // The file could not be opened
+#define DMG_ESIZE       -2      // Too small to hold a koly trailer
+#define DMG_EMAP        -3
+#define DMG_ENOTUDIF    -4      // No koly trailer
+#define DMG_EPLIST      -5      // The plist is malformed or lies outside of the file
+#define DMG_ENOMEM      -6
+#define DMG_EINFLATE    -7      // The inflate backend could not be set up, or a chunk failed to inflate
+#define DMG_EWRITE      -8      // The expanded partition could not be written
+#define DMG_ECHECKSUM   -9      // The expanded partition or the data fork does not match its checksum
+#define DMG_EFORK       -10     // The data fork lies outside of the file
+
 typedef struct command_line_options {
 	uint8_t all;
 	uint8_t container;
@@ -95,17 +176,55 @@ typedef struct command_line_options {
 	unsigned char file_name[256];
 	uint8_t fs_structure;
 	uint8_t debug_mode;
+	uint8_t list_partitions;
+	int32_t partition;
+	char *export_file;
+	char *cache_dir;
+	uint8_t verify;
+	uint8_t benchmark;
+	uint8_t stats;
+	uint8_t list_volumes;
+	uint8_t list_directory;
+	uint8_t show_inode;
+	char *path;
+	char *export_raw;
+	char *export_map;
+	int32_t threads;
+	uint64_t diff_from;
+	uint64_t diff_to;
+	char *diff_image;
+	uint8_t list_snapshots;
+	char *snapshot;
+	uint8_t space_map;
+	uint8_t skip_free;
+	uint8_t xattr_sidecar;	// Extended attributes always go to <path>.xattrs/
+	uint8_t carve;
+	unsigned hash;		// Digests of --hash, 1 << DIGEST_*
 } command_line_args;
 
-FILE* readImageFile(FILE*, char* dmg_path);  // To open the file
-FILE* parseDMGFile(FILE*, UDIFResourceFile*);
-FILE* readXMLOffset(FILE*, UDIFResourceFile*, char**);
-void build_decoding_table();
-void base64_cleanup();
+int readImageFile(dmg_image*, char* dmg_path);  // To map the file
+void closeImageFile(dmg_image*);
+const char* dmgStrerror(int);
+const uint8_t* imageRange(dmg_image*, uint64_t, uint64_t);
+void adviseImageRange(dmg_image*, uint64_t, uint64_t, int);
+int parseDMGTrailer(dmg_image*, UDIFResourceFile*);
+const char* readXMLOffset(dmg_image*, UDIFResourceFile*);
 char* base64_encode(const char*,size_t ,size_t* );
 unsigned char* base64_decode(const char* ,size_t ,size_t* );
-BLKXTable* decodeDataBlk(const char*);
-void readDataBlks(BLKXTable*, FILE*, char*);
+size_t base64_decode_ws(const char*, size_t, unsigned char*);
+int buildPartitionTable(const char*, size_t, dmg_partition_table*);
+void freePartitionTable(dmg_partition_table*);
+dmg_partition* getPartition(dmg_partition_table*, uint32_t);
+dmg_partition* findPartitionByName(dmg_partition_table*, const char*);
+dmg_chunk* findChunkBySector(dmg_partition*, uint64_t);
+const char* chunkTypeName(uint32_t);
+void printPartitionTable(dmg_partition_table*);
+int readDataBlks(dmg_partition*, dmg_image*, char*, dmg_expansion*);
+void startForkCheck(dmg_fork_check*, dmg_image*, UDIFResourceFile*);
+int finishForkCheck(dmg_fork_check*);
+struct apfs_ctx;
+int exportRaw(dmg_partition*, dmg_image*, char*, int, struct apfs_ctx*);
+int exportMap(dmg_partition*, char*);
 int checkCommandLineArguments(char** argv, int argc);
 void printUsage();
 command_line_args fillCommandLineArguments(char **argv,int argc);
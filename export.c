@@ -0,0 +1,373 @@
+// export.c : Exports a partition as a sparse raw image, or as a map of its chunks.
+//
+//   Unlike readDataBlks, which writes the expanded partition front to back,
+//   the export only writes what the DMG stores: zero and free chunks stay
+//   holes, raw chunks are copied file to file by the kernel and zlib chunks
+//   are inflated by a pool of threads, each writing its chunks in place.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include "dmgParser.h"
+#include "stats.h"
+#include "inflate.h"
+#include "libapfsspy.h"
+
+#define EXPORT_MAX_THREADS      64
+
+/* State shared by the inflating threads */
+typedef struct {
+        dmg_partition *part;
+        dmg_image *image;
+        int fd;
+        uint32_t next;                  // Next chunk to claim, taken atomically
+        uint8_t *skip;                  // Chunks that only cover free blocks, NULL when not known
+        int failed;
+} export_job;
+
+/* One inflating thread, with its counters merged into the stats after the join */
+typedef struct {
+        export_job *job;
+        pthread_t thread;
+        uint64_t bytesRead;
+        uint64_t bytesWritten;
+        uint64_t syscalls;
+        uint64_t chunks;
+} export_worker;
+
+static int writeFully(int fd, const uint8_t *data, uint64_t len, uint64_t offset, uint64_t *syscalls)
+{
+        while (len > 0) {
+                ssize_t written = pwrite(fd, data, len, offset);
+
+                (*syscalls)++;
+                if (written <= 0)
+                        return -1;
+
+                data += written;
+                offset += written;
+                len -= written;
+        }
+
+        return 0;
+}
+
+// True when the whole buffer is zero, so the chunk can stay a hole
+static int isZero(const uint8_t *data, uint64_t len)
+{
+        return len == 0 || (data[0] == 0 && memcmp(data, data + 1, len - 1) == 0);
+}
+
+static void* inflateWorker(void *arg)
+{
+        export_worker *worker = (export_worker*)arg;
+        export_job *job = worker->job;
+        dmg_partition *part = job->part;
+        uint8_t *buffer = NULL;
+        uint64_t bufferLen = 0;
+        void *inflater = inflateBackendInit();
+
+        if (inflater == NULL) {
+                __atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+                return NULL;
+        }
+
+        for (;;) {
+                uint32_t i = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED);
+                dmg_chunk *chunk;
+                const uint8_t *compressed;
+                uint64_t expanded;
+                size_t produced = 0;
+
+                if (i >= part->NumberOfChunks)
+                        break;
+
+                chunk = &part->Chunks[i];
+                if (chunk->EntryType != ENTRY_TYPE_ZLIB || (job->skip && job->skip[i]))
+                        continue;
+
+                expanded = (uint64_t)chunk->SectorCount * SECTOR_SIZE;
+                if (expanded > bufferLen) {
+                        free(buffer);
+                        if ((buffer = (uint8_t*)malloc(expanded)) == NULL) {
+                                printf("Unable to allocate %lu bytes for inflating!\n", expanded);
+                                __atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+                                break;
+                        }
+                        bufferLen = expanded;
+                }
+
+                compressed = imageRange(job->image, chunk->CompressedOffset, chunk->CompressedLength);
+                if (compressed == NULL || inflateBackendChunk(inflater, compressed, chunk->CompressedLength,
+                                                              buffer, expanded, &produced) < 0) {
+                        printf("Failed to decompress the chunk at sector %lu\n", chunk->SectorNumber);
+                        __atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+                        continue;
+                }
+
+                worker->bytesRead += chunk->CompressedLength;
+                worker->chunks++;
+
+                if (isZero(buffer, produced))
+                        continue;
+
+                if (writeFully(job->fd, buffer, produced, chunk->SectorNumber * SECTOR_SIZE, &worker->syscalls) < 0) {
+                        printf("Error Writing to output file!\n");
+                        __atomic_store_n(&job->failed, 1, __ATOMIC_RELAXED);
+                        break;
+                }
+                worker->bytesWritten += produced;
+        }
+
+        inflateBackendEnd(inflater);
+        free(buffer);
+        return NULL;
+}
+
+// Copies a raw chunk without passing it through user space; falls back to a write from the mapping
+static int copyRawChunk(dmg_image *image, int fd, dmg_chunk *chunk, int *useCopyRange)
+{
+        loff_t in = chunk->CompressedOffset, out = chunk->SectorNumber * SECTOR_SIZE;
+        uint64_t len = chunk->CompressedLength;
+        const uint8_t *data;
+        uint64_t syscalls = 0;
+
+        if (imageRange(image, chunk->CompressedOffset, len) == NULL)
+                return -1;
+
+        while (*useCopyRange && len > 0) {
+                ssize_t copied = copy_file_range(image->fd, &in, fd, &out, len, 0);
+
+                STATS_ADD(STATS_SYSCALLS, 1);
+
+                if (copied < 0 && (errno == EXDEV || errno == ENOSYS || errno == EINVAL || errno == EOPNOTSUPP)) {
+                        *useCopyRange = 0;
+                        break;
+                }
+                if (copied <= 0)
+                        return -1;
+
+                STATS_ADD(STATS_BYTES_WRITTEN, copied);
+                len -= copied;
+        }
+
+        if (len == 0)
+                return 0;
+
+        data = imageRange(image, in, len);
+        if (writeFully(fd, data, len, out, &syscalls) < 0)
+                return -1;
+
+        STATS_ADD(STATS_SYSCALLS, syscalls);
+        STATS_ADD(STATS_BYTES_WRITTEN, len);
+        return 0;
+}
+
+/*
+ * Marks the chunks whose blocks the space manager records as all free; they
+ * are left as holes without being read. Returns how many there are.
+ */
+static uint32_t freeChunks(dmg_partition *part, apfs_ctx *space, uint8_t *skip)
+{
+        apfs_container_info info;
+        uint32_t count = 0;
+
+        apfs_container_info_get(space, &info);
+
+        for (uint32_t i = 0; i < part->NumberOfChunks; ++i) {
+                uint64_t start = part->Chunks[i].SectorNumber * SECTOR_SIZE;
+                uint64_t end = start + (uint64_t)part->Chunks[i].SectorCount * SECTOR_SIZE;
+                uint64_t first = start / info.block_size, last = (end + info.block_size - 1) / info.block_size;
+
+                skip[i] = part->Chunks[i].SectorCount > 0 && apfs_range_used(space, first, last - first) == 0;
+                count += skip[i];
+        }
+
+        return count;
+}
+
+/*
+   Input Parameters: dmg_partition*, dmg_image*, char*, int, apfs_ctx*
+   Return Type:      int
+Description: Writes the partition as a sparse raw image. The file is sized to
+the partition first, so zero and free chunks (and inflated chunks that come
+out all zeros) are never written and stay holes. The calling thread copies the
+raw chunks with copy_file_range while up to the given number of threads
+inflate the zlib chunks and pwrite them at their own offsets. The time and
+the space taken follow the data the DMG stores, not its SectorCount. No
+checksum is computed here, --verify checks the partition. When space is an
+open context on the same partition, chunks that only hold blocks its space
+manager marks free are skipped as well.
+
+ */
+int exportRaw(dmg_partition* part, dmg_image* image, char* filename, int threads, apfs_ctx* space)
+{
+        export_worker workers[EXPORT_MAX_THREADS];
+        export_job job;
+        uint64_t size = part->SectorCount * SECTOR_SIZE;
+        int started = 0, useCopyRange = 1, ret = 0;
+
+        memset(&job, 0, sizeof(job));
+        job.part = part;
+        job.image = image;
+
+        if (threads < 1)
+                threads = 1;
+        if (threads > EXPORT_MAX_THREADS)
+                threads = EXPORT_MAX_THREADS;
+
+        for (uint32_t i = 0; i < part->NumberOfChunks; ++i) {
+                uint64_t end = (part->Chunks[i].SectorNumber + part->Chunks[i].SectorCount) * SECTOR_SIZE;
+
+                if (end > size)
+                        size = end;
+        }
+
+        if (space && (job.skip = (uint8_t*)calloc(part->NumberOfChunks ? part->NumberOfChunks : 1, 1)) != NULL)
+                STATS_ADD(STATS_FREE_SKIPPED, freeChunks(part, space, job.skip));
+
+        if ((job.fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644)) < 0) {
+                printf("Unable to create file %s!\n", filename);
+                free(job.skip);
+                return -1;
+        }
+
+        if (ftruncate(job.fd, size) < 0) {
+                printf("Unable to size %s to %lu bytes!\n", filename, size);
+                close(job.fd);
+                free(job.skip);
+                return -1;
+        }
+        STATS_ADD(STATS_SYSCALLS, 2);
+
+        STATS_START(STATS_INFLATE);
+
+        for (int i = 0; i < threads; ++i) {
+                memset(&workers[i], 0, sizeof(workers[i]));
+                workers[i].job = &job;
+                if (pthread_create(&workers[i].thread, NULL, inflateWorker, &workers[i]) != 0)
+                        break;
+                started++;
+        }
+
+        if (started == 0) {
+                printf("Unable to start the inflating threads\n");
+                job.failed = 1;
+        }
+
+        for (uint32_t i = 0; i < part->NumberOfChunks; ++i) {
+                dmg_chunk *chunk = &part->Chunks[i];
+
+                if (job.skip && job.skip[i])
+                        continue;
+
+                if (chunk->EntryType == ENTRY_TYPE_RAW) {
+                        STATS_ADD(STATS_CHUNKS, 1);
+                        STATS_ADD(STATS_BYTES_READ, chunk->CompressedLength);
+
+                        if (copyRawChunk(image, job.fd, chunk, &useCopyRange) < 0) {
+                                printf("Unable to copy the chunk at sector %lu\n", chunk->SectorNumber);
+                                ret = -1;
+                        }
+                } else if (chunk->EntryType != ENTRY_TYPE_ZLIB && chunk->EntryType != ENTRY_TYPE_ZERO &&
+                           chunk->EntryType != ENTRY_TYPE_IGNORE) {
+                        printf("Unsupported chunk type %s (0x%x) at sector %lu, leaving a hole\n",
+                               chunkTypeName(chunk->EntryType), chunk->EntryType, chunk->SectorNumber);
+                }
+        }
+
+        for (int i = 0; i < started; ++i) {
+                pthread_join(workers[i].thread, NULL);
+                STATS_ADD(STATS_BYTES_READ, workers[i].bytesRead);
+                STATS_ADD(STATS_BYTES_WRITTEN, workers[i].bytesWritten);
+                STATS_ADD(STATS_SYSCALLS, workers[i].syscalls);
+                STATS_ADD(STATS_CHUNKS, workers[i].chunks);
+        }
+
+        STATS_STOP(STATS_INFLATE);
+
+        if (job.failed)
+                ret = -1;
+
+        if (close(job.fd) < 0) {
+                printf("Error Writing to output file!\n");
+                ret = -1;
+        }
+
+        free(job.skip);
+        return ret;
+}
+
+/*
+   Input Parameters: dmg_partition*, char*
+   Return Type:      int
+Description: Writes a JSON map of the partition, one entry per chunk: where
+its expanded bytes start in the partition, how long they are, how they are
+stored and where the stored bytes sit in the DMG. Runs of zero and free
+chunks are merged into one entry with "data": false. A tool can then read
+the image lazily, straight out of the DMG. "-" writes to stdout.
+
+ */
+int exportMap(dmg_partition* part, char* filename)
+{
+        FILE *out = strcmp(filename, "-") == 0 ? stdout : fopen(filename, "w");
+        uint64_t holeStart = 0, holeLength = 0;
+        int first = 1;
+
+        if (out == NULL) {
+                printf("Unable to create file %s!\n", filename);
+                return -1;
+        }
+
+        fprintf(out, "{\"partition\": %u, \"name\": ", part->ID);
+        printJsonString(out, part->Name);
+        fprintf(out, ", \"size\": %lu, \"sector_size\": %d, \"chunks\": [", part->SectorCount * SECTOR_SIZE, SECTOR_SIZE);
+
+        for (uint32_t i = 0; i <= part->NumberOfChunks; ++i) {
+                dmg_chunk *chunk = i < part->NumberOfChunks ? &part->Chunks[i] : NULL;
+                uint64_t start = chunk ? chunk->SectorNumber * SECTOR_SIZE : 0;
+                uint64_t length = chunk ? (uint64_t)chunk->SectorCount * SECTOR_SIZE : 0;
+                int hole = chunk && (chunk->EntryType == ENTRY_TYPE_ZERO || chunk->EntryType == ENTRY_TYPE_IGNORE);
+
+                if (hole && holeLength && holeStart + holeLength == start) {
+                        holeLength += length;
+                        continue;
+                }
+
+                if (holeLength) {
+                        fprintf(out, "%s\n  {\"start\": %lu, \"length\": %lu, \"type\": \"zero\", \"data\": false}",
+                                first ? "" : ",", holeStart, holeLength);
+                        first = 0;
+                        holeLength = 0;
+                }
+
+                if (chunk == NULL)
+                        break;
+
+                if (hole) {
+                        holeStart = start;
+                        holeLength = length;
+                        continue;
+                }
+
+                fprintf(out, "%s\n  {\"start\": %lu, \"length\": %lu, \"type\": \"%s\", \"data\": true, "
+                        "\"offset\": %lu, \"stored_length\": %u}",
+                        first ? "" : ",", start, length, chunkTypeName(chunk->EntryType),
+                        chunk->CompressedOffset, chunk->CompressedLength);
+                first = 0;
+        }
+
+        fprintf(out, "\n]}\n");
+
+        if (out != stdout && fclose(out) != 0) {
+                printf("Error Writing to output file!\n");
+                return -1;
+        }
+
+        return 0;
+}
@@ -0,0 +1,329 @@
+// fsobject.c : Gathers the FS tree records of one object.
+//
+//   apfs_walk reads the FS tree in key order and hands every leaf record to
+//   fsAccumulate, which keeps the records of the current object and calls
+//   back with the whole object once a record of the next one arrives. The arrays are kept between objects,
+//   so a walk allocates only while they grow.
+
+#include <stdlib.h>
+#include <string.h>
+#include "fsobject.h"
+
+// Makes room for one more element; 0 on success, -1 when out of memory
+static int reserve(void **array, uint32_t *capacity, uint32_t count, size_t size)
+{
+        uint32_t grown = *capacity ? *capacity * 2 : 16;
+        void *bigger;
+
+        if (count < *capacity)
+                return 0;
+        if ((bigger = realloc(*array, grown * size)) == NULL)
+                return -1;
+
+        *array = bigger;
+        *capacity = grown;
+        return 0;
+}
+
+// Copies len bytes to the string area, NUL-terminated; returns the offset or -1
+static int64_t stringAdd(fs_object *obj, const void *data, uint32_t len)
+{
+        uint32_t off = obj->stringsUsed;
+
+        if ((uint64_t)off + len + 1 > obj->stringsCapacity) {
+                uint32_t capacity = obj->stringsCapacity ? obj->stringsCapacity : 256;
+                char *grown;
+
+                while (capacity < (uint64_t)off + len + 1)
+                        capacity *= 2;
+                if ((grown = realloc(obj->strings, capacity)) == NULL)
+                        return -1;
+                obj->strings = grown;
+                obj->stringsCapacity = capacity;
+        }
+
+        memcpy(obj->strings + off, data, len);
+        obj->strings[off + len] = '\0';
+        obj->stringsUsed += len + 1;
+        return off;
+}
+
+static void objectReset(fs_object *obj)
+{
+        obj->oid = 0;
+        obj->hasInode = 0;
+        memset(&obj->xf, 0, sizeof(obj->xf));
+        obj->name[0] = '\0';
+        obj->extentCount = 0;
+        obj->xattrCount = 0;
+        obj->childCount = 0;
+        obj->siblingCount = 0;
+        obj->stringsUsed = 0;
+}
+
+// The inode and its extended fields; the name is copied as the record's node is not kept
+static void inodeAdd(fs_object *obj, const uint8_t *val, uint16_t valLen)
+{
+        uint16_t len;
+
+        if (xfInodeDecode(val, valLen, &obj->xf) < 0)
+                return;
+
+        memcpy(&obj->inode, val, sizeof(j_inode_val_t));
+        obj->hasInode = 1;
+
+        len = obj->xf.nameLen < sizeof(obj->name) ? obj->xf.nameLen : sizeof(obj->name) - 1;
+        if (len)
+                memcpy(obj->name, obj->xf.name, len);
+        obj->name[len] = '\0';
+        obj->xf.name = obj->name;
+        obj->xf.nameLen = len;
+}
+
+static int extentAdd(fs_object *obj, const uint8_t *key, uint16_t keyLen, const uint8_t *val, uint16_t valLen)
+{
+        j_file_extent_val_t extent;
+        fs_extent *entry;
+
+        if (keyLen < sizeof(j_key_t) + sizeof(uint64_t) || valLen < sizeof(extent))
+                return 0;
+        if (reserve((void**)&obj->extents, &obj->extentCapacity, obj->extentCount, sizeof(fs_extent)))
+                return -1;
+
+        memcpy(&extent, val, sizeof(extent));
+        entry = &obj->extents[obj->extentCount++];
+        memcpy(&entry->logical, key + sizeof(j_key_t), sizeof(entry->logical));
+        entry->length = extent.len_and_flags & J_FILE_EXTENT_LEN_MASK;
+        entry->paddr = extent.phys_block_num;
+        return 0;
+}
+
+static int xattrAdd(fs_object *obj, const uint8_t *key, uint16_t keyLen, const uint8_t *val, uint16_t valLen)
+{
+        const j_xattr_key_t *xkey = (const j_xattr_key_t*)key;
+        const j_xattr_val_t *xval = (const j_xattr_val_t*)val;
+        uint16_t nameLen, dataLen;
+        fs_xattr *entry;
+        int64_t off;
+
+        if (keyLen < sizeof(j_xattr_key_t) || valLen < sizeof(j_xattr_val_t))
+                return 0;
+        if (reserve((void**)&obj->xattrs, &obj->xattrCapacity, obj->xattrCount, sizeof(fs_xattr)))
+                return -1;
+
+        // The stored length counts the terminating NUL
+        nameLen = xkey->name_len;
+        if (nameLen > keyLen - sizeof(j_xattr_key_t))
+                nameLen = keyLen - sizeof(j_xattr_key_t);
+        if (nameLen && xkey->name[nameLen - 1] == '\0')
+                nameLen--;
+
+        entry = &obj->xattrs[obj->xattrCount];
+        memset(entry, 0, sizeof(*entry));
+        entry->flags = xval->flags;
+        if ((off = stringAdd(obj, xkey->name, nameLen)) < 0)
+                return -1;
+        entry->nameOff = off;
+
+        dataLen = xval->xdata_len;
+        if (dataLen > valLen - sizeof(j_xattr_val_t))
+                dataLen = valLen - sizeof(j_xattr_val_t);
+
+        if ((xval->flags & XATTR_DATA_STREAM) && dataLen >= sizeof(j_xattr_dstream_t)) {
+                j_xattr_dstream_t stream;
+
+                memcpy(&stream, xval->xdata, sizeof(stream));
+                entry->stream = stream.xattr_obj_id;
+                entry->size = stream.dstream.size;
+        } else {
+                if ((off = stringAdd(obj, xval->xdata, dataLen)) < 0)
+                        return -1;
+                entry->dataOff = off;
+                entry->length = dataLen;
+                entry->size = dataLen;
+        }
+
+        obj->xattrCount++;
+        return 0;
+}
+
+/*
+   Input Parameters: uint8_t* key, uint16_t, int hashed, uint32_t* nameLen
+   Return Type:      const uint8_t*
+Description: Finds the name in a directory entry's key, a j_drec_hashed_key_t
+on volumes that hash names and a j_drec_key_t on the others. Sets nameLen
+without the terminating NUL. Returns NULL when the key is too short.
+
+ */
+const uint8_t* fsDrecName(const uint8_t *key, uint16_t keyLen, int hashed, uint32_t *nameLen)
+{
+        const uint8_t *name;
+        uint32_t len;
+        size_t fixed;
+
+        if (hashed) {
+                const j_drec_hashed_key_t *drec = (const j_drec_hashed_key_t*)key;
+
+                fixed = sizeof(j_drec_hashed_key_t);
+                if (keyLen < fixed)
+                        return NULL;
+                len = drec->name_len_and_hash & J_DREC_LEN_MASK;
+                name = drec->name;
+        } else {
+                const j_drec_key_t *drec = (const j_drec_key_t*)key;
+
+                fixed = sizeof(j_drec_key_t);
+                if (keyLen < fixed)
+                        return NULL;
+                len = drec->name_len;
+                name = drec->name;
+        }
+
+        // The stored length counts the terminating NUL
+        if (len > keyLen - fixed)
+                len = keyLen - fixed;
+        if (len && name[len - 1] == '\0')
+                len--;
+        *nameLen = len;
+        return name;
+}
+
+static int childAdd(fs_object *obj, int hashed, const uint8_t *key, uint16_t keyLen, const uint8_t *val, uint16_t valLen)
+{
+        const uint8_t *name;
+        j_drec_val_t entry;
+        fs_child *child;
+        uint32_t nameLen;
+        int64_t off;
+
+        if ((name = fsDrecName(key, keyLen, hashed, &nameLen)) == NULL || valLen < sizeof(entry))
+                return 0;
+        if (reserve((void**)&obj->children, &obj->childCapacity, obj->childCount, sizeof(fs_child)))
+                return -1;
+
+        if ((off = stringAdd(obj, name, nameLen)) < 0)
+                return -1;
+
+        memcpy(&entry, val, sizeof(entry));
+        child = &obj->children[obj->childCount++];
+        child->name = NULL;
+        child->ino = entry.file_id;
+        child->dateAdded = entry.date_added;
+        child->type = entry.flags & DREC_TYPE_MASK;
+        child->nameOff = off;
+        return 0;
+}
+
+// hashedNames tells how the volume keys its directory entries
+void fsAccumulatorInit(fs_accumulator *acc, int hashedNames, fs_object_cb callback, void *arg)
+{
+        memset(acc, 0, sizeof(*acc));
+        acc->hashedNames = hashedNames;
+        acc->callback = callback;
+        acc->arg = arg;
+}
+
+static int siblingAdd(fs_object *obj, const uint8_t *key, uint16_t keyLen, const uint8_t *val, uint16_t valLen)
+{
+        const j_sibling_val_t *link = (const j_sibling_val_t*)val;
+        fs_sibling *sibling;
+        uint16_t nameLen;
+        int64_t off;
+
+        if (keyLen < sizeof(j_sibling_key_t) || valLen < sizeof(j_sibling_val_t))
+                return 0;
+        if (reserve((void**)&obj->siblings, &obj->siblingCapacity, obj->siblingCount, sizeof(fs_sibling)))
+                return -1;
+
+        nameLen = link->name_len;
+        if (nameLen > valLen - sizeof(j_sibling_val_t))
+                nameLen = valLen - sizeof(j_sibling_val_t);
+        if (nameLen && link->name[nameLen - 1] == '\0')
+                nameLen--;
+        if ((off = stringAdd(obj, link->name, nameLen)) < 0)
+                return -1;
+
+        sibling = &obj->siblings[obj->siblingCount++];
+        sibling->name = NULL;
+        memcpy(&sibling->id, key + sizeof(j_key_t), sizeof(sibling->id));
+        sibling->parent = link->parent_id;
+        sibling->nameOff = off;
+        return 0;
+}
+
+/*
+   Input Parameters: fs_accumulator*, uint8_t* key, uint16_t, uint8_t* value, uint16_t
+   Return Type:      int
+Description: Adds one FS tree record to the current object. A record of
+another object first passes the current one to the callback. Record types
+that are not kept (sibling maps, directory stats, ...) only mark the object
+as seen, and malformed records are skipped. Returns 0, the callback's
+non-zero return, or -1 when out of memory.
+
+ */
+int fsAccumulate(fs_accumulator *acc, const uint8_t *key, uint16_t keyLen, const uint8_t *val, uint16_t valLen)
+{
+        fs_object *obj = &acc->object;
+        uint64_t header, oid;
+        int ret;
+
+        if (keyLen < sizeof(j_key_t))
+                return 0;
+
+        memcpy(&header, key, sizeof(header));
+        oid = header & OBJ_ID_MASK;
+
+        if (oid != obj->oid && (ret = fsAccumulatorFlush(acc)) != 0)
+                return ret;
+        obj->oid = oid;
+
+        switch ((header & OBJ_TYPE_MASK) >> OBJ_TYPE_SHIFT) {
+        case APFS_TYPE_INODE:
+                inodeAdd(obj, val, valLen);
+                return 0;
+        case APFS_TYPE_XATTR:
+                return xattrAdd(obj, key, keyLen, val, valLen);
+        case APFS_TYPE_FILE_EXTENT:
+                return extentAdd(obj, key, keyLen, val, valLen);
+        case APFS_TYPE_DIR_REC:
+                return childAdd(obj, acc->hashedNames, key, keyLen, val, valLen);
+        case APFS_TYPE_SIBLING_LINK:
+                return siblingAdd(obj, key, keyLen, val, valLen);
+        default:
+                return 0;
+        }
+}
+
+// Hands the current object, if any, to the callback; call once more after the last record
+int fsAccumulatorFlush(fs_accumulator *acc)
+{
+        fs_object *obj = &acc->object;
+        int ret;
+
+        if (obj->oid == 0)
+                return 0;
+
+        // The string area may have moved while it grew, the pointers are only set now
+        for (uint32_t i = 0; i < obj->xattrCount; ++i) {
+                obj->xattrs[i].name = obj->strings + obj->xattrs[i].nameOff;
+                obj->xattrs[i].data = obj->xattrs[i].stream ? NULL : (const uint8_t*)obj->strings + obj->xattrs[i].dataOff;
+        }
+        for (uint32_t i = 0; i < obj->childCount; ++i)
+                obj->children[i].name = obj->strings + obj->children[i].nameOff;
+        for (uint32_t i = 0; i < obj->siblingCount; ++i)
+                obj->siblings[i].name = obj->strings + obj->siblings[i].nameOff;
+
+        ret = acc->callback(obj, acc->arg);
+        objectReset(obj);
+        return ret;
+}
+
+void fsAccumulatorFree(fs_accumulator *acc)
+{
+        free(acc->object.extents);
+        free(acc->object.xattrs);
+        free(acc->object.children);
+        free(acc->object.siblings);
+        free(acc->object.strings);
+        memset(acc, 0, sizeof(*acc));
+}
@@ -0,0 +1,87 @@
+#pragma once
+#include <stdint.h>
+#include "apfs.h"
+#include "xfield.h"
+
+/*
+ * One FS tree object with all of its records: the inode with its extended
+ * fields, the file extents, the extended attributes, the sibling links of a
+ * file with hard links and, for a directory, its entries. FS tree keys sort by object identifier first, so
+ * the records of an object are contiguous; the accumulator gathers them as
+ * the walk hands them over and passes the object on when the identifier
+ * changes.
+ */
+
+typedef struct {
+        uint64_t logical;
+        uint64_t length;
+        uint64_t paddr;                 // First block, 0 for a hole
+} fs_extent;
+
+typedef struct {
+        const char *name;               // Set when the object is emitted
+        const uint8_t *data;            // Embedded data, NULL when it lives in a data stream
+        uint16_t flags;
+        uint16_t length;                // Bytes of embedded data
+        uint64_t stream;                // Data stream holding the value, 0 when embedded
+        uint64_t size;                  // Logical size of that stream
+        uint32_t nameOff;
+        uint32_t dataOff;
+} fs_xattr;
+
+typedef struct {
+        const char *name;               // Set when the object is emitted
+        uint64_t ino;
+        uint64_t dateAdded;
+        uint16_t type;                  // DT_* value
+        uint32_t nameOff;
+} fs_child;
+
+// One hard link of the inode: the directory holding it and its name there
+typedef struct {
+        const char *name;               // Set when the object is emitted
+        uint64_t id;                    // Sibling identifier
+        uint64_t parent;
+        uint32_t nameOff;
+} fs_sibling;
+
+typedef struct {
+        uint64_t oid;
+        int hasInode;
+        j_inode_val_t inode;
+        xf_inode xf;                    // Extended fields of the inode, xf.name points at name
+        char name[APFS_NAME_LEN];       // From the inode's name field, NUL-terminated
+
+        fs_extent *extents;             // In logical order
+        uint32_t extentCount;
+        uint32_t extentCapacity;
+        fs_xattr *xattrs;
+        uint32_t xattrCount;
+        uint32_t xattrCapacity;
+        fs_child *children;             // Directory entries, in hash order
+        uint32_t childCount;
+        uint32_t childCapacity;
+        fs_sibling *siblings;           // In sibling identifier order
+        uint32_t siblingCount;
+        uint32_t siblingCapacity;
+
+        char *strings;                  // Names and embedded data of the above
+        uint32_t stringsUsed;
+        uint32_t stringsCapacity;
+} fs_object;
+
+// Called once per completed object; a non-zero return stops the walk and is passed back
+typedef int (*fs_object_cb)(const fs_object*, void*);
+
+typedef struct {
+        fs_object object;               // The object being gathered, its arrays are reused
+        int hashedNames;                // Directory entries have j_drec_hashed_key_t keys
+        fs_object_cb callback;
+        void *arg;
+} fs_accumulator;
+
+const uint8_t* fsDrecName(const uint8_t*, uint16_t, int, uint32_t*);
+void fsAccumulatorInit(fs_accumulator*, int, fs_object_cb, void*);
+int fsAccumulate(fs_accumulator*, const uint8_t*, uint16_t, const uint8_t*, uint16_t);
+int fsAccumulatorFlush(fs_accumulator*);
+void fsAccumulatorFree(fs_accumulator*);
@@ -0,0 +1,445 @@
+// hash.c : Digests of every file of a volume, read in place.
+//
+//   One apfs_walk pass lists the regular files with their extents and the
+//   directories their paths are built from. The files are then claimed one
+//   at a time by a pool of threads, each with its own context, which read
+//   the extents block run by block run and feed every requested digest; no
+//   data is written anywhere. Lines are printed in walk order as soon as the
+//   files before them are done.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include "hash.h"
+#include "libapfsspy.h"
+#include "stats.h"
+
+#define HASH_READ_BLOCKS        256     // Blocks read at a time
+#define HASH_SLICE              65536   // Bytes fed to each digest in turn, so they stay in cache
+#define HASH_MAX_THREADS        64
+
+typedef struct {
+        uint64_t ino;
+        uint64_t parent;
+        uint32_t name;                  // Offset in the name area
+} hash_directory;
+
+typedef struct {
+        uint64_t ino;
+        uint64_t parent;
+        uint64_t size;
+        uint32_t name;
+        uint32_t extentCount;
+        apfs_object_extent *extents;
+        uint8_t digests[DIGEST_COUNT][DIGEST_MAX_SIZE];
+        int error;                      // APFS_E* code of a failed read, 0 otherwise
+        int done;
+} hash_file;
+
+typedef struct {
+        uint32_t blockSize;
+        unsigned algorithms;
+
+        hash_directory *dirs;           // In inode order, as the walk visits them
+        uint64_t dirCount;
+        uint64_t dirCapacity;
+        hash_file *files;
+        uint64_t fileCount;
+        uint64_t fileCapacity;
+        char *names;
+        uint64_t namesUsed;
+        uint64_t namesCapacity;
+
+        uint64_t next;                  // Next file to claim
+        pthread_mutex_t lock;
+        pthread_cond_t done;
+        int failed;
+} hash_job;
+
+typedef struct {
+        hash_job *job;
+        apfs_ctx *ctx;
+        pthread_t thread;
+} hash_worker;
+
+static double now(void)
+{
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static int64_t nameAdd(hash_job *job, const char *name)
+{
+        size_t len = strlen(name) + 1;
+        uint64_t off = job->namesUsed;
+
+        if (job->namesUsed + len > job->namesCapacity) {
+                uint64_t capacity = job->namesCapacity ? job->namesCapacity * 2 : 65536;
+                char *grown;
+
+                while (capacity < job->namesUsed + len)
+                        capacity *= 2;
+                if ((grown = realloc(job->names, capacity)) == NULL)
+                        return -1;
+                job->names = grown;
+                job->namesCapacity = capacity;
+        }
+
+        memcpy(job->names + off, name, len);
+        job->namesUsed += len;
+        return off;
+}
+
+// Keeps the directories for the paths and the regular files with a copy of their extents
+static int collectObject(const apfs_object *object, void *arg)
+{
+        hash_job *job = (hash_job*)arg;
+        int64_t name;
+
+        if (!S_ISDIR(object->st.mode) && !S_ISREG(object->st.mode))
+                return 0;
+        if ((name = nameAdd(job, object->name)) < 0)
+                goto nomem;
+
+        if (S_ISDIR(object->st.mode)) {
+                if (job->dirCount == job->dirCapacity) {
+                        uint64_t capacity = job->dirCapacity ? job->dirCapacity * 2 : 256;
+                        hash_directory *grown = realloc(job->dirs, capacity * sizeof(hash_directory));
+
+                        if (grown == NULL)
+                                goto nomem;
+                        job->dirs = grown;
+                        job->dirCapacity = capacity;
+                }
+                job->dirs[job->dirCount].ino = object->st.ino;
+                job->dirs[job->dirCount].parent = object->st.parent_ino;
+                job->dirs[job->dirCount++].name = name;
+                return 0;
+        }
+
+        if (job->fileCount == job->fileCapacity) {
+                uint64_t capacity = job->fileCapacity ? job->fileCapacity * 2 : 1024;
+                hash_file *grown = realloc(job->files, capacity * sizeof(hash_file));
+
+                if (grown == NULL)
+                        goto nomem;
+                job->files = grown;
+                job->fileCapacity = capacity;
+        }
+
+        hash_file *file = &job->files[job->fileCount];
+
+        memset(file, 0, sizeof(*file));
+        file->ino = object->st.ino;
+        file->parent = object->st.parent_ino;
+        file->size = object->st.size;
+        file->name = name;
+        if (object->extent_count) {
+                if ((file->extents = malloc(object->extent_count * sizeof(apfs_object_extent))) == NULL)
+                        goto nomem;
+                memcpy(file->extents, object->extents, object->extent_count * sizeof(apfs_object_extent));
+                file->extentCount = object->extent_count;
+        }
+        job->fileCount++;
+        return 0;
+
+nomem:
+        job->failed = 1;
+        return 1;
+}
+
+static const hash_directory* findDirectory(const hash_job *job, uint64_t ino)
+{
+        uint64_t low = 0, high = job->dirCount;
+
+        while (low < high) {
+                uint64_t mid = low + (high - low) / 2;
+
+                if (job->dirs[mid].ino < ino)
+                        low = mid + 1;
+                else
+                        high = mid;
+        }
+
+        return low < job->dirCount && job->dirs[low].ino == ino ? &job->dirs[low] : NULL;
+}
+
+// Writes the path of a directory, root first; returns the length or -1 when it does not fit
+static int directoryPath(const hash_job *job, uint64_t ino, char *out, size_t size, int depth)
+{
+        const hash_directory *dir;
+        int len;
+
+        if (ino == APFS_ROOT_INO || depth > 256 || (dir = findDirectory(job, ino)) == NULL) {
+                out[0] = '\0';
+                return 0;
+        }
+
+        if ((len = directoryPath(job, dir->parent, out, size, depth + 1)) < 0)
+                return -1;
+        if ((size_t)len + 1 + strlen(job->names + dir->name) >= size)
+                return -1;
+
+        return len + sprintf(out + len, "/%s", job->names + dir->name);
+}
+
+static void feedDigests(const hash_job *job, digest_ctx *digests, const uint8_t *buf, uint64_t len)
+{
+        for (uint64_t s = 0; s < len; s += HASH_SLICE) {
+                size_t slice = len - s < HASH_SLICE ? len - s : HASH_SLICE;
+
+                for (int a = 0; a < DIGEST_COUNT; ++a)
+                        if (job->algorithms & (1u << a))
+                                digestUpdate(&digests[a], buf + s, slice);
+        }
+}
+
+/*
+   Input Parameters: hash_worker*, hash_file*, uint8_t* buffer
+   Return Type:      int
+Description: Feeds the logical contents of one file to every requested
+digest: the extents as they are on disk, zeros for holes and for the end of
+a sparse file past its last extent, all cut to the file's size.
+
+ */
+static int hashFile(hash_worker *worker, hash_file *file, uint8_t *buf)
+{
+        hash_job *job = worker->job;
+        digest_ctx digests[DIGEST_COUNT];
+        uint64_t runBytes = (uint64_t)HASH_READ_BLOCKS * job->blockSize;
+        uint64_t offset = 0;
+        uint32_t e = 0;
+        int ret = 0;
+
+        for (int a = 0; a < DIGEST_COUNT; ++a)
+                if (job->algorithms & (1u << a))
+                        digestInit(&digests[a], a);
+
+        while (offset < file->size) {
+                const apfs_object_extent *extent = e < file->extentCount ? &file->extents[e] : NULL;
+                uint64_t len;
+
+                if (extent && offset >= extent->logical + extent->length) {
+                        e++;
+                        continue;
+                }
+
+                if (extent == NULL || offset < extent->logical) {
+                        // A hole up to the next extent
+                        len = (extent ? extent->logical : file->size) - offset;
+                        if (len > runBytes)
+                                len = runBytes;
+                        if (len > file->size - offset)
+                                len = file->size - offset;
+                        memset(buf, 0, len);
+                } else {
+                        uint64_t within = offset - extent->logical;
+                        uint64_t first = within / job->blockSize;
+                        uint64_t skip = within % job->blockSize;
+                        uint64_t blocks;
+
+                        len = extent->logical + extent->length - offset;
+                        if (len > runBytes - skip)
+                                len = runBytes - skip;
+                        if (len > file->size - offset)
+                                len = file->size - offset;
+
+                        if (extent->paddr == 0) {
+                                memset(buf, 0, len);
+                                skip = 0;
+                        } else {
+                                blocks = (skip + len + job->blockSize - 1) / job->blockSize;
+                                if ((ret = apfs_block_read(worker->ctx, extent->paddr + first, blocks, buf)) < 0)
+                                        break;
+                        }
+
+                        if (skip)
+                                memmove(buf, buf + skip, len);
+                }
+
+                feedDigests(job, digests, buf, len);
+                offset += len;
+        }
+
+        for (int a = 0; a < DIGEST_COUNT; ++a)
+                if (job->algorithms & (1u << a))
+                        digestFinal(&digests[a], file->digests[a]);
+
+        return ret;
+}
+
+static void* hashWorker(void *arg)
+{
+        hash_worker *worker = (hash_worker*)arg;
+        hash_job *job = worker->job;
+        uint8_t *buf = malloc((size_t)HASH_READ_BLOCKS * job->blockSize);
+
+        for (;;) {
+                uint64_t i = __atomic_fetch_add(&job->next, 1, __ATOMIC_RELAXED);
+                hash_file *file;
+
+                if (i >= job->fileCount)
+                        break;
+
+                file = &job->files[i];
+                file->error = buf ? hashFile(worker, file, buf) : APFS_ENOMEM;
+
+                pthread_mutex_lock(&job->lock);
+                file->done = 1;
+                pthread_cond_broadcast(&job->done);
+                pthread_mutex_unlock(&job->lock);
+        }
+
+        free(buf);
+        return NULL;
+}
+
+static void printFile(const hash_job *job, const hash_file *file, FILE *out)
+{
+        char path[4096];
+
+        if (directoryPath(job, file->parent, path, sizeof(path), 0) < 0 ||
+            strlen(path) + 1 + strlen(job->names + file->name) >= sizeof(path))
+                snprintf(path, sizeof(path), "<inode %lu>", file->ino);
+        else
+                sprintf(path + strlen(path), "/%s", job->names + file->name);
+
+        fprintf(out, "{\"path\":");
+        printJsonString(out, path);
+        fprintf(out, ",\"ino\":%lu,\"size\":%lu", file->ino, file->size);
+
+        if (file->error) {
+                fprintf(out, ",\"error\":");
+                printJsonString(out, apfs_strerror(file->error));
+        } else {
+                for (int a = 0; a < DIGEST_COUNT; ++a) {
+                        if (!(job->algorithms & (1u << a)))
+                                continue;
+                        fprintf(out, ",\"%s\":\"", digestName(a));
+                        for (size_t i = 0; i < digestSize(a); ++i)
+                                fprintf(out, "%02x", file->digests[a][i]);
+                        fputc('"', out);
+                }
+        }
+
+        fprintf(out, "}\n");
+}
+
+/*
+   Input Parameters: char* path, int partition, uint32_t volume, int threads, unsigned algorithms, FILE*, hash_stats*
+   Return Type:      int
+Description: Prints one JSON line per regular file of the volume with the
+digests in the algorithms mask (1 << DIGEST_*). A file whose data cannot be
+read gets an "error" member instead of digests. Returns -1 when the volume
+cannot be walked.
+
+ */
+int hashVolume(const char *path, int partition, uint32_t volume, int threads, unsigned algorithms, FILE *out,
+               hash_stats *stats)
+{
+        hash_worker workers[HASH_MAX_THREADS];
+        apfs_container_info info;
+        apfs_volume *vol = NULL;
+        apfs_ctx *ctx;
+        hash_job job;
+        double start = now();
+        int started = 0, ret;
+
+        memset(stats, 0, sizeof(*stats));
+        memset(&job, 0, sizeof(job));
+        job.algorithms = algorithms;
+
+        if ((ret = apfs_open(path, partition, &ctx)) < 0) {
+                printf("Unable to open the APFS container: %s\n", apfs_strerror(ret));
+                return -1;
+        }
+
+        apfs_container_info_get(ctx, &info);
+        job.blockSize = info.block_size;
+
+        if ((ret = apfs_volume_open(ctx, volume, &vol)) < 0 || (ret = apfs_walk(vol, collectObject, &job)) < 0) {
+                printf("Unable to walk the volume: %s\n", apfs_strerror(ret));
+                job.failed = 1;
+                goto end;
+        }
+        if (job.failed) {
+                printf("Out of memory listing the volume\n");
+                goto end;
+        }
+
+        pthread_mutex_init(&job.lock, NULL);
+        pthread_cond_init(&job.done, NULL);
+
+        if (threads < 1)
+                threads = 1;
+        if (threads > HASH_MAX_THREADS)
+                threads = HASH_MAX_THREADS;
+
+        for (int i = 0; i < threads; ++i) {
+                workers[i].job = &job;
+
+                // The first thread reuses the context the walk warmed up
+                if (i == 0)
+                        workers[i].ctx = ctx;
+                else if (apfs_open(path, partition, &workers[i].ctx) < 0)
+                        break;
+
+                if (pthread_create(&workers[i].thread, NULL, hashWorker, &workers[i]) != 0) {
+                        if (i > 0)
+                                apfs_close(workers[i].ctx);
+                        break;
+                }
+                started++;
+        }
+
+        if (started == 0) {
+                printf("Unable to start the hashing threads\n");
+                job.failed = 1;
+        }
+
+        // Lines come out in walk order, each once the files before it are done
+        for (uint64_t i = 0; started && i < job.fileCount; ++i) {
+                hash_file *file = &job.files[i];
+
+                pthread_mutex_lock(&job.lock);
+                while (!file->done)
+                        pthread_cond_wait(&job.done, &job.lock);
+                pthread_mutex_unlock(&job.lock);
+
+                printFile(&job, file, out);
+                stats->files++;
+                if (file->error)
+                        stats->errors++;
+                else
+                        stats->bytes += file->size;
+        }
+
+        for (int i = 0; i < started; ++i) {
+                pthread_join(workers[i].thread, NULL);
+                if (i > 0) {
+                        apfs_stats_add(workers[i].ctx, &stats->io);
+                        apfs_close(workers[i].ctx);
+                }
+        }
+
+        pthread_cond_destroy(&job.done);
+        pthread_mutex_destroy(&job.lock);
+
+end:
+        for (uint64_t i = 0; i < job.fileCount; ++i)
+                free(job.files[i].extents);
+        free(job.files);
+        free(job.dirs);
+        free(job.names);
+        apfs_volume_close(vol);
+        apfs_stats_add(ctx, &stats->io);
+        apfs_close(ctx);
+
+        stats->seconds = now() - start;
+        return job.failed ? -1 : 0;
+}
@@ -0,0 +1,15 @@
+#pragma once
+#include <stdio.h>
+#include <stdint.h>
+#include "digest.h"
+#include "libapfsspy.h"
+
+typedef struct {
+        uint64_t files;
+        uint64_t bytes;                 // Logical bytes hashed
+        uint64_t errors;                // Files whose data could not be read
+        double seconds;
+        apfs_stats io;                  // Summed over the contexts of every thread
+} hash_stats;
+
+int hashVolume(const char*, int, uint32_t, int, unsigned, FILE*, hash_stats*);
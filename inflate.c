@@ -0,0 +1,98 @@
+// inflate.c : The inflate backend used for zlib chunks, picked at build time.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "inflate.h"
+
+#if defined(INFLATE_BACKEND_LIBDEFLATE)
+#include <libdeflate.h>
+
+#define INFLATE_BACKEND_NAME "libdeflate"
+
+void* inflateBackendInit(void)
+{
+        return libdeflate_alloc_decompressor();
+}
+
+int inflateBackendChunk(void *state, const uint8_t *in, size_t inLen, uint8_t *out, size_t outLen, size_t *produced)
+{
+        enum libdeflate_result ret = libdeflate_zlib_decompress((struct libdeflate_decompressor*)state, in, inLen, out, outLen, produced);
+
+        if (ret != LIBDEFLATE_SUCCESS) {
+                *produced = 0;
+                return -1;
+        }
+
+        return 0;
+}
+
+void inflateBackendEnd(void *state)
+{
+        libdeflate_free_decompressor((struct libdeflate_decompressor*)state);
+}
+
+#else
+#if defined(INFLATE_BACKEND_ZLIBNG)
+#include <zlib-ng.h>
+
+#define INFLATE_BACKEND_NAME "zlib-ng"
+#define ZLIB(name) zng_##name
+typedef zng_stream inflate_stream;
+#else
+#include <zlib.h>
+
+#define INFLATE_BACKEND_NAME "zlib"
+#define ZLIB(name) name
+typedef z_stream inflate_stream;
+#endif
+
+// One stream per expansion, reset between chunks instead of reinitialized
+void* inflateBackendInit(void)
+{
+        inflate_stream *stream = (inflate_stream*)calloc(1, sizeof(inflate_stream));
+
+        if (stream != NULL && ZLIB(inflateInit)(stream) != Z_OK) {
+                free(stream);
+                return NULL;
+        }
+
+        return stream;
+}
+
+int inflateBackendChunk(void *state, const uint8_t *in, size_t inLen, uint8_t *out, size_t outLen, size_t *produced)
+{
+        inflate_stream *stream = (inflate_stream*)state;
+        int ret;
+
+        if (ZLIB(inflateReset)(stream) != Z_OK) {
+                *produced = 0;
+                return -1;
+        }
+
+        stream->next_in   = (void*)in;
+        stream->avail_in  = inLen;
+        stream->next_out  = out;
+        stream->avail_out = outLen;
+
+        ret = ZLIB(inflate)(stream, Z_FINISH);
+
+        // Whatever was inflated is kept, even on error
+        *produced = stream->total_out;
+
+        if (ret != Z_STREAM_END)
+                return -1;
+
+        return 0;
+}
+
+void inflateBackendEnd(void *state)
+{
+        ZLIB(inflateEnd)((inflate_stream*)state);
+        free(state);
+}
+#endif
+
+const char* inflateBackendName(void)
+{
+        return INFLATE_BACKEND_NAME;
+}
@@ -0,0 +1,18 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Inflate backends
+ *
+ * zlib chunks carry their expanded size in the blkx table, so every backend
+ * inflates a whole chunk into a buffer supplied by the caller. The backend is
+ * chosen at build time with INFLATE_BACKEND (zlib, zlibng or libdeflate, see
+ * the Makefile); zlib stays the default. Each state is used by one thread.
+ * Nothing is printed: inflateBackendInit returns NULL and inflateBackendChunk
+ * -1 (with what was inflated counted in *produced) and the caller reports it.
+ */
+void* inflateBackendInit(void);
+int inflateBackendChunk(void*, const uint8_t*, size_t, uint8_t*, size_t, size_t*);
+void inflateBackendEnd(void*);
+const char* inflateBackendName(void);
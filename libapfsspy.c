@@ -0,0 +1,2973 @@
+// libapfsspy.c : Reentrant, read-only APFS reader behind the apfs_ctx handle.
+//
+//   Blocks are served from the DMG mapping (inflating zlib chunks on demand)
+//   or from a raw image, through small per-context caches for metadata and
+//   file data. On top of that sit a generic B-tree engine with typed key
+//   comparison, the object map and the file system tree operations of
+//   libapfsspy.h.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <endian.h>
+#include "dmgParser.h"
+#include "apfs.h"
+#include "inflate.h"
+#include "libapfsspy.h"
+#include "popcount.h"
+#include "checkpoint.h"
+#include "fsobject.h"
+#include "xfield.h"
+#include "crc32.h"
+#include "unicode.h"
+
+#define APFS_CHUNK_SLOTS        4       // Inflated DMG chunks kept per context
+#define APFS_CACHE_BLOCKS       1024    // Metadata blocks kept per context
+#define APFS_DATA_BLOCKS        1024    // File data blocks kept per context
+#define APFS_READAHEAD_MIN      4       // Blocks read ahead once access turns sequential
+#define APFS_READAHEAD_MAX      256     // Largest readahead window, in blocks
+#define APFS_MAX_DEPTH          16      // Deepest B-tree that is followed
+#define APFS_MIN_BLOCK_SIZE     4096
+#define APFS_MAX_BLOCK_SIZE     65536
+#define APFS_MAX_CHECKPOINTS    64      // Container superblocks remembered from the descriptor area
+
+#define OBJECT_TYPE_MASK        0x0000ffff
+#define OBJ_PHYSICAL            0x40000000
+
+#define BTNODE_ROOT             0x0001
+#define BTNODE_LEAF             0x0002
+#define BTNODE_FIXED_KV_SIZE    0x0004
+#define BTOFF_INVALID           0xffff
+
+#define OMAP_VAL_DELETED        0x00000001
+#define CI_COUNT_MASK           0x000fffff
+#define DREC_HASH_BITS          0x003fffff      // J_DREC_HASH_MASK as the specification prints it misses bit 11
+
+typedef int (*apfs_key_compare)(const uint8_t*, uint16_t, const uint8_t*, uint16_t);
+
+/* A B-tree and what is needed to walk it */
+typedef struct apfs_btree {
+        uint64_t root;                  // Root node, physical address or virtual identifier
+        uint64_t xid;                   // Newest transaction visible through the tree
+        const struct apfs_btree *omap;  // Resolves virtual child identifiers, NULL for physical trees
+        apfs_key_compare compare;
+        uint32_t keySize;               // Fixed key and value sizes, 0 for variable sized trees
+        uint32_t valSize;
+} apfs_btree;
+
+/* A B-tree node decoded in place */
+typedef struct {
+        const uint8_t *block;
+        uint16_t flags;
+        uint16_t level;
+        uint32_t count;
+        uint32_t toc;                   // Offset of the table of contents
+        uint32_t keys;                  // Start of the key area
+        uint32_t vals;                  // End of the value area
+} apfs_node;
+
+/* Direct mapped block cache */
+typedef struct {
+        uint64_t *tags;                 // Block address + 1, 0 for an empty slot
+        uint8_t *data;
+        uint32_t slots;
+} apfs_cache;
+
+/* One extent of a file's data stream */
+typedef struct {
+        uint64_t logical;
+        uint64_t length;
+        uint64_t paddr;                 // First block, 0 for a hole
+} apfs_extent;
+
+/* One inflated DMG chunk */
+typedef struct {
+        const dmg_chunk *chunk;
+        uint8_t *data;
+        uint64_t capacity;
+        uint64_t used;                  // Clock value of the last hit
+} apfs_chunk_slot;
+
+struct apfs_ctx {
+        dmg_image image;
+        dmg_partition_table partitions;
+        dmg_partition *part;            // NULL for a raw image
+        uint64_t size;                  // Bytes in the container
+        void *inflater;
+        apfs_chunk_slot chunks[APFS_CHUNK_SLOTS];
+        uint64_t clock;
+
+        apfs_cache meta;                // B-tree nodes and other objects
+        apfs_cache data;                // File contents, filled by apfs_pread and its readahead
+
+        uint32_t blockSize;
+        APFS_SuperBlk nx;
+        uint64_t xid;
+        uint8_t uuid[16];
+        apfs_btree omap;
+        uint32_t volumeCount;
+        uint64_t volumes[NX_MAX_FILE_SYSTEMS];
+        uint32_t checkpointCount;
+        uint64_t checkpoints[APFS_MAX_CHECKPOINTS];     // Transactions of the valid superblocks, ascending
+        uint64_t checkpointBlocks[APFS_MAX_CHECKPOINTS];        // Where each was read, the descriptor area's copy if any
+        ephemeral_map ephemeral;        // Ephemeral objects of the checkpoint in use
+
+        uint64_t *allocated;            // One bit per container block, 1 when in use; loaded on first use
+        apfs_space_info space;
+        int spaceError;                 // Why the space manager could not be loaded, so it is only tried once
+
+        int carveOmapsLoaded;
+        uint32_t carveOmapCount;
+        apfs_btree carveOmaps[NX_MAX_FILE_SYSTEMS];     // Volume omaps that orphaned nodes are checked against
+
+        apfs_stats stats;               // See apfs_stats_add; syscalls are counted in image
+};
+
+struct apfs_volume {
+        apfs_ctx *ctx;
+        apfs_superblock_t sb;
+        apfs_btree omap;
+        apfs_btree fs;
+        int caseInsensitive;
+        int hashedNames;                // Directory entries have j_drec_hashed_key_t keys
+        uint64_t snapshot;              // Transaction of the snapshot, 0 for the live volume
+};
+
+struct apfs_file {
+        apfs_volume *volume;
+        apfs_stat_t st;
+        apfs_extent *extents;           // Sorted by logical offset
+        uint32_t count;
+        uint32_t capacity;
+        uint64_t nextOffset;            // Where a sequential reader continues
+        uint64_t readaheadEnd;          // Logical offset read ahead up to
+        uint32_t window;                // Current readahead window, in blocks
+        uint8_t *scratch;               // APFS_READAHEAD_MAX blocks for readAhead
+};
+
+/* Fletcher-64 as used by obj_phys_t.o_cksum */
+static uint64_t fletcher64(const uint8_t *data, size_t len)
+{
+        uint64_t sum1 = 0, sum2 = 0, c1, c2;
+        const uint32_t *words = (const uint32_t*)data;
+
+        for (size_t i = 0; i < len / 4; ++i) {
+                sum1 = (sum1 + le32toh(words[i])) % 0xffffffff;
+                sum2 = (sum2 + sum1) % 0xffffffff;
+        }
+
+        c1 = 0xffffffff - ((sum1 + sum2) % 0xffffffff);
+        c2 = 0xffffffff - ((sum1 + c1) % 0xffffffff);
+
+        return (c2 << 32) | c1;
+}
+
+static int objectValid(const uint8_t *block, uint32_t blockSize)
+{
+        uint64_t stored;
+
+        memcpy(&stored, block, sizeof(stored));
+        return fletcher64(block + MAX_CKSUM_SIZE, blockSize - MAX_CKSUM_SIZE) == stored;
+}
+
+static double now(void)
+{
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void timerAdd(apfs_timer *timer, double started)
+{
+        timer->seconds += now() - started;
+        timer->runs++;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Device: the bytes of the container                                     */
+/* ---------------------------------------------------------------------- */
+
+// Returns an inflated zlib chunk, from the slots when it was used recently
+static const uint8_t* chunkData(apfs_ctx *ctx, const dmg_chunk *chunk)
+{
+        apfs_chunk_slot *slot = &ctx->chunks[0];
+        uint64_t expanded = (uint64_t)chunk->SectorCount * SECTOR_SIZE;
+        const uint8_t *compressed;
+        size_t produced;
+        double started;
+
+        for (int i = 0; i < APFS_CHUNK_SLOTS; ++i) {
+                if (ctx->chunks[i].chunk == chunk) {
+                        ctx->chunks[i].used = ++ctx->clock;
+                        return ctx->chunks[i].data;
+                }
+                if (ctx->chunks[i].used < slot->used)
+                        slot = &ctx->chunks[i];
+        }
+
+        if (slot->capacity < expanded) {
+                uint8_t *grown = (uint8_t*)realloc(slot->data, expanded);
+
+                if (grown == NULL)
+                        return NULL;
+                slot->data = grown;
+                slot->capacity = expanded;
+        }
+
+        slot->chunk = NULL;
+        if ((compressed = imageRange(&ctx->image, chunk->CompressedOffset, chunk->CompressedLength)) == NULL)
+                return NULL;
+
+        started = now();
+        if (inflateBackendChunk(ctx->inflater, compressed, chunk->CompressedLength, slot->data, expanded, &produced) < 0)
+                return NULL;
+        timerAdd(&ctx->stats.inflate, started);
+        ctx->stats.chunks++;
+        ctx->stats.bytes_read += chunk->CompressedLength;
+
+        // A short chunk reads as zeros past its end, as readDataBlks leaves it
+        memset(slot->data + produced, 0, expanded - produced);
+        slot->chunk = chunk;
+        slot->used = ++ctx->clock;
+
+        return slot->data;
+}
+
+// Copies [offset, offset + len) of the container into buf
+static int deviceRead(apfs_ctx *ctx, uint64_t offset, void *buf, uint64_t len)
+{
+        uint8_t *out = (uint8_t*)buf;
+
+        if (offset > ctx->size || len > ctx->size - offset)
+                return APFS_EIO;
+
+        if (len > 0)
+                ctx->stats.blocks_fetched += (offset + len - 1) / BLK_SIZE - offset / BLK_SIZE + 1;
+
+        if (ctx->part == NULL) {
+                memcpy(out, ctx->image.data + offset, len);
+                ctx->stats.bytes_read += len;
+                return APFS_OK;
+        }
+
+        while (len > 0) {
+                const dmg_chunk *chunk = findChunkBySector(ctx->part, offset / SECTOR_SIZE);
+                uint64_t within, n;
+                const uint8_t *data;
+
+                // Sectors no chunk covers read as zeros
+                if (chunk == NULL) {
+                        n = SECTOR_SIZE - offset % SECTOR_SIZE;
+                        n = n < len ? n : len;
+                        memset(out, 0, n);
+                        out += n;
+                        offset += n;
+                        len -= n;
+                        continue;
+                }
+
+                within = offset - chunk->SectorNumber * SECTOR_SIZE;
+                n = (uint64_t)chunk->SectorCount * SECTOR_SIZE - within;
+                n = n < len ? n : len;
+
+                switch (chunk->EntryType) {
+                        case ENTRY_TYPE_ZERO:
+                        case ENTRY_TYPE_IGNORE:
+                                memset(out, 0, n);
+                                break;
+                        case ENTRY_TYPE_RAW:
+                                if ((data = imageRange(&ctx->image, chunk->CompressedOffset + within, n)) == NULL)
+                                        return APFS_EIO;
+                                memcpy(out, data, n);
+                                ctx->stats.bytes_read += n;
+                                break;
+                        case ENTRY_TYPE_ZLIB:
+                                if ((data = chunkData(ctx, chunk)) == NULL)
+                                        return APFS_EIO;
+                                memcpy(out, data + within, n);
+                                break;
+                        default:
+                                return APFS_EUNSUPPORTED;
+                }
+
+                out += n;
+                offset += n;
+                len -= n;
+        }
+
+        return APFS_OK;
+}
+
+static int cacheInit(apfs_cache *cache, uint32_t slots, uint32_t blockSize)
+{
+        cache->slots = slots;
+        cache->tags = (uint64_t*)calloc(slots, sizeof(uint64_t));
+        cache->data = (uint8_t*)malloc((uint64_t)slots * blockSize);
+
+        return cache->tags == NULL || cache->data == NULL ? APFS_ENOMEM : APFS_OK;
+}
+
+static void cacheFree(apfs_cache *cache)
+{
+        free(cache->tags);
+        free(cache->data);
+}
+
+/*
+ * Returns the cached copy of a block, reading it on a miss. It stays valid
+ * until the slot is reused. *ret is 1 when the block had to be read, 0 on a
+ * hit and negative (with NULL returned) on error.
+ */
+static const uint8_t* cacheBlock(apfs_ctx *ctx, apfs_cache *cache, uint64_t paddr, int *ret)
+{
+        uint32_t slot = paddr % cache->slots;
+        uint8_t *cached = cache->data + (uint64_t)slot * ctx->blockSize;
+
+        *ret = 0;
+        if (cache->tags[slot] != paddr + 1) {
+                if ((*ret = deviceRead(ctx, paddr * ctx->blockSize, cached, ctx->blockSize)) < 0) {
+                        cache->tags[slot] = 0;
+                        return NULL;
+                }
+                cache->tags[slot] = paddr + 1;
+                *ret = 1;
+        }
+
+        return cached;
+}
+
+static void cacheDrop(apfs_cache *cache, uint64_t paddr)
+{
+        if (cache->tags[paddr % cache->slots] == paddr + 1)
+                cache->tags[paddr % cache->slots] = 0;
+}
+
+/*
+ * Loads count blocks from paddr into the cache with as few device reads as
+ * possible: runs of blocks that are not cached yet are read in one go.
+ */
+static int cachePrefetch(apfs_ctx *ctx, apfs_cache *cache, uint64_t paddr, uint64_t count, uint8_t *scratch)
+{
+        uint64_t i = 0, run;
+        int ret;
+
+        while (i < count) {
+                if (cache->tags[(paddr + i) % cache->slots] == paddr + i + 1) {
+                        i++;
+                        continue;
+                }
+
+                for (run = 1; i + run < count && run < APFS_READAHEAD_MAX; ++run)
+                        if (cache->tags[(paddr + i + run) % cache->slots] == paddr + i + run + 1)
+                                break;
+
+                if ((ret = deviceRead(ctx, (paddr + i) * ctx->blockSize, scratch, run * ctx->blockSize)) < 0)
+                        return ret;
+
+                for (uint64_t b = 0; b < run; ++b) {
+                        uint32_t slot = (paddr + i + b) % cache->slots;
+
+                        memcpy(cache->data + (uint64_t)slot * ctx->blockSize, scratch + b * ctx->blockSize, ctx->blockSize);
+                        cache->tags[slot] = paddr + i + b + 1;
+                }
+                i += run;
+        }
+
+        return APFS_OK;
+}
+
+/*
+ * Reads an object through the metadata cache and checks its type unless that
+ * is 0. The checksum is verified when the block is read from the image; only
+ * valid objects stay cached, so hits skip the Fletcher-64 pass.
+ */
+static int readObject(apfs_ctx *ctx, uint64_t paddr, uint8_t *buf, uint32_t type)
+{
+        const obj_phys_t *obj = (const obj_phys_t*)buf;
+        const uint8_t *cached;
+        int ret;
+
+        if ((cached = cacheBlock(ctx, &ctx->meta, paddr, &ret)) == NULL)
+                return ret;
+        if (ret == 1 && !objectValid(cached, ctx->blockSize)) {
+                cacheDrop(&ctx->meta, paddr);
+                return APFS_ECHECKSUM;
+        }
+
+        memcpy(buf, cached, ctx->blockSize);
+        if (type != 0 && (obj->o_type & OBJECT_TYPE_MASK) != type)
+                return APFS_EFORMAT;
+
+        return APFS_OK;
+}
+
+/* ---------------------------------------------------------------------- */
+/* B-trees                                                                */
+/* ---------------------------------------------------------------------- */
+
+static int nodeDecode(apfs_ctx *ctx, const uint8_t *block, apfs_node *node)
+{
+        const btree_node_phys_t *phys = (const btree_node_phys_t*)block;
+        uint32_t type = phys->btn_o.o_type & OBJECT_TYPE_MASK;
+
+        if (type != eApFS_ObjectType_02_BTreeRoot && type != eApFS_ObjectType_03_BTreeNode)
+                return APFS_EFORMAT;
+
+        node->block = block;
+        node->flags = phys->btn_flags;
+        node->level = phys->btn_level;
+        node->count = phys->btn_nkeys;
+        node->toc = sizeof(btree_node_phys_t) + phys->btn_table_space.off;
+        node->keys = node->toc + phys->btn_table_space.len;
+        node->vals = ctx->blockSize - (node->flags & BTNODE_ROOT ? sizeof(btree_info_t) : 0);
+
+        if (node->keys > node->vals ||
+            node->count * (node->flags & BTNODE_FIXED_KV_SIZE ? sizeof(kvoff_t) : sizeof(kvloc_t)) > phys->btn_table_space.len)
+                return APFS_EFORMAT;
+
+        return APFS_OK;
+}
+
+// Locates entry i of a node. Entries that fall outside the node are reported as malformed.
+static int nodeEntry(const apfs_btree *tree, const apfs_node *node, uint32_t i,
+                     const uint8_t **key, uint16_t *keyLen, const uint8_t **val, uint16_t *valLen)
+{
+        uint32_t keyOff, valOff;
+
+        if (node->flags & BTNODE_FIXED_KV_SIZE) {
+                const kvoff_t *entry = (const kvoff_t*)(node->block + node->toc) + i;
+
+                keyOff = entry->k;
+                valOff = entry->v;
+                *keyLen = tree->keySize;
+                *valLen = node->flags & BTNODE_LEAF ? tree->valSize : sizeof(uint64_t);
+        } else {
+                const kvloc_t *entry = (const kvloc_t*)(node->block + node->toc) + i;
+
+                keyOff = entry->k.off;
+                *keyLen = entry->k.len;
+                valOff = entry->v.off;
+                *valLen = entry->v.len;
+        }
+
+        if (node->keys + keyOff + *keyLen > node->vals || valOff == BTOFF_INVALID ||
+            valOff > node->vals - node->keys || *valLen > valOff)
+                return APFS_EFORMAT;
+
+        *key = node->block + node->keys + keyOff;
+        *val = node->block + node->vals - valOff;
+
+        return APFS_OK;
+}
+
+static int btreeOpen(apfs_ctx *ctx, apfs_btree *tree, uint64_t root, const apfs_btree *omap,
+                     uint64_t xid, apfs_key_compare compare);
+static int omapLookup(apfs_ctx *ctx, const apfs_btree *omap, uint64_t oid, uint64_t xid, uint64_t *paddr);
+
+// Reads a node of the tree by its identifier, resolving it through the omap for virtual trees
+static int readNode(apfs_ctx *ctx, const apfs_btree *tree, uint64_t oid, uint8_t *buf, apfs_node *node)
+{
+        uint64_t paddr = oid;
+        int ret;
+
+        ctx->stats.btree_nodes++;
+        if (tree->omap != NULL && (ret = omapLookup(ctx, tree->omap, oid, tree->xid, &paddr)) < 0)
+                return ret == APFS_ENOENT ? APFS_EFORMAT : ret;
+
+        if ((ret = readObject(ctx, paddr, buf, 0)) < 0)
+                return ret;
+
+        return nodeDecode(ctx, buf, node);
+}
+
+// Called for every entry of a scan in key order; 0 continues, 1 stops, <0 aborts
+typedef int (*apfs_scan_cb)(const uint8_t*, uint16_t, const uint8_t*, uint16_t, void*);
+
+/*
+ * Visits the entries of the subtree rooted at oid whose keys are not below
+ * key, in order, until the callback stops the scan.
+ *
+ * Return Value
+ *
+ *  1 if the callback stopped the scan
+ *  0 if the subtree was exhausted
+ *  <0 on error
+ */
+static int scanNode(apfs_ctx *ctx, const apfs_btree *tree, uint64_t oid, int depth,
+                    const uint8_t *key, uint16_t keyLen, apfs_scan_cb callback, void *arg)
+{
+        const uint8_t *entryKey, *entryVal;
+        uint16_t entryKeyLen, entryValLen;
+        uint32_t low = 0, high, i;
+        apfs_node node;
+        uint8_t *block;
+        int ret;
+
+        if (depth >= APFS_MAX_DEPTH)
+                return APFS_EFORMAT;
+
+        // Every level keeps its own copy, the cache slot may be reused while it is walked
+        if ((block = (uint8_t*)malloc(ctx->blockSize)) == NULL)
+                return APFS_ENOMEM;
+
+        if ((ret = readNode(ctx, tree, oid, block, &node)) < 0)
+                goto end;
+
+        // First entry whose key is not below the search key
+        high = node.count;
+        while (low < high) {
+                uint32_t mid = low + (high - low) / 2;
+
+                if ((ret = nodeEntry(tree, &node, mid, &entryKey, &entryKeyLen, &entryVal, &entryValLen)) < 0)
+                        goto end;
+                if (tree->compare(entryKey, entryKeyLen, key, keyLen) < 0)
+                        low = mid + 1;
+                else
+                        high = mid;
+        }
+
+        ret = 0;
+        if (node.flags & BTNODE_LEAF) {
+                for (i = low; i < node.count && ret == 0; ++i) {
+                        if ((ret = nodeEntry(tree, &node, i, &entryKey, &entryKeyLen, &entryVal, &entryValLen)) < 0)
+                                break;
+                        ret = callback(entryKey, entryKeyLen, entryVal, entryValLen, arg);
+                }
+                goto end;
+        }
+
+        // The child left of the first bigger key may still hold matches
+        if (low == node.count && low > 0) {
+                low--;
+        } else if (low > 0) {
+                if ((ret = nodeEntry(tree, &node, low, &entryKey, &entryKeyLen, &entryVal, &entryValLen)) < 0)
+                        goto end;
+                if (tree->compare(entryKey, entryKeyLen, key, keyLen) > 0)
+                        low--;
+        }
+
+        for (i = low; i < node.count && ret == 0; ++i) {
+                uint64_t child;
+
+                if ((ret = nodeEntry(tree, &node, i, &entryKey, &entryKeyLen, &entryVal, &entryValLen)) < 0)
+                        break;
+                if (entryValLen < sizeof(child)) {
+                        ret = APFS_EFORMAT;
+                        break;
+                }
+                memcpy(&child, entryVal, sizeof(child));
+                ret = scanNode(ctx, tree, child, depth + 1, key, keyLen, callback, arg);
+        }
+
+end:
+        free(block);
+        return ret;
+}
+
+static int btreeScan(apfs_ctx *ctx, const apfs_btree *tree, const void *key, uint16_t keyLen,
+                     apfs_scan_cb callback, void *arg)
+{
+        int ret = scanNode(ctx, tree, tree->root, 0, (const uint8_t*)key, keyLen, callback, arg);
+
+        return ret < 0 ? ret : APFS_OK;
+}
+
+typedef struct {
+        const apfs_btree *tree;
+        const void *key;
+        uint16_t keyLen;
+        void *val;
+        uint16_t valLen;                // Capacity in, bytes found out
+        int found;
+} apfs_find;
+
+static int findCallback(const uint8_t *key, uint16_t keyLen, const uint8_t *val, uint16_t valLen, void *arg)
+{
+        apfs_find *find = (apfs_find*)arg;
+
+        if (find->tree->compare(key, keyLen, (const uint8_t*)find->key, find->keyLen) == 0) {
+                find->valLen = valLen < find->valLen ? valLen : find->valLen;
+                memcpy(find->val, val, find->valLen);
+                find->found = 1;
+        }
+
+        return 1;
+}
+
+// Copies the value of the entry whose key equals key; *valLen is the capacity in and the length out
+static int btreeFind(apfs_ctx *ctx, const apfs_btree *tree, const void *key, uint16_t keyLen,
+                     void *val, uint16_t *valLen)
+{
+        apfs_find find = { tree, key, keyLen, val, *valLen, 0 };
+        int ret;
+
+        if ((ret = btreeScan(ctx, tree, key, keyLen, findCallback, &find)) < 0)
+                return ret;
+        if (!find.found)
+                return APFS_ENOENT;
+
+        *valLen = find.valLen;
+        return APFS_OK;
+}
+
+static int btreeOpen(apfs_ctx *ctx, apfs_btree *tree, uint64_t root, const apfs_btree *omap,
+                     uint64_t xid, apfs_key_compare compare)
+{
+        uint8_t *block;
+        apfs_node node;
+        int ret;
+
+        memset(tree, 0, sizeof(*tree));
+        tree->root = root;
+        tree->xid = xid;
+        tree->omap = omap;
+        tree->compare = compare;
+
+        if ((block = (uint8_t*)malloc(ctx->blockSize)) == NULL)
+                return APFS_ENOMEM;
+
+        // Fixed key and value sizes are only recorded in the root's btree_info
+        if ((ret = readNode(ctx, tree, root, block, &node)) == 0) {
+                const btree_info_t *info = (const btree_info_t*)(block + ctx->blockSize - sizeof(btree_info_t));
+
+                if (!(node.flags & BTNODE_ROOT)) {
+                        ret = APFS_EFORMAT;
+                } else if (node.flags & BTNODE_FIXED_KV_SIZE) {
+                        tree->keySize = info->bt_fixed.bt_key_size;
+                        tree->valSize = info->bt_fixed.bt_val_size;
+                }
+        }
+
+        free(block);
+        return ret;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Object maps                                                            */
+/* ---------------------------------------------------------------------- */
+
+static int omapCompare(const uint8_t *a, uint16_t aLen, const uint8_t *b, uint16_t bLen)
+{
+        tApFS_0B_ObjectsMap_Key_t first, second;
+
+        if (aLen < sizeof(first) || bLen < sizeof(second))
+                return (aLen > bLen) - (aLen < bLen);
+
+        memcpy(&first, a, sizeof(first));
+        memcpy(&second, b, sizeof(second));
+
+        if (first.ObjectIdent != second.ObjectIdent)
+                return first.ObjectIdent < second.ObjectIdent ? -1 : 1;
+        if (first.Transaction != second.Transaction)
+                return first.Transaction < second.Transaction ? -1 : 1;
+        return 0;
+}
+
+typedef struct {
+        uint64_t oid;
+        uint64_t xid;
+        tApFS_0B_ObjectsMap_Value_t val;
+        int found;
+} apfs_omap_search;
+
+// Keeps the newest mapping of the object that is not newer than the wanted transaction
+static int omapCallback(const uint8_t *key, uint16_t keyLen, const uint8_t *val, uint16_t valLen, void *arg)
+{
+        apfs_omap_search *search = (apfs_omap_search*)arg;
+        tApFS_0B_ObjectsMap_Key_t entry;
+
+        if (keyLen < sizeof(entry) || valLen < sizeof(search->val))
+                return APFS_EFORMAT;
+
+        memcpy(&entry, key, sizeof(entry));
+        if (entry.ObjectIdent != search->oid || entry.Transaction > search->xid)
+                return 1;
+
+        memcpy(&search->val, val, sizeof(search->val));
+        search->found = 1;
+        return 0;
+}
+
+static int omapLookup(apfs_ctx *ctx, const apfs_btree *omap, uint64_t oid, uint64_t xid, uint64_t *paddr)
+{
+        tApFS_0B_ObjectsMap_Key_t key = { oid, 0 };
+        apfs_omap_search search = { oid, xid };
+        int ret;
+
+        ctx->stats.omap_lookups++;
+        if ((ret = btreeScan(ctx, omap, &key, sizeof(key), omapCallback, &search)) < 0)
+                return ret;
+        if (!search.found || (search.val.Flags & OMAP_VAL_DELETED))
+                return APFS_ENOENT;
+
+        *paddr = search.val.Address;
+        return APFS_OK;
+}
+
+// Opens the B-tree of the omap_phys_t object at paddr
+static int omapOpen(apfs_ctx *ctx, apfs_btree *tree, uint64_t paddr, uint64_t xid)
+{
+        uint8_t *block;
+        omap_phys_t omap;
+        int ret;
+
+        if ((block = (uint8_t*)malloc(ctx->blockSize)) == NULL)
+                return APFS_ENOMEM;
+
+        ret = readObject(ctx, paddr, block, eApFS_ObjectType_0B_ObjectsMap);
+        memcpy(&omap, block, sizeof(omap));
+        free(block);
+
+        if (ret < 0)
+                return ret;
+
+        return btreeOpen(ctx, tree, omap.om_tree_oid, NULL, xid, omapCompare);
+}
+
+/* ---------------------------------------------------------------------- */
+/* Container                                                              */
+/* ---------------------------------------------------------------------- */
+
+// Records a valid container superblock read at paddr, keeping it in best if it is newer than *xid (and is the wanted one, if any)
+static void considerSuperBlock(apfs_ctx *ctx, const uint8_t *block, uint64_t paddr, uint8_t *best, uint64_t *xid,
+                               uint64_t wanted)
+{
+        const obj_phys_t *obj = (const obj_phys_t*)block;
+        const APFS_SuperBlk *nx = (const APFS_SuperBlk*)(block + sizeof(obj_phys_t));
+        uint32_t i;
+
+        if ((obj->o_type & OBJECT_TYPE_MASK) != eApFS_ObjectType_01_SuperBlock || nx->MagicNumber != NX_MAGIC ||
+            nx->BlockSize != ctx->blockSize || !objectValid(block, ctx->blockSize))
+                return;
+
+        for (i = 0; i < ctx->checkpointCount && ctx->checkpoints[i] < obj->o_xid; ++i)
+                ;
+        if (i < ctx->checkpointCount && ctx->checkpoints[i] == obj->o_xid) {
+                ctx->checkpointBlocks[i] = paddr;
+        } else if (ctx->checkpointCount < APFS_MAX_CHECKPOINTS) {
+                memmove(ctx->checkpoints + i + 1, ctx->checkpoints + i, (ctx->checkpointCount - i) * sizeof(uint64_t));
+                memmove(ctx->checkpointBlocks + i + 1, ctx->checkpointBlocks + i,
+                        (ctx->checkpointCount - i) * sizeof(uint64_t));
+                ctx->checkpoints[i] = obj->o_xid;
+                ctx->checkpointBlocks[i] = paddr;
+                ctx->checkpointCount++;
+        }
+
+        if (obj->o_xid <= *xid || (wanted != 0 && obj->o_xid != wanted))
+                return;
+
+        memcpy(best, block, ctx->blockSize);
+        *xid = obj->o_xid;
+}
+
+// Decodes the checkpoint map blocks written by the selected transaction into ctx->ephemeral
+static int loadEphemeralObjects(apfs_ctx *ctx, const uint32_t *maps, const uint64_t *mapXids, uint32_t mapCount,
+                                uint8_t *block)
+{
+        for (uint32_t i = 0; i < mapCount; ++i) {
+                if (mapXids[i] != ctx->xid)
+                        continue;
+                if (deviceRead(ctx, (ctx->nx.DescriptorBase + maps[i]) * ctx->blockSize, block, ctx->blockSize) < 0)
+                        return APFS_EIO;
+                if (ephemeralMapAdd(&ctx->ephemeral, (const checkPoint_Map*)block, ctx->blockSize) < 0)
+                        return APFS_ENOMEM;
+        }
+
+        return APFS_OK;
+}
+
+/*
+   Input Parameters: apfs_ctx*, uint64_t
+   Return Type:      int
+Description: Reads block 0 for the block size and the checkpoint descriptor
+area, then keeps the valid container superblock with the highest transaction
+among block 0 and the copies in the descriptor area, or the one written by
+the wanted transaction when that is not 0. The checkpoint map blocks met on
+the way are noted, and those of the selected checkpoint are decoded into the
+table of its ephemeral objects.
+
+ */
+static int openContainer(apfs_ctx *ctx, uint64_t wanted)
+{
+        uint8_t *block, *best;
+        APFS_SuperBlk nx;
+        uint64_t xid = 0, *mapXids = NULL;
+        uint32_t *maps = NULL, mapCount = 0;
+        int ret = APFS_OK;
+
+        if (ctx->size < APFS_MIN_BLOCK_SIZE)
+                return APFS_EFORMAT;
+
+        // The superblock candidates are read past the cache, they are only looked at once
+        if ((block = (uint8_t*)malloc(APFS_MAX_BLOCK_SIZE)) == NULL)
+                return APFS_ENOMEM;
+        if ((best = (uint8_t*)malloc(APFS_MAX_BLOCK_SIZE)) == NULL) {
+                free(block);
+                return APFS_ENOMEM;
+        }
+
+        if ((ret = deviceRead(ctx, 0, block, APFS_MIN_BLOCK_SIZE)) < 0)
+                goto end;
+
+        memcpy(&nx, block + sizeof(obj_phys_t), sizeof(nx));
+        if (nx.MagicNumber != NX_MAGIC || nx.BlockSize < APFS_MIN_BLOCK_SIZE || nx.BlockSize > APFS_MAX_BLOCK_SIZE ||
+            (nx.BlockSize & (nx.BlockSize - 1)) != 0 || nx.BlockSize > ctx->size) {
+                ret = APFS_EFORMAT;
+                goto end;
+        }
+
+        ctx->blockSize = nx.BlockSize;
+        if ((ret = cacheInit(&ctx->meta, APFS_CACHE_BLOCKS, ctx->blockSize)) < 0 ||
+            (ret = cacheInit(&ctx->data, APFS_DATA_BLOCKS, ctx->blockSize)) < 0)
+                goto end;
+
+        if ((ret = deviceRead(ctx, 0, block, ctx->blockSize)) < 0)
+                goto end;
+        considerSuperBlock(ctx, block, 0, best, &xid, wanted);
+
+        // A descriptor area given as a B-tree (high bit set) is not walked, block 0 is used then
+        if (!(nx.DescriptorBlocks & 0x80000000)) {
+                if ((maps = (uint32_t*)malloc(nx.DescriptorBlocks * sizeof(uint32_t) + 1)) == NULL ||
+                    (mapXids = (uint64_t*)malloc(nx.DescriptorBlocks * sizeof(uint64_t) + 1)) == NULL) {
+                        ret = APFS_ENOMEM;
+                        goto end;
+                }
+
+                for (uint32_t i = 0; i < nx.DescriptorBlocks; ++i) {
+                        const obj_phys_t *obj = (const obj_phys_t*)block;
+
+                        if (deviceRead(ctx, (nx.DescriptorBase + i) * ctx->blockSize, block, ctx->blockSize) < 0)
+                                continue;
+                        if ((obj->o_type & OBJECT_TYPE_MASK) == eApFS_ObjectType_0C_CheckPointMap &&
+                            objectValid(block, ctx->blockSize)) {
+                                maps[mapCount] = i;
+                                mapXids[mapCount++] = obj->o_xid;
+                        } else {
+                                considerSuperBlock(ctx, block, nx.DescriptorBase + i, best, &xid, wanted);
+                        }
+                }
+        }
+
+        if (xid == 0) {
+                ret = wanted != 0 && ctx->checkpointCount ? APFS_ENOENT : APFS_ECHECKSUM;
+                goto end;
+        }
+
+        memcpy(&ctx->nx, best + sizeof(obj_phys_t), sizeof(ctx->nx));
+        memcpy(ctx->uuid, ctx->nx.Uuid, sizeof(ctx->uuid));
+        ctx->xid = xid;
+
+        if ((ret = loadEphemeralObjects(ctx, maps, mapXids, mapCount, block)) < 0)
+                goto end;
+
+        if ((ret = omapOpen(ctx, &ctx->omap, ctx->nx.ObjectsMapIdent, xid)) < 0)
+                goto end;
+
+        for (uint32_t i = 0; i < NX_MAX_FILE_SYSTEMS && i < ctx->nx.MaximumVolumes; ++i)
+                if (ctx->nx.VolumesIdents[i] != 0)
+                        ctx->volumes[ctx->volumeCount++] = ctx->nx.VolumesIdents[i];
+
+end:
+        free(block);
+        free(best);
+        free(maps);
+        free(mapXids);
+        return ret;
+}
+
+/*
+   Input Parameters: char*, int, uint64_t, apfs_ctx**
+   Return Type:      int
+Description: Opens a DMG (partition is a blkx index, or APFS_PARTITION_AUTO
+for the first Apple_APFS one) or, when the file has no koly trailer, a raw
+container image, and reads the container superblock written by transaction
+xid (0 for the newest one). Everything read through the context afterwards
+is seen as of that checkpoint.
+
+ */
+int apfs_open_checkpoint(const char *path, int partition, uint64_t xid, apfs_ctx **out)
+{
+        apfs_ctx *ctx;
+        UDIFResourceFile trailer;
+        const char *plist;
+        double started = now();
+        int ret = APFS_OK;
+
+        *out = NULL;
+
+        if ((ctx = (apfs_ctx*)calloc(1, sizeof(apfs_ctx))) == NULL)
+                return APFS_ENOMEM;
+
+        if (readImageFile(&ctx->image, (char*)path) < 0) {
+                free(ctx);
+                return APFS_EIO;
+        }
+
+        ctx->size = ctx->image.size;
+        timerAdd(&ctx->stats.map, started);
+
+        if (memcmp(ctx->image.data + ctx->image.size - sizeof(trailer), "koly", 4) == 0) {
+                started = now();
+                if (parseDMGTrailer(&ctx->image, &trailer) < 0 || (plist = readXMLOffset(&ctx->image, &trailer)) == NULL) {
+                        ret = APFS_EFORMAT;
+                        goto end;
+                }
+                if ((ret = buildPartitionTable(plist, be64toh(trailer.XMLLength), &ctx->partitions)) < 0) {
+                        ret = ret == DMG_ENOMEM ? APFS_ENOMEM : APFS_EFORMAT;
+                        goto end;
+                }
+                timerAdd(&ctx->stats.plist, started);
+
+                if (partition == APFS_PARTITION_AUTO)
+                        ctx->part = findPartitionByName(&ctx->partitions, "Apple_APFS");
+                else if (partition >= 0)
+                        ctx->part = getPartition(&ctx->partitions, partition);
+
+                if (ctx->part == NULL) {
+                        ret = APFS_ENOENT;
+                        goto end;
+                }
+
+                ctx->size = ctx->part->SectorCount * SECTOR_SIZE;
+                if ((ctx->inflater = inflateBackendInit()) == NULL) {
+                        ret = APFS_ENOMEM;
+                        goto end;
+                }
+        }
+
+        started = now();
+        ret = openContainer(ctx, xid);
+        timerAdd(&ctx->stats.container, started);
+
+end:
+        if (ret < 0)
+                apfs_close(ctx);
+        else
+                *out = ctx;
+
+        return ret;
+}
+
+int apfs_open(const char *path, int partition, apfs_ctx **out)
+{
+        return apfs_open_checkpoint(path, partition, 0, out);
+}
+
+void apfs_close(apfs_ctx *ctx)
+{
+        if (ctx == NULL)
+                return;
+
+        for (int i = 0; i < APFS_CHUNK_SLOTS; ++i)
+                free(ctx->chunks[i].data);
+        if (ctx->inflater)
+                inflateBackendEnd(ctx->inflater);
+        if (ctx->partitions.Partitions)
+                freePartitionTable(&ctx->partitions);
+
+        cacheFree(&ctx->meta);
+        cacheFree(&ctx->data);
+        ephemeralMapFree(&ctx->ephemeral);
+        free(ctx->allocated);
+        closeImageFile(&ctx->image);
+        free(ctx);
+}
+
+/*
+   Input Parameters: apfs_ctx*, apfs_stats*
+   Return Type:      void
+Description: Adds what the context has done since it was opened to *stats,
+so the work of several contexts (one per thread, say) can be summed. Zero
+*stats first to read a single context.
+
+ */
+void apfs_stats_add(apfs_ctx *ctx, apfs_stats *stats)
+{
+        const apfs_timer *from[] = { &ctx->stats.map, &ctx->stats.plist, &ctx->stats.inflate, &ctx->stats.container };
+        apfs_timer *to[] = { &stats->map, &stats->plist, &stats->inflate, &stats->container };
+
+        stats->bytes_read += ctx->stats.bytes_read;
+        stats->syscalls += ctx->image.syscalls;
+        stats->blocks_fetched += ctx->stats.blocks_fetched;
+        stats->chunks += ctx->stats.chunks;
+        stats->omap_lookups += ctx->stats.omap_lookups;
+        stats->btree_nodes += ctx->stats.btree_nodes;
+
+        for (size_t i = 0; i < sizeof(to) / sizeof(to[0]); ++i) {
+                to[i]->seconds += from[i]->seconds;
+                to[i]->runs += from[i]->runs;
+        }
+}
+
+int apfs_container_info_get(apfs_ctx *ctx, apfs_container_info *info)
+{
+        memset(info, 0, sizeof(*info));
+        info->block_size = ctx->blockSize;
+        info->block_count = ctx->nx.BlocksCount;
+        info->xid = ctx->xid;
+        apfs_checkpoint_superblock(ctx, ctx->xid, &info->superblock);
+        info->volume_count = ctx->volumeCount;
+        info->ephemeral_count = ctx->ephemeral.count;
+        memcpy(info->uuid, ctx->uuid, sizeof(info->uuid));
+
+        return APFS_OK;
+}
+
+// Copies up to max transactions of the valid checkpoints, oldest first, and returns how many there are
+int apfs_checkpoint_list(apfs_ctx *ctx, uint64_t *xids, uint32_t max)
+{
+        for (uint32_t i = 0; i < ctx->checkpointCount && i < max; ++i)
+                xids[i] = ctx->checkpoints[i];
+
+        return ctx->checkpointCount;
+}
+
+// Block holding the container superblock written by transaction xid
+int apfs_checkpoint_superblock(apfs_ctx *ctx, uint64_t xid, uint64_t *paddr)
+{
+        for (uint32_t i = 0; i < ctx->checkpointCount; ++i) {
+                if (ctx->checkpoints[i] == xid) {
+                        *paddr = ctx->checkpointBlocks[i];
+                        return APFS_OK;
+                }
+        }
+
+        return APFS_ENOENT;
+}
+
+// Finds where the checkpoint in use stored an ephemeral object
+int apfs_ephemeral_find(apfs_ctx *ctx, uint64_t oid, uint64_t *paddr, uint32_t *size)
+{
+        const ephemeral_object *object = ephemeralMapFind(&ctx->ephemeral, oid);
+
+        if (object == NULL)
+                return ctx->nx.DescriptorBlocks & 0x80000000 ? APFS_EUNSUPPORTED : APFS_ENOENT;
+
+        *paddr = object->paddr;
+        *size = object->size;
+        return APFS_OK;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Space manager                                                          */
+/* ---------------------------------------------------------------------- */
+
+// Copies the allocation bits of one chunk straight from its bitmap block into ctx->allocated
+static int spaceChunk(apfs_ctx *ctx, const chunk_info_t *chunk)
+{
+        uint64_t first = chunk->ci_addr, count = chunk->ci_block_count & CI_COUNT_MASK;
+        uint8_t *bits = (uint8_t*)(ctx->allocated + first / 64);
+        int ret;
+
+        if (first % 64 != 0 || count > (uint64_t)ctx->blockSize * 8 || first + count > ctx->space.block_count)
+                return APFS_EFORMAT;
+
+        ctx->space.chunk_count++;
+
+        // A chunk without a bitmap is entirely free
+        if (chunk->ci_bitmap_addr == 0 || count == 0)
+                return APFS_OK;
+
+        if ((ret = deviceRead(ctx, chunk->ci_bitmap_addr * ctx->blockSize, bits, (count + 7) / 8)) < 0)
+                return ret;
+        if (count % 8)
+                bits[count / 8] &= (1 << (count % 8)) - 1;
+
+        return APFS_OK;
+}
+
+static int spaceChunkInfoBlock(apfs_ctx *ctx, uint64_t paddr, uint8_t *buf)
+{
+        const chunk_info_block_t *cib = (const chunk_info_block_t*)buf;
+        int ret;
+
+        if ((ret = readObject(ctx, paddr, buf, eApFS_ObjectType_07_SpaceManagerCIB)) < 0)
+                return ret;
+        if (sizeof(*cib) + (uint64_t)cib->cib_chunk_info_count * sizeof(chunk_info_t) > ctx->blockSize)
+                return APFS_EFORMAT;
+
+        ctx->space.cib_count++;
+        for (uint32_t i = 0; i < cib->cib_chunk_info_count; ++i)
+                if ((ret = spaceChunk(ctx, &cib->cib_chunk_info[i])) < 0)
+                        return ret;
+
+        return APFS_OK;
+}
+
+/*
+   Input Parameters: apfs_ctx*
+   Return Type:      int
+Description: Loads the allocation bitmap of the container's main device once.
+The space manager is an ephemeral object, found through the checkpoint map;
+its address array lists the chunk-info blocks, or the CIB address blocks that
+list them on large containers. Every chunk with a bitmap has it read in place
+into ctx->allocated, so the container costs one bit per block, and the used
+blocks are counted over the whole array with popcountWords.
+
+ */
+static int spaceLoad(apfs_ctx *ctx)
+{
+        const spaceman_phys_t *sm;
+        const spaceman_device_t *dev;
+        const uint64_t *addrs;
+        uint8_t *object = NULL, *buf = NULL, *cabBuf = NULL;
+        uint64_t paddr, words;
+        uint32_t size, count;
+        int ret;
+
+        if (ctx->allocated)
+                return APFS_OK;
+        if (ctx->spaceError)
+                return ctx->spaceError;
+
+        if ((ret = apfs_ephemeral_find(ctx, ctx->nx.SpaceManagerIdent, &paddr, &size)) < 0)
+                return ctx->spaceError = ret;
+        if (size < sizeof(spaceman_phys_t) || size % ctx->blockSize != 0 || size > (uint32_t)APFS_MAX_BLOCK_SIZE * 4)
+                return ctx->spaceError = APFS_EFORMAT;
+
+        if ((object = (uint8_t*)malloc(size)) == NULL || (buf = (uint8_t*)malloc(ctx->blockSize)) == NULL ||
+            (cabBuf = (uint8_t*)malloc(ctx->blockSize)) == NULL) {
+                ret = APFS_ENOMEM;
+                goto end;
+        }
+
+        if ((ret = deviceRead(ctx, paddr * ctx->blockSize, object, size)) < 0)
+                goto end;
+        if (!objectValid(object, size)) {
+                ret = APFS_ECHECKSUM;
+                goto end;
+        }
+
+        sm = (const spaceman_phys_t*)object;
+        dev = &sm->sm_dev[SD_MAIN];
+        count = dev->sm_cab_count ? dev->sm_cab_count : dev->sm_cib_count;
+        if ((sm->sm_o.o_type & OBJECT_TYPE_MASK) != eApFS_ObjectType_05_SpaceManager ||
+            sm->sm_block_size != ctx->blockSize || dev->sm_block_count > ctx->size / ctx->blockSize ||
+            dev->sm_addr_offset < sizeof(spaceman_phys_t) || dev->sm_addr_offset % sizeof(uint64_t) != 0 ||
+            dev->sm_addr_offset + (uint64_t)count * sizeof(uint64_t) > size) {
+                ret = APFS_EFORMAT;
+                goto end;
+        }
+
+        memset(&ctx->space, 0, sizeof(ctx->space));
+        ctx->space.block_count = dev->sm_block_count;
+        ctx->space.blocks_per_chunk = sm->sm_blocks_per_chunk;
+        ctx->space.recorded_free = dev->sm_free_count;
+        words = (dev->sm_block_count + 63) / 64;
+        if ((ctx->allocated = (uint64_t*)calloc(words ? words : 1, sizeof(uint64_t))) == NULL) {
+                ret = APFS_ENOMEM;
+                goto end;
+        }
+
+        addrs = (const uint64_t*)(object + dev->sm_addr_offset);
+        for (uint32_t i = 0; i < count && ret == APFS_OK; ++i) {
+                const cib_addr_block_t *cab = (const cib_addr_block_t*)cabBuf;
+
+                if (dev->sm_cab_count == 0) {
+                        ret = spaceChunkInfoBlock(ctx, addrs[i], buf);
+                        continue;
+                }
+
+                if ((ret = readObject(ctx, addrs[i], cabBuf, eApFS_ObjectType_06_SpaceManagerCAB)) < 0)
+                        break;
+                if (sizeof(*cab) + (uint64_t)cab->cab_cib_count * sizeof(uint64_t) > ctx->blockSize) {
+                        ret = APFS_EFORMAT;
+                        break;
+                }
+
+                ctx->space.cab_count++;
+                for (uint32_t j = 0; j < cab->cab_cib_count && ret == APFS_OK; ++j)
+                        ret = spaceChunkInfoBlock(ctx, cab->cab_cib_addr[j], buf);
+        }
+
+        if (ret < 0) {
+                free(ctx->allocated);
+                ctx->allocated = NULL;
+                goto end;
+        }
+
+        ctx->space.used_blocks = popcountWords(ctx->allocated, words);
+        ctx->space.free_blocks = ctx->space.block_count - ctx->space.used_blocks;
+
+end:
+        if (ret < 0 && ret != APFS_ENOMEM)
+                ctx->spaceError = ret;
+        free(object);
+        free(buf);
+        free(cabBuf);
+        return ret;
+}
+
+/*
+   Input Parameters: apfs_ctx*, apfs_space_info*
+   Return Type:      int
+Description: Loads the space manager if needed and fills info with the block
+counts of the main device: used and free as counted in the bitmaps, and the
+free count the space manager records for comparison.
+
+ */
+int apfs_space_info_get(apfs_ctx *ctx, apfs_space_info *info)
+{
+        int ret;
+
+        if ((ret = spaceLoad(ctx)) < 0)
+                return ret;
+
+        *info = ctx->space;
+        return APFS_OK;
+}
+
+// First block from block on whose bit is not the used value, or end when there is none
+static uint64_t spaceRunEnd(const uint64_t *bits, uint64_t block, uint64_t end, int used)
+{
+        while (block < end) {
+                uint64_t word = used ? ~bits[block / 64] : bits[block / 64];
+
+                word &= ~0ULL << (block % 64);
+                block -= block % 64;
+                if (word != 0)
+                        return block + __builtin_ctzll(word) < end ? block + __builtin_ctzll(word) : end;
+                block += 64;
+        }
+
+        return end;
+}
+
+/*
+   Input Parameters: apfs_ctx*, apfs_space_cb, void*
+   Return Type:      int
+Description: Calls callback once per run of used or free blocks, in block
+order. Whole words of equal bits are skipped at a time, so a mostly empty
+container is walked in a few thousand steps.
+
+ */
+int apfs_space_extents(apfs_ctx *ctx, apfs_space_cb callback, void *arg)
+{
+        uint64_t block = 0, end;
+        int ret;
+
+        if ((ret = spaceLoad(ctx)) < 0)
+                return ret;
+
+        while (block < ctx->space.block_count) {
+                int used = (ctx->allocated[block / 64] >> (block % 64)) & 1;
+
+                end = spaceRunEnd(ctx->allocated, block, ctx->space.block_count, used);
+                if ((ret = callback(block, end - block, used, arg)) != 0)
+                        return ret < 0 ? ret : APFS_OK;
+                block = end;
+        }
+
+        return APFS_OK;
+}
+
+/*
+   Input Parameters: apfs_ctx*, uint64_t, uint64_t
+   Return Type:      int
+Description: Returns 1 when any of the count blocks from first is in use, 0
+when they are all free and a negative code when the space manager cannot be
+read. Blocks past the end of the main device count as used, so callers that
+skip free space never skip something the bitmaps do not describe.
+
+ */
+int apfs_range_used(apfs_ctx *ctx, uint64_t first, uint64_t count)
+{
+        uint64_t end;
+        int ret;
+
+        if ((ret = spaceLoad(ctx)) < 0)
+                return ret;
+
+        if (count == 0)
+                return 0;
+        if (first >= ctx->space.block_count || count > ctx->space.block_count - first)
+                return 1;
+
+        end = first + count;
+        return spaceRunEnd(ctx->allocated, first, end, 0) < end;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Volumes                                                                */
+/* ---------------------------------------------------------------------- */
+
+// Reads the superblock of volume index, and the block it is in when paddr is not NULL
+static int readVolumeSuperBlock(apfs_ctx *ctx, uint32_t index, apfs_superblock_t *sb, uint64_t *paddr)
+{
+        uint64_t where;
+        uint8_t *block;
+        int ret;
+
+        if (index >= ctx->volumeCount)
+                return APFS_ENOENT;
+
+        if ((ret = omapLookup(ctx, &ctx->omap, ctx->volumes[index], ctx->xid, &where)) < 0)
+                return ret;
+        if (paddr != NULL)
+                *paddr = where;
+
+        if ((block = (uint8_t*)malloc(ctx->blockSize)) == NULL)
+                return APFS_ENOMEM;
+
+        if ((ret = readObject(ctx, where, block, eApFS_ObjectType_0D_FileSystem)) == 0) {
+                memcpy(sb, block, sizeof(*sb));
+                if (sb->apfs_magic != APFS_MAGIC)
+                        ret = APFS_EFORMAT;
+        }
+
+        free(block);
+        return ret;
+}
+
+int apfs_volume_info_get(apfs_ctx *ctx, uint32_t index, apfs_volume_info *info)
+{
+        apfs_superblock_t sb;
+        int ret;
+
+        memset(info, 0, sizeof(*info));
+        if ((ret = readVolumeSuperBlock(ctx, index, &sb, &info->superblock)) < 0)
+                return ret;
+
+        info->index = index;
+        info->oid = ctx->volumes[index];
+        snprintf(info->name, sizeof(info->name), "%.*s", APFS_VOLNAME_LEN, (const char*)sb.apfs_volname);
+        info->role = sb.apfs_role;
+        info->num_files = sb.apfs_num_files;
+        info->num_directories = sb.apfs_num_directories;
+        info->num_symlinks = sb.apfs_num_symlinks;
+        info->num_snapshots = sb.apfs_num_snapshots;
+        memcpy(info->uuid, sb.apfs_vol_uuid, sizeof(info->uuid));
+        info->case_insensitive = (sb.apfs_incompatible_features & APFS_INCOMPAT_CASE_INSENSITIVE) != 0;
+
+        return APFS_OK;
+}
+
+/*
+ * File system tree keys sort by object identifier, then record type, then a
+ * type specific part: the name hash and name of directory entries, the
+ * logical offset of file extents, the name of extended attributes and
+ * snapshot names, and the sibling identifier of sibling links. A search key
+ * made of the header alone sorts before every record of its object and type.
+ * Volumes that do not hash names sort directory entries by name alone.
+ */
+static int fsCompareKeys(const uint8_t *a, uint16_t aLen, const uint8_t *b, uint16_t bLen, int hashedNames)
+{
+        uint64_t first, second;
+
+        if (aLen < sizeof(j_key_t) || bLen < sizeof(j_key_t))
+                return (aLen > bLen) - (aLen < bLen);
+
+        memcpy(&first, a, sizeof(first));
+        memcpy(&second, b, sizeof(second));
+
+        if ((first & OBJ_ID_MASK) != (second & OBJ_ID_MASK))
+                return (first & OBJ_ID_MASK) < (second & OBJ_ID_MASK) ? -1 : 1;
+        if ((first >> OBJ_TYPE_SHIFT) != (second >> OBJ_TYPE_SHIFT))
+                return (first >> OBJ_TYPE_SHIFT) < (second >> OBJ_TYPE_SHIFT) ? -1 : 1;
+
+        if (aLen == sizeof(j_key_t) || bLen == sizeof(j_key_t))
+                return (aLen > bLen) - (aLen < bLen);
+
+        switch (first >> OBJ_TYPE_SHIFT) {
+                case APFS_TYPE_DIR_REC: {
+                        uint32_t firstHash, secondHash;
+                        int cmp;
+
+                        if (!hashedNames) {
+                                if (aLen < sizeof(j_drec_key_t) || bLen < sizeof(j_drec_key_t))
+                                        return (aLen > bLen) - (aLen < bLen);
+
+                                aLen -= sizeof(j_drec_key_t);
+                                bLen -= sizeof(j_drec_key_t);
+                                cmp = memcmp(a + sizeof(j_drec_key_t), b + sizeof(j_drec_key_t), aLen < bLen ? aLen : bLen);
+                                return cmp != 0 ? cmp : (aLen > bLen) - (aLen < bLen);
+                        }
+
+                        if (aLen < sizeof(j_drec_hashed_key_t) || bLen < sizeof(j_drec_hashed_key_t))
+                                return (aLen > bLen) - (aLen < bLen);
+
+                        memcpy(&firstHash, a + sizeof(j_key_t), sizeof(firstHash));
+                        memcpy(&secondHash, b + sizeof(j_key_t), sizeof(secondHash));
+                        firstHash >>= J_DREC_HASH_SHIFT;
+                        secondHash >>= J_DREC_HASH_SHIFT;
+                        if (firstHash != secondHash)
+                                return firstHash < secondHash ? -1 : 1;
+
+                        aLen -= sizeof(j_drec_hashed_key_t);
+                        bLen -= sizeof(j_drec_hashed_key_t);
+                        cmp = memcmp(a + sizeof(j_drec_hashed_key_t), b + sizeof(j_drec_hashed_key_t), aLen < bLen ? aLen : bLen);
+                        return cmp != 0 ? cmp : (aLen > bLen) - (aLen < bLen);
+                }
+                case APFS_TYPE_XATTR:
+                case APFS_TYPE_SNAP_NAME: {
+                        int cmp;
+
+                        aLen -= sizeof(j_xattr_key_t);
+                        bLen -= sizeof(j_xattr_key_t);
+                        cmp = memcmp(a + sizeof(j_xattr_key_t), b + sizeof(j_xattr_key_t), aLen < bLen ? aLen : bLen);
+                        return cmp != 0 ? cmp : (aLen > bLen) - (aLen < bLen);
+                }
+                case APFS_TYPE_FILE_EXTENT:
+                case APFS_TYPE_SIBLING_LINK: {
+                        if (aLen < sizeof(j_key_t) + sizeof(uint64_t) || bLen < sizeof(j_key_t) + sizeof(uint64_t))
+                                return (aLen > bLen) - (aLen < bLen);
+
+                        memcpy(&first, a + sizeof(j_key_t), sizeof(first));
+                        memcpy(&second, b + sizeof(j_key_t), sizeof(second));
+                        return first == second ? 0 : first < second ? -1 : 1;
+                }
+                default:
+                        return 0;
+        }
+}
+
+static int fsCompare(const uint8_t *a, uint16_t aLen, const uint8_t *b, uint16_t bLen)
+{
+        return fsCompareKeys(a, aLen, b, bLen, 1);
+}
+
+static int fsCompareUnhashed(const uint8_t *a, uint16_t aLen, const uint8_t *b, uint16_t bLen)
+{
+        return fsCompareKeys(a, aLen, b, bLen, 0);
+}
+
+// Whether a volume keys its directory entries by name hash
+static int hashedNames(const apfs_superblock_t *sb)
+{
+        return (sb->apfs_incompatible_features &
+                (APFS_INCOMPAT_CASE_INSENSITIVE | APFS_INCOMPAT_NORMALIZATION_INSENSITIVE)) != 0;
+}
+
+int apfs_volume_open(apfs_ctx *ctx, uint32_t index, apfs_volume **out)
+{
+        apfs_volume *volume;
+        int ret;
+
+        *out = NULL;
+
+        if ((volume = (apfs_volume*)calloc(1, sizeof(apfs_volume))) == NULL)
+                return APFS_ENOMEM;
+
+        volume->ctx = ctx;
+
+        if ((ret = readVolumeSuperBlock(ctx, index, &volume->sb, NULL)) < 0 ||
+            (ret = omapOpen(ctx, &volume->omap, volume->sb.apfs_omap_oid, ctx->xid)) < 0 ||
+            (ret = btreeOpen(ctx, &volume->fs, volume->sb.apfs_root_tree_oid,
+                             (volume->sb.apfs_root_tree_type & OBJ_PHYSICAL) ? NULL : &volume->omap,
+                             ctx->xid, hashedNames(&volume->sb) ? fsCompare : fsCompareUnhashed)) < 0) {
+                free(volume);
+                return ret;
+        }
+
+        volume->caseInsensitive = (volume->sb.apfs_incompatible_features & APFS_INCOMPAT_CASE_INSENSITIVE) != 0;
+        volume->hashedNames = hashedNames(&volume->sb);
+        *out = volume;
+
+        return APFS_OK;
+}
+
+void apfs_volume_close(apfs_volume *volume)
+{
+        free(volume);
+}
+
+/* ---------------------------------------------------------------------- */
+/* File system tree                                                       */
+/* ---------------------------------------------------------------------- */
+
+static void fsKey(uint8_t *key, uint64_t oid, uint64_t type)
+{
+        uint64_t header = (oid & OBJ_ID_MASK) | (type << OBJ_TYPE_SHIFT);
+
+        memcpy(key, &header, sizeof(header));
+}
+
+// Fills st from the fixed part of an inode and its decoded extended fields
+static void inodeFields(uint64_t ino, const j_inode_val_t *inode, const xf_inode *xf, apfs_stat_t *st)
+{
+        memset(st, 0, sizeof(*st));
+        st->ino = ino;
+        st->parent_ino = inode->parent_id;
+        st->private_id = inode->private_id;
+        st->mode = inode->mode;
+        st->uid = inode->owner;
+        st->gid = inode->group;
+        st->bsd_flags = inode->bsd_flags;
+        st->internal_flags = inode->internal_flags;
+        st->create_time = inode->create_time;
+        st->mod_time = inode->mod_time;
+        st->change_time = inode->change_time;
+        st->access_time = inode->access_time;
+        if (S_ISDIR(inode->mode))
+                st->nchildren = inode->nchildren;
+        else
+                st->nlink = inode->nlink;
+
+        if (XF_HAS(xf, INO_EXT_TYPE_DSTREAM)) {
+                st->size = xf->dstream.size;
+                st->alloced_size = xf->dstream.alloced_size;
+        }
+        st->sparse_bytes = xf->sparseBytes;
+        st->rdev = xf->rdev;
+        st->document_id = xf->documentId;
+}
+
+// Fills st from an inode record's value
+static int inodeDecode(uint64_t ino, const uint8_t *val, uint16_t valLen, apfs_stat_t *st)
+{
+        j_inode_val_t inode;
+        xf_inode xf;
+
+        if (xfInodeDecode(val, valLen, &xf) < 0)
+                return APFS_EFORMAT;
+
+        memcpy(&inode, val, sizeof(inode));
+        inodeFields(ino, &inode, &xf, st);
+        return APFS_OK;
+}
+
+int apfs_stat(apfs_volume *volume, uint64_t ino, apfs_stat_t *st)
+{
+        uint8_t key[sizeof(j_key_t)], val[APFS_MAX_BLOCK_SIZE / 16];
+        uint16_t valLen = sizeof(val);
+        int ret;
+
+        fsKey(key, ino, APFS_TYPE_INODE);
+        if ((ret = btreeFind(volume->ctx, &volume->fs, key, sizeof(key), val, &valLen)) < 0)
+                return ret;
+
+        return inodeDecode(ino, val, valLen, st);
+}
+
+typedef struct {
+        uint64_t ino;
+        int hashedNames;
+        apfs_readdir_cb callback;
+        void *arg;
+} apfs_readdir_scan;
+
+static int readdirCallback(const uint8_t *key, uint16_t keyLen, const uint8_t *val, uint16_t valLen, void *arg)
+{
+        apfs_readdir_scan *scan = (apfs_readdir_scan*)arg;
+        const uint8_t *drecName;
+        j_drec_val_t entry;
+        char name[APFS_NAME_LEN];
+        apfs_dirent dirent;
+        uint32_t nameLen;
+        uint64_t header;
+
+        memcpy(&header, key, sizeof(header));
+        if ((header & OBJ_ID_MASK) != scan->ino || (header >> OBJ_TYPE_SHIFT) != APFS_TYPE_DIR_REC)
+                return 1;
+
+        if ((drecName = fsDrecName(key, keyLen, scan->hashedNames, &nameLen)) == NULL || valLen < sizeof(entry))
+                return APFS_EFORMAT;
+
+        if (nameLen > sizeof(name) - 1)
+                nameLen = sizeof(name) - 1;
+        memcpy(name, drecName, nameLen);
+        name[nameLen] = '\0';
+
+        memcpy(&entry, val, sizeof(entry));
+        dirent.ino = entry.file_id;
+        dirent.date_added = entry.date_added;
+        dirent.type = entry.flags & DREC_TYPE_MASK;
+        dirent.name = name;
+
+        return scan->callback(&dirent, scan->arg) ? 1 : 0;
+}
+
+int apfs_readdir(apfs_volume *volume, uint64_t ino, apfs_readdir_cb callback, void *arg)
+{
+        apfs_readdir_scan scan = { ino, volume->hashedNames, callback, arg };
+        uint8_t key[sizeof(j_key_t)];
+        apfs_stat_t st;
+        int ret;
+
+        if ((ret = apfs_stat(volume, ino, &st)) < 0)
+                return ret;
+        if (!S_ISDIR(st.mode))
+                return APFS_ENOTDIR;
+
+        fsKey(key, ino, APFS_TYPE_DIR_REC);
+        return btreeScan(volume->ctx, &volume->fs, key, sizeof(key), readdirCallback, &scan);
+}
+
+/*
+ * Hash of a directory entry name as stored in j_drec_hashed_key_t: the raw
+ * CRC-32C register, seeded with ~0, over the normalized name's code points
+ * as 32-bit little-endian words, cut to 22 bits. Case-insensitive volumes
+ * fold the name before decomposing it.
+ */
+static uint32_t nameHash(const char *name, size_t len, int caseInsensitive)
+{
+        uint32_t words[APFS_NAME_LEN * UNICODE_EXPANSION];
+        size_t count = unicodeNormalize(name, len, caseInsensitive, words, sizeof(words) / sizeof(words[0]));
+
+        if (count > sizeof(words) / sizeof(words[0]))
+                count = sizeof(words) / sizeof(words[0]);
+        for (size_t i = 0; i < count; ++i)
+                words[i] = htole32(words[i]);
+
+        return crc32cUpdate(0xffffffff, words, count * sizeof(words[0])) & DREC_HASH_BITS;
+}
+
+typedef struct {
+        const char *name;
+        int caseInsensitive;
+        uint64_t ino;
+        int found;
+} apfs_lookup_scan;
+
+static int lookupCallback(const apfs_dirent *entry, void *arg)
+{
+        apfs_lookup_scan *scan = (apfs_lookup_scan*)arg;
+
+        if ((scan->caseInsensitive ? strcasecmp(entry->name, scan->name) : strcmp(entry->name, scan->name)) != 0)
+                return 0;
+
+        scan->ino = entry->ino;
+        scan->found = 1;
+        return 1;
+}
+
+typedef struct {
+        uint64_t parent;
+        uint32_t hash;
+        const char *name;
+        size_t nameLen;
+        int caseInsensitive;
+        uint64_t ino;
+        int found;
+} apfs_hash_lookup;
+
+// Visits the entries of the parent with the name's hash, a handful at most, until the name matches
+static int hashLookupCallback(const uint8_t *key, uint16_t keyLen, const uint8_t *val, uint16_t valLen, void *arg)
+{
+        apfs_hash_lookup *lookup = (apfs_hash_lookup*)arg;
+        const j_drec_hashed_key_t *drec = (const j_drec_hashed_key_t*)key;
+        j_drec_val_t entry;
+        uint32_t nameLen;
+        uint64_t header;
+
+        memcpy(&header, key, sizeof(header));
+        if ((header & OBJ_ID_MASK) != lookup->parent || (header >> OBJ_TYPE_SHIFT) != APFS_TYPE_DIR_REC ||
+            keyLen < sizeof(j_drec_hashed_key_t) ||
+            (drec->name_len_and_hash >> J_DREC_HASH_SHIFT) != lookup->hash)
+                return 1;
+
+        if (valLen < sizeof(entry))
+                return APFS_EFORMAT;
+
+        fsDrecName(key, keyLen, 1, &nameLen);
+        if (!unicodeNameEqual((const char*)drec->name, nameLen, lookup->name, lookup->nameLen, lookup->caseInsensitive))
+                return 0;
+
+        memcpy(&entry, val, sizeof(entry));
+        lookup->ino = entry.file_id;
+        lookup->found = 1;
+        return 1;
+}
+
+/*
+   Input Parameters: apfs_volume*, uint64_t parent, char* name, uint64_t*
+   Return Type:      int
+Description: Finds the entry name of directory parent. With hashed keys this
+is one descent to the first record of (parent, DIR_REC, hash) and a look at
+the records sharing that hash, whatever the size of the directory; volumes
+without them have their entries scanned.
+
+ */
+int apfs_lookup(apfs_volume *volume, uint64_t parent, const char *name, uint64_t *ino)
+{
+        apfs_lookup_scan scan = { name, volume->caseInsensitive, 0, 0 };
+        int ret;
+
+        if (volume->hashedNames) {
+                apfs_hash_lookup lookup = { parent, 0, name, strlen(name), volume->caseInsensitive, 0, 0 };
+                uint8_t key[sizeof(j_drec_hashed_key_t)];
+                uint32_t lengthAndHash;
+                apfs_stat_t st;
+
+                lookup.hash = nameHash(name, lookup.nameLen, volume->caseInsensitive);
+                lengthAndHash = lookup.hash << J_DREC_HASH_SHIFT;       // An empty name sorts first
+                fsKey(key, parent, APFS_TYPE_DIR_REC);
+                memcpy(key + sizeof(j_key_t), &lengthAndHash, sizeof(lengthAndHash));
+
+                if ((ret = btreeScan(volume->ctx, &volume->fs, key, sizeof(key), hashLookupCallback, &lookup)) < 0)
+                        return ret;
+                if (lookup.found) {
+                        *ino = lookup.ino;
+                        return APFS_OK;
+                }
+
+                // Tell a missing entry from a parent that is not a directory
+                if ((ret = apfs_stat(volume, parent, &st)) < 0)
+                        return ret;
+                return S_ISDIR(st.mode) ? APFS_ENOENT : APFS_ENOTDIR;
+        }
+
+        if ((ret = apfs_readdir(volume, parent, lookupCallback, &scan)) < 0)
+                return ret;
+        if (!scan.found)
+                return APFS_ENOENT;
+
+        *ino = scan.ino;
+        return APFS_OK;
+}
+
+// Resolves an absolute or root relative path, component by component
+int apfs_lookup_path(apfs_volume *volume, const char *path, uint64_t *ino)
+{
+        char name[APFS_NAME_LEN];
+        uint64_t current = APFS_ROOT_INO;
+        int ret;
+
+        while (*path) {
+                size_t len = strcspn(path, "/");
+
+                if (len >= sizeof(name))
+                        return APFS_ENOENT;
+
+                memcpy(name, path, len);
+                name[len] = '\0';
+                path += len + (path[len] == '/');
+
+                if (len == 0 || strcmp(name, ".") == 0)
+                        continue;
+
+                if (strcmp(name, "..") == 0) {
+                        apfs_stat_t st;
+
+                        if ((ret = apfs_stat(volume, current, &st)) < 0)
+                                return ret;
+                        if (current != APFS_ROOT_INO)
+                                current = st.parent_ino;
+                        continue;
+                }
+
+                if ((ret = apfs_lookup(volume, current, name, &current)) < 0)
+                        return ret;
+        }
+
+        *ino = current;
+        return APFS_OK;
+}
+
+typedef struct {
+        apfs_file *file;
+        uint64_t stream;
+} apfs_extent_scan;
+
+// Appends one file extent record of the data stream to the file's extent map
+static int extentCallback(const uint8_t *key, uint16_t keyLen, const uint8_t *val, uint16_t valLen, void *arg)
+{
+        apfs_extent_scan *scan = (apfs_extent_scan*)arg;
+        apfs_file *file = scan->file;
+        j_file_extent_val_t extent;
+        apfs_extent *entry;
+        uint64_t header;
+
+        memcpy(&header, key, sizeof(header));
+        if ((header & OBJ_ID_MASK) != scan->stream || (header >> OBJ_TYPE_SHIFT) != APFS_TYPE_FILE_EXTENT)
+                return 1;
+
+        if (keyLen < sizeof(j_key_t) + sizeof(uint64_t) || valLen < sizeof(extent))
+                return APFS_EFORMAT;
+
+        if (file->count == file->capacity) {
+                uint32_t capacity = file->capacity ? file->capacity * 2 : 16;
+                apfs_extent *grown = (apfs_extent*)realloc(file->extents, capacity * sizeof(apfs_extent));
+
+                if (grown == NULL)
+                        return APFS_ENOMEM;
+                file->extents = grown;
+                file->capacity = capacity;
+        }
+
+        memcpy(&extent, val, sizeof(extent));
+        entry = &file->extents[file->count++];
+        memcpy(&entry->logical, key + sizeof(j_key_t), sizeof(entry->logical));
+        entry->length = extent.len_and_flags & J_FILE_EXTENT_LEN_MASK;
+        entry->paddr = extent.phys_block_num;
+
+        return 0;
+}
+
+// A reader over the data stream stream, sized and typed by st; the extent map is loaded here
+static int streamOpen(apfs_volume *volume, uint64_t stream, const apfs_stat_t *st, apfs_file **out)
+{
+        apfs_extent_scan scan;
+        uint8_t key[sizeof(j_key_t)];
+        apfs_file *file;
+        int ret;
+
+        *out = NULL;
+
+        if ((file = (apfs_file*)calloc(1, sizeof(apfs_file))) == NULL)
+                return APFS_ENOMEM;
+
+        file->volume = volume;
+        file->st = *st;
+        file->window = APFS_READAHEAD_MIN;
+        if ((file->scratch = (uint8_t*)malloc((uint64_t)APFS_READAHEAD_MAX * volume->ctx->blockSize)) == NULL) {
+                free(file);
+                return APFS_ENOMEM;
+        }
+
+        scan.file = file;
+        scan.stream = stream;
+        fsKey(key, stream, APFS_TYPE_FILE_EXTENT);
+        if ((ret = btreeScan(volume->ctx, &volume->fs, key, sizeof(key), extentCallback, &scan)) < 0)
+                apfs_file_close(file);
+        else
+                *out = file;
+
+        return ret;
+}
+
+/*
+   Input Parameters: apfs_volume*, uint64_t, apfs_file**
+   Return Type:      int
+Description: Opens a file for apfs_pread. Its inode and extent map are loaded
+once here; the extent records come out of the FS tree in key order, so the
+map is already sorted by logical offset.
+
+ */
+int apfs_file_open(apfs_volume *volume, uint64_t ino, apfs_file **out)
+{
+        apfs_stat_t st;
+        int ret;
+
+        *out = NULL;
+
+        if ((ret = apfs_stat(volume, ino, &st)) < 0)
+                return ret;
+        if (S_ISDIR(st.mode))
+                return APFS_EISDIR;
+
+        return streamOpen(volume, st.private_id, &st, out);
+}
+
+void apfs_file_close(apfs_file *file)
+{
+        if (file == NULL)
+                return;
+
+        free(file->extents);
+        free(file->scratch);
+        free(file);
+}
+
+int apfs_file_stat(apfs_file *file, apfs_stat_t *st)
+{
+        *st = file->st;
+        return APFS_OK;
+}
+
+// Index of the first extent that ends past offset, count when there is none
+static uint32_t findExtent(const apfs_file *file, uint64_t offset)
+{
+        uint32_t low = 0, high = file->count;
+
+        while (low < high) {
+                uint32_t mid = low + (high - low) / 2;
+
+                if (file->extents[mid].logical + file->extents[mid].length <= offset)
+                        low = mid + 1;
+                else
+                        high = mid;
+        }
+
+        return low;
+}
+
+// Copies [start, end) of the extent, which lies inside it, block by block from the data cache
+static int copyExtent(apfs_ctx *ctx, const apfs_extent *extent, uint64_t start, uint64_t end, uint8_t *out)
+{
+        uint64_t pos = start - extent->logical;
+        int ret;
+
+        while (start < end) {
+                uint64_t within = pos % ctx->blockSize;
+                uint64_t n = ctx->blockSize - within;
+                const uint8_t *block;
+
+                n = n < end - start ? n : end - start;
+                if ((block = cacheBlock(ctx, &ctx->data, extent->paddr + pos / ctx->blockSize, &ret)) == NULL)
+                        return ret;
+
+                memcpy(out, block + within, n);
+                out += n;
+                start += n;
+                pos += n;
+        }
+
+        return APFS_OK;
+}
+
+// Loads the blocks behind [start, end) of the file into the data cache
+static int readAhead(apfs_file *file, uint64_t start, uint64_t end)
+{
+        apfs_ctx *ctx = file->volume->ctx;
+        int ret = APFS_OK;
+
+        for (uint32_t i = findExtent(file, start); i < file->count && file->extents[i].logical < end && ret == 0; ++i) {
+                const apfs_extent *extent = &file->extents[i];
+                uint64_t from = start > extent->logical ? start - extent->logical : 0;
+                uint64_t to = end - extent->logical < extent->length ? end - extent->logical : extent->length;
+
+                if (extent->paddr == 0 || from >= to)
+                        continue;
+
+                from /= ctx->blockSize;
+                to = (to + ctx->blockSize - 1) / ctx->blockSize;
+                ret = cachePrefetch(ctx, &ctx->data, extent->paddr + from, to - from, file->scratch);
+        }
+
+        return ret;
+}
+
+/*
+   Input Parameters: apfs_file*, void*, uint64_t, uint64_t
+   Return Type:      int64_t
+Description: Reads up to len bytes of the file from offset. The extents are
+found with a binary search of the extent map and the data is served through
+the context's data cache. A read that starts where the previous one ended
+counts as sequential: the blocks after it are read ahead, in a window that
+doubles up to APFS_READAHEAD_MAX blocks. Any other read resets the window.
+Holes read as zeros. Returns the number of bytes read, 0 at the end of file.
+
+ */
+int64_t apfs_pread(apfs_file *file, void *buf, uint64_t len, uint64_t offset)
+{
+        apfs_ctx *ctx = file->volume->ctx;
+        uint8_t *out = (uint8_t*)buf;
+        uint64_t end;
+        int ret;
+
+        if (offset >= file->st.size)
+                return 0;
+        if (len > file->st.size - offset)
+                len = file->st.size - offset;
+        end = offset + len;
+
+        if (offset == file->nextOffset && offset != 0) {
+                uint64_t ahead = end + (uint64_t)file->window * ctx->blockSize;
+
+                if (ahead > file->readaheadEnd) {
+                        if ((ret = readAhead(file, end > file->readaheadEnd ? offset : file->readaheadEnd, ahead)) < 0)
+                                return ret;
+                        file->readaheadEnd = ahead;
+                        if (file->window < APFS_READAHEAD_MAX)
+                                file->window *= 2;
+                }
+        } else {
+                file->window = APFS_READAHEAD_MIN;
+                file->readaheadEnd = 0;
+        }
+
+        memset(out, 0, len);
+
+        for (uint32_t i = findExtent(file, offset); i < file->count && file->extents[i].logical < end; ++i) {
+                const apfs_extent *extent = &file->extents[i];
+                uint64_t start = extent->logical > offset ? extent->logical : offset;
+                uint64_t stop = extent->logical + extent->length < end ? extent->logical + extent->length : end;
+
+                // Block 0 marks a sparse extent, which stays zeroed
+                if (extent->paddr != 0 && (ret = copyExtent(ctx, extent, start, stop, out + (start - offset))) < 0)
+                        return ret;
+        }
+
+        file->nextOffset = end;
+        return len;
+}
+
+// One-off read of a file, see apfs_pread
+int64_t apfs_read(apfs_volume *volume, uint64_t ino, void *buf, uint64_t len, uint64_t offset)
+{
+        apfs_file *file;
+        int64_t ret;
+
+        if ((ret = apfs_file_open(volume, ino, &file)) < 0)
+                return ret;
+
+        ret = apfs_pread(file, buf, len, offset);
+        apfs_file_close(file);
+
+        return ret;
+}
+
+typedef struct {
+        uint64_t ino;
+        apfs_xattr_cb callback;
+        void *arg;
+} apfs_xattr_scan;
+
+// Fills xattr from an extended attribute record, whose name is copied to name
+static int xattrDecode(const uint8_t *key, uint16_t keyLen, const uint8_t *val, uint16_t valLen,
+                       char *name, apfs_xattr *xattr)
+{
+        const j_xattr_key_t *xkey = (const j_xattr_key_t*)key;
+        const j_xattr_val_t *xval = (const j_xattr_val_t*)val;
+        uint16_t nameLen, dataLen;
+
+        if (keyLen < sizeof(j_xattr_key_t) || valLen < sizeof(j_xattr_val_t))
+                return APFS_EFORMAT;
+
+        nameLen = xkey->name_len;
+        if (nameLen > keyLen - sizeof(j_xattr_key_t))
+                nameLen = keyLen - sizeof(j_xattr_key_t);
+        memcpy(name, xkey->name, nameLen);
+        name[nameLen ? nameLen - 1 : 0] = '\0';
+
+        dataLen = xval->xdata_len;
+        if (dataLen > valLen - sizeof(j_xattr_val_t))
+                dataLen = valLen - sizeof(j_xattr_val_t);
+
+        memset(xattr, 0, sizeof(*xattr));
+        xattr->name = name;
+        xattr->flags = xval->flags;
+        if (xval->flags & XATTR_DATA_STREAM) {
+                j_xattr_dstream_t stream;
+
+                if (dataLen < sizeof(stream))
+                        return APFS_EFORMAT;
+                memcpy(&stream, xval->xdata, sizeof(stream));
+                xattr->stream = stream.xattr_obj_id;
+                xattr->size = stream.dstream.size;
+        } else {
+                xattr->data = xval->xdata;
+                xattr->size = dataLen;
+        }
+
+        return APFS_OK;
+}
+
+static int xattrCallback(const uint8_t *key, uint16_t keyLen, const uint8_t *val, uint16_t valLen, void *arg)
+{
+        apfs_xattr_scan *scan = (apfs_xattr_scan*)arg;
+        char name[APFS_NAME_LEN];
+        apfs_xattr xattr;
+        uint64_t header;
+        int ret;
+
+        memcpy(&header, key, sizeof(header));
+        if ((header & OBJ_ID_MASK) != scan->ino || (header >> OBJ_TYPE_SHIFT) != APFS_TYPE_XATTR)
+                return 1;
+
+        if ((ret = xattrDecode(key, keyLen, val, valLen, name, &xattr)) < 0)
+                return ret;
+
+        return scan->callback(&xattr, scan->arg) ? 1 : 0;
+}
+
+// Lists the extended attributes of an inode in name order
+int apfs_listxattr(apfs_volume *volume, uint64_t ino, apfs_xattr_cb callback, void *arg)
+{
+        apfs_xattr_scan scan = { ino, callback, arg };
+        uint8_t key[sizeof(j_key_t)];
+
+        fsKey(key, ino, APFS_TYPE_XATTR);
+        return btreeScan(volume->ctx, &volume->fs, key, sizeof(key), xattrCallback, &scan);
+}
+
+// Looks up the record of the extended attribute name of inode ino; its name is copied to found
+static int xattrFind(apfs_volume *volume, uint64_t ino, const char *name, uint8_t *val, char *found, apfs_xattr *xattr)
+{
+        uint8_t key[sizeof(j_xattr_key_t) + APFS_NAME_LEN];
+        size_t nameLen = strlen(name) + 1;
+        uint16_t valLen = APFS_MAX_BLOCK_SIZE / 16;
+        int ret;
+
+        if (nameLen > APFS_NAME_LEN)
+                return APFS_EINVAL;
+
+        fsKey(key, ino, APFS_TYPE_XATTR);
+        memcpy(key + sizeof(j_key_t), &(uint16_t){ nameLen }, sizeof(uint16_t));
+        memcpy(key + sizeof(j_xattr_key_t), name, nameLen);
+
+        if ((ret = btreeFind(volume->ctx, &volume->fs, key, sizeof(j_xattr_key_t) + nameLen, val, &valLen)) < 0)
+                return ret;
+
+        return xattrDecode(key, sizeof(j_xattr_key_t) + nameLen, val, valLen, found, xattr);
+}
+
+// A reader over the data stream holding an extended attribute's value
+static int xattrStreamOpen(apfs_volume *volume, uint64_t ino, const apfs_xattr *xattr, apfs_file **file)
+{
+        apfs_stat_t st;
+
+        memset(&st, 0, sizeof(st));
+        st.ino = ino;
+        st.private_id = xattr->stream;
+        st.mode = S_IFREG;
+        st.size = xattr->size;
+
+        return streamOpen(volume, xattr->stream, &st, file);
+}
+
+/*
+   Input Parameters: apfs_volume*, uint64_t, char* name, void*, uint64_t
+   Return Type:      int64_t
+Description: Copies up to len bytes of the value of the extended attribute
+name and returns its full size, as getxattr(2) does; a NULL buf only
+reports the size. Values too large to embed in the record live in a data
+stream of their own, read like file data with apfs_pread.
+
+ */
+int64_t apfs_getxattr(apfs_volume *volume, uint64_t ino, const char *name, void *buf, uint64_t len)
+{
+        uint8_t val[APFS_MAX_BLOCK_SIZE / 16];
+        char found[APFS_NAME_LEN];
+        apfs_xattr xattr;
+        apfs_file *file;
+        int64_t ret;
+
+        if ((ret = xattrFind(volume, ino, name, val, found, &xattr)) < 0)
+                return ret;
+
+        if (buf == NULL)
+                return xattr.size;
+        if (len > xattr.size)
+                len = xattr.size;
+
+        if (xattr.stream == 0) {
+                memcpy(buf, xattr.data, len);
+                return xattr.size;
+        }
+
+        if ((ret = xattrStreamOpen(volume, ino, &xattr, &file)) < 0)
+                return ret;
+
+        ret = apfs_pread(file, buf, len, 0);
+        apfs_file_close(file);
+
+        return ret < 0 ? ret : (int64_t)xattr.size;
+}
+
+// Opens the value of an extended attribute kept in a data stream for apfs_pread; embedded values are APFS_EINVAL
+int apfs_xattr_open(apfs_volume *volume, uint64_t ino, const char *name, apfs_file **file)
+{
+        uint8_t val[APFS_MAX_BLOCK_SIZE / 16];
+        char found[APFS_NAME_LEN];
+        apfs_xattr xattr;
+        int ret;
+
+        *file = NULL;
+
+        if ((ret = xattrFind(volume, ino, name, val, found, &xattr)) < 0)
+                return ret;
+        if (xattr.stream == 0)
+                return APFS_EINVAL;
+
+        return xattrStreamOpen(volume, ino, &xattr, file);
+}
+
+typedef struct {
+        apfs_volume *volume;
+        apfs_object_cb callback;
+        void *arg;
+        int stopped;
+        int error;                      // Why an extent lookup failed, the accumulator only reports ENOMEM
+        apfs_file stream;               // Extents of a data stream with an identifier of its own, reused
+        apfs_dirent *children;          // The object's records in the public layout, reused from object to object
+        uint32_t childCapacity;
+        apfs_xattr *xattrs;
+        uint32_t xattrCapacity;
+        apfs_link *links;
+        uint32_t linkCapacity;
+} apfs_walk_scan;
+
+// Makes room for count elements of size bytes in *array; 0 or APFS_ENOMEM
+static int walkReserve(void **array, uint32_t *capacity, uint32_t count, size_t size)
+{
+        void *grown;
+
+        if (count <= *capacity)
+                return APFS_OK;
+        if ((grown = realloc(*array, count * size)) == NULL)
+                return APFS_ENOMEM;
+
+        *array = grown;
+        *capacity = count;
+        return APFS_OK;
+}
+
+// Passes an object the accumulator completed on to the caller, if it has an inode
+static int walkObject(const fs_object *obj, void *arg)
+{
+        apfs_walk_scan *scan = (apfs_walk_scan*)arg;
+        apfs_object object;
+
+        if (!obj->hasInode)
+                return 0;
+
+        if (walkReserve((void**)&scan->children, &scan->childCapacity, obj->childCount, sizeof(apfs_dirent)) < 0 ||
+            walkReserve((void**)&scan->xattrs, &scan->xattrCapacity, obj->xattrCount, sizeof(apfs_xattr)) < 0 ||
+            walkReserve((void**)&scan->links, &scan->linkCapacity, obj->siblingCount, sizeof(apfs_link)) < 0)
+                return APFS_ENOMEM;
+
+        for (uint32_t i = 0; i < obj->childCount; ++i) {
+                const fs_child *child = &obj->children[i];
+
+                scan->children[i] = (apfs_dirent){ child->ino, child->dateAdded, child->type, child->name };
+        }
+
+        for (uint32_t i = 0; i < obj->xattrCount; ++i) {
+                const fs_xattr *xattr = &obj->xattrs[i];
+
+                scan->xattrs[i] = (apfs_xattr){ xattr->name, xattr->flags, xattr->stream ? xattr->size : xattr->length,
+                                                xattr->data, xattr->stream };
+        }
+
+        for (uint32_t i = 0; i < obj->siblingCount; ++i)
+                scan->links[i] = (apfs_link){ obj->siblings[i].parent, obj->siblings[i].name };
+
+        inodeFields(obj->oid, &obj->inode, &obj->xf, &object.st);
+        object.name = obj->name;
+        object.extents = (const apfs_object_extent*)obj->extents;    // Laid out like fs_extent
+        object.extent_count = obj->extentCount;
+
+        // The extents of a data stream with its own identifier are recorded under that identifier
+        if (object.st.private_id != obj->oid && !S_ISDIR(object.st.mode)) {
+                apfs_extent_scan extents = { &scan->stream, object.st.private_id };
+                uint8_t key[sizeof(j_key_t)];
+                int ret;
+
+                scan->stream.count = 0;
+                fsKey(key, object.st.private_id, APFS_TYPE_FILE_EXTENT);
+                if ((ret = btreeScan(scan->volume->ctx, &scan->volume->fs, key, sizeof(key), extentCallback, &extents)) < 0) {
+                        scan->error = ret;
+                        return 1;
+                }
+
+                object.extents = (const apfs_object_extent*)scan->stream.extents;  // Laid out like apfs_extent
+                object.extent_count = scan->stream.count;
+        }
+        object.children = scan->children;
+        object.child_count = obj->childCount;
+        object.xattrs = scan->xattrs;
+        object.xattr_count = obj->xattrCount;
+        object.links = scan->links;
+        object.link_count = obj->siblingCount;
+
+        scan->stopped = scan->callback(&object, scan->arg) != 0;
+        return scan->stopped;
+}
+
+static int walkCallback(const uint8_t *key, uint16_t keyLen, const uint8_t *val, uint16_t valLen, void *arg)
+{
+        int ret = fsAccumulate((fs_accumulator*)arg, key, keyLen, val, valLen);
+
+        return ret < 0 ? APFS_ENOMEM : ret;
+}
+
+/*
+   Input Parameters: apfs_volume*, apfs_object_cb, void*
+   Return Type:      int
+Description: Visits every inode of the volume in identifier order with the
+records that follow it in the FS tree: its name and extents, its extended
+attributes, the entries of a directory and the links of a file.
+The tree is read once from the first leaf to the last, so a whole volume
+can be listed, extracted or hashed without a lookup per file. Extents are
+gathered under the inode's own identifier, which is where APFS keeps them
+unless the data stream was given an identifier of its own (private_id);
+the extents of such a file are looked up under that identifier instead.
+
+ */
+int apfs_walk(apfs_volume *volume, apfs_object_cb callback, void *arg)
+{
+        apfs_walk_scan scan;
+        uint8_t key[sizeof(j_key_t)] = { 0 };
+        fs_accumulator acc;
+        int ret;
+
+        memset(&scan, 0, sizeof(scan));
+        scan.volume = volume;
+        scan.callback = callback;
+        scan.arg = arg;
+
+        fsAccumulatorInit(&acc, volume->hashedNames, walkObject, &scan);
+        ret = btreeScan(volume->ctx, &volume->fs, key, sizeof(key), walkCallback, &acc);
+
+        // The last object is only complete once the scan ran out of records
+        if (ret == APFS_OK && !scan.stopped && fsAccumulatorFlush(&acc) < 0)
+                ret = APFS_ENOMEM;
+        fsAccumulatorFree(&acc);
+        free(scan.stream.extents);
+        free(scan.children);
+        free(scan.xattrs);
+        free(scan.links);
+
+        return scan.error ? scan.error : ret;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Snapshots                                                              */
+/* ---------------------------------------------------------------------- */
+
+static int snapshotTreeOpen(apfs_volume *volume, apfs_btree *tree)
+{
+        if (volume->sb.apfs_snap_meta_tree_oid == 0)
+                return APFS_ENOENT;
+
+        return btreeOpen(volume->ctx, tree, volume->sb.apfs_snap_meta_tree_oid,
+                         (volume->sb.apfs_snap_meta_tree_type & OBJ_PHYSICAL) ? NULL : &volume->omap,
+                         volume->fs.xid, fsCompare);
+}
+
+// Decodes a snapshot metadata record; the name is cut to the size of info->name
+static int snapshotInfo(uint64_t xid, const uint8_t *val, uint16_t valLen, apfs_snapshot_info *info)
+{
+        tApFS_10_SnapshotMetaTree_Value_t meta;
+        uint16_t nameLen;
+
+        if (valLen < sizeof(meta))
+                return APFS_EFORMAT;
+
+        memcpy(&meta, val, sizeof(meta));
+        nameLen = meta.NameLength;
+        if (nameLen > valLen - sizeof(meta))
+                nameLen = valLen - sizeof(meta);
+        if (nameLen >= sizeof(info->name))
+                nameLen = sizeof(info->name) - 1;
+
+        memset(info, 0, sizeof(*info));
+        info->xid = xid;
+        memcpy(info->name, val + sizeof(meta), nameLen);
+        info->create_time = meta.CreatedTime;
+        info->change_time = meta.LastModifiedTime;
+        info->superblock = meta.SuperBlockIdent;
+        info->flags = meta.Flags;
+
+        return APFS_OK;
+}
+
+typedef struct {
+        apfs_snapshot_cb callback;
+        void *arg;
+} apfs_snapshot_scan;
+
+static int snapshotCallback(const uint8_t *key, uint16_t keyLen, const uint8_t *val, uint16_t valLen, void *arg)
+{
+        apfs_snapshot_scan *scan = (apfs_snapshot_scan*)arg;
+        apfs_snapshot_info info;
+        uint64_t header;
+        int ret;
+
+        if (keyLen < sizeof(header))
+                return APFS_EFORMAT;
+
+        memcpy(&header, key, sizeof(header));
+        if ((header >> OBJ_TYPE_SHIFT) != APFS_TYPE_SNAP_METADATA)
+                return (header >> OBJ_TYPE_SHIFT) == APFS_TYPE_SNAP_NAME;
+
+        if ((ret = snapshotInfo(header & OBJ_ID_MASK, val, valLen, &info)) < 0)
+                return ret;
+
+        return scan->callback(&info, scan->arg) != 0;
+}
+
+// Calls back once per snapshot of the volume, oldest first
+int apfs_snapshot_list(apfs_volume *volume, apfs_snapshot_cb callback, void *arg)
+{
+        apfs_snapshot_scan scan = { callback, arg };
+        apfs_btree tree;
+        uint8_t key[sizeof(j_key_t)];
+        int ret;
+
+        if ((ret = snapshotTreeOpen(volume, &tree)) < 0)
+                return ret == APFS_ENOENT ? APFS_OK : ret;
+
+        fsKey(key, 0, APFS_TYPE_SNAP_METADATA);
+        return btreeScan(volume->ctx, &tree, key, sizeof(key), snapshotCallback, &scan);
+}
+
+// Finds a snapshot's transaction by its name record
+int apfs_snapshot_find(apfs_volume *volume, const char *name, uint64_t *xid)
+{
+        uint8_t key[sizeof(j_xattr_key_t) + APFS_NAME_LEN];
+        size_t nameLen = strlen(name) + 1;
+        j_snap_name_val_t val;
+        uint16_t valLen = sizeof(val);
+        apfs_btree tree;
+        int ret;
+
+        if (nameLen > APFS_NAME_LEN)
+                return APFS_EINVAL;
+        if ((ret = snapshotTreeOpen(volume, &tree)) < 0)
+                return ret;
+
+        fsKey(key, OBJ_ID_MASK, APFS_TYPE_SNAP_NAME);
+        memcpy(key + sizeof(j_key_t), &(uint16_t){ nameLen }, sizeof(uint16_t));
+        memcpy(key + sizeof(j_xattr_key_t), name, nameLen);
+
+        if ((ret = btreeFind(volume->ctx, &tree, key, sizeof(j_xattr_key_t) + nameLen, &val, &valLen)) < 0)
+                return ret;
+        if (valLen < sizeof(val))
+                return APFS_EFORMAT;
+
+        *xid = val.snap_xid;
+        return APFS_OK;
+}
+
+static int xidCompare(const uint8_t *a, uint16_t aLen, const uint8_t *b, uint16_t bLen)
+{
+        uint64_t first, second;
+
+        if (aLen < sizeof(first) || bLen < sizeof(second))
+                return (aLen > bLen) - (aLen < bLen);
+
+        memcpy(&first, a, sizeof(first));
+        memcpy(&second, b, sizeof(second));
+        return first == second ? 0 : first < second ? -1 : 1;
+}
+
+// The omap keeps the mappings of a snapshot as long as its snapshot tree lists it, not deleted
+static int omapHasSnapshot(apfs_volume *volume, uint64_t xid)
+{
+        apfs_ctx *ctx = volume->ctx;
+        tApFS_13_ObjectsMapSnapshot_Value_t snap;
+        uint16_t snapLen = sizeof(snap);
+        apfs_btree tree;
+        omap_phys_t omap;
+        uint8_t *block;
+        int ret;
+
+        if ((block = (uint8_t*)malloc(ctx->blockSize)) == NULL)
+                return APFS_ENOMEM;
+
+        ret = readObject(ctx, volume->sb.apfs_omap_oid, block, eApFS_ObjectType_0B_ObjectsMap);
+        memcpy(&omap, block, sizeof(omap));
+        free(block);
+
+        if (ret < 0)
+                return ret;
+        if (omap.om_snapshot_tree_oid == 0)
+                return APFS_ENOENT;
+
+        if ((ret = btreeOpen(ctx, &tree, omap.om_snapshot_tree_oid, NULL, volume->fs.xid, xidCompare)) < 0 ||
+            (ret = btreeFind(ctx, &tree, &xid, sizeof(xid), &snap, &snapLen)) < 0)
+                return ret;
+
+        return snapLen >= sizeof(snap.Flags) && (snap.Flags & OMAP_SNAPSHOT_DELETED) ? APFS_ENOENT : APFS_OK;
+}
+
+/*
+   Input Parameters: apfs_volume*, uint64_t, apfs_volume**
+   Return Type:      int
+Description: Opens the volume as it was when the snapshot taken by transaction
+xid was made: the snapshot's own volume superblock gives the root of its FS
+tree, and the nodes are resolved through the live volume's omap, keeping for
+each node the newest mapping not past xid. The snapshot is read through the
+same context, so the nodes it shares with the live tree or other snapshots
+come from the same block cache. Close it with apfs_volume_close.
+
+ */
+int apfs_snapshot_open(apfs_volume *volume, uint64_t xid, apfs_volume **out)
+{
+        apfs_ctx *ctx = volume->ctx;
+        uint8_t key[sizeof(j_key_t)];
+        uint8_t val[sizeof(tApFS_10_SnapshotMetaTree_Value_t) + APFS_NAME_LEN];
+        uint16_t valLen = sizeof(val);
+        apfs_snapshot_info info;
+        apfs_volume *snapshot;
+        apfs_btree tree;
+        uint8_t *block;
+        int ret;
+
+        *out = NULL;
+
+        fsKey(key, xid, APFS_TYPE_SNAP_METADATA);
+        if ((ret = snapshotTreeOpen(volume, &tree)) < 0 ||
+            (ret = btreeFind(ctx, &tree, key, sizeof(key), val, &valLen)) < 0 ||
+            (ret = snapshotInfo(xid, val, valLen, &info)) < 0 ||
+            (ret = omapHasSnapshot(volume, xid)) < 0)
+                return ret;
+
+        if ((snapshot = (apfs_volume*)calloc(1, sizeof(apfs_volume))) == NULL)
+                return APFS_ENOMEM;
+        if ((block = (uint8_t*)malloc(ctx->blockSize)) == NULL) {
+                free(snapshot);
+                return APFS_ENOMEM;
+        }
+
+        if ((ret = readObject(ctx, info.superblock, block, eApFS_ObjectType_0D_FileSystem)) == 0) {
+                memcpy(&snapshot->sb, block, sizeof(snapshot->sb));
+                if (snapshot->sb.apfs_magic != APFS_MAGIC)
+                        ret = APFS_EFORMAT;
+        }
+        free(block);
+
+        snapshot->ctx = ctx;
+        snapshot->snapshot = xid;
+        snapshot->omap = volume->omap;
+        snapshot->omap.xid = xid;
+
+        if (ret < 0 || (ret = btreeOpen(ctx, &snapshot->fs, snapshot->sb.apfs_root_tree_oid,
+                                        (snapshot->sb.apfs_root_tree_type & OBJ_PHYSICAL) ? NULL : &snapshot->omap,
+                                        xid, hashedNames(&snapshot->sb) ? fsCompare : fsCompareUnhashed)) < 0) {
+                free(snapshot);
+                return ret;
+        }
+
+        snapshot->caseInsensitive = (snapshot->sb.apfs_incompatible_features & APFS_INCOMPAT_CASE_INSENSITIVE) != 0;
+        snapshot->hashedNames = hashedNames(&snapshot->sb);
+        *out = snapshot;
+
+        return APFS_OK;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Differences between two file system trees                              */
+/* ---------------------------------------------------------------------- */
+
+/* One level of a diff cursor: a private copy of the node and the entry it is at */
+typedef struct {
+        uint8_t *block;
+        apfs_node node;
+        uint32_t index;
+} apfs_diff_level;
+
+/* Walks one FS tree in key order, descending only when asked to */
+typedef struct {
+        apfs_volume *volume;
+        apfs_diff_level levels[APFS_MAX_DEPTH];
+        int depth;                      // Levels in use, 0 once the tree is exhausted
+        uint64_t childAddr;             // Child of the current index entry, resolved by cursorChild
+        obj_phys_t childHeader;
+} apfs_diff_cursor;
+
+/* Folds record differences into one change per object */
+typedef struct {
+        apfs_diff_cb callback;
+        void *arg;
+        uint64_t oid;                   // Object being accumulated, 0 for none
+        int change;
+        apfs_diff_stats *stats;
+} apfs_diff_state;
+
+static void cursorFree(apfs_diff_cursor *cursor)
+{
+        for (int i = 0; i < APFS_MAX_DEPTH; ++i)
+                free(cursor->levels[i].block);
+}
+
+// Steps past the current entry, climbing out of the nodes that are done
+static void cursorAdvance(apfs_diff_cursor *cursor)
+{
+        if (cursor->depth == 0)
+                return;
+
+        cursor->levels[cursor->depth - 1].index++;
+        while (cursor->depth > 0 && cursor->levels[cursor->depth - 1].index >= cursor->levels[cursor->depth - 1].node.count) {
+                cursor->depth--;
+                if (cursor->depth > 0)
+                        cursor->levels[cursor->depth - 1].index++;
+        }
+}
+
+static int cursorEntry(apfs_diff_cursor *cursor, const uint8_t **key, uint16_t *keyLen,
+                       const uint8_t **val, uint16_t *valLen)
+{
+        apfs_diff_level *level = &cursor->levels[cursor->depth - 1];
+
+        return nodeEntry(&cursor->volume->fs, &level->node, level->index, key, keyLen, val, valLen);
+}
+
+static int cursorIsLeaf(apfs_diff_cursor *cursor)
+{
+        return (cursor->levels[cursor->depth - 1].node.flags & BTNODE_LEAF) != 0;
+}
+
+/*
+ * Resolves the child of the current index entry and reads its object header
+ * only, which is enough to tell a subtree shared with the other cursor.
+ */
+static int cursorChild(apfs_diff_cursor *cursor)
+{
+        apfs_ctx *ctx = cursor->volume->ctx;
+        const apfs_btree *tree = &cursor->volume->fs;
+        const uint8_t *key, *val;
+        uint16_t keyLen, valLen;
+        uint64_t child;
+        int ret;
+
+        if ((ret = cursorEntry(cursor, &key, &keyLen, &val, &valLen)) < 0)
+                return ret;
+        if (valLen < sizeof(child))
+                return APFS_EFORMAT;
+
+        memcpy(&child, val, sizeof(child));
+        cursor->childAddr = child;
+        if (tree->omap != NULL && (ret = omapLookup(ctx, tree->omap, child, tree->xid, &cursor->childAddr)) < 0)
+                return ret == APFS_ENOENT ? APFS_EFORMAT : ret;
+
+        return deviceRead(ctx, cursor->childAddr * ctx->blockSize, &cursor->childHeader, sizeof(cursor->childHeader));
+}
+
+// Enters the child resolved by cursorChild
+static int cursorDescend(apfs_diff_cursor *cursor, apfs_diff_stats *stats)
+{
+        apfs_ctx *ctx = cursor->volume->ctx;
+        apfs_diff_level *next;
+        int ret;
+
+        if (cursor->depth >= APFS_MAX_DEPTH)
+                return APFS_EFORMAT;
+
+        next = &cursor->levels[cursor->depth];
+        if (next->block == NULL && (next->block = (uint8_t*)malloc(ctx->blockSize)) == NULL)
+                return APFS_ENOMEM;
+
+        stats->nodes_read++;
+        if ((ret = readObject(ctx, cursor->childAddr, next->block, 0)) < 0 ||
+            (ret = nodeDecode(ctx, next->block, &next->node)) < 0)
+                return ret;
+
+        next->index = 0;
+        cursor->depth++;
+
+        // An empty node is stepped over like a finished one
+        if (next->node.count == 0) {
+                cursor->depth--;
+                cursorAdvance(cursor);
+        }
+
+        return APFS_OK;
+}
+
+static int cursorOpen(apfs_diff_cursor *cursor, apfs_volume *volume, apfs_diff_stats *stats)
+{
+        apfs_ctx *ctx = volume->ctx;
+        int ret;
+
+        memset(cursor, 0, sizeof(*cursor));
+        cursor->volume = volume;
+
+        if ((cursor->levels[0].block = (uint8_t*)malloc(ctx->blockSize)) == NULL)
+                return APFS_ENOMEM;
+
+        stats->nodes_read++;
+        if ((ret = readNode(ctx, &volume->fs, volume->fs.root, cursor->levels[0].block, &cursor->levels[0].node)) < 0)
+                return ret;
+
+        cursor->depth = cursor->levels[0].node.count ? 1 : 0;
+        return APFS_OK;
+}
+
+// Two children are the same subtree when they are the same object at the same address
+static int sameSubtree(apfs_diff_cursor *from, apfs_diff_cursor *to)
+{
+        return from->childAddr == to->childAddr &&
+               memcmp(&from->childHeader, &to->childHeader, sizeof(obj_phys_t)) == 0;
+}
+
+static int diffFlush(apfs_diff_state *state)
+{
+        int ret = 0;
+
+        if (state->oid == 0)
+                return 0;
+
+        if (state->change == APFS_DIFF_ADDED)
+                state->stats->added++;
+        else if (state->change == APFS_DIFF_REMOVED)
+                state->stats->removed++;
+        else
+                state->stats->modified++;
+
+        ret = state->callback(state->oid, state->change, state->arg);
+        state->oid = 0;
+        return ret;
+}
+
+/*
+ * Notes a record that is only in one tree (side is APFS_DIFF_REMOVED or
+ * APFS_DIFF_ADDED) or whose value changed (APFS_DIFF_MODIFIED). Records come
+ * in key order, so all the records of an object arrive together; the object
+ * is added or removed when its inode record is, and modified otherwise.
+ */
+static int diffRecord(apfs_diff_state *state, const uint8_t *key, int side)
+{
+        uint64_t header, oid;
+        uint32_t type;
+        int ret;
+
+        memcpy(&header, key, sizeof(header));
+        oid = header & OBJ_ID_MASK;
+        type = header >> OBJ_TYPE_SHIFT;
+
+        // Snapshot records and the physical extent tree do not describe inodes
+        if (type == APFS_TYPE_SNAP_METADATA || type == APFS_TYPE_SNAP_NAME || type == APFS_TYPE_EXTENT)
+                return 0;
+
+        if (oid != state->oid) {
+                if ((ret = diffFlush(state)) != 0)
+                        return ret;
+                state->oid = oid;
+                state->change = APFS_DIFF_MODIFIED;
+        }
+
+        if (type == APFS_TYPE_INODE)
+                state->change = side;
+
+        return 0;
+}
+
+/*
+   Input Parameters: apfs_volume*, apfs_volume*, apfs_diff_cb, void*, apfs_diff_stats*
+   Return Type:      int
+Description: Reports the objects (inodes, and the data streams their extents
+belong to) that differ between the file system trees of two volumes, each
+once, in ascending order: APFS_DIFF_ADDED when only the second tree has its
+inode, APFS_DIFF_REMOVED when only the first one has, APFS_DIFF_MODIFIED when
+any of its records differ. Both trees are walked in lockstep and a node is
+only entered when its first key is not past the other cursor. When both
+cursors stand on children that resolve to the same physical address and
+carry the same object header (identifier, transaction and checksum), that
+subtree is identical on both sides and is skipped after reading that header
+only, so the cost follows the size of the change. The volumes
+may come from two checkpoints of a container (see apfs_open_checkpoint) or
+from two images. stats may be NULL.
+
+ */
+int apfs_diff(apfs_volume *from, apfs_volume *to, apfs_diff_cb callback, void *arg, apfs_diff_stats *stats)
+{
+        apfs_diff_cursor a, b;
+        apfs_diff_stats local;
+        apfs_diff_state state;
+        const uint8_t *aKey, *aVal, *bKey, *bVal;
+        uint16_t aKeyLen, aValLen, bKeyLen, bValLen;
+        int ret, cmp;
+
+        if (stats == NULL)
+                stats = &local;
+        memset(stats, 0, sizeof(*stats));
+        memset(&a, 0, sizeof(a));
+        memset(&b, 0, sizeof(b));
+        memset(&state, 0, sizeof(state));
+        state.callback = callback;
+        state.arg = arg;
+        state.stats = stats;
+
+        if ((ret = cursorOpen(&a, from, stats)) < 0 || (ret = cursorOpen(&b, to, stats)) < 0)
+                goto end;
+
+        while (a.depth > 0 || b.depth > 0) {
+                if (a.depth > 0 && (ret = cursorEntry(&a, &aKey, &aKeyLen, &aVal, &aValLen)) < 0)
+                        break;
+                if (b.depth > 0 && (ret = cursorEntry(&b, &bKey, &bKeyLen, &bVal, &bValLen)) < 0)
+                        break;
+
+                if (a.depth == 0)
+                        cmp = 1;
+                else if (b.depth == 0)
+                        cmp = -1;
+                else
+                        cmp = from->fs.compare(aKey, aKeyLen, bKey, bKeyLen);
+
+                // Index entries on both sides: skip a shared subtree, otherwise enter the one(s) that come first
+                if (a.depth > 0 && b.depth > 0 && !cursorIsLeaf(&a) && !cursorIsLeaf(&b)) {
+                        if ((cmp <= 0 && (ret = cursorChild(&a)) < 0) ||
+                            (cmp >= 0 && (ret = cursorChild(&b)) < 0))
+                                break;
+
+                        if (cmp == 0 && sameSubtree(&a, &b)) {
+                                stats->subtrees_shared++;
+                                cursorAdvance(&a);
+                                cursorAdvance(&b);
+                                continue;
+                        }
+
+                        if ((cmp <= 0 && (ret = cursorDescend(&a, stats)) < 0) ||
+                            (cmp >= 0 && (ret = cursorDescend(&b, stats)) < 0))
+                                break;
+                        continue;
+                }
+
+                // An index entry is entered once nothing on the other side sorts before it
+                if (a.depth > 0 && !cursorIsLeaf(&a) && cmp <= 0) {
+                        if ((ret = cursorChild(&a)) < 0 || (ret = cursorDescend(&a, stats)) < 0)
+                                break;
+                        continue;
+                }
+                if (b.depth > 0 && !cursorIsLeaf(&b) && cmp >= 0) {
+                        if ((ret = cursorChild(&b)) < 0 || (ret = cursorDescend(&b, stats)) < 0)
+                                break;
+                        continue;
+                }
+
+                // Records: the smaller key is missing on the other side
+                stats->records_compared++;
+                if (cmp < 0) {
+                        ret = diffRecord(&state, aKey, APFS_DIFF_REMOVED);
+                        cursorAdvance(&a);
+                } else if (cmp > 0) {
+                        ret = diffRecord(&state, bKey, APFS_DIFF_ADDED);
+                        cursorAdvance(&b);
+                } else {
+                        if (aValLen != bValLen || memcmp(aVal, bVal, aValLen) != 0)
+                                ret = diffRecord(&state, aKey, APFS_DIFF_MODIFIED);
+                        cursorAdvance(&a);
+                        cursorAdvance(&b);
+                }
+
+                if (ret != 0)
+                        break;
+        }
+
+        if (ret == 0)
+                ret = diffFlush(&state);
+
+end:
+        cursorFree(&a);
+        cursorFree(&b);
+        return ret < 0 ? ret : APFS_OK;
+}
+
+/* ---------------------------------------------------------------------- */
+/* Carving                                                                */
+/* ---------------------------------------------------------------------- */
+
+// Reads count blocks from paddr as they are, past the caches
+int apfs_block_read(apfs_ctx *ctx, uint64_t paddr, uint64_t count, void *buf)
+{
+        if (paddr > ctx->size / ctx->blockSize || count > ctx->size / ctx->blockSize - paddr)
+                return APFS_EINVAL;
+
+        return deviceRead(ctx, paddr * ctx->blockSize, buf, count * ctx->blockSize);
+}
+
+// Opens the object map of every readable volume once, for the orphan checks
+static void carveOmapsLoad(apfs_ctx *ctx)
+{
+        apfs_superblock_t sb;
+
+        if (ctx->carveOmapsLoaded)
+                return;
+
+        ctx->carveOmapsLoaded = 1;
+        for (uint32_t i = 0; i < ctx->volumeCount; ++i)
+                if (readVolumeSuperBlock(ctx, i, &sb, NULL) == 0 &&
+                    omapOpen(ctx, &ctx->carveOmaps[ctx->carveOmapCount], sb.apfs_omap_oid, ctx->xid) == 0)
+                        ctx->carveOmapCount++;
+}
+
+/*
+ * True when a node at paddr is still part of a tree: its block is not free
+ * in the space manager and a volume omap maps its identifier, as of the
+ * node's own transaction, to this block. Nodes kept for a snapshot are thus
+ * referenced; a copy that was superseded and dropped from the omap is not.
+ * Physical nodes cannot be checked against an omap and are only orphaned
+ * when their block is free.
+ */
+static int nodeReferenced(apfs_ctx *ctx, const obj_phys_t *obj, uint64_t paddr)
+{
+        uint64_t mapped;
+
+        if (spaceLoad(ctx) == 0 && apfs_range_used(ctx, paddr, 1) == 0)
+                return 0;
+        if (obj->o_type & OBJ_PHYSICAL)
+                return 1;
+
+        carveOmapsLoad(ctx);
+        for (uint32_t i = 0; i < ctx->carveOmapCount; ++i)
+                if (omapLookup(ctx, &ctx->carveOmaps[i], obj->o_oid, obj->o_xid, &mapped) == 0 && mapped == paddr)
+                        return 1;
+
+        return 0;
+}
+
+/*
+   Input Parameters: apfs_ctx*, void*, uint64_t, apfs_carve_cb, void*
+   Return Type:      int
+Description: Looks at a block read from paddr for an orphaned file system
+tree node: a B-tree node of the FS tree subtype, with a valid checksum, that
+nothing references any more (see nodeReferenced). The inode and file extent
+records of an orphaned leaf are passed to callback. Returns 1 for an
+orphaned node, 0 for anything else, or the callback's non-zero value.
+
+ */
+int apfs_carve_node(apfs_ctx *ctx, const void *block, uint64_t paddr, apfs_carve_cb callback, void *arg)
+{
+        const obj_phys_t *obj = (const obj_phys_t*)block;
+        apfs_btree tree = { 0 };
+        apfs_carved carved;
+        apfs_node node;
+        uint32_t type = obj->o_type & OBJECT_TYPE_MASK;
+        int ret;
+
+        if ((type != eApFS_ObjectType_02_BTreeRoot && type != eApFS_ObjectType_03_BTreeNode) ||
+            obj->o_subtype != eApFS_ObjectType_0E_FileSystemTree || !objectValid(block, ctx->blockSize) ||
+            nodeDecode(ctx, (const uint8_t*)block, &node) < 0 || nodeReferenced(ctx, obj, paddr))
+                return 0;
+
+        if (!(node.flags & BTNODE_LEAF))
+                return 1;
+
+        for (uint32_t i = 0; i < node.count; ++i) {
+                const uint8_t *key, *val;
+                uint16_t keyLen, valLen;
+                uint64_t header;
+
+                if (nodeEntry(&tree, &node, i, &key, &keyLen, &val, &valLen) < 0 || keyLen < sizeof(j_key_t))
+                        continue;
+
+                memset(&carved, 0, sizeof(carved));
+                carved.block = paddr;
+                carved.node_oid = obj->o_oid;
+                carved.node_xid = obj->o_xid;
+                memcpy(&header, key, sizeof(header));
+
+                switch (header >> OBJ_TYPE_SHIFT) {
+                        case APFS_TYPE_INODE:
+                                if (inodeDecode(header & OBJ_ID_MASK, val, valLen, &carved.st) < 0)
+                                        continue;
+                                carved.kind = APFS_CARVE_INODE;
+                                break;
+                        case APFS_TYPE_FILE_EXTENT: {
+                                j_file_extent_val_t extent;
+
+                                if (keyLen < sizeof(j_key_t) + sizeof(uint64_t) || valLen < sizeof(extent))
+                                        continue;
+                                memcpy(&extent, val, sizeof(extent));
+                                carved.kind = APFS_CARVE_EXTENT;
+                                carved.stream = header & OBJ_ID_MASK;
+                                memcpy(&carved.logical, key + sizeof(j_key_t), sizeof(carved.logical));
+                                carved.length = extent.len_and_flags & J_FILE_EXTENT_LEN_MASK;
+                                carved.paddr = extent.phys_block_num;
+                                break;
+                        }
+                        default:
+                                continue;
+                }
+
+                if ((ret = callback(&carved, arg)) != 0)
+                        return ret;
+        }
+
+        return 1;
+}
+
+const char* apfs_strerror(int error)
+{
+        switch (error) {
+                case APFS_OK:           return "Success";
+                case APFS_EIO:          return "The image could not be read";
+                case APFS_ENOMEM:       return "Out of memory";
+                case APFS_EFORMAT:      return "Malformed APFS structure";
+                case APFS_ECHECKSUM:    return "Object checksum mismatch";
+                case APFS_ENOENT:       return "No such file, directory or volume";
+                case APFS_ENOTDIR:      return "Not a directory";
+                case APFS_EISDIR:       return "Is a directory";
+                case APFS_EUNSUPPORTED: return "Unsupported feature";
+                case APFS_EINVAL:       return "Invalid argument";
+                default:                return "Unknown error";
+        }
+}
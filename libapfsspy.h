@@ -0,0 +1,266 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * libapfsspy: read-only access to APFS containers, inside a DMG or in a raw
+ * image (an exported partition).
+ *
+ * Everything the library knows about an image hangs off an opaque apfs_ctx:
+ * the DMG mapping, the inflate state, the block caches and the container
+ * superblock. There is no global state, so any number of contexts can be
+ * open at once. A context (and the volumes opened from it) must only be used
+ * by one thread at a time; open one context per thread to read in parallel.
+ *
+ * Functions return 0 (or a count) on success and a negative APFS_E* code on
+ * failure; apfs_strerror() describes the code.
+ */
+
+#define APFS_OK                 0
+#define APFS_EIO                -1      // The image could not be read
+#define APFS_ENOMEM             -2
+#define APFS_EFORMAT            -3      // Not an APFS container, or a malformed structure
+#define APFS_ECHECKSUM          -4      // An object failed its Fletcher-64 checksum
+#define APFS_ENOENT             -5      // No such volume, inode or name
+#define APFS_ENOTDIR            -6
+#define APFS_EISDIR             -7
+#define APFS_EUNSUPPORTED       -8      // A feature this library does not read (e.g. bzip2 chunks)
+#define APFS_EINVAL             -9
+
+#define APFS_PARTITION_AUTO     -1      // First Apple_APFS partition of a DMG
+
+#define APFS_ROOT_INO           2       // Inode number of a volume's root directory
+#define APFS_SYMLINK_XATTR      "com.apple.fs.symlink"  // A symlink's target, NUL-terminated
+
+typedef struct apfs_ctx apfs_ctx;
+typedef struct apfs_volume apfs_volume;
+typedef struct apfs_file apfs_file;
+
+typedef struct apfs_container_info {
+        uint32_t block_size;
+        uint64_t block_count;
+        uint64_t xid;                   // Transaction of the checkpoint in use
+        uint64_t superblock;            // Block of its container superblock
+        uint32_t volume_count;
+        uint32_t ephemeral_count;       // Ephemeral objects in its checkpoint maps
+        uint8_t  uuid[16];
+} apfs_container_info;
+
+typedef struct apfs_volume_info {
+        uint32_t index;                 // Position in the container's volume array
+        uint64_t oid;                   // Virtual identifier of the volume superblock
+        uint64_t superblock;            // Block it is in
+        char     name[256];
+        uint16_t role;
+        uint64_t num_files;
+        uint64_t num_directories;
+        uint64_t num_symlinks;
+        uint64_t num_snapshots;
+        uint8_t  uuid[16];
+        int      case_insensitive;
+} apfs_volume_info;
+
+typedef struct apfs_stat_t {
+        uint64_t ino;
+        uint64_t parent_ino;
+        uint64_t private_id;            // Identifier of the data stream
+        uint16_t mode;                  // S_IF* type and permission bits
+        uint32_t nlink;                 // Hard links of a file
+        uint32_t nchildren;             // Entries of a directory
+        uint32_t uid;
+        uint32_t gid;
+        uint32_t bsd_flags;
+        uint64_t internal_flags;        // INODE_* flags, e.g. INODE_WAS_CLONED
+        uint64_t size;                  // Logical size of the data stream
+        uint64_t alloced_size;
+        uint64_t sparse_bytes;          // Bytes of the data stream that are holes
+        uint32_t rdev;                  // Device of a character or block special file
+        uint32_t document_id;
+        uint64_t create_time;           // Nanoseconds since 1970-01-01
+        uint64_t mod_time;
+        uint64_t change_time;
+        uint64_t access_time;
+} apfs_stat_t;
+
+typedef struct apfs_snapshot_info {
+        uint64_t xid;                   // Transaction the snapshot was taken at
+        char     name[256];
+        uint64_t create_time;           // Nanoseconds since 1970-01-01
+        uint64_t change_time;
+        uint64_t superblock;            // Physical address of the snapshot's volume superblock
+        uint32_t flags;
+} apfs_snapshot_info;
+
+typedef struct apfs_diff_stats {
+        uint64_t added;
+        uint64_t removed;
+        uint64_t modified;
+        uint64_t nodes_read;            // B-tree nodes read on both sides, roots included
+        uint64_t subtrees_shared;       // Subtrees skipped because both sides point at the same node
+        uint64_t records_compared;
+} apfs_diff_stats;
+
+/* Time spent in one stage, over all its runs */
+typedef struct apfs_timer {
+        double   seconds;
+        uint64_t runs;
+} apfs_timer;
+
+/* Work done through a context, for reports such as APFSpy --stats */
+typedef struct apfs_stats {
+        uint64_t bytes_read;            // Taken from the file: stored chunks inflated and raw data copied
+        uint64_t syscalls;              // open, fstat, mmap and madvise on the file
+        uint64_t blocks_fetched;        // Container blocks covered by the reads
+        uint64_t chunks;                // DMG chunks inflated
+        uint64_t omap_lookups;
+        uint64_t btree_nodes;           // B-tree nodes visited, object maps and FS trees
+        apfs_timer map;                 // Mapping the file and checking for a koly trailer
+        apfs_timer plist;               // Building the partition table
+        apfs_timer inflate;             // One run per chunk inflated
+        apfs_timer container;           // Checkpoint, container superblock and omap
+} apfs_stats;
+
+typedef struct apfs_space_info {
+        uint64_t block_count;           // Blocks of the main device
+        uint64_t used_blocks;           // Counted in the allocation bitmaps
+        uint64_t free_blocks;
+        uint64_t recorded_free;         // Free count the space manager keeps, for comparison
+        uint32_t blocks_per_chunk;
+        uint64_t chunk_count;
+        uint32_t cib_count;
+        uint32_t cab_count;
+} apfs_space_info;
+
+#define APFS_CARVE_INODE        1
+#define APFS_CARVE_EXTENT       2
+
+/* A record recovered from an orphaned FS tree node */
+typedef struct apfs_carved {
+        int      kind;                  // APFS_CARVE_INODE or APFS_CARVE_EXTENT
+        uint64_t block;                 // Where the node was found
+        uint64_t node_oid;
+        uint64_t node_xid;
+        apfs_stat_t st;                 // APFS_CARVE_INODE
+        uint64_t stream;                // APFS_CARVE_EXTENT: data stream, logical offset, length and first block
+        uint64_t logical;
+        uint64_t length;
+        uint64_t paddr;
+} apfs_carved;
+
+/* One extent of a data stream, as apfs_walk reports it */
+typedef struct apfs_object_extent {
+        uint64_t logical;
+        uint64_t length;
+        uint64_t paddr;                 // First block, 0 for a hole
+} apfs_object_extent;
+
+/* An extended attribute; resource forks and other large values live in a data stream */
+typedef struct apfs_xattr {
+        const char *name;               // NUL-terminated, valid during the callback
+        uint16_t flags;                 // XATTR_DATA_STREAM or XATTR_DATA_EMBEDDED of the record
+        uint64_t size;                  // Bytes of the value
+        const uint8_t *data;            // Embedded value, valid during the callback; NULL in a stream
+        uint64_t stream;                // Data stream holding the value, 0 when embedded
+} apfs_xattr;
+
+typedef struct apfs_dirent {
+        uint64_t ino;
+        uint64_t date_added;
+        uint16_t type;                  // DT_* value
+        const char *name;               // NUL-terminated, valid during the callback
+} apfs_dirent;
+
+/* One hard link of a file: the directory holding it and its name there */
+typedef struct apfs_link {
+        uint64_t parent;
+        const char *name;               // NUL-terminated, valid during the callback
+} apfs_link;
+
+/* An inode with the records gathered after it in the FS tree, all valid during the callback */
+typedef struct apfs_object {
+        apfs_stat_t st;
+        const char *name;               // From the inode
+        const apfs_object_extent *extents;      // In logical order
+        uint32_t extent_count;
+        const apfs_dirent *children;    // Entries of a directory, in FS tree order
+        uint32_t child_count;
+        const apfs_xattr *xattrs;       // In name order
+        uint32_t xattr_count;
+        const apfs_link *links;         // Sibling links of a file with hard links
+        uint32_t link_count;
+} apfs_object;
+
+// Called once per directory entry; a non-zero return stops the listing
+typedef int (*apfs_readdir_cb)(const apfs_dirent*, void*);
+
+// Called once per extended attribute; a non-zero return stops the listing
+typedef int (*apfs_xattr_cb)(const apfs_xattr*, void*);
+
+// Called once per snapshot; a non-zero return stops the listing
+typedef int (*apfs_snapshot_cb)(const apfs_snapshot_info*, void*);
+
+// Called once per inode by apfs_walk; a non-zero return stops the walk
+typedef int (*apfs_object_cb)(const apfs_object*, void*);
+
+// Called once per run of used (1) or free (0) blocks; a non-zero return stops the walk
+typedef int (*apfs_space_cb)(uint64_t, uint64_t, int, void*);
+
+#define APFS_DIFF_ADDED         1
+#define APFS_DIFF_REMOVED       2
+#define APFS_DIFF_MODIFIED      3
+
+// Called once per carved record; a non-zero return stops the node
+typedef int (*apfs_carve_cb)(const apfs_carved*, void*);
+
+// Called once per changed object with an APFS_DIFF_* value; a non-zero return stops the diff
+typedef int (*apfs_diff_cb)(uint64_t, int, void*);
+
+int apfs_open(const char *path, int partition, apfs_ctx **ctx);
+int apfs_open_checkpoint(const char *path, int partition, uint64_t xid, apfs_ctx **ctx);
+void apfs_close(apfs_ctx *ctx);
+void apfs_stats_add(apfs_ctx *ctx, apfs_stats *stats);
+int apfs_container_info_get(apfs_ctx *ctx, apfs_container_info *info);
+int apfs_checkpoint_list(apfs_ctx *ctx, uint64_t *xids, uint32_t max);
+int apfs_checkpoint_superblock(apfs_ctx *ctx, uint64_t xid, uint64_t *paddr);
+int apfs_ephemeral_find(apfs_ctx *ctx, uint64_t oid, uint64_t *paddr, uint32_t *size);
+
+// The space manager's bitmaps, loaded on first use and kept as one bit per block
+int apfs_space_info_get(apfs_ctx *ctx, apfs_space_info *info);
+int apfs_space_extents(apfs_ctx *ctx, apfs_space_cb callback, void *arg);
+int apfs_range_used(apfs_ctx *ctx, uint64_t first, uint64_t count);
+
+int apfs_volume_info_get(apfs_ctx *ctx, uint32_t index, apfs_volume_info *info);
+int apfs_volume_open(apfs_ctx *ctx, uint32_t index, apfs_volume **volume);
+void apfs_volume_close(apfs_volume *volume);
+
+// Snapshots open as volumes of their own, read through the same context and block cache
+int apfs_snapshot_list(apfs_volume *volume, apfs_snapshot_cb callback, void *arg);
+int apfs_snapshot_find(apfs_volume *volume, const char *name, uint64_t *xid);
+int apfs_snapshot_open(apfs_volume *volume, uint64_t xid, apfs_volume **snapshot);
+
+int apfs_lookup(apfs_volume *volume, uint64_t parent, const char *name, uint64_t *ino);
+int apfs_lookup_path(apfs_volume *volume, const char *path, uint64_t *ino);
+int apfs_stat(apfs_volume *volume, uint64_t ino, apfs_stat_t *st);
+int apfs_readdir(apfs_volume *volume, uint64_t ino, apfs_readdir_cb callback, void *arg);
+int64_t apfs_read(apfs_volume *volume, uint64_t ino, void *buf, uint64_t len, uint64_t offset);
+int apfs_listxattr(apfs_volume *volume, uint64_t ino, apfs_xattr_cb callback, void *arg);
+int64_t apfs_getxattr(apfs_volume *volume, uint64_t ino, const char *name, void *buf, uint64_t len);
+int apfs_xattr_open(apfs_volume *volume, uint64_t ino, const char *name, apfs_file **file);
+
+// Every inode of the volume with its name and extents, in one pass over the FS tree
+int apfs_walk(apfs_volume *volume, apfs_object_cb callback, void *arg);
+
+// Random access reads: the extent map is loaded once at open, each read binary searches it
+int apfs_file_open(apfs_volume *volume, uint64_t ino, apfs_file **file);
+void apfs_file_close(apfs_file *file);
+int apfs_file_stat(apfs_file *file, apfs_stat_t *st);
+int64_t apfs_pread(apfs_file *file, void *buf, uint64_t len, uint64_t offset);
+
+// Changed objects between two volumes, walking only the B-tree nodes that are not shared
+int apfs_diff(apfs_volume *from, apfs_volume *to, apfs_diff_cb callback, void *arg, apfs_diff_stats *stats);
+
+// Orphaned FS tree nodes, for carving blocks read with apfs_block_read
+int apfs_block_read(apfs_ctx *ctx, uint64_t paddr, uint64_t count, void *buf);
+int apfs_carve_node(apfs_ctx *ctx, const void *block, uint64_t paddr, apfs_carve_cb callback, void *arg);
+
+const char* apfs_strerror(int error);
@@ -1,190 +1,287 @@
 #include <string.h>
-#include <libxml/tree.h>
-#include <libxml/parser.h>
 
-//Searches through the siblings of a node for the given type
-xmlNode* findSiblingByType(xmlNode *node, char* type)
-{
-	const xmlChar *nodeType = (const xmlChar*)type;
+//A streaming scanner for the DMG property list.
+//The plist is walked once, front to back, without building a document tree:
+//the scanner finds the blkx array and reports each partition's name and its
+//decoded mish table through a callback. Base64 data is decoded straight from
+//the XML text into one reusable buffer, so memory stays bounded by the largest
+//partition table instead of the size of the plist.
 
-	//Advance the pointer to its sibling
-	node = node->next;
+#define PLIST_NAME_LEN 256
 
-	while (node != NULL && !xmlStrEqual(node->name, nodeType))
-		node = node->next;
+typedef struct plist_scanner {
+	const char *pos;
+	const char *end;
+} plist_scanner;
 
-	return node;
-}
+//Called once per blkx entry. Returning non-zero stops the scan, a negative value as a failure.
+typedef int (*plist_partition_cb)(const char *name, const uint8_t *blkx, size_t blkxLen, void *ctx);
 
-//Searches through the siblings of a node for the given content
-xmlNode* findSiblingByContent(xmlDoc *doc, xmlNode *node, char* content)
+//Advances past the next tag. The text preceding it is returned in text/textLen
+//and the tag name (including a leading '/' for closing tags) in tag/tagLen.
+//Processing instructions, the DOCTYPE and comments are skipped.
+int plistNextTag(plist_scanner *s, const char **text, size_t *textLen, const char **tag, size_t *tagLen, int *selfClosing)
 {
-	const xmlChar *nodeContent = (const xmlChar*)content;
-
-	for(xmlNode* sibling = node->next; sibling != NULL; sibling = sibling->next)
+	for (;;)
 	{
-		if (sibling->type == XML_ELEMENT_NODE)
+		const char *open = memchr(s->pos, '<', s->end - s->pos);
+
+		if (open == NULL)
+			return 0;
+
+		if (text != NULL)
 		{
-			const xmlChar *nodeText = xmlNodeListGetString(doc, sibling->children, 1);
-		
-			if (xmlStrEqual(nodeText, nodeContent))
-				return sibling;
+			*text = s->pos;
+			*textLen = open - s->pos;
 		}
 
-	}
+		//Comments may contain '>' so they need their own terminator
+		if (s->end - open >= 4 && memcmp(open, "<!--", 4) == 0)
+		{
+			const char *close = open + 4;
 
-	return NULL;
-}
+			while (close + 3 <= s->end && memcmp(close, "-->", 3) != 0)
+				close++;
 
-//A breadth-first search for an xmlNode with the given contents
-xmlNode* findNodeByText(xmlDoc *doc, xmlNode *root, char *searchText)
-{
-	//Search all siblings
-	xmlNode* sibling = findSiblingByContent(doc, root, searchText);
+			if (close + 3 > s->end)
+				return 0;
 
-	if (sibling != NULL)
-		return sibling;
+			s->pos = close + 3;
+			continue;
+		}
 
-	//Search all children
-	for (xmlNode* sibling = root; sibling != NULL; sibling = sibling->next)
-	{
-		if (sibling->type == XML_ELEMENT_NODE)
-		{
-			xmlNode* node = findNodeByText(doc, sibling->children, searchText);
+		const char *close = memchr(open, '>', s->end - open);
 
-			if (node != NULL)
-				return node;
-		}
+		if (close == NULL)
+			return 0;
+
+		s->pos = close + 1;
+
+		if (open[1] == '?' || open[1] == '!')
+			continue;
+
+		*tag = open + 1;
+		*selfClosing = close[-1] == '/';
+
+		//The name ends at the first whitespace or '/' after its first character
+		const char *nameEnd = *tag + 1;
+		while (nameEnd < close && *nameEnd != ' ' && *nameEnd != '\t' &&
+		       *nameEnd != '\n' && *nameEnd != '\r' && *nameEnd != '/')
+			nameEnd++;
+
+		*tagLen = nameEnd - *tag;
+		return 1;
 	}
+}
 
-	//Item not found in this branch
-	return NULL;
+int plistTagIs(const char *tag, size_t tagLen, const char *name)
+{
+	return tagLen == strlen(name) && memcmp(tag, name, tagLen) == 0;
 }
 
-char* removeWhiteSpace(char* string)
+//Reads the text content of a simple element whose opening tag was just consumed
+int plistReadText(plist_scanner *s, const char **text, size_t *textLen)
 {
-	char* copy;
-	int length = strlen(string);
-	int wsCount = 0;
-	int newLength;
+	const char *tag;
+	size_t tagLen;
+	int selfClosing;
+
+	return plistNextTag(s, text, textLen, &tag, &tagLen, &selfClosing) && tag[0] == '/';
+}
 
-	int strIndex = 0;
-	int copyIndex = 0;
+//Skips a value element (and anything nested in it) whose opening tag was just consumed
+int plistSkipElement(plist_scanner *s)
+{
+	const char *tag;
+	size_t tagLen;
+	int selfClosing, depth = 1;
 
-	//Count the number of white spaces
-	for (strIndex = 0; strIndex < length; strIndex++)
+	while (depth > 0)
 	{
-		if (string[strIndex] == ' ' ||
-			string[strIndex] == '\t'||
-			string[strIndex] == '\n'||
-			string[strIndex] == '\r')
-			wsCount++;
+		if (!plistNextTag(s, NULL, NULL, &tag, &tagLen, &selfClosing))
+			return 0;
+
+		if (tag[0] == '/')
+			depth--;
+		else if (!selfClosing)
+			depth++;
 	}
 
-	//Allocate memory for a new string
-	//Add an extra byte for the null terminator character
-	newLength = length - wsCount + 1;
-	copy = (char*) malloc(newLength * sizeof(char));
+	return 1;
+}
 
-	//Copy all non-whitespace characters
-	for (strIndex = 0; strIndex <= length; strIndex++)
+//Copies XML text into a NUL-terminated buffer, resolving the predefined entities
+void plistCopyText(char *dst, size_t dstLen, const char *text, size_t textLen)
+{
+	static const struct { const char *entity; char ch; } entities[] = {
+		{ "&amp;", '&' }, { "&lt;", '<' }, { "&gt;", '>' }, { "&quot;", '"' }, { "&apos;", '\'' }
+	};
+	size_t out = 0;
+
+	for (size_t in = 0; in < textLen && out + 1 < dstLen; in++)
 	{
-		if (string[strIndex] != ' ' &&
-			string[strIndex] != '\t'&&
-			string[strIndex] != '\n'&&
-			string[strIndex] != '\r')
+		char ch = text[in];
+
+		if (ch == '&')
 		{
-			copy[copyIndex] = string[strIndex];
-			copyIndex++;
+			for (size_t e = 0; e < sizeof(entities) / sizeof(entities[0]); e++)
+			{
+				size_t len = strlen(entities[e].entity);
+
+				if (textLen - in >= len && memcmp(text + in, entities[e].entity, len) == 0)
+				{
+					ch = entities[e].ch;
+					in += len - 1;
+					break;
+				}
+			}
 		}
+
+		dst[out++] = ch;
 	}
 
-	return copy;
+	dst[out] = '\0';
 }
 
-//Finds the APFS data block in the parsed Plist
-char* getApfsData(xmlDoc *doc, xmlNode *blkxNode, FILE* stream)
+//Scans one blkx <dict> and reports it. Returns 1 to continue, 0 to stop, -1 on malformed input or a failed callback.
+int plistScanPartition(plist_scanner *s, uint8_t **buffer, size_t *bufferLen, plist_partition_cb callback, void *ctx)
 {
-	xmlNode *array = findSiblingByType(blkxNode, "array");
+	char key[32] = {0};
+	char cfName[PLIST_NAME_LEN] = {0};
+	char name[PLIST_NAME_LEN] = {0};
+	size_t dataLen = 0;
+	int haveData = 0;
+	const char *text, *tag;
+	size_t textLen, tagLen;
+	int selfClosing, ret;
+
+	for (;;)
+	{
+		if (!plistNextTag(s, NULL, NULL, &tag, &tagLen, &selfClosing))
+			return -1;
 
-	if (array == NULL)
-		return NULL;
+		if (plistTagIs(tag, tagLen, "/dict"))
+			break;
 
-	xmlNode *block = findSiblingByType(array->children, "dict");
+		if (plistTagIs(tag, tagLen, "key"))
+		{
+			if (!plistReadText(s, &text, &textLen))
+				return -1;
 
-	if (block == NULL)
-		return NULL;
+			plistCopyText(key, sizeof(key), text, textLen);
+			continue;
+		}
 
-	//Print all blocks
-	for (int i = 0; block != NULL; i++)
-	{
-		//Find the CFName key
-		xmlNode *node = findSiblingByContent(doc, block->children, "CFName");
+		if (selfClosing)
+			continue;
+
+		if (plistTagIs(tag, tagLen, "string") && (strcmp(key, "CFName") == 0 || strcmp(key, "Name") == 0))
+		{
+			if (!plistReadText(s, &text, &textLen))
+				return -1;
 
-		if (node == NULL)
-			return NULL;
+			plistCopyText(key[0] == 'C' ? cfName : name, PLIST_NAME_LEN, text, textLen);
+		}
+		else if (plistTagIs(tag, tagLen, "data") && strcmp(key, "Data") == 0)
+		{
+			//Find the end of the text first so the buffer is grown at most once
+			const char *dataEnd = memchr(s->pos, '<', s->end - s->pos);
 
-		//Find the CFName content node
-		node = findSiblingByType(node, "string");
+			if (dataEnd == NULL)
+				return -1;
 
-		if (node == NULL)
-			return NULL;
+			size_t needed = (dataEnd - s->pos) / 4 * 3 + 3;
 
-		//Read the block CFName
-		const xmlChar *name = xmlNodeListGetString(doc, node->children, 1);
-		
-		if (strstr(name, "Apple_APFS") != NULL)
-		{
-			//Find the data node
-			node = findSiblingByType(node, "data");
+			if (needed > *bufferLen)
+			{
+				uint8_t *grown = (uint8_t*)realloc(*buffer, needed);
 
-			if (node == NULL)
-				return NULL;
+				if (grown == NULL)
+					return -1;
 
-			//Print the block data
-			char *data = xmlNodeListGetString(doc, node->children, 1);
-			char *dataNoWs = removeWhiteSpace(data);
-			free(data);
+				*buffer = grown;
+				*bufferLen = needed;
+			}
 
-			return dataNoWs;
-		}
+			dataLen = base64_decode_ws(s->pos, dataEnd - s->pos, *buffer);
+			haveData = 1;
 
-		//Go to the next block
-		block = findSiblingByType(block, "dict");
+			if (!plistReadText(s, &text, &textLen))
+				return -1;
+		}
+		else if (!plistSkipElement(s))
+		{
+			return -1;
+		}
 	}
 
-	//If no APFS block was found, return NULL
-	return NULL;
+	if (!haveData)
+		return 1;
+
+	ret = callback(cfName[0] ? cfName : name, *buffer, dataLen, ctx);
+	return ret < 0 ? -1 : ret ? 0 : 1;
 }
 
-//Parses the given Plist and returns the APFS data block
-//Adapted from the article:
-//https://www.developer.com/database/libxml2-everything-you-need-in-an-xml-library/
-char* parsePlist(char* xmlStr, FILE* stream)
+//Walks the plist and calls back for every partition in the blkx array.
+//Returns the number of partitions reported, or -1 if the plist is malformed or the callback failed.
+int scanPlistPartitions(const char *xmlStr, size_t xmlLen, plist_partition_cb callback, void *ctx)
 {
-	xmlDoc *doc = NULL;
-	xmlNode *root = NULL;
+	plist_scanner s = { xmlStr, xmlStr + xmlLen };
+	uint8_t *buffer = NULL;
+	size_t bufferLen = 0;
+	const char *text, *tag;
+	size_t textLen, tagLen;
+	int selfClosing, count = 0, result = 0;
+
+	//Find <key>blkx</key>
+	for (;;)
+	{
+		if (!plistNextTag(&s, NULL, NULL, &tag, &tagLen, &selfClosing))
+			return -1;
 
-	//Parse the given string into an XML file
-	doc = xmlParseDoc(xmlStr);
+		if (plistTagIs(tag, tagLen, "key"))
+		{
+			if (!plistReadText(&s, &text, &textLen))
+				return -1;
 
-	if (doc == NULL)
-		return NULL;
+			if (textLen == 4 && memcmp(text, "blkx", 4) == 0)
+				break;
+		}
+	}
 
-	root = xmlDocGetRootElement(doc);
+	//The value must be the partition array
+	if (!plistNextTag(&s, NULL, NULL, &tag, &tagLen, &selfClosing) || !plistTagIs(tag, tagLen, "array"))
+		return -1;
 
-	//Get the blkx node
-	xmlNode *blkx = findNodeByText(doc, root, "blkx");
+	while (result == 0)
+	{
+		if (!plistNextTag(&s, NULL, NULL, &tag, &tagLen, &selfClosing))
+		{
+			result = -1;
+			break;
+		}
+
+		if (plistTagIs(tag, tagLen, "/array"))
+			break;
 
-	if (blkx == NULL)
-		return NULL;
+		if (!plistTagIs(tag, tagLen, "dict") || selfClosing)
+			continue;
 
-	//Find the APFS data block
-	char* apfsData = getApfsData(doc, blkx,stream);
+		switch (plistScanPartition(&s, &buffer, &bufferLen, callback, ctx))
+		{
+			case 1:
+				count++;
+				break;
+			case 0:
+				count++;
+				result = 1;
+				break;
+			default:
+				result = -1;
+		}
+	}
 
-	//Free any libXML2 memory
-	xmlFreeDoc(doc);
-	xmlCleanupParser();
+	free(buffer);
 
-	return apfsData;
-}
\ No newline at end of file
+	return result < 0 ? -1 : count;
+}
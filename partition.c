@@ -0,0 +1,231 @@
+// partition.c : Partition table of a DMG, built from every blkx entry in the plist.
+//
+//   Each mish table is decoded once into a compact, host-endian chunk array
+//   sorted by sector, so a logical sector resolves to its chunk with a binary
+//   search instead of a walk over the big-endian BLKXTable.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <endian.h>
+#include "dmgParser.h"
+#include "pList.h"
+
+static int compareChunks(const void *a, const void *b)
+{
+        const dmg_chunk *first = a, *second = b;
+
+        if (first->SectorNumber != second->SectorNumber)
+                return first->SectorNumber < second->SectorNumber ? -1 : 1;
+        return 0;
+}
+
+/* The table being built and why the scan stopped */
+typedef struct {
+        dmg_partition_table *table;
+        int error;                      // DMG_ENOMEM when addPartition ran out of memory
+} table_builder;
+
+// Called by scanPlistPartitions for every blkx entry; -1 when out of memory
+static int addPartition(const char *name, const uint8_t *blkx, size_t blkxLen, void *ctx)
+{
+        table_builder *builder = (table_builder*)ctx;
+        dmg_partition_table *table = builder->table;
+        const BLKXTable *mish = (const BLKXTable*)blkx;
+        dmg_partition *part, *grown;
+        uint64_t sectors;
+        uint32_t entries, i;
+
+        // Entries that are not a whole mish table, or whose chunks run past it, are counted and left out
+        entries = blkxLen < sizeof(BLKXTable) ? 0 : be32toh(mish->NumberOfBlockChunks);
+        if (blkxLen < sizeof(BLKXTable) || memcmp(&mish->Signature, "mish", 4) != 0 ||
+            blkxLen < sizeof(BLKXTable) + (uint64_t)entries * sizeof(BLKXChunkEntry)) {
+                table->Skipped++;
+                return 0;
+        }
+
+        builder->error = DMG_ENOMEM;
+        grown = (dmg_partition*)realloc(table->Partitions, (table->Count + 1) * sizeof(dmg_partition));
+        if (grown == NULL)
+                return -1;
+        table->Partitions = grown;
+
+        part = &table->Partitions[table->Count];
+        memset(part, 0, sizeof(*part));
+        snprintf(part->Name, sizeof(part->Name), "%s", name);
+        part->ID = table->Count;
+        part->SectorNumber = be64toh(mish->SectorNumber);
+        part->SectorCount = be64toh(mish->SectorCount);
+        part->DataOffset = be64toh(mish->DataOffset);
+        part->Checksum = mish->checksum;
+        part->Chunks = (dmg_chunk*)malloc((entries ? entries : 1) * sizeof(dmg_chunk));
+
+        if (part->Chunks == NULL)
+                return -1;
+
+        // Comments and the terminator carry no data and are left out of the index
+        for (i = 0; i < entries; ++i) {
+                const BLKXChunkEntry *entry = &mish->chunk[i];
+                uint32_t type = be32toh(entry->EntryType);
+                dmg_chunk *chunk;
+
+                if (type == ENTRY_TYPE_COMMENT || type == ENTRY_TYPE_TERMINATOR)
+                        continue;
+
+                sectors = be64toh(entry->SectorCount);
+                chunk = &part->Chunks[part->NumberOfChunks++];
+                chunk->SectorNumber = be64toh(entry->SectorNumber);
+
+                // A chunk past the partition's own sectors means the table is corrupt
+                if (sectors > UINT32_MAX || sectors > part->SectorCount ||
+                    chunk->SectorNumber > part->SectorCount - sectors) {
+                        free(part->Chunks);
+                        table->Skipped++;
+                        builder->error = 0;
+                        return 0;
+                }
+
+                chunk->SectorCount = (uint32_t)sectors;
+                chunk->CompressedOffset = be64toh(entry->CompressedOffset) + part->DataOffset;
+                chunk->CompressedLength = be64toh(entry->CompressedLength);
+                chunk->EntryType = type;
+
+                if (type != ENTRY_TYPE_ZERO && type != ENTRY_TYPE_IGNORE)
+                        part->CompressedBytes += chunk->CompressedLength;
+        }
+
+        qsort(part->Chunks, part->NumberOfChunks, sizeof(dmg_chunk), compareChunks);
+        table->Count++;
+        builder->error = 0;
+
+        return 0;
+}
+
+/*
+   Input Parameters: char*, size_t, dmg_partition_table*
+   Return Type:      int
+Description: Scans the plist and decodes every blkx entry into the table.
+Entries that are not whole mish tables, or that have chunks outside of the
+partition's SectorCount, are counted in table->Skipped. Returns the
+number of partitions, or (with the table freed) DMG_EPLIST if the plist
+could not be scanned and DMG_ENOMEM if memory ran out.
+
+ */
+int buildPartitionTable(const char *xmlStr, size_t xmlLen, dmg_partition_table *table)
+{
+        table_builder builder = { table, 0 };
+
+        memset(table, 0, sizeof(*table));
+
+        if (scanPlistPartitions(xmlStr, xmlLen, addPartition, &builder) < 0) {
+                freePartitionTable(table);
+                return builder.error ? builder.error : DMG_EPLIST;
+        }
+
+        return table->Count;
+}
+
+void freePartitionTable(dmg_partition_table *table)
+{
+        for (uint32_t i = 0; i < table->Count; ++i)
+                free(table->Partitions[i].Chunks);
+
+        free(table->Partitions);
+        table->Partitions = NULL;
+        table->Count = 0;
+}
+
+dmg_partition* getPartition(dmg_partition_table *table, uint32_t id)
+{
+        return id < table->Count ? &table->Partitions[id] : NULL;
+}
+
+// Returns the first partition whose name contains the given text, e.g. "Apple_APFS"
+dmg_partition* findPartitionByName(dmg_partition_table *table, const char *name)
+{
+        for (uint32_t i = 0; i < table->Count; ++i)
+                if (strstr(table->Partitions[i].Name, name) != NULL)
+                        return &table->Partitions[i];
+
+        return NULL;
+}
+
+/*
+ * Finds the chunk holding the given sector (relative to the partition start)
+ *
+ * Return Value
+ *
+ *  NULL if no chunk covers the sector
+ *  The chunk otherwise
+ */
+dmg_chunk* findChunkBySector(dmg_partition *part, uint64_t sector)
+{
+        uint32_t low = 0, high = part->NumberOfChunks;
+
+        while (low < high) {
+                uint32_t mid = low + (high - low) / 2;
+                dmg_chunk *chunk = &part->Chunks[mid];
+
+                if (sector < chunk->SectorNumber)
+                        high = mid;
+                else if (sector >= chunk->SectorNumber + chunk->SectorCount)
+                        low = mid + 1;
+                else
+                        return chunk;
+        }
+
+        return NULL;
+}
+
+const char* chunkTypeName(uint32_t type)
+{
+        switch (type) {
+                case ENTRY_TYPE_ZERO:   return "zero";
+                case ENTRY_TYPE_RAW:    return "raw";
+                case ENTRY_TYPE_IGNORE: return "free";
+                case ENTRY_TYPE_ADC:    return "adc";
+                case ENTRY_TYPE_ZLIB:   return "zlib";
+                case ENTRY_TYPE_BZIP2:  return "bzip2";
+                case ENTRY_TYPE_LZFSE:  return "lzfse";
+                case ENTRY_TYPE_LZMA:   return "lzma";
+                default:                return "unknown";
+        }
+}
+
+// Prints one line per partition with its size, stored size and compression ratio
+void printPartitionTable(dmg_partition_table *table)
+{
+        printf("\nPartitions: %u\n\n", table->Count);
+        printf("  ID  %-44s %12s %12s %14s %14s %8s %8s  %s\n",
+               "Name", "Start", "Sectors", "Size", "Stored", "Ratio", "Chunks", "Encoding");
+
+        for (uint32_t i = 0; i < table->Count; ++i) {
+                dmg_partition *part = &table->Partitions[i];
+                uint64_t size = part->SectorCount * SECTOR_SIZE;
+                uint32_t seen = 0, types[8];
+                char encoding[64] = "";
+
+                // Distinct chunk encodings, in order of first appearance
+                for (uint32_t c = 0; c < part->NumberOfChunks; ++c) {
+                        uint32_t type = part->Chunks[c].EntryType, t;
+
+                        for (t = 0; t < seen && types[t] != type; ++t)
+                                ;
+                        if (t == seen && seen < sizeof(types) / sizeof(types[0])) {
+                                types[seen++] = type;
+                                snprintf(encoding + strlen(encoding), sizeof(encoding) - strlen(encoding),
+                                         "%s%s", seen > 1 ? "," : "", chunkTypeName(type));
+                        }
+                }
+
+                printf("  %2u  %-44.44s %12lu %12lu %14lu %14lu ", part->ID, part->Name,
+                       part->SectorNumber, part->SectorCount, size, part->CompressedBytes);
+
+                if (part->CompressedBytes)
+                        printf("%7.2fx", (double)size / part->CompressedBytes);
+                else
+                        printf("%8s", "-");
+
+                printf(" %8u  %s\n", part->NumberOfChunks, encoding);
+        }
+}
@@ -0,0 +1,115 @@
+// popcount.c : Counts the allocated blocks of space manager bitmaps.
+//
+//   The AVX2 path looks up the bit count of each nibble with a byte shuffle
+//   and sums the bytes with SAD, 32 bytes per step (Mula's method). Words
+//   left over, and CPUs without AVX2, use POPCNT or a portable fallback.
+
+#include "popcount.h"
+
+// _mm_popcnt_u64 and _mm256_extract_epi64 need 64-bit mode
+#ifdef __x86_64__
+#include <immintrin.h>
+#define POPCOUNT_HAVE_X86 1
+#endif
+
+enum { POPCOUNT_PORTABLE, POPCOUNT_POPCNT, POPCOUNT_AVX2 };
+
+static uint64_t popcountPortable(const uint64_t *words, size_t count)
+{
+        uint64_t total = 0;
+
+        for (size_t i = 0; i < count; ++i) {
+                uint64_t x = words[i];
+
+                x = x - ((x >> 1) & 0x5555555555555555ULL);
+                x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+                x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+                total += (x * 0x0101010101010101ULL) >> 56;
+        }
+
+        return total;
+}
+
+#ifdef POPCOUNT_HAVE_X86
+__attribute__((target("popcnt")))
+static uint64_t popcountPopcnt(const uint64_t *words, size_t count)
+{
+        uint64_t total = 0;
+
+        for (size_t i = 0; i < count; ++i)
+                total += _mm_popcnt_u64(words[i]);
+
+        return total;
+}
+
+__attribute__((target("avx2,popcnt")))
+static uint64_t popcountAvx2(const uint64_t *words, size_t count)
+{
+        const __m256i lookup = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i low = _mm256_set1_epi8(0x0f);
+        __m256i sums = _mm256_setzero_si256();
+        uint64_t total = 0;
+        size_t i = 0;
+
+        while (i + 4 <= count) {
+                __m256i bytes = _mm256_setzero_si256();
+
+                // Byte counters hold at most 8 per step, so 31 steps cannot overflow them
+                for (int step = 0; step < 31 && i + 4 <= count; ++step, i += 4) {
+                        __m256i v = _mm256_loadu_si256((const __m256i*)(words + i));
+                        __m256i lo = _mm256_shuffle_epi8(lookup, _mm256_and_si256(v, low));
+                        __m256i hi = _mm256_shuffle_epi8(lookup, _mm256_and_si256(_mm256_srli_epi16(v, 4), low));
+
+                        bytes = _mm256_add_epi8(bytes, _mm256_add_epi8(lo, hi));
+                }
+                sums = _mm256_add_epi64(sums, _mm256_sad_epu8(bytes, _mm256_setzero_si256()));
+        }
+
+        total = (uint64_t)_mm256_extract_epi64(sums, 0) + (uint64_t)_mm256_extract_epi64(sums, 1) +
+                (uint64_t)_mm256_extract_epi64(sums, 2) + (uint64_t)_mm256_extract_epi64(sums, 3);
+
+        for (; i < count; ++i)
+                total += _mm_popcnt_u64(words[i]);
+
+        return total;
+}
+#endif
+
+static int popcountSelect(void)
+{
+        static int selected = -1;
+
+        if (selected < 0) {
+                selected = POPCOUNT_PORTABLE;
+#ifdef POPCOUNT_HAVE_X86
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt"))
+                        selected = POPCOUNT_AVX2;
+                else if (__builtin_cpu_supports("popcnt"))
+                        selected = POPCOUNT_POPCNT;
+#endif
+        }
+
+        return selected;
+}
+
+uint64_t popcountWords(const uint64_t *words, size_t count)
+{
+        switch (popcountSelect()) {
+#ifdef POPCOUNT_HAVE_X86
+                case POPCOUNT_AVX2:     return popcountAvx2(words, count);
+                case POPCOUNT_POPCNT:   return popcountPopcnt(words, count);
+#endif
+                default:                return popcountPortable(words, count);
+        }
+}
+
+const char* popcountImplementation(void)
+{
+        switch (popcountSelect()) {
+                case POPCOUNT_AVX2:     return "avx2";
+                case POPCOUNT_POPCNT:   return "popcnt";
+                default:                return "portable";
+        }
+}
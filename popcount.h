@@ -0,0 +1,11 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Set bits in an array of 64-bit words, for the space manager bitmaps.
+ * AVX2 nibble lookups are used when the CPU supports them, then POPCNT,
+ * then a portable bit-slicing fallback.
+ */
+uint64_t popcountWords(const uint64_t*, size_t);
+const char* popcountImplementation(void);
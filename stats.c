@@ -0,0 +1,282 @@
+// stats.c : Phase timers and I/O counters behind --stats.
+//
+//   Timers accumulate, so a phase that runs many times (extent copies) is
+//   reported as its total time and number of runs. The APFS image and the
+//   extracted files are opened through statsFopen(), which counts the read,
+//   write and seek system calls stdio really issues on them.
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <time.h>
+#include <unistd.h>
+#include "apfs.h"
+#include "libapfsspy.h"
+#include "stats.h"
+
+int statsEnabled;
+uint64_t statsCounters[STATS_COUNTERS];
+
+static enum stats_format statsFormat;
+
+static struct {
+        double started;         // Start of the current run, 0 when not running
+        double total;
+        uint64_t runs;
+} statsTimers[STATS_PHASES];
+
+static const char *phaseNames[STATS_PHASES] = {
+        "map", "plist", "inflate", "verify", "container", "volume", "fs_walk", "extent_copy"
+};
+
+static const char *counterNames[STATS_COUNTERS] = {
+        "bytes_read", "bytes_written", "syscalls", "blocks_fetched", "chunks", "omap_lookups",
+        "btree_nodes", "cache_hits", "cache_misses",
+        "free_skipped"
+};
+
+/* Stream behind statsFopen() */
+typedef struct {
+        int fd;
+        off64_t pos;
+} stats_stream;
+
+static double now(void)
+{
+        struct timespec ts;
+
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+void statsStart(enum stats_phase phase)
+{
+        statsTimers[phase].started = now();
+}
+
+void statsStop(enum stats_phase phase)
+{
+        if (statsTimers[phase].started == 0)
+                return;
+
+        statsTimers[phase].total += now() - statsTimers[phase].started;
+        statsTimers[phase].started = 0;
+        statsTimers[phase].runs++;
+}
+
+static void timerMerge(enum stats_phase phase, const apfs_timer *timer)
+{
+        statsTimers[phase].total += timer->seconds;
+        statsTimers[phase].runs += timer->runs;
+}
+
+// Adds the counters and timers of libapfsspy contexts to the report
+void statsMerge(const apfs_stats *stats)
+{
+        if (!statsEnabled)
+                return;
+
+        statsCounters[STATS_BYTES_READ] += stats->bytes_read;
+        statsCounters[STATS_SYSCALLS] += stats->syscalls;
+        statsCounters[STATS_BLOCKS_FETCHED] += stats->blocks_fetched;
+        statsCounters[STATS_CHUNKS] += stats->chunks;
+        statsCounters[STATS_OMAP_LOOKUPS] += stats->omap_lookups;
+        statsCounters[STATS_BTREE_NODES] += stats->btree_nodes;
+
+        timerMerge(STATS_MAP, &stats->map);
+        timerMerge(STATS_PLIST, &stats->plist);
+        timerMerge(STATS_INFLATE, &stats->inflate);
+        timerMerge(STATS_CONTAINER, &stats->container);
+}
+
+// Merges one context, just before it is closed
+void statsMergeContext(apfs_ctx *ctx)
+{
+        apfs_stats stats;
+
+        if (!statsEnabled || ctx == NULL)
+                return;
+
+        memset(&stats, 0, sizeof(stats));
+        apfs_stats_add(ctx, &stats);
+        statsMerge(&stats);
+}
+
+static ssize_t statsStreamRead(void *cookie, char *buf, size_t size)
+{
+        stats_stream *stream = (stats_stream*)cookie;
+        ssize_t got = pread(stream->fd, buf, size, stream->pos);
+
+        statsCounters[STATS_SYSCALLS]++;
+
+        if (got > 0) {
+                statsCounters[STATS_BYTES_READ] += got;
+                statsCounters[STATS_BLOCKS_FETCHED] += (stream->pos + got - 1) / BLK_SIZE - stream->pos / BLK_SIZE + 1;
+                stream->pos += got;
+        }
+
+        return got;
+}
+
+static ssize_t statsStreamWrite(void *cookie, const char *buf, size_t size)
+{
+        stats_stream *stream = (stats_stream*)cookie;
+        ssize_t put = write(stream->fd, buf, size);
+
+        statsCounters[STATS_SYSCALLS]++;
+
+        if (put > 0) {
+                statsCounters[STATS_BYTES_WRITTEN] += put;
+                stream->pos += put;
+        }
+
+        return put;
+}
+
+// Reads are positional, so a seek only moves the cursor
+static int statsStreamSeek(void *cookie, off64_t *offset, int whence)
+{
+        stats_stream *stream = (stats_stream*)cookie;
+
+        if (whence == SEEK_SET) {
+                stream->pos = *offset;
+        } else if (whence == SEEK_CUR) {
+                stream->pos += *offset;
+        } else {
+                off64_t end = lseek(stream->fd, 0, SEEK_END);
+
+                statsCounters[STATS_SYSCALLS]++;
+                if (end < 0)
+                        return -1;
+                stream->pos = end + *offset;
+        }
+
+        *offset = stream->pos;
+        return 0;
+}
+
+static int statsStreamClose(void *cookie)
+{
+        stats_stream *stream = (stats_stream*)cookie;
+        int ret = close(stream->fd);
+
+        statsCounters[STATS_SYSCALLS]++;
+        free(stream);
+
+        return ret;
+}
+
+/*
+   Input Parameters: char*, char*
+   Return Type:      FILE*
+Description: fopen() for the files the APFS parser reads and writes. With
+--stats the stream is backed by counting callbacks; modes "r", "w" and "a"
+are supported.
+
+ */
+FILE* statsFopen(const char *filename, const char *mode)
+{
+        cookie_io_functions_t io = { statsStreamRead, statsStreamWrite, statsStreamSeek, statsStreamClose };
+        stats_stream *stream;
+        FILE *file;
+        int flags = O_RDONLY;
+
+        if (!statsEnabled)
+                return fopen(filename, mode);
+
+        if (mode[0] == 'w')
+                flags = O_WRONLY | O_CREAT | O_TRUNC;
+        else if (mode[0] == 'a')
+                flags = O_WRONLY | O_CREAT | O_APPEND;
+
+        if ((stream = (stats_stream*)calloc(1, sizeof(stats_stream))) == NULL)
+                return NULL;
+
+        statsCounters[STATS_SYSCALLS]++;
+        if ((stream->fd = open(filename, flags, 0644)) < 0) {
+                free(stream);
+                return NULL;
+        }
+
+        if ((file = fopencookie(stream, mode, io)) == NULL)
+                statsStreamClose(stream);
+
+        return file;
+}
+
+static void statsPrintTable(FILE *out)
+{
+        uint64_t partitions = statsCounters[STATS_CACHE_HITS] + statsCounters[STATS_CACHE_MISSES];
+
+        fprintf(out, "\n%-16s %12s %8s\n", "Phase", "Seconds", "Runs");
+        for (int i = 0; i < STATS_PHASES; ++i)
+                if (statsTimers[i].runs)
+                        fprintf(out, "%-16s %12.6f %8lu\n", phaseNames[i], statsTimers[i].total, statsTimers[i].runs);
+
+        fprintf(out, "\n%-16s %12s\n", "Counter", "Value");
+        for (int i = 0; i < STATS_COUNTERS; ++i)
+                fprintf(out, "%-16s %12lu\n", counterNames[i], statsCounters[i]);
+
+        if (partitions)
+                fprintf(out, "\n%-16s %11.1f%%\n", "cache hits", 100.0 * statsCounters[STATS_CACHE_HITS] / partitions);
+}
+
+static void statsPrintJson(FILE *out)
+{
+        fprintf(out, "{\n  \"phases\": {");
+        for (int i = 0, first = 1; i < STATS_PHASES; ++i) {
+                if (!statsTimers[i].runs)
+                        continue;
+                fprintf(out, "%s\n    \"%s\": { \"seconds\": %.6f, \"runs\": %lu }", first ? "" : ",",
+                        phaseNames[i], statsTimers[i].total, statsTimers[i].runs);
+                first = 0;
+        }
+
+        fprintf(out, "\n  },\n  \"counters\": {");
+        for (int i = 0; i < STATS_COUNTERS; ++i)
+                fprintf(out, "%s\n    \"%s\": %lu", i ? "," : "", counterNames[i], statsCounters[i]);
+        fprintf(out, "\n  }\n}\n");
+}
+
+// Writes s as a quoted JSON string; every JSON report goes through it
+void printJsonString(FILE *out, const char *s)
+{
+        fputc('"', out);
+        for (; *s; ++s) {
+                unsigned char c = (unsigned char)*s;
+
+                if (c == '"' || c == '\\')
+                        fprintf(out, "\\%c", c);
+                else if (c < 0x20)
+                        fprintf(out, "\\u%04x", c);
+                else
+                        fputc(c, out);
+        }
+        fputc('"', out);
+}
+
+// Registered with atexit(): the FS walk may end the process on its own
+static void statsReport(void)
+{
+        fflush(stdout);
+
+        for (int i = 0; i < STATS_PHASES; ++i)
+                statsStop(i);
+
+        if (statsFormat == STATS_JSON)
+                statsPrintJson(stderr);
+        else
+                statsPrintTable(stderr);
+}
+
+void statsInit(enum stats_format format)
+{
+        if (format == STATS_OFF)
+                return;
+
+        statsFormat = format;
+        statsEnabled = 1;
+        atexit(statsReport);
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <stdio.h>
+#include <stdint.h>
+
+/*
+ * Per-phase timers and counters, reported at exit with --stats.
+ *
+ * Everything is guarded by statsEnabled, so a run without --stats pays one
+ * predictable branch per instrumented site and never reads the clock.
+ * libapfsspy keeps its own counters per context instead (apfs_stats_add);
+ * statsMerge adds them to the report before the context is closed.
+ */
+
+enum stats_phase {
+        STATS_MAP,              // Mapping the DMG and reading the trailer
+        STATS_PLIST,            // Scanning the plist into the partition table
+        STATS_INFLATE,          // Expanding the partition
+        STATS_VERIFY,           // --verify
+        STATS_CONTAINER,        // Container superblock and omap
+        STATS_VOLUME,           // Volume superblock and omap
+        STATS_FS_WALK,          // Walking the FS-Tree, extent copies included
+        STATS_EXTENT_COPY,      // Copying file extents out of the image
+        STATS_PHASES
+};
+
+enum stats_counter {
+        STATS_BYTES_READ,
+        STATS_BYTES_WRITTEN,
+        STATS_SYSCALLS,
+        STATS_BLOCKS_FETCHED,   // Image blocks covered by reads of the APFS image
+        STATS_CHUNKS,           // DMG chunks expanded
+        STATS_OMAP_LOOKUPS,
+        STATS_BTREE_NODES,      // B-Tree nodes visited, omap and FS-Tree
+        STATS_CACHE_HITS,       // Partitions served from --cache-dir
+        STATS_CACHE_MISSES,
+        STATS_FREE_SKIPPED,     // DMG chunks left as holes because the space manager marks them free
+        STATS_COUNTERS
+};
+
+enum stats_format { STATS_OFF, STATS_TABLE, STATS_JSON };
+
+extern int statsEnabled;
+extern uint64_t statsCounters[STATS_COUNTERS];
+
+#define STATS_ADD(counter, n)   do { if (statsEnabled) statsCounters[counter] += (n); } while (0)
+#define STATS_START(phase)      do { if (statsEnabled) statsStart(phase); } while (0)
+#define STATS_STOP(phase)       do { if (statsEnabled) statsStop(phase); } while (0)
+
+void statsInit(enum stats_format);
+void statsStart(enum stats_phase);
+void statsStop(enum stats_phase);
+FILE* statsFopen(const char*, const char*);
+struct apfs_ctx;
+struct apfs_stats;
+void statsMerge(const struct apfs_stats*);
+void statsMergeContext(struct apfs_ctx*);
+void printJsonString(FILE*, const char*);
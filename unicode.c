@@ -0,0 +1,213 @@
+// unicode.c : Canonical decomposition and case folding of file names.
+//
+//   Every code point is looked up in two stages, cp >> 7 then cp & 127, to a
+//   record holding its combining class, its decomposition and its folded
+//   decomposition; Hangul syllables are decomposed arithmetically. Runs of
+//   ASCII, the bulk of real names, skip the tables: 16 bytes at a time with
+//   SSE2 they are checked, folded and widened to code points in registers.
+
+#include <string.h>
+#include "unicode.h"
+#include "unicodeTables.h"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#define HANGUL_S_BASE           0xac00
+#define HANGUL_L_BASE           0x1100
+#define HANGUL_V_BASE           0x1161
+#define HANGUL_T_BASE           0x11a7
+#define HANGUL_T_COUNT          28
+#define HANGUL_N_COUNT          588             // Vowels times trailing consonants
+#define HANGUL_S_COUNT          11172
+
+#define YPOGEGRAMMENI           0x0345          // Combining mark that folds to a starter, U+03B9
+#define NAME_MAX_CODE_POINTS    (1024 * UNICODE_EXPANSION)      // Names are at most 1023 bytes
+
+static const unicode_record* lookup(uint32_t cp)
+{
+        if (cp >= UNICODE_TABLE_LIMIT)
+                return &unicodeRecords[0];
+
+        return &unicodeRecords[unicodeStage2[unicodeStage1[cp >> 7] * 128 + (cp & 127)]];
+}
+
+/*
+ * Next code point of a UTF-8 string; a byte that does not start a valid
+ * sequence stands for itself, as it would in a name stored by a broken
+ * client.
+ */
+static uint32_t utf8Next(const uint8_t **p, const uint8_t *end)
+{
+        const uint8_t *s = *p;
+        uint32_t cp = *s;
+        int extra = cp >= 0xf0 ? 3 : cp >= 0xe0 ? 2 : cp >= 0xc0 ? 1 : 0;
+
+        if (cp < 0xc0 || cp > 0xf4 || end - s <= extra) {
+                *p = s + 1;
+                return cp;
+        }
+
+        cp &= 0x3f >> extra;
+        for (int i = 1; i <= extra; ++i) {
+                if ((s[i] & 0xc0) != 0x80) {
+                        *p = s + 1;
+                        return *s;
+                }
+                cp = (cp << 6) | (s[i] & 0x3f);
+        }
+
+        *p = s + extra + 1;
+        return cp;
+}
+
+static inline size_t put(uint32_t *out, size_t cap, size_t n, uint32_t cp)
+{
+        if (n < cap)
+                out[n] = cp;
+        return n + 1;
+}
+
+#ifdef __SSE2__
+// Folds and widens 16 ASCII bytes; 0 if one of them is not ASCII
+static int asciiBlock(const uint8_t *p, int fold, uint32_t *out)
+{
+        const __m128i zero = _mm_setzero_si128();
+        __m128i v = _mm_loadu_si128((const __m128i*)p), low, high;
+
+        if (_mm_movemask_epi8(v))
+                return 0;
+
+        if (fold) {
+                __m128i upper = _mm_and_si128(_mm_cmpgt_epi8(v, _mm_set1_epi8('A' - 1)),
+                                              _mm_cmplt_epi8(v, _mm_set1_epi8('Z' + 1)));
+
+                v = _mm_add_epi8(v, _mm_and_si128(upper, _mm_set1_epi8('a' - 'A')));
+        }
+
+        low = _mm_unpacklo_epi8(v, zero);
+        high = _mm_unpackhi_epi8(v, zero);
+        _mm_storeu_si128((__m128i*)out, _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128((__m128i*)(out + 4), _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128((__m128i*)(out + 8), _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128((__m128i*)(out + 12), _mm_unpackhi_epi16(high, zero));
+        return 1;
+}
+#endif
+
+// Canonical ordering: combining marks between two starters sorted by class, stably
+static void reorder(uint32_t *cps, size_t count)
+{
+        for (size_t i = 1; i < count; ++i) {
+                uint32_t cp = cps[i];
+                uint8_t ccc = lookup(cp)->ccc;
+                size_t j = i;
+
+                if (ccc == 0)
+                        continue;
+                while (j > 0 && lookup(cps[j - 1])->ccc > ccc) {
+                        cps[j] = cps[j - 1];
+                        j--;
+                }
+                cps[j] = cp;
+        }
+}
+
+/*
+   Input Parameters: char* name, size_t, int fold, uint32_t* out, size_t cap
+   Return Type:      size_t
+Description: Decomposes a UTF-8 name into out, case-folding it first when
+fold is set, and puts the combining marks in canonical order. Returns the
+number of code points of the result; only the first cap are written, so a
+return above cap means out was too small.
+
+ */
+size_t unicodeNormalize(const char *name, size_t len, int fold, uint32_t *out, size_t cap)
+{
+        const uint8_t *p = (const uint8_t*)name, *end = p + len;
+        int marks = 0;
+        size_t n = 0;
+
+        while (p < end) {
+                const unicode_record *record;
+                uint32_t cp;
+
+                if (*p < 0x80) {
+#ifdef __SSE2__
+                        if (end - p >= 16 && n + 16 <= cap && asciiBlock(p, fold, out + n)) {
+                                p += 16;
+                                n += 16;
+                                continue;
+                        }
+#endif
+                        cp = *p++;
+                        if (fold && cp >= 'A' && cp <= 'Z')
+                                cp += 'a' - 'A';
+                        n = put(out, cap, n, cp);
+                        continue;
+                }
+
+                cp = utf8Next(&p, end);
+                marks = 1;
+
+                if (cp - HANGUL_S_BASE < HANGUL_S_COUNT) {
+                        uint32_t s = cp - HANGUL_S_BASE;
+
+                        n = put(out, cap, n, HANGUL_L_BASE + s / HANGUL_N_COUNT);
+                        n = put(out, cap, n, HANGUL_V_BASE + (s % HANGUL_N_COUNT) / HANGUL_T_COUNT);
+                        if (s % HANGUL_T_COUNT)
+                                n = put(out, cap, n, HANGUL_T_BASE + s % HANGUL_T_COUNT);
+                        continue;
+                }
+
+                record = lookup(cp);
+                if (fold && record->foldLen) {
+                        for (uint8_t i = 0; i < record->foldLen; ++i)
+                                n = put(out, cap, n, unicodePool[record->fold + i]);
+                } else if (record->nfdLen) {
+                        for (uint8_t i = 0; i < record->nfdLen; ++i)
+                                n = put(out, cap, n, unicodePool[record->nfd + i]);
+                } else {
+                        n = put(out, cap, n, cp);
+                }
+        }
+
+        if (marks) {
+                size_t count = n < cap ? n : cap;
+
+                reorder(out, count);
+                // U+0345 sorts after every other mark, it becomes a starter without reordering again
+                for (size_t i = 0; fold && i < count; ++i)
+                        if (out[i] == YPOGEGRAMMENI)
+                                out[i] = 0x03b9;
+        }
+
+        return n;
+}
+
+// Whether two names are the same once normalized, and folded if fold is set
+int unicodeNameEqual(const char *a, size_t aLen, const char *b, size_t bLen, int fold)
+{
+        uint32_t first[NAME_MAX_CODE_POINTS], second[NAME_MAX_CODE_POINTS];
+        size_t firstCount, secondCount;
+
+        if (aLen == bLen && memcmp(a, b, aLen) == 0)
+                return 1;
+
+        firstCount = unicodeNormalize(a, aLen, fold, first, NAME_MAX_CODE_POINTS);
+        secondCount = unicodeNormalize(b, bLen, fold, second, NAME_MAX_CODE_POINTS);
+        if (firstCount > NAME_MAX_CODE_POINTS || secondCount > NAME_MAX_CODE_POINTS)
+                return 0;
+
+        return firstCount == secondCount && memcmp(first, second, firstCount * sizeof(first[0])) == 0;
+}
+
+const char* unicodeImplementation(void)
+{
+#ifdef __SSE2__
+        return "sse2";
+#else
+        return "portable";
+#endif
+}
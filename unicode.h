@@ -0,0 +1,16 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Names as APFS hashes and compares them on normalization-insensitive and
+ * case-insensitive volumes: UTF-8 decoded to code points, case-folded when
+ * asked for, canonically decomposed (NFD) and reordered. A name needs at
+ * most UNICODE_EXPANSION code points per byte of UTF-8.
+ */
+
+#define UNICODE_EXPANSION       2
+
+size_t unicodeNormalize(const char*, size_t, int, uint32_t*, size_t);
+int unicodeNameEqual(const char*, size_t, const char*, size_t, int);
+const char* unicodeImplementation(void);
@@ -0,0 +1,2526 @@
+// unicodeTables.h : Unicode 14.0.0 character data for unicode.c.
+//
+//   Generated from the Unicode Character Database: for every code point
+//   below U+30000 (Hangul syllables excepted, they decompose arithmetically)
+//   the canonical combining class, the full canonical decomposition (NFD)
+//   and NFD(full case folding(NFD)), the latter only where it differs and
+//   with U+0345 left unfolded (it is a mark, unicode.c folds it after the
+//   canonical reordering).
+//   unicodeStage1 maps cp >> 7 to a block of unicodeStage2, whose entries
+//   index unicodeRecords; record 0 is a starter that maps to itself.
+
+#define UNICODE_TABLE_LIMIT     0x30000
+
+typedef struct {
+        uint8_t ccc;                    // Canonical combining class
+        uint8_t nfdLen;
+        uint8_t foldLen;
+        uint16_t nfd;                   // Offsets into unicodePool
+        uint16_t fold;
+} unicode_record;
+
+static const uint16_t unicodeStage1[1536] = {
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+        32, 33, 5, 5, 5, 5, 34, 35, 5, 5, 5, 5, 5, 5, 36, 37,
+        5, 38, 39, 5, 40, 41, 42, 43, 44, 45, 5, 46, 47, 48, 49, 50,
+        51, 52, 53, 54, 55, 56, 57, 5, 5, 58, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 59, 5, 5, 60, 61, 62, 63, 5, 5, 5, 5,
+        64, 65, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 66, 67, 68, 69,
+        70, 71, 72, 73, 5, 74, 75, 76, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 77, 78, 79, 80, 81, 5, 5, 5, 5, 5, 82, 5, 83, 5,
+        5, 5, 5, 84, 5, 85, 86, 5, 87, 88, 89, 90, 5, 5, 5, 5,
+        5, 5, 5, 5, 91, 92, 5, 5, 5, 93, 94, 5, 5, 95, 96, 97,
+        98, 99, 100, 101, 102, 103, 104, 5, 105, 106, 5, 107, 108, 109, 110, 5,
+        111, 112, 113, 114, 115, 116, 5, 5, 108, 5, 117, 118, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 119, 120, 5, 5, 5, 5, 5, 121, 5, 5, 122,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 123, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 124, 125, 126, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        127, 5, 120, 5, 5, 128, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 129, 130, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+        131, 132, 133, 134, 135, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+};
+
+static const uint16_t unicodeStage2[17408] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43,
+        44, 45, 46, 47, 48, 49, 50, 0, 51, 52, 53, 54, 55, 56, 57, 58,
+        59, 60, 61, 62, 63, 64, 0, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+        0, 74, 75, 76, 77, 78, 79, 0, 0, 80, 81, 82, 83, 84, 0, 85,
+        86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101,
+        102, 0, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116,
+        117, 118, 119, 120, 121, 122, 123, 0, 124, 125, 126, 127, 128, 129, 130, 131,
+        132, 0, 133, 0, 134, 135, 136, 137, 0, 138, 139, 140, 141, 142, 143, 144,
+        0, 145, 0, 146, 147, 148, 149, 150, 151, 152, 153, 0, 154, 155, 156, 157,
+        158, 159, 160, 0, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172,
+        173, 174, 175, 176, 177, 178, 179, 0, 180, 181, 182, 183, 184, 185, 186, 187,
+        188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 19,
+        0, 203, 204, 0, 205, 0, 206, 207, 0, 208, 209, 210, 0, 0, 211, 212,
+        213, 214, 0, 215, 216, 0, 217, 218, 219, 0, 0, 0, 220, 221, 0, 222,
+        223, 224, 225, 0, 226, 0, 227, 228, 0, 229, 0, 0, 230, 0, 231, 232,
+        233, 234, 235, 236, 0, 237, 0, 238, 239, 0, 0, 0, 240, 0, 0, 0,
+        0, 0, 0, 0, 241, 241, 0, 242, 242, 0, 243, 243, 0, 244, 245, 246,
+        247, 248, 249, 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 0, 260, 261,
+        262, 263, 264, 265, 266, 0, 267, 268, 269, 270, 271, 272, 273, 274, 275, 276,
+        277, 278, 278, 0, 279, 280, 281, 282, 283, 284, 285, 286, 287, 288, 289, 290,
+        291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301, 302, 303, 304, 305, 306,
+        307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317, 318, 319, 0, 320, 321,
+        322, 0, 323, 0, 324, 0, 325, 326, 327, 328, 329, 330, 331, 332, 333, 334,
+        335, 336, 337, 338, 0, 0, 0, 0, 0, 0, 339, 340, 0, 341, 342, 0,
+        0, 343, 0, 344, 345, 346, 347, 0, 348, 0, 349, 0, 350, 0, 351, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352,
+        352, 352, 352, 352, 352, 353, 354, 354, 354, 354, 353, 355, 354, 354, 354, 354,
+        354, 356, 356, 354, 354, 354, 354, 356, 356, 354, 354, 354, 354, 354, 354, 354,
+        354, 354, 354, 354, 357, 357, 357, 357, 357, 354, 354, 354, 354, 352, 352, 352,
+        358, 359, 352, 360, 361, 362, 352, 354, 354, 354, 352, 352, 352, 354, 354, 0,
+        352, 352, 352, 354, 354, 354, 354, 352, 353, 354, 354, 352, 363, 364, 364, 363,
+        364, 364, 363, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352,
+        365, 0, 366, 0, 367, 0, 368, 0, 0, 0, 0, 0, 0, 0, 369, 370,
+        0, 0, 0, 0, 0, 371, 372, 373, 374, 375, 376, 0, 377, 0, 378, 379,
+        380, 381, 382, 383, 384, 385, 386, 387, 388, 389, 390, 391, 27, 392, 393, 394,
+        395, 396, 0, 397, 398, 399, 400, 401, 402, 403, 404, 405, 406, 407, 408, 409,
+        410, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 397, 0, 0, 0, 0, 0, 0, 0, 411, 412, 413, 414, 415, 416,
+        382, 388, 0, 417, 418, 400, 395, 0, 419, 0, 420, 0, 421, 0, 422, 0,
+        423, 0, 424, 0, 425, 0, 426, 0, 427, 0, 428, 0, 429, 0, 430, 0,
+        390, 396, 0, 0, 388, 385, 0, 431, 0, 432, 433, 0, 0, 434, 435, 436,
+        437, 438, 439, 440, 441, 442, 443, 444, 445, 446, 447, 448, 449, 450, 451, 452,
+        453, 454, 455, 456, 457, 458, 459, 460, 461, 462, 463, 464, 465, 466, 467, 468,
+        469, 470, 471, 472, 473, 474, 475, 476, 477, 478, 479, 480, 481, 482, 483, 484,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 485, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        486, 487, 0, 488, 0, 0, 0, 489, 0, 0, 0, 0, 490, 491, 492, 0,
+        493, 0, 494, 0, 495, 0, 496, 0, 497, 0, 498, 0, 499, 0, 500, 0,
+        501, 0, 502, 0, 503, 0, 504, 505, 506, 0, 507, 0, 508, 0, 509, 0,
+        510, 0, 0, 352, 352, 352, 352, 352, 0, 0, 511, 0, 512, 0, 513, 0,
+        514, 0, 515, 0, 516, 0, 517, 0, 518, 0, 519, 0, 520, 0, 521, 0,
+        522, 0, 523, 0, 524, 0, 525, 0, 526, 0, 527, 0, 528, 0, 529, 0,
+        530, 0, 531, 0, 532, 0, 533, 0, 534, 0, 535, 0, 536, 0, 537, 0,
+        538, 539, 540, 541, 0, 542, 0, 543, 0, 544, 0, 545, 0, 546, 0, 0,
+        547, 548, 549, 550, 551, 0, 552, 553, 554, 0, 555, 556, 557, 558, 559, 560,
+        561, 0, 562, 563, 564, 565, 566, 567, 568, 0, 569, 570, 571, 572, 573, 574,
+        575, 576, 577, 578, 579, 580, 581, 0, 582, 583, 584, 0, 585, 0, 586, 0,
+        587, 0, 588, 0, 589, 0, 590, 0, 591, 0, 592, 0, 593, 0, 594, 0,
+        595, 0, 596, 0, 597, 0, 598, 0, 599, 0, 600, 0, 601, 0, 602, 0,
+        603, 0, 604, 0, 605, 0, 606, 0, 607, 0, 608, 0, 609, 0, 610, 0,
+        0, 611, 612, 613, 614, 615, 616, 617, 618, 619, 620, 621, 622, 623, 624, 625,
+        626, 627, 628, 629, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641,
+        642, 643, 644, 645, 646, 647, 648, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 649, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 354, 352, 352, 352, 352, 354, 352, 352, 352, 650, 354, 352, 352, 352, 352,
+        352, 352, 354, 354, 354, 354, 354, 354, 352, 352, 354, 352, 352, 650, 651, 352,
+        652, 653, 654, 655, 656, 657, 658, 659, 660, 661, 661, 662, 663, 664, 0, 665,
+        0, 666, 667, 0, 352, 354, 0, 660, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        352, 352, 352, 352, 352, 352, 352, 352, 668, 669, 670, 0, 0, 0, 0, 0,
+        0, 0, 671, 672, 673, 674, 675, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 676, 677, 678, 668, 669,
+        670, 679, 680, 352, 352, 354, 354, 352, 352, 352, 352, 352, 354, 352, 352, 354,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        681, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        682, 0, 683, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 684, 0, 0, 352, 352, 352, 352, 352, 352, 352, 0, 0, 352,
+        352, 352, 352, 354, 352, 0, 0, 352, 352, 0, 354, 352, 352, 354, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 685, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        352, 354, 352, 352, 354, 352, 352, 354, 354, 354, 352, 354, 354, 352, 354, 352,
+        352, 352, 354, 352, 354, 352, 354, 352, 354, 352, 352, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 352, 352, 352, 352, 352,
+        352, 352, 354, 352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 352, 352, 352, 352, 0, 352, 352, 352, 352, 352,
+        352, 352, 352, 352, 0, 352, 352, 352, 0, 352, 352, 352, 352, 352, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 354, 354, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 352, 354, 354, 354, 352, 352, 352, 352,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 352, 352, 352, 352, 352, 354,
+        354, 354, 354, 354, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352,
+        352, 352, 0, 354, 352, 352, 354, 352, 352, 354, 352, 352, 352, 354, 354, 354,
+        676, 677, 678, 352, 352, 352, 354, 352, 352, 354, 354, 352, 352, 352, 352, 352,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 686, 0, 0, 0, 0, 0, 0,
+        0, 687, 0, 0, 688, 0, 0, 0, 0, 0, 0, 0, 689, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 690, 0, 0,
+        0, 352, 354, 352, 352, 0, 0, 0, 691, 692, 693, 694, 695, 696, 697, 698,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 689, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 699, 700, 690, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 701, 702, 0, 703,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 352, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 704, 0, 0, 705, 0, 0, 0, 0, 0, 689, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 690, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 706, 707, 708, 0, 0, 709, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 689, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 690, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 689, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 710, 0, 0, 711, 712, 690, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 713, 714, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 715, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 716, 717, 718, 690, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 689, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 719, 0, 0, 0, 0, 690, 0, 0,
+        0, 0, 0, 0, 0, 720, 721, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 689, 0, 0, 0,
+        722, 0, 0, 0, 0, 0, 0, 723, 724, 0, 725, 726, 0, 690, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 690, 690, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 727, 728, 729, 690, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 690, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 730, 0, 731, 732, 733, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 734, 734, 690, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 735, 735, 735, 735, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 736, 736, 690, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 737, 737, 737, 737, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 354, 354, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 354, 0, 354, 0, 355, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 738, 0, 0, 0, 0, 0, 0, 0, 0, 0, 739, 0, 0,
+        0, 0, 740, 0, 0, 0, 0, 741, 0, 0, 0, 0, 742, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 743, 0, 0, 0, 0, 0, 0,
+        0, 744, 745, 746, 747, 748, 749, 0, 750, 0, 745, 745, 745, 745, 0, 0,
+        745, 751, 352, 352, 690, 0, 352, 352, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 752, 0, 0, 0, 0, 0, 0, 0, 0, 0, 753, 0, 0,
+        0, 0, 754, 0, 0, 0, 0, 755, 0, 0, 0, 0, 756, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 757, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 758, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 689, 0, 690, 690, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        759, 760, 761, 762, 763, 764, 765, 766, 767, 768, 769, 770, 771, 772, 773, 774,
+        775, 776, 777, 778, 779, 780, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790,
+        791, 792, 793, 794, 795, 796, 0, 797, 0, 0, 0, 0, 0, 798, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 352, 352, 352,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 799, 800, 801, 802, 803, 804, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 690, 690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 352, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 651, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 650, 352, 354, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 352, 354, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 352, 352, 352, 352, 352, 352, 352, 352, 0, 0, 354,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        352, 352, 352, 352, 352, 354, 354, 354, 354, 354, 354, 352, 352, 354, 0, 354,
+        354, 352, 352, 354, 354, 352, 352, 352, 352, 352, 354, 352, 352, 352, 352, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 805, 0, 806, 0, 807, 0, 808, 0, 809, 0,
+        0, 0, 810, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 689, 0, 0, 0, 0, 0, 0, 811, 0, 812, 0, 0,
+        813, 814, 0, 815, 690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 352, 354, 352, 352, 352,
+        352, 352, 352, 352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 690, 690, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 689, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 690, 690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 689, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        455, 457, 467, 470, 471, 471, 479, 494, 816, 0, 0, 0, 0, 0, 0, 0,
+        817, 818, 819, 820, 821, 822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832,
+        833, 834, 835, 836, 837, 838, 839, 840, 841, 842, 843, 844, 845, 846, 847, 848,
+        849, 850, 851, 852, 853, 854, 855, 856, 857, 858, 859, 0, 0, 860, 861, 862,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        352, 352, 352, 0, 357, 354, 354, 354, 354, 354, 352, 352, 354, 354, 354, 354,
+        352, 0, 357, 357, 357, 357, 357, 357, 357, 0, 0, 0, 0, 354, 0, 0,
+        0, 0, 0, 0, 352, 0, 0, 0, 352, 352, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        352, 352, 354, 352, 352, 352, 352, 352, 352, 352, 354, 352, 352, 364, 863, 354,
+        356, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352,
+        352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352,
+        352, 352, 352, 352, 352, 352, 353, 651, 651, 354, 864, 352, 363, 354, 352, 354,
+        865, 866, 867, 868, 869, 870, 871, 872, 873, 874, 875, 876, 877, 878, 879, 880,
+        881, 882, 883, 884, 885, 886, 887, 888, 889, 890, 891, 892, 893, 894, 895, 896,
+        897, 898, 899, 900, 901, 902, 903, 904, 905, 906, 907, 908, 909, 910, 911, 912,
+        913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928,
+        929, 930, 931, 932, 933, 934, 935, 936, 937, 938, 939, 940, 941, 942, 943, 944,
+        945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958, 959, 960,
+        961, 962, 963, 964, 965, 966, 967, 968, 969, 970, 971, 972, 973, 974, 975, 976,
+        977, 978, 979, 980, 981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991, 992,
+        993, 994, 995, 996, 997, 998, 999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008,
+        1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 0, 0, 58, 0,
+        1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036,
+        1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052,
+        1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068,
+        1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084,
+        1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100,
+        1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 0, 1112, 0, 1113, 0,
+        1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128, 1129,
+        1130, 1131, 1132, 1133, 1134, 1135, 0, 0, 1136, 1137, 1138, 1139, 1140, 1141, 0, 0,
+        1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1157,
+        1158, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173,
+        1174, 1175, 1176, 1177, 1178, 1179, 0, 0, 1180, 1181, 1182, 1183, 1184, 1185, 0, 0,
+        1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 0, 1194, 0, 1195, 0, 1196, 0, 1197,
+        1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213,
+        1214, 406, 1215, 407, 1216, 408, 1217, 409, 1218, 413, 1219, 414, 1220, 415, 0, 0,
+        1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236,
+        1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252,
+        1253, 1254, 1255, 1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268,
+        1269, 1270, 1271, 1272, 1273, 0, 1274, 1275, 1276, 1277, 1278, 372, 1279, 0, 1280, 0,
+        0, 1281, 1282, 1283, 1284, 0, 1285, 1286, 1287, 374, 1288, 375, 1289, 1290, 1291, 1292,
+        1293, 1294, 1295, 380, 0, 0, 1296, 1297, 1298, 1299, 1300, 376, 0, 1301, 1302, 1303,
+        1304, 1305, 1306, 410, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 378, 1314, 1315, 371, 1316,
+        0, 0, 1317, 1318, 1319, 0, 1320, 1321, 1322, 377, 1323, 379, 1324, 1325, 0, 0,
+        1326, 1327, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        352, 352, 357, 357, 352, 352, 352, 352, 357, 357, 357, 352, 352, 0, 0, 0,
+        0, 352, 0, 0, 0, 357, 357, 352, 354, 352, 357, 357, 354, 354, 354, 354,
+        352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1328, 0, 0, 0, 1329, 33, 0, 0, 0, 0,
+        0, 0, 1330, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1331, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 1347, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1348, 1349, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1350, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1351, 1352, 1353,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1354, 0, 0, 0, 0, 1355, 0, 0, 1356, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1357, 0, 1358, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 1359, 0, 0, 1360, 0, 0, 1361, 0, 1362, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1363, 0, 1364, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1365, 1366, 1367,
+        1368, 1369, 0, 0, 1370, 1371, 0, 0, 1372, 1373, 0, 0, 0, 0, 0, 0,
+        1374, 1375, 0, 0, 1376, 1377, 0, 0, 1378, 1379, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1380, 1381, 1382, 1383,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1384, 1385, 1386, 1387, 0, 0, 0, 0, 0, 0, 1388, 1389, 1390, 1391, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1392, 1393, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403,
+        1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1420, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1421, 1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436,
+        1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452,
+        1453, 1454, 1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1469, 0, 1470, 1471, 1472, 0, 0, 1473, 0, 1474, 0, 1475, 0, 1476, 1477, 1478,
+        1479, 0, 1480, 0, 0, 1481, 0, 0, 0, 0, 0, 0, 0, 0, 1482, 1483,
+        1484, 0, 1485, 0, 1486, 0, 1487, 0, 1488, 0, 1489, 0, 1490, 0, 1491, 0,
+        1492, 0, 1493, 0, 1494, 0, 1495, 0, 1496, 0, 1497, 0, 1498, 0, 1499, 0,
+        1500, 0, 1501, 0, 1502, 0, 1503, 0, 1504, 0, 1505, 0, 1506, 0, 1507, 0,
+        1508, 0, 1509, 0, 1510, 0, 1511, 0, 1512, 0, 1513, 0, 1514, 0, 1515, 0,
+        1516, 0, 1517, 0, 1518, 0, 1519, 0, 1520, 0, 1521, 0, 1522, 0, 1523, 0,
+        1524, 0, 1525, 0, 1526, 0, 1527, 0, 1528, 0, 1529, 0, 1530, 0, 1531, 0,
+        1532, 0, 1533, 0, 0, 0, 0, 0, 0, 0, 0, 1534, 0, 1535, 0, 352,
+        352, 352, 1536, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 690,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352,
+        352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 864, 651, 353, 650, 1537, 1537,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1538, 0, 1539, 0,
+        1540, 0, 1541, 0, 1542, 0, 1543, 0, 1544, 0, 1545, 0, 1546, 0, 1547, 0,
+        1548, 0, 1549, 0, 0, 1550, 0, 1551, 0, 1552, 0, 0, 0, 0, 0, 0,
+        1553, 1554, 0, 1555, 1556, 0, 1557, 1558, 0, 1559, 1560, 0, 1561, 1562, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1563, 0, 0, 0, 0, 1564, 1564, 0, 0, 0, 1565, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1566, 0, 1567, 0,
+        1568, 0, 1569, 0, 1570, 0, 1571, 0, 1572, 0, 1573, 0, 1574, 0, 1575, 0,
+        1576, 0, 1577, 0, 0, 1578, 0, 1579, 0, 1580, 0, 0, 0, 0, 0, 0,
+        1581, 1582, 0, 1583, 1584, 0, 1585, 1586, 0, 1587, 1588, 0, 1589, 1590, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 1591, 0, 0, 1592, 1593, 1594, 1595, 0, 0, 0, 1596, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1597, 0, 1598, 0, 1599, 0, 1600, 0, 1601, 0, 816, 0, 1602, 0, 1603, 0,
+        1604, 0, 1605, 0, 1606, 0, 1607, 0, 1608, 0, 1609, 0, 1610, 0, 1611, 0,
+        1612, 0, 1613, 0, 1614, 0, 1615, 0, 1616, 0, 1617, 0, 1618, 0, 0, 352,
+        0, 0, 0, 0, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 0, 0,
+        1619, 0, 1620, 0, 1621, 0, 1622, 0, 1623, 0, 1624, 0, 1625, 0, 1626, 0,
+        1627, 0, 1628, 0, 1629, 0, 1630, 0, 1631, 0, 1632, 0, 0, 0, 352, 352,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        352, 352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 1633, 0, 1634, 0, 1635, 0, 1636, 0, 1637, 0, 1638, 0, 1639, 0,
+        0, 0, 1640, 0, 1641, 0, 1642, 0, 1643, 0, 1644, 0, 1645, 0, 1646, 0,
+        1647, 0, 1648, 0, 1649, 0, 1650, 0, 1651, 0, 1652, 0, 1653, 0, 1654, 0,
+        1655, 0, 1656, 0, 1657, 0, 1658, 0, 1659, 0, 1660, 0, 1661, 0, 1662, 0,
+        1663, 0, 1664, 0, 1665, 0, 1666, 0, 1667, 0, 1668, 0, 1669, 0, 1670, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 1671, 0, 1672, 0, 1673, 1674, 0,
+        1675, 0, 1676, 0, 1677, 0, 1678, 0, 0, 0, 0, 1679, 0, 1680, 0, 0,
+        1681, 0, 1682, 0, 0, 0, 1683, 0, 1684, 0, 1685, 0, 1686, 0, 1687, 0,
+        1688, 0, 1689, 0, 1690, 0, 1691, 0, 1692, 0, 1693, 1694, 1695, 1696, 1697, 0,
+        1698, 1699, 1700, 1701, 1702, 0, 1703, 0, 1704, 0, 1705, 0, 1706, 0, 1707, 0,
+        1708, 0, 1709, 0, 1710, 1711, 1712, 1713, 0, 1714, 0, 0, 0, 0, 0, 0,
+        1715, 0, 0, 0, 0, 0, 1716, 0, 1717, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 1718, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 690, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 690, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352, 352,
+        352, 352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 354, 354, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 689, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        352, 0, 352, 352, 354, 0, 0, 352, 352, 0, 0, 0, 0, 0, 352, 352,
+        0, 352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 690, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1719, 1720, 1721, 1722, 1723, 1724, 1725, 1726, 1727, 1728, 1729, 1730, 1731, 1732, 1733, 1734,
+        1735, 1736, 1737, 1738, 1739, 1740, 1741, 1742, 1743, 1744, 1745, 1746, 1747, 1748, 1749, 1750,
+        1751, 1752, 1753, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766,
+        1767, 1768, 1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1780, 1781, 1782,
+        1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1791, 1792, 1793, 1794, 1795, 1796, 1797, 1798,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 690, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1806, 1807, 1808, 1809, 1810, 1811, 1812, 1813,
+        1814, 1815, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826, 1827, 1828, 1829,
+        1830, 1831, 1832, 1833, 1834, 1835, 1836, 1837, 1838, 1839, 1840, 1841, 1842, 1843, 1844, 1845,
+        1846, 1847, 1848, 1849, 1850, 1851, 1852, 1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1861,
+        1862, 1863, 1864, 1865, 1866, 1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1875, 1876, 1877,
+        1878, 1879, 1880, 1881, 1882, 1883, 1884, 1885, 1886, 1887, 1888, 1889, 1818, 1890, 1891, 1892,
+        1893, 1894, 1895, 1896, 1897, 1898, 1899, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908,
+        1909, 1910, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1922, 1923, 1924,
+        1925, 1926, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937, 1938, 1939, 1940,
+        1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1950, 1951, 1952, 1953, 1954, 1955, 1956,
+        1957, 1908, 1958, 1959, 1960, 1961, 1962, 1963, 1964, 1965, 1892, 1966, 1967, 1968, 1969, 1970,
+        1971, 1972, 1973, 1974, 1975, 1976, 1977, 1978, 1979, 1980, 1981, 1982, 1983, 1984, 1985, 1818,
+        1986, 1987, 1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001,
+        2002, 2003, 2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 1894, 2013, 2014, 2015, 2016,
+        2017, 2018, 2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 2030, 2031, 2032,
+        2033, 2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 2042, 2043, 2044, 2045, 2046, 2047, 2048,
+        2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 0, 0,
+        2063, 0, 2064, 0, 0, 2065, 2066, 2067, 2068, 2069, 2070, 2071, 2072, 2073, 2074, 0,
+        2075, 0, 2076, 0, 0, 2077, 2078, 0, 0, 0, 2079, 2080, 2081, 2082, 2083, 2084,
+        2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093, 2094, 2095, 2096, 2097, 2098, 2099, 2100,
+        2101, 2102, 2103, 2104, 2105, 2106, 2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116,
+        2117, 2118, 2119, 2120, 2121, 2122, 2123, 1947, 2124, 2125, 2126, 2127, 2128, 2129, 2129, 2130,
+        2131, 2132, 2133, 2134, 2135, 2136, 2137, 2077, 2138, 2139, 2140, 2141, 2142, 2143, 0, 0,
+        2144, 2145, 2146, 2147, 2148, 2149, 2150, 2151, 2091, 2152, 2153, 2154, 2063, 2155, 2156, 2157,
+        2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165, 2166, 2100, 2167, 2101, 2168, 2169, 2170, 2171,
+        2172, 2064, 1839, 2173, 2174, 2175, 1909, 1996, 2176, 2177, 2108, 2178, 2109, 2179, 2180, 2181,
+        2066, 2182, 2183, 2184, 2185, 2186, 2067, 2187, 2188, 2189, 2190, 2191, 2192, 2123, 2193, 2194,
+        1947, 2195, 2127, 2196, 2197, 2198, 2199, 2200, 2132, 2201, 2076, 2202, 2133, 1890, 2203, 2134,
+        2204, 2136, 2205, 2206, 2207, 2208, 2209, 2138, 2072, 2210, 2139, 2211, 2140, 2212, 1806, 2213,
+        2214, 2215, 2216, 2217, 2218, 2219, 2220, 2221, 2222, 2223, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2224, 2225, 2226, 2227, 2228, 2229, 2229, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 2230, 2231, 2232, 2233, 2234, 0, 0, 0, 0, 0, 2235, 2236, 2237,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2238, 2239, 2240, 2241, 2242, 2243,
+        2244, 2245, 2246, 2247, 2248, 2249, 2250, 0, 2251, 2252, 2253, 2254, 2255, 0, 2256, 0,
+        2257, 2258, 0, 2259, 2260, 0, 2261, 2262, 2263, 2264, 2265, 2266, 2267, 2268, 2269, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        352, 352, 352, 352, 352, 352, 352, 354, 354, 354, 354, 354, 354, 354, 352, 352,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 2270, 2271, 2272, 2273, 2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283, 2284,
+        2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293, 2294, 2295, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 352, 352, 352, 352, 352, 0, 0, 0, 0, 0,
+        2296, 2297, 2298, 2299, 2300, 2301, 2302, 2303, 2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311,
+        2312, 2313, 2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323, 2324, 2325, 2326, 2327,
+        2328, 2329, 2330, 2331, 2332, 2333, 2334, 2335, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343, 2344, 2345, 2346, 2347, 2348, 2349, 2350, 2351,
+        2352, 2353, 2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363, 2364, 2365, 2366, 2367,
+        2368, 2369, 2370, 2371, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2372, 2373, 2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 0, 2383, 2384, 2385, 2386,
+        2387, 2388, 2389, 2390, 2391, 2392, 2393, 2394, 2395, 2396, 2397, 0, 2398, 2399, 2400, 2401,
+        2402, 2403, 2404, 0, 2405, 2406, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 354, 0, 352,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 352, 357, 354, 0, 0, 0, 0, 690,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 352, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2407, 2408, 2409, 2410, 2411, 2412, 2413, 2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422,
+        2423, 2424, 2425, 2426, 2427, 2428, 2429, 2430, 2431, 2432, 2433, 2434, 2435, 2436, 2437, 2438,
+        2439, 2440, 2441, 2442, 2443, 2444, 2445, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453, 2454,
+        2455, 2456, 2457, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 352, 352, 352, 352, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 352, 352, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 354, 354, 352, 352, 352, 354, 352, 354, 354, 354,
+        354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 352, 354, 352, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 690, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 690,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2458, 0, 2459, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2460, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 690, 689, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        352, 352, 352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2461, 2462,
+        0, 0, 0, 690, 690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 689, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 689, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 690, 689, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 689, 690, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 689, 689, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2463, 2464, 690, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 352, 352, 352, 352, 352, 352, 352, 0, 0, 0,
+        352, 352, 352, 352, 352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 690, 0, 0, 0, 689, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 352, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2465, 2466, 0, 2467, 0,
+        0, 0, 690, 689, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2468, 2469, 0, 0, 0, 690,
+        689, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 690,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 690, 689, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 690, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 690, 689, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2470, 2471, 2472, 2473, 2474, 2475, 2476, 2477, 2478, 2479, 2480, 2481, 2482, 2483, 2484, 2485,
+        2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493, 2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 2502, 0, 0, 0, 0, 690, 690, 0,
+        0, 0, 0, 689, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 690, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 690, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 689, 0, 690, 690, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 690, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        357, 357, 357, 357, 357, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        352, 352, 352, 352, 352, 352, 352, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2503, 2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513, 2514, 2515, 2516, 2517, 2518,
+        2519, 2520, 2521, 2522, 2523, 2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533, 2534,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2535, 2535, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 357, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2536, 2537,
+        2538, 2539, 2540, 2541, 2542, 355, 355, 357, 357, 357, 0, 0, 0, 2543, 355, 355,
+        355, 355, 355, 0, 0, 0, 0, 0, 0, 0, 0, 354, 354, 354, 354, 354,
+        354, 354, 354, 0, 0, 352, 352, 352, 352, 352, 354, 354, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 352, 352, 352, 352, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2544, 2545, 2546, 2547, 2548,
+        2549, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 352, 352, 352, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        352, 352, 352, 352, 352, 352, 352, 0, 352, 352, 352, 352, 352, 352, 352, 352,
+        352, 352, 352, 352, 352, 352, 352, 352, 352, 0, 0, 352, 352, 352, 352, 352,
+        352, 352, 0, 352, 352, 0, 352, 352, 352, 352, 352, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 352, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 352, 352, 352, 352,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        354, 354, 354, 354, 354, 354, 354, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2550, 2551, 2552, 2553, 2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563, 2564, 2565,
+        2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573, 2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581,
+        2582, 2583, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 352, 352, 352, 352, 352, 352, 689, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        2584, 2585, 2586, 2587, 2588, 2085, 2589, 2590, 2591, 2592, 2086, 2593, 2594, 2595, 2087, 2596,
+        2597, 2598, 2599, 2600, 2601, 2602, 2603, 2604, 2605, 2606, 2607, 2145, 2608, 2609, 2610, 2611,
+        2612, 2613, 2614, 2615, 2616, 2150, 2088, 2089, 2151, 2617, 2618, 1896, 2619, 2090, 2620, 2621,
+        2622, 2623, 2623, 2623, 2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633, 2634, 2635,
+        2636, 2637, 2638, 2639, 2640, 2641, 2641, 2153, 2642, 2643, 2644, 2645, 2092, 2646, 2647, 2648,
+        2049, 2649, 2650, 2651, 2652, 2653, 2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663,
+        2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673, 2674, 2674, 2675, 2676, 2677, 1892,
+        2678, 2679, 2680, 2681, 2682, 2683, 2684, 2685, 2097, 2686, 2687, 2688, 2689, 2690, 2691, 2692,
+        2693, 2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703, 2704, 2705, 2706, 1838, 2707,
+        2708, 2709, 2709, 2710, 2711, 2711, 2712, 2713, 2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721,
+        2722, 2723, 2724, 2098, 2725, 2726, 2727, 2728, 2165, 2728, 2729, 2100, 2730, 2731, 2732, 2733,
+        2101, 1811, 2734, 2735, 2736, 2737, 2738, 2739, 2740, 2741, 2742, 2743, 2744, 2745, 2746, 2747,
+        2748, 2749, 2750, 2751, 2752, 2753, 2754, 2755, 2102, 2756, 2757, 2758, 2759, 2760, 2761, 2104,
+        2762, 2763, 2764, 2765, 2766, 2767, 2768, 2769, 1839, 2173, 2770, 2771, 2772, 2773, 2774, 2775,
+        2776, 2777, 2105, 2778, 2779, 2780, 2781, 2216, 2782, 2783, 2784, 2785, 2786, 2787, 2788, 2789,
+        2790, 2791, 2792, 2793, 2794, 1909, 2795, 2796, 2797, 2798, 2799, 2800, 2801, 2802, 2803, 2804,
+        2805, 2106, 1996, 2806, 2807, 2808, 2809, 2810, 2811, 2812, 2813, 2177, 2814, 2815, 2816, 2817,
+        2818, 2819, 2820, 2821, 2178, 2822, 2823, 2824, 2825, 2826, 2827, 2828, 2829, 2830, 2831, 2832,
+        2833, 2180, 2834, 2835, 2836, 2837, 2838, 2839, 2840, 2841, 2842, 2843, 2844, 2844, 2845, 2846,
+        2182, 2847, 2848, 2849, 2850, 2851, 2852, 2853, 1895, 2854, 2855, 2856, 2857, 2858, 2859, 2860,
+        2188, 2861, 2862, 2863, 2864, 2865, 2866, 2866, 2189, 2218, 2867, 2868, 2869, 2870, 2871, 1857,
+        2191, 2872, 2873, 2117, 2874, 2875, 2071, 2876, 2877, 2121, 2878, 2879, 2880, 2881, 2881, 2882,
+        2883, 2884, 2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894, 2895, 2896, 2897, 2898,
+        2899, 2900, 2901, 2902, 2903, 2904, 2905, 2906, 2907, 2908, 2127, 2909, 2910, 2911, 2912, 2913,
+        2914, 2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923, 2924, 2710, 2925, 2926, 2927, 2928,
+        2929, 2930, 2931, 2932, 2933, 2934, 2935, 2936, 1913, 2937, 2938, 2939, 2940, 2941, 2942, 2130,
+        2943, 2944, 2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954, 2955, 2956, 2957, 2958,
+        2959, 2960, 2961, 2962, 1852, 2963, 2964, 2965, 2966, 2967, 2968, 2198, 2969, 2970, 2971, 2972,
+        2973, 2974, 2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983, 2984, 2985, 2986, 2987, 2988,
+        2203, 2204, 2989, 2990, 2991, 2992, 2993, 2994, 2995, 2996, 2997, 2998, 2999, 3000, 3001, 2205,
+        3002, 3003, 3004, 3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014, 3015, 3016, 3017,
+        3018, 3019, 3020, 3021, 3022, 3023, 3024, 3025, 3026, 3027, 3028, 3029, 3030, 3031, 2211, 2211,
+        3032, 3033, 3034, 3035, 3036, 3037, 3038, 3039, 3040, 3041, 2212, 3042, 3043, 3044, 3045, 3046,
+        3047, 3048, 3049, 3050, 3051, 3052, 3053, 3054, 3055, 3056, 3057, 3058, 3059, 3060, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+static const unicode_record unicodeRecords[3061] = {
+        { 0, 0, 0, 0, 0 }, { 0, 0, 1, 0, 0 }, { 0, 0, 1, 0, 1 }, { 0, 0, 1, 0, 2 },
+        { 0, 0, 1, 0, 3 }, { 0, 0, 1, 0, 4 }, { 0, 0, 1, 0, 5 }, { 0, 0, 1, 0, 6 },
+        { 0, 0, 1, 0, 7 }, { 0, 0, 1, 0, 8 }, { 0, 0, 1, 0, 9 }, { 0, 0, 1, 0, 10 },
+        { 0, 0, 1, 0, 11 }, { 0, 0, 1, 0, 12 }, { 0, 0, 1, 0, 13 }, { 0, 0, 1, 0, 14 },
+        { 0, 0, 1, 0, 15 }, { 0, 0, 1, 0, 16 }, { 0, 0, 1, 0, 17 }, { 0, 0, 1, 0, 18 },
+        { 0, 0, 1, 0, 19 }, { 0, 0, 1, 0, 20 }, { 0, 0, 1, 0, 21 }, { 0, 0, 1, 0, 22 },
+        { 0, 0, 1, 0, 23 }, { 0, 0, 1, 0, 24 }, { 0, 0, 1, 0, 25 }, { 0, 0, 1, 0, 26 },
+        { 0, 2, 2, 27, 29 }, { 0, 2, 2, 31, 33 }, { 0, 2, 2, 35, 37 }, { 0, 2, 2, 39, 41 },
+        { 0, 2, 2, 43, 45 }, { 0, 2, 2, 47, 49 }, { 0, 0, 1, 0, 51 }, { 0, 2, 2, 52, 54 },
+        { 0, 2, 2, 56, 58 }, { 0, 2, 2, 60, 62 }, { 0, 2, 2, 64, 66 }, { 0, 2, 2, 68, 70 },
+        { 0, 2, 2, 72, 74 }, { 0, 2, 2, 76, 78 }, { 0, 2, 2, 80, 82 }, { 0, 2, 2, 84, 86 },
+        { 0, 0, 1, 0, 88 }, { 0, 2, 2, 89, 91 }, { 0, 2, 2, 93, 95 }, { 0, 2, 2, 97, 99 },
+        { 0, 2, 2, 101, 103 }, { 0, 2, 2, 105, 107 }, { 0, 2, 2, 109, 111 }, { 0, 0, 1, 0, 113 },
+        { 0, 2, 2, 114, 116 }, { 0, 2, 2, 118, 120 }, { 0, 2, 2, 122, 124 }, { 0, 2, 2, 126, 128 },
+        { 0, 2, 2, 130, 132 }, { 0, 0, 1, 0, 134 }, { 0, 0, 2, 0, 135 }, { 0, 2, 0, 29, 0 },
+        { 0, 2, 0, 33, 0 }, { 0, 2, 0, 37, 0 }, { 0, 2, 0, 41, 0 }, { 0, 2, 0, 45, 0 },
+        { 0, 2, 0, 49, 0 }, { 0, 2, 0, 54, 0 }, { 0, 2, 0, 58, 0 }, { 0, 2, 0, 62, 0 },
+        { 0, 2, 0, 66, 0 }, { 0, 2, 0, 70, 0 }, { 0, 2, 0, 74, 0 }, { 0, 2, 0, 78, 0 },
+        { 0, 2, 0, 82, 0 }, { 0, 2, 0, 86, 0 }, { 0, 2, 0, 91, 0 }, { 0, 2, 0, 95, 0 },
+        { 0, 2, 0, 99, 0 }, { 0, 2, 0, 103, 0 }, { 0, 2, 0, 107, 0 }, { 0, 2, 0, 111, 0 },
+        { 0, 2, 0, 116, 0 }, { 0, 2, 0, 120, 0 }, { 0, 2, 0, 124, 0 }, { 0, 2, 0, 128, 0 },
+        { 0, 2, 0, 132, 0 }, { 0, 2, 0, 137, 0 }, { 0, 2, 2, 139, 141 }, { 0, 2, 0, 141, 0 },
+        { 0, 2, 2, 143, 145 }, { 0, 2, 0, 145, 0 }, { 0, 2, 2, 147, 149 }, { 0, 2, 0, 149, 0 },
+        { 0, 2, 2, 151, 153 }, { 0, 2, 0, 153, 0 }, { 0, 2, 2, 155, 157 }, { 0, 2, 0, 157, 0 },
+        { 0, 2, 2, 159, 161 }, { 0, 2, 0, 161, 0 }, { 0, 2, 2, 163, 165 }, { 0, 2, 0, 165, 0 },
+        { 0, 2, 2, 167, 169 }, { 0, 2, 0, 169, 0 }, { 0, 0, 1, 0, 171 }, { 0, 2, 2, 172, 174 },
+        { 0, 2, 0, 174, 0 }, { 0, 2, 2, 176, 178 }, { 0, 2, 0, 178, 0 }, { 0, 2, 2, 180, 182 },
+        { 0, 2, 0, 182, 0 }, { 0, 2, 2, 184, 186 }, { 0, 2, 0, 186, 0 }, { 0, 2, 2, 188, 190 },
+        { 0, 2, 0, 190, 0 }, { 0, 2, 2, 192, 194 }, { 0, 2, 0, 194, 0 }, { 0, 2, 2, 196, 198 },
+        { 0, 2, 0, 198, 0 }, { 0, 2, 2, 200, 202 }, { 0, 2, 0, 202, 0 }, { 0, 2, 2, 204, 206 },
+        { 0, 2, 0, 206, 0 }, { 0, 2, 2, 208, 210 }, { 0, 2, 0, 210, 0 }, { 0, 0, 1, 0, 212 },
+        { 0, 2, 2, 213, 215 }, { 0, 2, 0, 215, 0 }, { 0, 2, 2, 217, 219 }, { 0, 2, 0, 219, 0 },
+        { 0, 2, 2, 221, 223 }, { 0, 2, 0, 223, 0 }, { 0, 2, 2, 225, 227 }, { 0, 2, 0, 227, 0 },
+        { 0, 2, 2, 229, 231 }, { 0, 0, 1, 0, 233 }, { 0, 2, 2, 234, 236 }, { 0, 2, 0, 236, 0 },
+        { 0, 2, 2, 238, 240 }, { 0, 2, 0, 240, 0 }, { 0, 2, 2, 242, 244 }, { 0, 2, 0, 244, 0 },
+        { 0, 2, 2, 246, 248 }, { 0, 2, 0, 248, 0 }, { 0, 2, 2, 250, 252 }, { 0, 2, 0, 252, 0 },
+        { 0, 0, 1, 0, 254 }, { 0, 0, 1, 0, 255 }, { 0, 2, 2, 256, 258 }, { 0, 2, 0, 258, 0 },
+        { 0, 2, 2, 260, 262 }, { 0, 2, 0, 262, 0 }, { 0, 2, 2, 264, 266 }, { 0, 2, 0, 266, 0 },
+        { 0, 0, 2, 0, 268 }, { 0, 0, 1, 0, 270 }, { 0, 2, 2, 271, 273 }, { 0, 2, 0, 273, 0 },
+        { 0, 2, 2, 275, 277 }, { 0, 2, 0, 277, 0 }, { 0, 2, 2, 279, 281 }, { 0, 2, 0, 281, 0 },
+        { 0, 0, 1, 0, 283 }, { 0, 2, 2, 284, 286 }, { 0, 2, 0, 286, 0 }, { 0, 2, 2, 288, 290 },
+        { 0, 2, 0, 290, 0 }, { 0, 2, 2, 292, 294 }, { 0, 2, 0, 294, 0 }, { 0, 2, 2, 296, 298 },
+        { 0, 2, 0, 298, 0 }, { 0, 2, 2, 300, 302 }, { 0, 2, 0, 302, 0 }, { 0, 2, 2, 304, 306 },
+        { 0, 2, 0, 306, 0 }, { 0, 2, 2, 308, 310 }, { 0, 2, 0, 310, 0 }, { 0, 2, 2, 312, 314 },
+        { 0, 2, 0, 314, 0 }, { 0, 2, 2, 316, 318 }, { 0, 2, 0, 318, 0 }, { 0, 0, 1, 0, 320 },
+        { 0, 2, 2, 321, 323 }, { 0, 2, 0, 323, 0 }, { 0, 2, 2, 325, 327 }, { 0, 2, 0, 327, 0 },
+        { 0, 2, 2, 329, 331 }, { 0, 2, 0, 331, 0 }, { 0, 2, 2, 333, 335 }, { 0, 2, 0, 335, 0 },
+        { 0, 2, 2, 337, 339 }, { 0, 2, 0, 339, 0 }, { 0, 2, 2, 341, 343 }, { 0, 2, 0, 343, 0 },
+        { 0, 2, 2, 345, 347 }, { 0, 2, 0, 347, 0 }, { 0, 2, 2, 349, 351 }, { 0, 2, 0, 351, 0 },
+        { 0, 2, 2, 353, 137 }, { 0, 2, 2, 355, 357 }, { 0, 2, 0, 357, 0 }, { 0, 2, 2, 359, 361 },
+        { 0, 2, 0, 361, 0 }, { 0, 2, 2, 363, 365 }, { 0, 2, 0, 365, 0 }, { 0, 0, 1, 0, 367 },
+        { 0, 0, 1, 0, 368 }, { 0, 0, 1, 0, 369 }, { 0, 0, 1, 0, 370 }, { 0, 0, 1, 0, 371 },
+        { 0, 0, 1, 0, 372 }, { 0, 0, 1, 0, 373 }, { 0, 0, 1, 0, 374 }, { 0, 0, 1, 0, 375 },
+        { 0, 0, 1, 0, 376 }, { 0, 0, 1, 0, 377 }, { 0, 0, 1, 0, 378 }, { 0, 0, 1, 0, 379 },
+        { 0, 0, 1, 0, 380 }, { 0, 0, 1, 0, 381 }, { 0, 0, 1, 0, 382 }, { 0, 0, 1, 0, 383 },
+        { 0, 0, 1, 0, 384 }, { 0, 0, 1, 0, 385 }, { 0, 0, 1, 0, 386 }, { 0, 2, 2, 387, 389 },
+        { 0, 2, 0, 389, 0 }, { 0, 0, 1, 0, 391 }, { 0, 0, 1, 0, 392 }, { 0, 0, 1, 0, 393 },
+        { 0, 0, 1, 0, 394 }, { 0, 0, 1, 0, 395 }, { 0, 0, 1, 0, 396 }, { 0, 0, 1, 0, 397 },
+        { 0, 2, 2, 398, 400 }, { 0, 2, 0, 400, 0 }, { 0, 0, 1, 0, 402 }, { 0, 0, 1, 0, 403 },
+        { 0, 0, 1, 0, 404 }, { 0, 0, 1, 0, 405 }, { 0, 0, 1, 0, 406 }, { 0, 0, 1, 0, 407 },
+        { 0, 0, 1, 0, 408 }, { 0, 0, 1, 0, 409 }, { 0, 0, 1, 0, 410 }, { 0, 0, 1, 0, 411 },
+        { 0, 2, 2, 412, 414 }, { 0, 2, 0, 414, 0 }, { 0, 2, 2, 416, 418 }, { 0, 2, 0, 418, 0 },
+        { 0, 2, 2, 420, 422 }, { 0, 2, 0, 422, 0 }, { 0, 2, 2, 424, 426 }, { 0, 2, 0, 426, 0 },
+        { 0, 3, 3, 428, 431 }, { 0, 3, 0, 431, 0 }, { 0, 3, 3, 434, 437 }, { 0, 3, 0, 437, 0 },
+        { 0, 3, 3, 440, 443 }, { 0, 3, 0, 443, 0 }, { 0, 3, 3, 446, 449 }, { 0, 3, 0, 449, 0 },
+        { 0, 3, 3, 452, 455 }, { 0, 3, 0, 455, 0 }, { 0, 3, 3, 458, 461 }, { 0, 3, 0, 461, 0 },
+        { 0, 2, 2, 464, 466 }, { 0, 2, 0, 466, 0 }, { 0, 0, 1, 0, 468 }, { 0, 2, 2, 469, 471 },
+        { 0, 2, 0, 471, 0 }, { 0, 2, 2, 473, 475 }, { 0, 2, 0, 475, 0 }, { 0, 2, 2, 477, 479 },
+        { 0, 2, 0, 479, 0 }, { 0, 3, 3, 481, 484 }, { 0, 3, 0, 484, 0 }, { 0, 2, 2, 487, 489 },
+        { 0, 2, 0, 489, 0 }, { 0, 2, 0, 491, 0 }, { 0, 0, 1, 0, 493 }, { 0, 2, 2, 494, 496 },
+        { 0, 2, 0, 496, 0 }, { 0, 0, 1, 0, 498 }, { 0, 0, 1, 0, 499 }, { 0, 2, 2, 500, 502 },
+        { 0, 2, 0, 502, 0 }, { 0, 3, 3, 504, 507 }, { 0, 3, 0, 507, 0 }, { 0, 2, 2, 510, 512 },
+        { 0, 2, 0, 512, 0 }, { 0, 2, 2, 514, 516 }, { 0, 2, 0, 516, 0 }, { 0, 2, 2, 518, 520 },
+        { 0, 2, 0, 520, 0 }, { 0, 2, 2, 522, 524 }, { 0, 2, 0, 524, 0 }, { 0, 2, 2, 526, 528 },
+        { 0, 2, 0, 528, 0 }, { 0, 2, 2, 530, 532 }, { 0, 2, 0, 532, 0 }, { 0, 2, 2, 534, 536 },
+        { 0, 2, 0, 536, 0 }, { 0, 2, 2, 538, 540 }, { 0, 2, 0, 540, 0 }, { 0, 2, 2, 542, 544 },
+        { 0, 2, 0, 544, 0 }, { 0, 2, 2, 546, 548 }, { 0, 2, 0, 548, 0 }, { 0, 2, 2, 550, 552 },
+        { 0, 2, 0, 552, 0 }, { 0, 2, 2, 554, 556 }, { 0, 2, 0, 556, 0 }, { 0, 2, 2, 558, 560 },
+        { 0, 2, 0, 560, 0 }, { 0, 2, 2, 562, 564 }, { 0, 2, 0, 564, 0 }, { 0, 2, 2, 566, 568 },
+        { 0, 2, 0, 568, 0 }, { 0, 2, 2, 570, 572 }, { 0, 2, 0, 572, 0 }, { 0, 0, 1, 0, 574 },
+        { 0, 2, 2, 575, 577 }, { 0, 2, 0, 577, 0 }, { 0, 0, 1, 0, 579 }, { 0, 0, 1, 0, 580 },
+        { 0, 0, 1, 0, 581 }, { 0, 2, 2, 582, 584 }, { 0, 2, 0, 584, 0 }, { 0, 2, 2, 586, 588 },
+        { 0, 2, 0, 588, 0 }, { 0, 3, 3, 590, 593 }, { 0, 3, 0, 593, 0 }, { 0, 3, 3, 596, 599 },
+        { 0, 3, 0, 599, 0 }, { 0, 2, 2, 602, 604 }, { 0, 2, 0, 604, 0 }, { 0, 3, 3, 606, 609 },
+        { 0, 3, 0, 609, 0 }, { 0, 2, 2, 612, 614 }, { 0, 2, 0, 614, 0 }, { 0, 0, 1, 0, 616 },
+        { 0, 0, 1, 0, 617 }, { 0, 0, 1, 0, 618 }, { 0, 0, 1, 0, 619 }, { 0, 0, 1, 0, 620 },
+        { 0, 0, 1, 0, 621 }, { 0, 0, 1, 0, 622 }, { 0, 0, 1, 0, 623 }, { 0, 0, 1, 0, 624 },
+        { 0, 0, 1, 0, 625 }, { 0, 0, 1, 0, 626 }, { 0, 0, 1, 0, 627 }, { 0, 0, 1, 0, 628 },
+        { 230, 0, 0, 0, 0 }, { 232, 0, 0, 0, 0 }, { 220, 0, 0, 0, 0 }, { 216, 0, 0, 0, 0 },
+        { 202, 0, 0, 0, 0 }, { 1, 0, 0, 0, 0 }, { 230, 1, 0, 629, 0 }, { 230, 1, 0, 630, 0 },
+        { 230, 1, 0, 631, 0 }, { 230, 2, 0, 632, 0 }, { 240, 0, 0, 0, 0 }, { 233, 0, 0, 0, 0 },
+        { 234, 0, 0, 0, 0 }, { 0, 0, 1, 0, 634 }, { 0, 0, 1, 0, 635 }, { 0, 1, 0, 636, 0 },
+        { 0, 0, 1, 0, 637 }, { 0, 1, 0, 638, 0 }, { 0, 0, 1, 0, 639 }, { 0, 2, 0, 640, 0 },
+        { 0, 2, 2, 642, 644 }, { 0, 1, 0, 646, 0 }, { 0, 2, 2, 647, 649 }, { 0, 2, 2, 651, 653 },
+        { 0, 2, 2, 655, 657 }, { 0, 2, 2, 659, 661 }, { 0, 2, 2, 663, 665 }, { 0, 2, 2, 667, 669 },
+        { 0, 3, 0, 671, 0 }, { 0, 0, 1, 0, 674 }, { 0, 0, 1, 0, 675 }, { 0, 0, 1, 0, 676 },
+        { 0, 0, 1, 0, 677 }, { 0, 0, 1, 0, 678 }, { 0, 0, 1, 0, 679 }, { 0, 0, 1, 0, 680 },
+        { 0, 0, 1, 0, 681 }, { 0, 0, 1, 0, 682 }, { 0, 0, 1, 0, 683 }, { 0, 0, 1, 0, 684 },
+        { 0, 0, 1, 0, 685 }, { 0, 0, 1, 0, 686 }, { 0, 0, 1, 0, 687 }, { 0, 0, 1, 0, 688 },
+        { 0, 0, 1, 0, 689 }, { 0, 0, 1, 0, 690 }, { 0, 0, 1, 0, 691 }, { 0, 0, 1, 0, 692 },
+        { 0, 0, 1, 0, 693 }, { 0, 0, 1, 0, 694 }, { 0, 0, 1, 0, 695 }, { 0, 0, 1, 0, 696 },
+        { 0, 2, 2, 697, 699 }, { 0, 2, 2, 701, 703 }, { 0, 2, 0, 644, 0 }, { 0, 2, 0, 649, 0 },
+        { 0, 2, 0, 653, 0 }, { 0, 2, 0, 657, 0 }, { 0, 3, 0, 705, 0 }, { 0, 2, 0, 699, 0 },
+        { 0, 2, 0, 703, 0 }, { 0, 2, 0, 661, 0 }, { 0, 2, 0, 665, 0 }, { 0, 2, 0, 669, 0 },
+        { 0, 0, 1, 0, 708 }, { 0, 2, 0, 709, 0 }, { 0, 2, 0, 711, 0 }, { 0, 0, 1, 0, 713 },
+        { 0, 0, 1, 0, 714 }, { 0, 0, 1, 0, 715 }, { 0, 0, 1, 0, 716 }, { 0, 0, 1, 0, 717 },
+        { 0, 0, 1, 0, 718 }, { 0, 0, 1, 0, 719 }, { 0, 0, 1, 0, 720 }, { 0, 0, 1, 0, 721 },
+        { 0, 0, 1, 0, 722 }, { 0, 0, 1, 0, 723 }, { 0, 0, 1, 0, 724 }, { 0, 0, 1, 0, 725 },
+        { 0, 0, 1, 0, 726 }, { 0, 0, 1, 0, 727 }, { 0, 0, 1, 0, 728 }, { 0, 0, 1, 0, 729 },
+        { 0, 0, 1, 0, 730 }, { 0, 2, 2, 731, 733 }, { 0, 2, 2, 735, 737 }, { 0, 0, 1, 0, 739 },
+        { 0, 2, 2, 740, 742 }, { 0, 0, 1, 0, 744 }, { 0, 0, 1, 0, 745 }, { 0, 0, 1, 0, 746 },
+        { 0, 2, 2, 747, 749 }, { 0, 0, 1, 0, 751 }, { 0, 0, 1, 0, 752 }, { 0, 0, 1, 0, 753 },
+        { 0, 0, 1, 0, 754 }, { 0, 2, 2, 755, 757 }, { 0, 2, 2, 759, 761 }, { 0, 2, 2, 763, 765 },
+        { 0, 0, 1, 0, 767 }, { 0, 0, 1, 0, 768 }, { 0, 0, 1, 0, 769 }, { 0, 0, 1, 0, 770 },
+        { 0, 0, 1, 0, 771 }, { 0, 0, 1, 0, 772 }, { 0, 0, 1, 0, 773 }, { 0, 0, 1, 0, 774 },
+        { 0, 0, 1, 0, 775 }, { 0, 0, 1, 0, 776 }, { 0, 2, 2, 777, 779 }, { 0, 0, 1, 0, 781 },
+        { 0, 0, 1, 0, 782 }, { 0, 0, 1, 0, 783 }, { 0, 0, 1, 0, 784 }, { 0, 0, 1, 0, 785 },
+        { 0, 0, 1, 0, 786 }, { 0, 0, 1, 0, 787 }, { 0, 0, 1, 0, 788 }, { 0, 0, 1, 0, 789 },
+        { 0, 0, 1, 0, 790 }, { 0, 0, 1, 0, 791 }, { 0, 0, 1, 0, 792 }, { 0, 0, 1, 0, 793 },
+        { 0, 0, 1, 0, 794 }, { 0, 0, 1, 0, 795 }, { 0, 0, 1, 0, 796 }, { 0, 0, 1, 0, 797 },
+        { 0, 0, 1, 0, 798 }, { 0, 0, 1, 0, 799 }, { 0, 0, 1, 0, 800 }, { 0, 0, 1, 0, 801 },
+        { 0, 0, 1, 0, 802 }, { 0, 2, 0, 779, 0 }, { 0, 2, 0, 733, 0 }, { 0, 2, 0, 737, 0 },
+        { 0, 2, 0, 742, 0 }, { 0, 2, 0, 749, 0 }, { 0, 2, 0, 757, 0 }, { 0, 2, 0, 761, 0 },
+        { 0, 2, 0, 765, 0 }, { 0, 0, 1, 0, 803 }, { 0, 0, 1, 0, 804 }, { 0, 0, 1, 0, 805 },
+        { 0, 0, 1, 0, 806 }, { 0, 0, 1, 0, 807 }, { 0, 0, 1, 0, 808 }, { 0, 0, 1, 0, 809 },
+        { 0, 0, 1, 0, 810 }, { 0, 0, 1, 0, 811 }, { 0, 0, 1, 0, 812 }, { 0, 0, 1, 0, 813 },
+        { 0, 2, 2, 814, 816 }, { 0, 2, 0, 816, 0 }, { 0, 0, 1, 0, 818 }, { 0, 0, 1, 0, 819 },
+        { 0, 0, 1, 0, 820 }, { 0, 0, 1, 0, 821 }, { 0, 0, 1, 0, 822 }, { 0, 0, 1, 0, 823 },
+        { 0, 0, 1, 0, 824 }, { 0, 0, 1, 0, 825 }, { 0, 0, 1, 0, 826 }, { 0, 0, 1, 0, 827 },
+        { 0, 0, 1, 0, 828 }, { 0, 0, 1, 0, 829 }, { 0, 0, 1, 0, 830 }, { 0, 0, 1, 0, 831 },
+        { 0, 0, 1, 0, 832 }, { 0, 0, 1, 0, 833 }, { 0, 0, 1, 0, 834 }, { 0, 0, 1, 0, 835 },
+        { 0, 0, 1, 0, 836 }, { 0, 0, 1, 0, 837 }, { 0, 0, 1, 0, 838 }, { 0, 0, 1, 0, 839 },
+        { 0, 0, 1, 0, 840 }, { 0, 0, 1, 0, 841 }, { 0, 0, 1, 0, 842 }, { 0, 0, 1, 0, 843 },
+        { 0, 0, 1, 0, 844 }, { 0, 0, 1, 0, 845 }, { 0, 0, 1, 0, 846 }, { 0, 0, 1, 0, 847 },
+        { 0, 0, 1, 0, 848 }, { 0, 0, 1, 0, 849 }, { 0, 0, 1, 0, 850 }, { 0, 2, 2, 851, 853 },
+        { 0, 2, 0, 853, 0 }, { 0, 0, 1, 0, 855 }, { 0, 0, 1, 0, 856 }, { 0, 0, 1, 0, 857 },
+        { 0, 0, 1, 0, 858 }, { 0, 0, 1, 0, 859 }, { 0, 0, 1, 0, 860 }, { 0, 2, 2, 861, 863 },
+        { 0, 2, 0, 863, 0 }, { 0, 2, 2, 865, 867 }, { 0, 2, 0, 867, 0 }, { 0, 0, 1, 0, 869 },
+        { 0, 2, 2, 870, 872 }, { 0, 2, 0, 872, 0 }, { 0, 0, 1, 0, 874 }, { 0, 2, 2, 875, 877 },
+        { 0, 2, 0, 877, 0 }, { 0, 2, 2, 879, 881 }, { 0, 2, 0, 881, 0 }, { 0, 2, 2, 883, 885 },
+        { 0, 2, 0, 885, 0 }, { 0, 0, 1, 0, 887 }, { 0, 2, 2, 888, 890 }, { 0, 2, 0, 890, 0 },
+        { 0, 2, 2, 892, 894 }, { 0, 2, 0, 894, 0 }, { 0, 2, 2, 896, 898 }, { 0, 2, 0, 898, 0 },
+        { 0, 0, 1, 0, 900 }, { 0, 2, 2, 901, 903 }, { 0, 2, 0, 903, 0 }, { 0, 2, 2, 905, 907 },
+        { 0, 2, 0, 907, 0 }, { 0, 2, 2, 909, 911 }, { 0, 2, 0, 911, 0 }, { 0, 2, 2, 913, 915 },
+        { 0, 2, 0, 915, 0 }, { 0, 2, 2, 917, 919 }, { 0, 2, 0, 919, 0 }, { 0, 2, 2, 921, 923 },
+        { 0, 2, 0, 923, 0 }, { 0, 0, 1, 0, 925 }, { 0, 2, 2, 926, 928 }, { 0, 2, 0, 928, 0 },
+        { 0, 0, 1, 0, 930 }, { 0, 0, 1, 0, 931 }, { 0, 0, 1, 0, 932 }, { 0, 0, 1, 0, 933 },
+        { 0, 0, 1, 0, 934 }, { 0, 0, 1, 0, 935 }, { 0, 0, 1, 0, 936 }, { 0, 0, 1, 0, 937 },
+        { 0, 0, 1, 0, 938 }, { 0, 0, 1, 0, 939 }, { 0, 0, 1, 0, 940 }, { 0, 0, 1, 0, 941 },
+        { 0, 0, 1, 0, 942 }, { 0, 0, 1, 0, 943 }, { 0, 0, 1, 0, 944 }, { 0, 0, 1, 0, 945 },
+        { 0, 0, 1, 0, 946 }, { 0, 0, 1, 0, 947 }, { 0, 0, 1, 0, 948 }, { 0, 0, 1, 0, 949 },
+        { 0, 0, 1, 0, 950 }, { 0, 0, 1, 0, 951 }, { 0, 0, 1, 0, 952 }, { 0, 0, 1, 0, 953 },
+        { 0, 0, 1, 0, 954 }, { 0, 0, 1, 0, 955 }, { 0, 0, 1, 0, 956 }, { 0, 0, 1, 0, 957 },
+        { 0, 0, 1, 0, 958 }, { 0, 0, 1, 0, 959 }, { 0, 0, 1, 0, 960 }, { 0, 0, 1, 0, 961 },
+        { 0, 0, 1, 0, 962 }, { 0, 0, 1, 0, 963 }, { 0, 0, 1, 0, 964 }, { 0, 0, 1, 0, 965 },
+        { 0, 0, 1, 0, 966 }, { 0, 0, 1, 0, 967 }, { 0, 0, 1, 0, 968 }, { 0, 0, 1, 0, 969 },
+        { 0, 0, 1, 0, 970 }, { 0, 0, 1, 0, 971 }, { 0, 0, 1, 0, 972 }, { 0, 0, 1, 0, 973 },
+        { 0, 0, 1, 0, 974 }, { 0, 0, 1, 0, 975 }, { 0, 0, 1, 0, 976 }, { 0, 0, 1, 0, 977 },
+        { 0, 0, 1, 0, 978 }, { 0, 0, 1, 0, 979 }, { 0, 0, 1, 0, 980 }, { 0, 0, 1, 0, 981 },
+        { 0, 0, 1, 0, 982 }, { 0, 0, 1, 0, 983 }, { 0, 0, 1, 0, 984 }, { 0, 0, 1, 0, 985 },
+        { 0, 0, 1, 0, 986 }, { 0, 0, 1, 0, 987 }, { 0, 0, 1, 0, 988 }, { 0, 0, 1, 0, 989 },
+        { 0, 0, 1, 0, 990 }, { 0, 0, 1, 0, 991 }, { 0, 0, 1, 0, 992 }, { 0, 0, 1, 0, 993 },
+        { 0, 0, 1, 0, 994 }, { 0, 0, 2, 0, 995 }, { 222, 0, 0, 0, 0 }, { 228, 0, 0, 0, 0 },
+        { 10, 0, 0, 0, 0 }, { 11, 0, 0, 0, 0 }, { 12, 0, 0, 0, 0 }, { 13, 0, 0, 0, 0 },
+        { 14, 0, 0, 0, 0 }, { 15, 0, 0, 0, 0 }, { 16, 0, 0, 0, 0 }, { 17, 0, 0, 0, 0 },
+        { 18, 0, 0, 0, 0 }, { 19, 0, 0, 0, 0 }, { 20, 0, 0, 0, 0 }, { 21, 0, 0, 0, 0 },
+        { 22, 0, 0, 0, 0 }, { 23, 0, 0, 0, 0 }, { 24, 0, 0, 0, 0 }, { 25, 0, 0, 0, 0 },
+        { 30, 0, 0, 0, 0 }, { 31, 0, 0, 0, 0 }, { 32, 0, 0, 0, 0 }, { 0, 2, 0, 997, 0 },
+        { 0, 2, 0, 999, 0 }, { 0, 2, 0, 1001, 0 }, { 0, 2, 0, 1003, 0 }, { 0, 2, 0, 1005, 0 },
+        { 27, 0, 0, 0, 0 }, { 28, 0, 0, 0, 0 }, { 29, 0, 0, 0, 0 }, { 33, 0, 0, 0, 0 },
+        { 34, 0, 0, 0, 0 }, { 35, 0, 0, 0, 0 }, { 0, 2, 0, 1007, 0 }, { 0, 2, 0, 1009, 0 },
+        { 0, 2, 0, 1011, 0 }, { 36, 0, 0, 0, 0 }, { 0, 2, 0, 1013, 0 }, { 0, 2, 0, 1015, 0 },
+        { 0, 2, 0, 1017, 0 }, { 7, 0, 0, 0, 0 }, { 9, 0, 0, 0, 0 }, { 0, 2, 0, 1019, 0 },
+        { 0, 2, 0, 1021, 0 }, { 0, 2, 0, 1023, 0 }, { 0, 2, 0, 1025, 0 }, { 0, 2, 0, 1027, 0 },
+        { 0, 2, 0, 1029, 0 }, { 0, 2, 0, 1031, 0 }, { 0, 2, 0, 1033, 0 }, { 0, 2, 0, 1035, 0 },
+        { 0, 2, 0, 1037, 0 }, { 0, 2, 0, 1039, 0 }, { 0, 2, 0, 1041, 0 }, { 0, 2, 0, 1043, 0 },
+        { 0, 2, 0, 1045, 0 }, { 0, 2, 0, 1047, 0 }, { 0, 2, 0, 1049, 0 }, { 0, 2, 0, 1051, 0 },
+        { 0, 2, 0, 1053, 0 }, { 0, 2, 0, 1055, 0 }, { 0, 2, 0, 1057, 0 }, { 0, 2, 0, 1059, 0 },
+        { 0, 2, 0, 1061, 0 }, { 0, 2, 0, 1063, 0 }, { 0, 2, 0, 1065, 0 }, { 0, 2, 0, 1067, 0 },
+        { 0, 2, 0, 1069, 0 }, { 0, 2, 0, 1071, 0 }, { 0, 2, 0, 1073, 0 }, { 0, 2, 0, 1075, 0 },
+        { 84, 0, 0, 0, 0 }, { 91, 0, 0, 0, 0 }, { 0, 2, 0, 1077, 0 }, { 0, 2, 0, 1079, 0 },
+        { 0, 2, 0, 1081, 0 }, { 0, 2, 0, 1083, 0 }, { 0, 3, 0, 1085, 0 }, { 0, 2, 0, 1088, 0 },
+        { 0, 2, 0, 1090, 0 }, { 0, 2, 0, 1092, 0 }, { 0, 2, 0, 1094, 0 }, { 0, 2, 0, 1096, 0 },
+        { 0, 3, 0, 1098, 0 }, { 0, 2, 0, 1101, 0 }, { 103, 0, 0, 0, 0 }, { 107, 0, 0, 0, 0 },
+        { 118, 0, 0, 0, 0 }, { 122, 0, 0, 0, 0 }, { 0, 2, 0, 1103, 0 }, { 0, 2, 0, 1105, 0 },
+        { 0, 2, 0, 1107, 0 }, { 0, 2, 0, 1109, 0 }, { 0, 2, 0, 1111, 0 }, { 0, 2, 0, 1113, 0 },
+        { 129, 0, 0, 0, 0 }, { 130, 0, 0, 0, 0 }, { 0, 2, 0, 1115, 0 }, { 132, 0, 0, 0, 0 },
+        { 0, 2, 0, 1117, 0 }, { 0, 2, 0, 1119, 0 }, { 0, 2, 0, 1121, 0 }, { 0, 2, 0, 1123, 0 },
+        { 0, 2, 0, 1125, 0 }, { 0, 2, 0, 1127, 0 }, { 0, 2, 0, 1129, 0 }, { 0, 2, 0, 1131, 0 },
+        { 0, 2, 0, 1133, 0 }, { 0, 2, 0, 1135, 0 }, { 0, 2, 0, 1137, 0 }, { 0, 0, 1, 0, 1139 },
+        { 0, 0, 1, 0, 1140 }, { 0, 0, 1, 0, 1141 }, { 0, 0, 1, 0, 1142 }, { 0, 0, 1, 0, 1143 },
+        { 0, 0, 1, 0, 1144 }, { 0, 0, 1, 0, 1145 }, { 0, 0, 1, 0, 1146 }, { 0, 0, 1, 0, 1147 },
+        { 0, 0, 1, 0, 1148 }, { 0, 0, 1, 0, 1149 }, { 0, 0, 1, 0, 1150 }, { 0, 0, 1, 0, 1151 },
+        { 0, 0, 1, 0, 1152 }, { 0, 0, 1, 0, 1153 }, { 0, 0, 1, 0, 1154 }, { 0, 0, 1, 0, 1155 },
+        { 0, 0, 1, 0, 1156 }, { 0, 0, 1, 0, 1157 }, { 0, 0, 1, 0, 1158 }, { 0, 0, 1, 0, 1159 },
+        { 0, 0, 1, 0, 1160 }, { 0, 0, 1, 0, 1161 }, { 0, 0, 1, 0, 1162 }, { 0, 0, 1, 0, 1163 },
+        { 0, 0, 1, 0, 1164 }, { 0, 0, 1, 0, 1165 }, { 0, 0, 1, 0, 1166 }, { 0, 0, 1, 0, 1167 },
+        { 0, 0, 1, 0, 1168 }, { 0, 0, 1, 0, 1169 }, { 0, 0, 1, 0, 1170 }, { 0, 0, 1, 0, 1171 },
+        { 0, 0, 1, 0, 1172 }, { 0, 0, 1, 0, 1173 }, { 0, 0, 1, 0, 1174 }, { 0, 0, 1, 0, 1175 },
+        { 0, 0, 1, 0, 1176 }, { 0, 0, 1, 0, 1177 }, { 0, 0, 1, 0, 1178 }, { 0, 0, 1, 0, 1179 },
+        { 0, 0, 1, 0, 1180 }, { 0, 0, 1, 0, 1181 }, { 0, 0, 1, 0, 1182 }, { 0, 0, 1, 0, 1183 },
+        { 0, 0, 1, 0, 1184 }, { 0, 2, 0, 1185, 0 }, { 0, 2, 0, 1187, 0 }, { 0, 2, 0, 1189, 0 },
+        { 0, 2, 0, 1191, 0 }, { 0, 2, 0, 1193, 0 }, { 0, 2, 0, 1195, 0 }, { 0, 2, 0, 1197, 0 },
+        { 0, 2, 0, 1199, 0 }, { 0, 2, 0, 1201, 0 }, { 0, 2, 0, 1203, 0 }, { 0, 2, 0, 1205, 0 },
+        { 0, 0, 1, 0, 1207 }, { 0, 0, 1, 0, 1208 }, { 0, 0, 1, 0, 1209 }, { 0, 0, 1, 0, 1210 },
+        { 0, 0, 1, 0, 1211 }, { 0, 0, 1, 0, 1212 }, { 0, 0, 1, 0, 1213 }, { 0, 0, 1, 0, 1214 },
+        { 0, 0, 1, 0, 1215 }, { 0, 0, 1, 0, 1216 }, { 0, 0, 1, 0, 1217 }, { 0, 0, 1, 0, 1218 },
+        { 0, 0, 1, 0, 1219 }, { 0, 0, 1, 0, 1220 }, { 0, 0, 1, 0, 1221 }, { 0, 0, 1, 0, 1222 },
+        { 0, 0, 1, 0, 1223 }, { 0, 0, 1, 0, 1224 }, { 0, 0, 1, 0, 1225 }, { 0, 0, 1, 0, 1226 },
+        { 0, 0, 1, 0, 1227 }, { 0, 0, 1, 0, 1228 }, { 0, 0, 1, 0, 1229 }, { 0, 0, 1, 0, 1230 },
+        { 0, 0, 1, 0, 1231 }, { 0, 0, 1, 0, 1232 }, { 0, 0, 1, 0, 1233 }, { 0, 0, 1, 0, 1234 },
+        { 0, 0, 1, 0, 1235 }, { 0, 0, 1, 0, 1236 }, { 0, 0, 1, 0, 1237 }, { 0, 0, 1, 0, 1238 },
+        { 0, 0, 1, 0, 1239 }, { 0, 0, 1, 0, 1240 }, { 0, 0, 1, 0, 1241 }, { 0, 0, 1, 0, 1242 },
+        { 0, 0, 1, 0, 1243 }, { 0, 0, 1, 0, 1244 }, { 0, 0, 1, 0, 1245 }, { 0, 0, 1, 0, 1246 },
+        { 0, 0, 1, 0, 1247 }, { 0, 0, 1, 0, 1248 }, { 0, 0, 1, 0, 1249 }, { 0, 0, 1, 0, 1250 },
+        { 0, 0, 1, 0, 1251 }, { 0, 0, 1, 0, 1252 }, { 0, 0, 1, 0, 1253 }, { 214, 0, 0, 0, 0 },
+        { 218, 0, 0, 0, 0 }, { 0, 2, 2, 1254, 1256 }, { 0, 2, 0, 1256, 0 }, { 0, 2, 2, 1258, 1260 },
+        { 0, 2, 0, 1260, 0 }, { 0, 2, 2, 1262, 1264 }, { 0, 2, 0, 1264, 0 }, { 0, 2, 2, 1266, 1268 },
+        { 0, 2, 0, 1268, 0 }, { 0, 3, 3, 1270, 1273 }, { 0, 3, 0, 1273, 0 }, { 0, 2, 2, 1276, 1278 },
+        { 0, 2, 0, 1278, 0 }, { 0, 2, 2, 1280, 1282 }, { 0, 2, 0, 1282, 0 }, { 0, 2, 2, 1284, 1286 },
+        { 0, 2, 0, 1286, 0 }, { 0, 2, 2, 1288, 1290 }, { 0, 2, 0, 1290, 0 }, { 0, 2, 2, 1292, 1294 },
+        { 0, 2, 0, 1294, 0 }, { 0, 3, 3, 1296, 1299 }, { 0, 3, 0, 1299, 0 }, { 0, 3, 3, 1302, 1305 },
+        { 0, 3, 0, 1305, 0 }, { 0, 2, 2, 1308, 1310 }, { 0, 2, 0, 1310, 0 }, { 0, 2, 2, 1312, 1314 },
+        { 0, 2, 0, 1314, 0 }, { 0, 3, 3, 1316, 1319 }, { 0, 3, 0, 1319, 0 }, { 0, 2, 2, 1322, 1324 },
+        { 0, 2, 0, 1324, 0 }, { 0, 2, 2, 1326, 1328 }, { 0, 2, 0, 1328, 0 }, { 0, 2, 2, 1330, 1332 },
+        { 0, 2, 0, 1332, 0 }, { 0, 2, 2, 1334, 1336 }, { 0, 2, 0, 1336, 0 }, { 0, 2, 2, 1338, 1340 },
+        { 0, 2, 0, 1340, 0 }, { 0, 2, 2, 1342, 1344 }, { 0, 2, 0, 1344, 0 }, { 0, 2, 2, 1346, 1348 },
+        { 0, 2, 0, 1348, 0 }, { 0, 2, 2, 1350, 1352 }, { 0, 2, 0, 1352, 0 }, { 0, 3, 3, 1354, 1357 },
+        { 0, 3, 0, 1357, 0 }, { 0, 2, 2, 1360, 1362 }, { 0, 2, 0, 1362, 0 }, { 0, 2, 2, 1364, 1366 },
+        { 0, 2, 0, 1366, 0 }, { 0, 2, 2, 1368, 1370 }, { 0, 2, 0, 1370, 0 }, { 0, 2, 2, 1372, 1374 },
+        { 0, 2, 0, 1374, 0 }, { 0, 3, 3, 1376, 1379 }, { 0, 3, 0, 1379, 0 }, { 0, 2, 2, 1382, 1384 },
+        { 0, 2, 0, 1384, 0 }, { 0, 2, 2, 1386, 1388 }, { 0, 2, 0, 1388, 0 }, { 0, 2, 2, 1390, 1392 },
+        { 0, 2, 0, 1392, 0 }, { 0, 2, 2, 1394, 1396 }, { 0, 2, 0, 1396, 0 }, { 0, 2, 2, 1398, 1400 },
+        { 0, 2, 0, 1400, 0 }, { 0, 2, 2, 1402, 1404 }, { 0, 2, 0, 1404, 0 }, { 0, 2, 2, 1406, 1408 },
+        { 0, 2, 0, 1408, 0 }, { 0, 2, 2, 1410, 1412 }, { 0, 2, 0, 1412, 0 }, { 0, 2, 2, 1414, 1416 },
+        { 0, 2, 0, 1416, 0 }, { 0, 3, 3, 1418, 1421 }, { 0, 3, 0, 1421, 0 }, { 0, 3, 3, 1424, 1427 },
+        { 0, 3, 0, 1427, 0 }, { 0, 3, 3, 1430, 1433 }, { 0, 3, 0, 1433, 0 }, { 0, 3, 3, 1436, 1439 },
+        { 0, 3, 0, 1439, 0 }, { 0, 2, 2, 1442, 1444 }, { 0, 2, 0, 1444, 0 }, { 0, 2, 2, 1446, 1448 },
+        { 0, 2, 0, 1448, 0 }, { 0, 2, 2, 1450, 1452 }, { 0, 2, 0, 1452, 0 }, { 0, 2, 2, 1454, 1456 },
+        { 0, 2, 0, 1456, 0 }, { 0, 3, 3, 1458, 1461 }, { 0, 3, 0, 1461, 0 }, { 0, 2, 2, 1464, 1466 },
+        { 0, 2, 0, 1466, 0 }, { 0, 2, 2, 1468, 1470 }, { 0, 2, 0, 1470, 0 }, { 0, 2, 2, 1472, 1474 },
+        { 0, 2, 0, 1474, 0 }, { 0, 3, 3, 1476, 1479 }, { 0, 3, 0, 1479, 0 }, { 0, 3, 3, 1482, 1485 },
+        { 0, 3, 0, 1485, 0 }, { 0, 3, 3, 1488, 1491 }, { 0, 3, 0, 1491, 0 }, { 0, 2, 2, 1494, 1496 },
+        { 0, 2, 0, 1496, 0 }, { 0, 2, 2, 1498, 1500 }, { 0, 2, 0, 1500, 0 }, { 0, 2, 2, 1502, 1504 },
+        { 0, 2, 0, 1504, 0 }, { 0, 2, 2, 1506, 1508 }, { 0, 2, 0, 1508, 0 }, { 0, 2, 2, 1510, 1512 },
+        { 0, 2, 0, 1512, 0 }, { 0, 2, 2, 1514, 1516 }, { 0, 2, 0, 1516, 0 }, { 0, 2, 2, 1518, 1520 },
+        { 0, 2, 0, 1520, 0 }, { 0, 3, 3, 1522, 1525 }, { 0, 3, 0, 1525, 0 }, { 0, 3, 3, 1528, 1531 },
+        { 0, 3, 0, 1531, 0 }, { 0, 2, 2, 1534, 1536 }, { 0, 2, 0, 1536, 0 }, { 0, 2, 2, 1538, 1540 },
+        { 0, 2, 0, 1540, 0 }, { 0, 2, 2, 1542, 1544 }, { 0, 2, 0, 1544, 0 }, { 0, 2, 2, 1546, 1548 },
+        { 0, 2, 0, 1548, 0 }, { 0, 2, 2, 1550, 1552 }, { 0, 2, 0, 1552, 0 }, { 0, 2, 2, 1554, 1556 },
+        { 0, 2, 0, 1556, 0 }, { 0, 2, 2, 1558, 1560 }, { 0, 2, 0, 1560, 0 }, { 0, 2, 2, 1562, 1564 },
+        { 0, 2, 0, 1564, 0 }, { 0, 2, 2, 1566, 1568 }, { 0, 2, 0, 1568, 0 }, { 0, 2, 2, 1570, 1572 },
+        { 0, 2, 0, 1572, 0 }, { 0, 2, 2, 1574, 1576 }, { 0, 2, 0, 1576, 0 }, { 0, 2, 2, 1578, 1580 },
+        { 0, 2, 0, 1580, 0 }, { 0, 2, 2, 1582, 1584 }, { 0, 2, 0, 1584, 0 }, { 0, 2, 0, 1586, 0 },
+        { 0, 2, 0, 1588, 0 }, { 0, 2, 0, 1590, 0 }, { 0, 2, 0, 1592, 0 }, { 0, 0, 2, 0, 1594 },
+        { 0, 2, 2, 1596, 1470 }, { 0, 2, 2, 1598, 1600 }, { 0, 2, 0, 1600, 0 }, { 0, 2, 2, 1602, 1604 },
+        { 0, 2, 0, 1604, 0 }, { 0, 3, 3, 1606, 1609 }, { 0, 3, 0, 1609, 0 }, { 0, 3, 3, 1612, 1615 },
+        { 0, 3, 0, 1615, 0 }, { 0, 3, 3, 1618, 1621 }, { 0, 3, 0, 1621, 0 }, { 0, 3, 3, 1624, 1627 },
+        { 0, 3, 0, 1627, 0 }, { 0, 3, 3, 1630, 1633 }, { 0, 3, 0, 1633, 0 }, { 0, 3, 3, 1636, 1639 },
+        { 0, 3, 0, 1639, 0 }, { 0, 3, 3, 1642, 1645 }, { 0, 3, 0, 1645, 0 }, { 0, 3, 3, 1648, 1651 },
+        { 0, 3, 0, 1651, 0 }, { 0, 3, 3, 1654, 1657 }, { 0, 3, 0, 1657, 0 }, { 0, 3, 3, 1660, 1663 },
+        { 0, 3, 0, 1663, 0 }, { 0, 2, 2, 1666, 1668 }, { 0, 2, 0, 1668, 0 }, { 0, 2, 2, 1670, 1672 },
+        { 0, 2, 0, 1672, 0 }, { 0, 2, 2, 1674, 1676 }, { 0, 2, 0, 1676, 0 }, { 0, 3, 3, 1678, 1681 },
+        { 0, 3, 0, 1681, 0 }, { 0, 3, 3, 1684, 1687 }, { 0, 3, 0, 1687, 0 }, { 0, 3, 3, 1690, 1693 },
+        { 0, 3, 0, 1693, 0 }, { 0, 3, 3, 1696, 1699 }, { 0, 3, 0, 1699, 0 }, { 0, 3, 3, 1702, 1705 },
+        { 0, 3, 0, 1705, 0 }, { 0, 2, 2, 1708, 1710 }, { 0, 2, 0, 1710, 0 }, { 0, 2, 2, 1712, 1714 },
+        { 0, 2, 0, 1714, 0 }, { 0, 2, 2, 1716, 1718 }, { 0, 2, 0, 1718, 0 }, { 0, 2, 2, 1720, 1722 },
+        { 0, 2, 0, 1722, 0 }, { 0, 3, 3, 1724, 1727 }, { 0, 3, 0, 1727, 0 }, { 0, 3, 3, 1730, 1733 },
+        { 0, 3, 0, 1733, 0 }, { 0, 3, 3, 1736, 1739 }, { 0, 3, 0, 1739, 0 }, { 0, 3, 3, 1742, 1745 },
+        { 0, 3, 0, 1745, 0 }, { 0, 3, 3, 1748, 1751 }, { 0, 3, 0, 1751, 0 }, { 0, 3, 3, 1754, 1757 },
+        { 0, 3, 0, 1757, 0 }, { 0, 3, 3, 1760, 1763 }, { 0, 3, 0, 1763, 0 }, { 0, 3, 3, 1766, 1769 },
+        { 0, 3, 0, 1769, 0 }, { 0, 3, 3, 1772, 1775 }, { 0, 3, 0, 1775, 0 }, { 0, 3, 3, 1778, 1781 },
+        { 0, 3, 0, 1781, 0 }, { 0, 2, 2, 1784, 1786 }, { 0, 2, 0, 1786, 0 }, { 0, 2, 2, 1788, 1790 },
+        { 0, 2, 0, 1790, 0 }, { 0, 3, 3, 1792, 1795 }, { 0, 3, 0, 1795, 0 }, { 0, 3, 3, 1798, 1801 },
+        { 0, 3, 0, 1801, 0 }, { 0, 3, 3, 1804, 1807 }, { 0, 3, 0, 1807, 0 }, { 0, 3, 3, 1810, 1813 },
+        { 0, 3, 0, 1813, 0 }, { 0, 3, 3, 1816, 1819 }, { 0, 3, 0, 1819, 0 }, { 0, 2, 2, 1822, 1824 },
+        { 0, 2, 0, 1824, 0 }, { 0, 2, 2, 1826, 1828 }, { 0, 2, 0, 1828, 0 }, { 0, 2, 2, 1830, 1832 },
+        { 0, 2, 0, 1832, 0 }, { 0, 2, 2, 1834, 1836 }, { 0, 2, 0, 1836, 0 }, { 0, 0, 1, 0, 1838 },
+        { 0, 0, 1, 0, 1839 }, { 0, 0, 1, 0, 1840 }, { 0, 2, 0, 1841, 0 }, { 0, 2, 0, 1843, 0 },
+        { 0, 3, 0, 1845, 0 }, { 0, 3, 0, 1848, 0 }, { 0, 3, 0, 1851, 0 }, { 0, 3, 0, 1854, 0 },
+        { 0, 3, 0, 1857, 0 }, { 0, 3, 0, 1860, 0 }, { 0, 2, 2, 1863, 1841 }, { 0, 2, 2, 1865, 1843 },
+        { 0, 3, 3, 1867, 1845 }, { 0, 3, 3, 1870, 1848 }, { 0, 3, 3, 1873, 1851 }, { 0, 3, 3, 1876, 1854 },
+        { 0, 3, 3, 1879, 1857 }, { 0, 3, 3, 1882, 1860 }, { 0, 2, 0, 1885, 0 }, { 0, 2, 0, 1887, 0 },
+        { 0, 3, 0, 1889, 0 }, { 0, 3, 0, 1892, 0 }, { 0, 3, 0, 1895, 0 }, { 0, 3, 0, 1898, 0 },
+        { 0, 2, 2, 1901, 1885 }, { 0, 2, 2, 1903, 1887 }, { 0, 3, 3, 1905, 1889 }, { 0, 3, 3, 1908, 1892 },
+        { 0, 3, 3, 1911, 1895 }, { 0, 3, 3, 1914, 1898 }, { 0, 2, 0, 1917, 0 }, { 0, 2, 0, 1919, 0 },
+        { 0, 3, 0, 1921, 0 }, { 0, 3, 0, 1924, 0 }, { 0, 3, 0, 1927, 0 }, { 0, 3, 0, 1930, 0 },
+        { 0, 3, 0, 1933, 0 }, { 0, 3, 0, 1936, 0 }, { 0, 2, 2, 1939, 1917 }, { 0, 2, 2, 1941, 1919 },
+        { 0, 3, 3, 1943, 1921 }, { 0, 3, 3, 1946, 1924 }, { 0, 3, 3, 1949, 1927 }, { 0, 3, 3, 1952, 1930 },
+        { 0, 3, 3, 1955, 1933 }, { 0, 3, 3, 1958, 1936 }, { 0, 2, 0, 1961, 0 }, { 0, 2, 0, 1963, 0 },
+        { 0, 3, 0, 1965, 0 }, { 0, 3, 0, 1968, 0 }, { 0, 3, 0, 1971, 0 }, { 0, 3, 0, 1974, 0 },
+        { 0, 3, 0, 1977, 0 }, { 0, 3, 0, 1980, 0 }, { 0, 2, 2, 1983, 1961 }, { 0, 2, 2, 1985, 1963 },
+        { 0, 3, 3, 1987, 1965 }, { 0, 3, 3, 1990, 1968 }, { 0, 3, 3, 1993, 1971 }, { 0, 3, 3, 1996, 1974 },
+        { 0, 3, 3, 1999, 1977 }, { 0, 3, 3, 2002, 1980 }, { 0, 2, 0, 2005, 0 }, { 0, 2, 0, 2007, 0 },
+        { 0, 3, 0, 2009, 0 }, { 0, 3, 0, 2012, 0 }, { 0, 3, 0, 2015, 0 }, { 0, 3, 0, 2018, 0 },
+        { 0, 2, 2, 2021, 2005 }, { 0, 2, 2, 2023, 2007 }, { 0, 3, 3, 2025, 2009 }, { 0, 3, 3, 2028, 2012 },
+        { 0, 3, 3, 2031, 2015 }, { 0, 3, 3, 2034, 2018 }, { 0, 2, 0, 2037, 0 }, { 0, 2, 0, 2039, 0 },
+        { 0, 3, 0, 2041, 0 }, { 0, 3, 0, 2044, 0 }, { 0, 3, 0, 2047, 0 }, { 0, 3, 0, 2050, 0 },
+        { 0, 3, 0, 2053, 0 }, { 0, 3, 0, 2056, 0 }, { 0, 2, 2, 2059, 2039 }, { 0, 3, 3, 2061, 2044 },
+        { 0, 3, 3, 2064, 2050 }, { 0, 3, 3, 2067, 2056 }, { 0, 2, 0, 2070, 0 }, { 0, 2, 0, 2072, 0 },
+        { 0, 3, 0, 2074, 0 }, { 0, 3, 0, 2077, 0 }, { 0, 3, 0, 2080, 0 }, { 0, 3, 0, 2083, 0 },
+        { 0, 3, 0, 2086, 0 }, { 0, 3, 0, 2089, 0 }, { 0, 2, 2, 2092, 2070 }, { 0, 2, 2, 2094, 2072 },
+        { 0, 3, 3, 2096, 2074 }, { 0, 3, 3, 2099, 2077 }, { 0, 3, 3, 2102, 2080 }, { 0, 3, 3, 2105, 2083 },
+        { 0, 3, 3, 2108, 2086 }, { 0, 3, 3, 2111, 2089 }, { 0, 2, 0, 2114, 0 }, { 0, 2, 0, 2116, 0 },
+        { 0, 2, 0, 2118, 0 }, { 0, 2, 0, 2120, 0 }, { 0, 2, 0, 2122, 0 }, { 0, 2, 0, 2124, 0 },
+        { 0, 2, 0, 2126, 0 }, { 0, 3, 0, 2128, 0 }, { 0, 3, 0, 2131, 0 }, { 0, 4, 0, 2134, 0 },
+        { 0, 4, 0, 2138, 0 }, { 0, 4, 0, 2142, 0 }, { 0, 4, 0, 2146, 0 }, { 0, 4, 0, 2150, 0 },
+        { 0, 4, 0, 2154, 0 }, { 0, 3, 3, 2158, 2128 }, { 0, 3, 3, 2161, 2131 }, { 0, 4, 4, 2164, 2134 },
+        { 0, 4, 4, 2168, 2138 }, { 0, 4, 4, 2172, 2142 }, { 0, 4, 4, 2176, 2146 }, { 0, 4, 4, 2180, 2150 },
+        { 0, 4, 4, 2184, 2154 }, { 0, 3, 0, 2188, 0 }, { 0, 3, 0, 2191, 0 }, { 0, 4, 0, 2194, 0 },
+        { 0, 4, 0, 2198, 0 }, { 0, 4, 0, 2202, 0 }, { 0, 4, 0, 2206, 0 }, { 0, 4, 0, 2210, 0 },
+        { 0, 4, 0, 2214, 0 }, { 0, 3, 3, 2218, 2188 }, { 0, 3, 3, 2221, 2191 }, { 0, 4, 4, 2224, 2194 },
+        { 0, 4, 4, 2228, 2198 }, { 0, 4, 4, 2232, 2202 }, { 0, 4, 4, 2236, 2206 }, { 0, 4, 4, 2240, 2210 },
+        { 0, 4, 4, 2244, 2214 }, { 0, 3, 0, 2248, 0 }, { 0, 3, 0, 2251, 0 }, { 0, 4, 0, 2254, 0 },
+        { 0, 4, 0, 2258, 0 }, { 0, 4, 0, 2262, 0 }, { 0, 4, 0, 2266, 0 }, { 0, 4, 0, 2270, 0 },
+        { 0, 4, 0, 2274, 0 }, { 0, 3, 3, 2278, 2248 }, { 0, 3, 3, 2281, 2251 }, { 0, 4, 4, 2284, 2254 },
+        { 0, 4, 4, 2288, 2258 }, { 0, 4, 4, 2292, 2262 }, { 0, 4, 4, 2296, 2266 }, { 0, 4, 4, 2300, 2270 },
+        { 0, 4, 4, 2304, 2274 }, { 0, 2, 0, 2308, 0 }, { 0, 2, 0, 2310, 0 }, { 0, 3, 0, 2312, 0 },
+        { 0, 2, 0, 2315, 0 }, { 0, 3, 0, 2317, 0 }, { 0, 2, 0, 2320, 0 }, { 0, 3, 0, 2322, 0 },
+        { 0, 2, 2, 2325, 2308 }, { 0, 2, 2, 2327, 2310 }, { 0, 2, 2, 2329, 2114 }, { 0, 2, 2, 2331, 2315 },
+        { 0, 1, 0, 682, 0 }, { 0, 2, 0, 2333, 0 }, { 0, 3, 0, 2335, 0 }, { 0, 2, 0, 2338, 0 },
+        { 0, 3, 0, 2340, 0 }, { 0, 2, 0, 2343, 0 }, { 0, 3, 0, 2345, 0 }, { 0, 2, 2, 2348, 2116 },
+        { 0, 2, 2, 2350, 2118 }, { 0, 2, 2, 2352, 2338 }, { 0, 2, 0, 2354, 0 }, { 0, 2, 0, 2356, 0 },
+        { 0, 2, 0, 2358, 0 }, { 0, 2, 0, 2360, 0 }, { 0, 2, 0, 2362, 0 }, { 0, 3, 0, 2364, 0 },
+        { 0, 2, 0, 2367, 0 }, { 0, 3, 0, 2369, 0 }, { 0, 2, 2, 2372, 2360 }, { 0, 2, 2, 2374, 2362 },
+        { 0, 2, 2, 2376, 2120 }, { 0, 2, 0, 2378, 0 }, { 0, 2, 0, 2380, 0 }, { 0, 2, 0, 2382, 0 },
+        { 0, 2, 0, 2384, 0 }, { 0, 2, 0, 2386, 0 }, { 0, 3, 0, 2388, 0 }, { 0, 2, 0, 2391, 0 },
+        { 0, 2, 0, 2393, 0 }, { 0, 2, 0, 2395, 0 }, { 0, 3, 0, 2397, 0 }, { 0, 2, 2, 2400, 2384 },
+        { 0, 2, 2, 2402, 2386 }, { 0, 2, 2, 2404, 2124 }, { 0, 2, 2, 2406, 2393 }, { 0, 2, 0, 2408, 0 },
+        { 0, 1, 0, 2410, 0 }, { 0, 3, 0, 2411, 0 }, { 0, 2, 0, 2414, 0 }, { 0, 3, 0, 2416, 0 },
+        { 0, 2, 0, 2419, 0 }, { 0, 3, 0, 2421, 0 }, { 0, 2, 2, 2424, 2122 }, { 0, 2, 2, 2426, 2126 },
+        { 0, 2, 2, 2428, 2414 }, { 0, 1, 0, 2430, 0 }, { 0, 1, 0, 2431, 0 }, { 0, 1, 0, 2432, 0 },
+        { 0, 1, 1, 2433, 696 }, { 0, 1, 1, 2434, 10 }, { 0, 0, 1, 0, 2435 }, { 0, 0, 1, 0, 2436 },
+        { 0, 0, 1, 0, 2437 }, { 0, 0, 1, 0, 2438 }, { 0, 0, 1, 0, 2439 }, { 0, 0, 1, 0, 2440 },
+        { 0, 0, 1, 0, 2441 }, { 0, 0, 1, 0, 2442 }, { 0, 0, 1, 0, 2443 }, { 0, 0, 1, 0, 2444 },
+        { 0, 0, 1, 0, 2445 }, { 0, 0, 1, 0, 2446 }, { 0, 0, 1, 0, 2447 }, { 0, 0, 1, 0, 2448 },
+        { 0, 0, 1, 0, 2449 }, { 0, 0, 1, 0, 2450 }, { 0, 0, 1, 0, 2451 }, { 0, 0, 1, 0, 2452 },
+        { 0, 2, 0, 2453, 0 }, { 0, 2, 0, 2455, 0 }, { 0, 2, 0, 2457, 0 }, { 0, 2, 0, 2459, 0 },
+        { 0, 2, 0, 2461, 0 }, { 0, 2, 0, 2463, 0 }, { 0, 2, 0, 2465, 0 }, { 0, 2, 0, 2467, 0 },
+        { 0, 2, 0, 2469, 0 }, { 0, 2, 0, 2471, 0 }, { 0, 2, 0, 2473, 0 }, { 0, 2, 0, 2475, 0 },
+        { 0, 2, 0, 2477, 0 }, { 0, 2, 0, 2479, 0 }, { 0, 2, 0, 2481, 0 }, { 0, 2, 0, 2483, 0 },
+        { 0, 2, 0, 2485, 0 }, { 0, 2, 0, 2487, 0 }, { 0, 2, 0, 2489, 0 }, { 0, 2, 0, 2491, 0 },
+        { 0, 2, 0, 2493, 0 }, { 0, 2, 0, 2495, 0 }, { 0, 2, 0, 2497, 0 }, { 0, 2, 0, 2499, 0 },
+        { 0, 2, 0, 2501, 0 }, { 0, 2, 0, 2503, 0 }, { 0, 2, 0, 2505, 0 }, { 0, 2, 0, 2507, 0 },
+        { 0, 2, 0, 2509, 0 }, { 0, 2, 0, 2511, 0 }, { 0, 2, 0, 2513, 0 }, { 0, 2, 0, 2515, 0 },
+        { 0, 2, 0, 2517, 0 }, { 0, 2, 0, 2519, 0 }, { 0, 2, 0, 2521, 0 }, { 0, 2, 0, 2523, 0 },
+        { 0, 2, 0, 2525, 0 }, { 0, 2, 0, 2527, 0 }, { 0, 2, 0, 2529, 0 }, { 0, 2, 0, 2531, 0 },
+        { 0, 2, 0, 2533, 0 }, { 0, 2, 0, 2535, 0 }, { 0, 2, 0, 2537, 0 }, { 0, 2, 0, 2539, 0 },
+        { 0, 1, 0, 2541, 0 }, { 0, 1, 0, 2542, 0 }, { 0, 0, 1, 0, 2543 }, { 0, 0, 1, 0, 2544 },
+        { 0, 0, 1, 0, 2545 }, { 0, 0, 1, 0, 2546 }, { 0, 0, 1, 0, 2547 }, { 0, 0, 1, 0, 2548 },
+        { 0, 0, 1, 0, 2549 }, { 0, 0, 1, 0, 2550 }, { 0, 0, 1, 0, 2551 }, { 0, 0, 1, 0, 2552 },
+        { 0, 0, 1, 0, 2553 }, { 0, 0, 1, 0, 2554 }, { 0, 0, 1, 0, 2555 }, { 0, 0, 1, 0, 2556 },
+        { 0, 0, 1, 0, 2557 }, { 0, 0, 1, 0, 2558 }, { 0, 0, 1, 0, 2559 }, { 0, 0, 1, 0, 2560 },
+        { 0, 0, 1, 0, 2561 }, { 0, 0, 1, 0, 2562 }, { 0, 0, 1, 0, 2563 }, { 0, 0, 1, 0, 2564 },
+        { 0, 0, 1, 0, 2565 }, { 0, 0, 1, 0, 2566 }, { 0, 0, 1, 0, 2567 }, { 0, 0, 1, 0, 2568 },
+        { 0, 2, 0, 2569, 0 }, { 0, 0, 1, 0, 2571 }, { 0, 0, 1, 0, 2572 }, { 0, 0, 1, 0, 2573 },
+        { 0, 0, 1, 0, 2574 }, { 0, 0, 1, 0, 2575 }, { 0, 0, 1, 0, 2576 }, { 0, 0, 1, 0, 2577 },
+        { 0, 0, 1, 0, 2578 }, { 0, 0, 1, 0, 2579 }, { 0, 0, 1, 0, 2580 }, { 0, 0, 1, 0, 2581 },
+        { 0, 0, 1, 0, 2582 }, { 0, 0, 1, 0, 2583 }, { 0, 0, 1, 0, 2584 }, { 0, 0, 1, 0, 2585 },
+        { 0, 0, 1, 0, 2586 }, { 0, 0, 1, 0, 2587 }, { 0, 0, 1, 0, 2588 }, { 0, 0, 1, 0, 2589 },
+        { 0, 0, 1, 0, 2590 }, { 0, 0, 1, 0, 2591 }, { 0, 0, 1, 0, 2592 }, { 0, 0, 1, 0, 2593 },
+        { 0, 0, 1, 0, 2594 }, { 0, 0, 1, 0, 2595 }, { 0, 0, 1, 0, 2596 }, { 0, 0, 1, 0, 2597 },
+        { 0, 0, 1, 0, 2598 }, { 0, 0, 1, 0, 2599 }, { 0, 0, 1, 0, 2600 }, { 0, 0, 1, 0, 2601 },
+        { 0, 0, 1, 0, 2602 }, { 0, 0, 1, 0, 2603 }, { 0, 0, 1, 0, 2604 }, { 0, 0, 1, 0, 2605 },
+        { 0, 0, 1, 0, 2606 }, { 0, 0, 1, 0, 2607 }, { 0, 0, 1, 0, 2608 }, { 0, 0, 1, 0, 2609 },
+        { 0, 0, 1, 0, 2610 }, { 0, 0, 1, 0, 2611 }, { 0, 0, 1, 0, 2612 }, { 0, 0, 1, 0, 2613 },
+        { 0, 0, 1, 0, 2614 }, { 0, 0, 1, 0, 2615 }, { 0, 0, 1, 0, 2616 }, { 0, 0, 1, 0, 2617 },
+        { 0, 0, 1, 0, 2618 }, { 0, 0, 1, 0, 2619 }, { 0, 0, 1, 0, 2620 }, { 0, 0, 1, 0, 2621 },
+        { 0, 0, 1, 0, 2622 }, { 0, 0, 1, 0, 2623 }, { 0, 0, 1, 0, 2624 }, { 0, 0, 1, 0, 2625 },
+        { 0, 0, 1, 0, 2626 }, { 0, 0, 1, 0, 2627 }, { 0, 0, 1, 0, 2628 }, { 0, 0, 1, 0, 2629 },
+        { 0, 0, 1, 0, 2630 }, { 0, 0, 1, 0, 2631 }, { 0, 0, 1, 0, 2632 }, { 0, 0, 1, 0, 2633 },
+        { 0, 0, 1, 0, 2634 }, { 0, 0, 1, 0, 2635 }, { 0, 0, 1, 0, 2636 }, { 0, 0, 1, 0, 2637 },
+        { 0, 0, 1, 0, 2638 }, { 0, 0, 1, 0, 2639 }, { 0, 0, 1, 0, 2640 }, { 0, 0, 1, 0, 2641 },
+        { 0, 0, 1, 0, 2642 }, { 0, 0, 1, 0, 2643 }, { 0, 0, 1, 0, 2644 }, { 0, 0, 1, 0, 2645 },
+        { 0, 0, 1, 0, 2646 }, { 0, 0, 1, 0, 2647 }, { 0, 0, 1, 0, 2648 }, { 0, 0, 1, 0, 2649 },
+        { 0, 0, 1, 0, 2650 }, { 0, 0, 1, 0, 2651 }, { 0, 0, 1, 0, 2652 }, { 0, 0, 1, 0, 2653 },
+        { 0, 0, 1, 0, 2654 }, { 0, 0, 1, 0, 2655 }, { 0, 0, 1, 0, 2656 }, { 0, 0, 1, 0, 2657 },
+        { 0, 0, 1, 0, 2658 }, { 0, 0, 1, 0, 2659 }, { 0, 0, 1, 0, 2660 }, { 0, 0, 1, 0, 2661 },
+        { 0, 0, 1, 0, 2662 }, { 0, 0, 1, 0, 2663 }, { 0, 0, 1, 0, 2664 }, { 0, 0, 1, 0, 2665 },
+        { 0, 0, 1, 0, 2666 }, { 0, 0, 1, 0, 2667 }, { 0, 0, 1, 0, 2668 }, { 0, 0, 1, 0, 2669 },
+        { 0, 0, 1, 0, 2670 }, { 0, 0, 1, 0, 2671 }, { 0, 0, 1, 0, 2672 }, { 0, 0, 1, 0, 2673 },
+        { 0, 0, 1, 0, 2674 }, { 0, 0, 1, 0, 2675 }, { 0, 0, 1, 0, 2676 }, { 0, 0, 1, 0, 2677 },
+        { 0, 0, 1, 0, 2678 }, { 0, 0, 1, 0, 2679 }, { 0, 0, 1, 0, 2680 }, { 0, 0, 1, 0, 2681 },
+        { 0, 0, 1, 0, 2682 }, { 0, 0, 1, 0, 2683 }, { 0, 0, 1, 0, 2684 }, { 0, 0, 1, 0, 2685 },
+        { 0, 0, 1, 0, 2686 }, { 224, 0, 0, 0, 0 }, { 0, 2, 0, 2687, 0 }, { 0, 2, 0, 2689, 0 },
+        { 0, 2, 0, 2691, 0 }, { 0, 2, 0, 2693, 0 }, { 0, 2, 0, 2695, 0 }, { 0, 2, 0, 2697, 0 },
+        { 0, 2, 0, 2699, 0 }, { 0, 2, 0, 2701, 0 }, { 0, 2, 0, 2703, 0 }, { 0, 2, 0, 2705, 0 },
+        { 0, 2, 0, 2707, 0 }, { 0, 2, 0, 2709, 0 }, { 0, 2, 0, 2711, 0 }, { 0, 2, 0, 2713, 0 },
+        { 0, 2, 0, 2715, 0 }, { 0, 2, 0, 2717, 0 }, { 0, 2, 0, 2719, 0 }, { 0, 2, 0, 2721, 0 },
+        { 0, 2, 0, 2723, 0 }, { 0, 2, 0, 2725, 0 }, { 0, 2, 0, 2727, 0 }, { 0, 2, 0, 2729, 0 },
+        { 0, 2, 0, 2731, 0 }, { 0, 2, 0, 2733, 0 }, { 0, 2, 0, 2735, 0 }, { 0, 2, 0, 2737, 0 },
+        { 8, 0, 0, 0, 0 }, { 0, 2, 0, 2739, 0 }, { 0, 2, 0, 2741, 0 }, { 0, 2, 0, 2743, 0 },
+        { 0, 2, 0, 2745, 0 }, { 0, 2, 0, 2747, 0 }, { 0, 2, 0, 2749, 0 }, { 0, 2, 0, 2751, 0 },
+        { 0, 2, 0, 2753, 0 }, { 0, 2, 0, 2755, 0 }, { 0, 2, 0, 2757, 0 }, { 0, 2, 0, 2759, 0 },
+        { 0, 2, 0, 2761, 0 }, { 0, 2, 0, 2763, 0 }, { 0, 2, 0, 2765, 0 }, { 0, 2, 0, 2767, 0 },
+        { 0, 2, 0, 2769, 0 }, { 0, 2, 0, 2771, 0 }, { 0, 2, 0, 2773, 0 }, { 0, 2, 0, 2775, 0 },
+        { 0, 2, 0, 2777, 0 }, { 0, 2, 0, 2779, 0 }, { 0, 2, 0, 2781, 0 }, { 0, 2, 0, 2783, 0 },
+        { 0, 2, 0, 2785, 0 }, { 0, 2, 0, 2787, 0 }, { 0, 2, 0, 2789, 0 }, { 0, 2, 0, 2791, 0 },
+        { 0, 2, 0, 2793, 0 }, { 0, 2, 0, 2795, 0 }, { 0, 2, 0, 2797, 0 }, { 0, 2, 0, 2799, 0 },
+        { 0, 2, 0, 2801, 0 }, { 0, 0, 1, 0, 2803 }, { 0, 0, 1, 0, 2804 }, { 0, 0, 1, 0, 2805 },
+        { 0, 0, 1, 0, 2806 }, { 0, 0, 1, 0, 2807 }, { 0, 0, 1, 0, 2808 }, { 0, 0, 1, 0, 2809 },
+        { 0, 0, 1, 0, 2810 }, { 0, 0, 1, 0, 2811 }, { 0, 0, 1, 0, 2812 }, { 0, 0, 1, 0, 2813 },
+        { 0, 0, 1, 0, 2814 }, { 0, 0, 1, 0, 2815 }, { 0, 0, 1, 0, 2816 }, { 0, 0, 1, 0, 2817 },
+        { 0, 0, 1, 0, 2818 }, { 0, 0, 1, 0, 2819 }, { 0, 0, 1, 0, 2820 }, { 0, 0, 1, 0, 2821 },
+        { 0, 0, 1, 0, 2822 }, { 0, 0, 1, 0, 2823 }, { 0, 0, 1, 0, 2824 }, { 0, 0, 1, 0, 2825 },
+        { 0, 0, 1, 0, 2826 }, { 0, 0, 1, 0, 2827 }, { 0, 0, 1, 0, 2828 }, { 0, 0, 1, 0, 2829 },
+        { 0, 0, 1, 0, 2830 }, { 0, 0, 1, 0, 2831 }, { 0, 0, 1, 0, 2832 }, { 0, 0, 1, 0, 2833 },
+        { 0, 0, 1, 0, 2834 }, { 0, 0, 1, 0, 2835 }, { 0, 0, 1, 0, 2836 }, { 0, 0, 1, 0, 2837 },
+        { 0, 0, 1, 0, 2838 }, { 0, 0, 1, 0, 2839 }, { 0, 0, 1, 0, 2840 }, { 0, 0, 1, 0, 2841 },
+        { 0, 0, 1, 0, 2842 }, { 0, 0, 1, 0, 2843 }, { 0, 0, 1, 0, 2844 }, { 0, 0, 1, 0, 2845 },
+        { 0, 0, 1, 0, 2846 }, { 0, 0, 1, 0, 2847 }, { 0, 0, 1, 0, 2848 }, { 0, 0, 1, 0, 2849 },
+        { 0, 0, 1, 0, 2850 }, { 0, 0, 1, 0, 2851 }, { 0, 0, 1, 0, 2852 }, { 0, 0, 1, 0, 2853 },
+        { 0, 0, 1, 0, 2854 }, { 0, 0, 1, 0, 2855 }, { 0, 0, 1, 0, 2856 }, { 0, 0, 1, 0, 2857 },
+        { 0, 0, 1, 0, 2858 }, { 0, 0, 1, 0, 2859 }, { 0, 0, 1, 0, 2860 }, { 0, 0, 1, 0, 2861 },
+        { 0, 0, 1, 0, 2862 }, { 0, 0, 1, 0, 2863 }, { 0, 0, 1, 0, 2864 }, { 0, 0, 1, 0, 2865 },
+        { 0, 0, 1, 0, 2866 }, { 0, 0, 1, 0, 2867 }, { 0, 0, 1, 0, 2868 }, { 0, 0, 1, 0, 2869 },
+        { 0, 0, 1, 0, 2870 }, { 0, 0, 1, 0, 2871 }, { 0, 0, 1, 0, 2872 }, { 0, 0, 1, 0, 2873 },
+        { 0, 0, 1, 0, 2874 }, { 0, 0, 1, 0, 2875 }, { 0, 0, 1, 0, 2876 }, { 0, 0, 1, 0, 2877 },
+        { 0, 0, 1, 0, 2878 }, { 0, 0, 1, 0, 2879 }, { 0, 0, 1, 0, 2880 }, { 0, 0, 1, 0, 2881 },
+        { 0, 0, 1, 0, 2882 }, { 0, 0, 1, 0, 2883 }, { 0, 0, 1, 0, 2884 }, { 0, 0, 1, 0, 2885 },
+        { 0, 0, 1, 0, 2886 }, { 0, 0, 1, 0, 2887 }, { 0, 0, 1, 0, 2888 }, { 0, 0, 1, 0, 2889 },
+        { 0, 0, 1, 0, 2890 }, { 0, 0, 1, 0, 2891 }, { 0, 0, 1, 0, 2892 }, { 0, 0, 1, 0, 2893 },
+        { 0, 0, 1, 0, 2894 }, { 0, 0, 1, 0, 2895 }, { 0, 0, 1, 0, 2896 }, { 0, 0, 1, 0, 2897 },
+        { 0, 0, 1, 0, 2898 }, { 0, 0, 1, 0, 2899 }, { 0, 0, 1, 0, 2900 }, { 0, 0, 1, 0, 2901 },
+        { 0, 0, 1, 0, 2902 }, { 0, 0, 1, 0, 2903 }, { 0, 0, 1, 0, 2904 }, { 0, 0, 1, 0, 2905 },
+        { 0, 0, 1, 0, 2906 }, { 0, 0, 1, 0, 2907 }, { 0, 0, 1, 0, 2908 }, { 0, 0, 1, 0, 2909 },
+        { 0, 0, 1, 0, 2910 }, { 0, 0, 1, 0, 2911 }, { 0, 0, 1, 0, 2912 }, { 0, 0, 1, 0, 2913 },
+        { 0, 0, 1, 0, 2914 }, { 0, 0, 1, 0, 2915 }, { 0, 0, 1, 0, 2916 }, { 0, 0, 1, 0, 2917 },
+        { 0, 0, 1, 0, 2918 }, { 0, 0, 1, 0, 2919 }, { 0, 0, 1, 0, 2920 }, { 0, 0, 1, 0, 2921 },
+        { 0, 0, 1, 0, 2922 }, { 0, 0, 1, 0, 2923 }, { 0, 0, 1, 0, 2924 }, { 0, 0, 1, 0, 2925 },
+        { 0, 0, 1, 0, 2926 }, { 0, 0, 1, 0, 2927 }, { 0, 0, 1, 0, 2928 }, { 0, 0, 1, 0, 2929 },
+        { 0, 0, 1, 0, 2930 }, { 0, 0, 1, 0, 2931 }, { 0, 0, 1, 0, 2932 }, { 0, 0, 1, 0, 2933 },
+        { 0, 0, 1, 0, 2934 }, { 0, 0, 1, 0, 2935 }, { 0, 0, 1, 0, 2936 }, { 0, 0, 1, 0, 2937 },
+        { 0, 0, 1, 0, 2938 }, { 0, 0, 1, 0, 2939 }, { 0, 0, 1, 0, 2940 }, { 0, 0, 1, 0, 2941 },
+        { 0, 0, 1, 0, 2942 }, { 0, 0, 1, 0, 2943 }, { 0, 0, 1, 0, 2944 }, { 0, 0, 1, 0, 2945 },
+        { 0, 0, 1, 0, 2946 }, { 0, 0, 1, 0, 2947 }, { 0, 0, 1, 0, 2948 }, { 0, 0, 1, 0, 2949 },
+        { 0, 0, 1, 0, 2950 }, { 0, 0, 1, 0, 2951 }, { 0, 0, 1, 0, 2952 }, { 0, 0, 1, 0, 2953 },
+        { 0, 0, 1, 0, 2954 }, { 0, 0, 1, 0, 2955 }, { 0, 0, 1, 0, 2956 }, { 0, 0, 1, 0, 2957 },
+        { 0, 0, 1, 0, 2958 }, { 0, 0, 1, 0, 2959 }, { 0, 0, 1, 0, 2960 }, { 0, 0, 1, 0, 2961 },
+        { 0, 0, 1, 0, 2962 }, { 0, 0, 1, 0, 2963 }, { 0, 0, 1, 0, 2964 }, { 0, 0, 1, 0, 2965 },
+        { 0, 0, 1, 0, 2966 }, { 0, 0, 1, 0, 2967 }, { 0, 0, 1, 0, 2968 }, { 0, 0, 1, 0, 2969 },
+        { 0, 0, 1, 0, 2970 }, { 0, 0, 1, 0, 2971 }, { 0, 0, 1, 0, 2972 }, { 0, 0, 1, 0, 2973 },
+        { 0, 0, 1, 0, 2974 }, { 0, 0, 1, 0, 2975 }, { 0, 0, 1, 0, 2976 }, { 0, 0, 1, 0, 2977 },
+        { 0, 0, 1, 0, 2978 }, { 0, 0, 1, 0, 2979 }, { 0, 0, 1, 0, 2980 }, { 0, 0, 1, 0, 2981 },
+        { 0, 0, 1, 0, 2982 }, { 0, 0, 1, 0, 2983 }, { 0, 0, 1, 0, 2984 }, { 0, 0, 1, 0, 2985 },
+        { 0, 0, 1, 0, 2986 }, { 0, 0, 1, 0, 2987 }, { 0, 0, 1, 0, 2988 }, { 0, 0, 1, 0, 2989 },
+        { 0, 0, 1, 0, 2990 }, { 0, 0, 1, 0, 2991 }, { 0, 0, 1, 0, 2992 }, { 0, 0, 1, 0, 2993 },
+        { 0, 0, 1, 0, 2994 }, { 0, 0, 1, 0, 2995 }, { 0, 0, 1, 0, 2996 }, { 0, 0, 1, 0, 2997 },
+        { 0, 0, 1, 0, 2998 }, { 0, 0, 1, 0, 2999 }, { 0, 0, 1, 0, 3000 }, { 0, 0, 1, 0, 3001 },
+        { 0, 0, 1, 0, 3002 }, { 0, 0, 1, 0, 3003 }, { 0, 0, 1, 0, 3004 }, { 0, 1, 0, 3005, 0 },
+        { 0, 1, 0, 3006, 0 }, { 0, 1, 0, 3007, 0 }, { 0, 1, 0, 3008, 0 }, { 0, 1, 0, 3009, 0 },
+        { 0, 1, 0, 3010, 0 }, { 0, 1, 0, 3011, 0 }, { 0, 1, 0, 3012, 0 }, { 0, 1, 0, 3013, 0 },
+        { 0, 1, 0, 3014, 0 }, { 0, 1, 0, 3015, 0 }, { 0, 1, 0, 3016, 0 }, { 0, 1, 0, 3017, 0 },
+        { 0, 1, 0, 3018, 0 }, { 0, 1, 0, 3019, 0 }, { 0, 1, 0, 3020, 0 }, { 0, 1, 0, 3021, 0 },
+        { 0, 1, 0, 3022, 0 }, { 0, 1, 0, 3023, 0 }, { 0, 1, 0, 3024, 0 }, { 0, 1, 0, 3025, 0 },
+        { 0, 1, 0, 3026, 0 }, { 0, 1, 0, 3027, 0 }, { 0, 1, 0, 3028, 0 }, { 0, 1, 0, 3029, 0 },
+        { 0, 1, 0, 3030, 0 }, { 0, 1, 0, 3031, 0 }, { 0, 1, 0, 3032, 0 }, { 0, 1, 0, 3033, 0 },
+        { 0, 1, 0, 3034, 0 }, { 0, 1, 0, 3035, 0 }, { 0, 1, 0, 3036, 0 }, { 0, 1, 0, 3037, 0 },
+        { 0, 1, 0, 3038, 0 }, { 0, 1, 0, 3039, 0 }, { 0, 1, 0, 3040, 0 }, { 0, 1, 0, 3041, 0 },
+        { 0, 1, 0, 3042, 0 }, { 0, 1, 0, 3043, 0 }, { 0, 1, 0, 3044, 0 }, { 0, 1, 0, 3045, 0 },
+        { 0, 1, 0, 3046, 0 }, { 0, 1, 0, 3047, 0 }, { 0, 1, 0, 3048, 0 }, { 0, 1, 0, 3049, 0 },
+        { 0, 1, 0, 3050, 0 }, { 0, 1, 0, 3051, 0 }, { 0, 1, 0, 3052, 0 }, { 0, 1, 0, 3053, 0 },
+        { 0, 1, 0, 3054, 0 }, { 0, 1, 0, 3055, 0 }, { 0, 1, 0, 3056, 0 }, { 0, 1, 0, 3057, 0 },
+        { 0, 1, 0, 3058, 0 }, { 0, 1, 0, 3059, 0 }, { 0, 1, 0, 3060, 0 }, { 0, 1, 0, 3061, 0 },
+        { 0, 1, 0, 3062, 0 }, { 0, 1, 0, 3063, 0 }, { 0, 1, 0, 3064, 0 }, { 0, 1, 0, 3065, 0 },
+        { 0, 1, 0, 3066, 0 }, { 0, 1, 0, 3067, 0 }, { 0, 1, 0, 3068, 0 }, { 0, 1, 0, 3069, 0 },
+        { 0, 1, 0, 3070, 0 }, { 0, 1, 0, 3071, 0 }, { 0, 1, 0, 3072, 0 }, { 0, 1, 0, 3073, 0 },
+        { 0, 1, 0, 3074, 0 }, { 0, 1, 0, 3075, 0 }, { 0, 1, 0, 3076, 0 }, { 0, 1, 0, 3077, 0 },
+        { 0, 1, 0, 3078, 0 }, { 0, 1, 0, 3079, 0 }, { 0, 1, 0, 3080, 0 }, { 0, 1, 0, 3081, 0 },
+        { 0, 1, 0, 3082, 0 }, { 0, 1, 0, 3083, 0 }, { 0, 1, 0, 3084, 0 }, { 0, 1, 0, 3085, 0 },
+        { 0, 1, 0, 3086, 0 }, { 0, 1, 0, 3087, 0 }, { 0, 1, 0, 3088, 0 }, { 0, 1, 0, 3089, 0 },
+        { 0, 1, 0, 3090, 0 }, { 0, 1, 0, 3091, 0 }, { 0, 1, 0, 3092, 0 }, { 0, 1, 0, 3093, 0 },
+        { 0, 1, 0, 3094, 0 }, { 0, 1, 0, 3095, 0 }, { 0, 1, 0, 3096, 0 }, { 0, 1, 0, 3097, 0 },
+        { 0, 1, 0, 3098, 0 }, { 0, 1, 0, 3099, 0 }, { 0, 1, 0, 3100, 0 }, { 0, 1, 0, 3101, 0 },
+        { 0, 1, 0, 3102, 0 }, { 0, 1, 0, 3103, 0 }, { 0, 1, 0, 3104, 0 }, { 0, 1, 0, 3105, 0 },
+        { 0, 1, 0, 3106, 0 }, { 0, 1, 0, 3107, 0 }, { 0, 1, 0, 3108, 0 }, { 0, 1, 0, 3109, 0 },
+        { 0, 1, 0, 3110, 0 }, { 0, 1, 0, 3111, 0 }, { 0, 1, 0, 3112, 0 }, { 0, 1, 0, 3113, 0 },
+        { 0, 1, 0, 3114, 0 }, { 0, 1, 0, 3115, 0 }, { 0, 1, 0, 3116, 0 }, { 0, 1, 0, 3117, 0 },
+        { 0, 1, 0, 3118, 0 }, { 0, 1, 0, 3119, 0 }, { 0, 1, 0, 3120, 0 }, { 0, 1, 0, 3121, 0 },
+        { 0, 1, 0, 3122, 0 }, { 0, 1, 0, 3123, 0 }, { 0, 1, 0, 3124, 0 }, { 0, 1, 0, 3125, 0 },
+        { 0, 1, 0, 3126, 0 }, { 0, 1, 0, 3127, 0 }, { 0, 1, 0, 3128, 0 }, { 0, 1, 0, 3129, 0 },
+        { 0, 1, 0, 3130, 0 }, { 0, 1, 0, 3131, 0 }, { 0, 1, 0, 3132, 0 }, { 0, 1, 0, 3133, 0 },
+        { 0, 1, 0, 3134, 0 }, { 0, 1, 0, 3135, 0 }, { 0, 1, 0, 3136, 0 }, { 0, 1, 0, 3137, 0 },
+        { 0, 1, 0, 3138, 0 }, { 0, 1, 0, 3139, 0 }, { 0, 1, 0, 3140, 0 }, { 0, 1, 0, 3141, 0 },
+        { 0, 1, 0, 3142, 0 }, { 0, 1, 0, 3143, 0 }, { 0, 1, 0, 3144, 0 }, { 0, 1, 0, 3145, 0 },
+        { 0, 1, 0, 3146, 0 }, { 0, 1, 0, 3147, 0 }, { 0, 1, 0, 3148, 0 }, { 0, 1, 0, 3149, 0 },
+        { 0, 1, 0, 3150, 0 }, { 0, 1, 0, 3151, 0 }, { 0, 1, 0, 3152, 0 }, { 0, 1, 0, 3153, 0 },
+        { 0, 1, 0, 3154, 0 }, { 0, 1, 0, 3155, 0 }, { 0, 1, 0, 3156, 0 }, { 0, 1, 0, 3157, 0 },
+        { 0, 1, 0, 3158, 0 }, { 0, 1, 0, 3159, 0 }, { 0, 1, 0, 3160, 0 }, { 0, 1, 0, 3161, 0 },
+        { 0, 1, 0, 3162, 0 }, { 0, 1, 0, 3163, 0 }, { 0, 1, 0, 3164, 0 }, { 0, 1, 0, 3165, 0 },
+        { 0, 1, 0, 3166, 0 }, { 0, 1, 0, 3167, 0 }, { 0, 1, 0, 3168, 0 }, { 0, 1, 0, 3169, 0 },
+        { 0, 1, 0, 3170, 0 }, { 0, 1, 0, 3171, 0 }, { 0, 1, 0, 3172, 0 }, { 0, 1, 0, 3173, 0 },
+        { 0, 1, 0, 3174, 0 }, { 0, 1, 0, 3175, 0 }, { 0, 1, 0, 3176, 0 }, { 0, 1, 0, 3177, 0 },
+        { 0, 1, 0, 3178, 0 }, { 0, 1, 0, 3179, 0 }, { 0, 1, 0, 3180, 0 }, { 0, 1, 0, 3181, 0 },
+        { 0, 1, 0, 3182, 0 }, { 0, 1, 0, 3183, 0 }, { 0, 1, 0, 3184, 0 }, { 0, 1, 0, 3185, 0 },
+        { 0, 1, 0, 3186, 0 }, { 0, 1, 0, 3187, 0 }, { 0, 1, 0, 3188, 0 }, { 0, 1, 0, 3189, 0 },
+        { 0, 1, 0, 3190, 0 }, { 0, 1, 0, 3191, 0 }, { 0, 1, 0, 3192, 0 }, { 0, 1, 0, 3193, 0 },
+        { 0, 1, 0, 3194, 0 }, { 0, 1, 0, 3195, 0 }, { 0, 1, 0, 3196, 0 }, { 0, 1, 0, 3197, 0 },
+        { 0, 1, 0, 3198, 0 }, { 0, 1, 0, 3199, 0 }, { 0, 1, 0, 3200, 0 }, { 0, 1, 0, 3201, 0 },
+        { 0, 1, 0, 3202, 0 }, { 0, 1, 0, 3203, 0 }, { 0, 1, 0, 3204, 0 }, { 0, 1, 0, 3205, 0 },
+        { 0, 1, 0, 3206, 0 }, { 0, 1, 0, 3207, 0 }, { 0, 1, 0, 3208, 0 }, { 0, 1, 0, 3209, 0 },
+        { 0, 1, 0, 3210, 0 }, { 0, 1, 0, 3211, 0 }, { 0, 1, 0, 3212, 0 }, { 0, 1, 0, 3213, 0 },
+        { 0, 1, 0, 3214, 0 }, { 0, 1, 0, 3215, 0 }, { 0, 1, 0, 3216, 0 }, { 0, 1, 0, 3217, 0 },
+        { 0, 1, 0, 3218, 0 }, { 0, 1, 0, 3219, 0 }, { 0, 1, 0, 3220, 0 }, { 0, 1, 0, 3221, 0 },
+        { 0, 1, 0, 3222, 0 }, { 0, 1, 0, 3223, 0 }, { 0, 1, 0, 3224, 0 }, { 0, 1, 0, 3225, 0 },
+        { 0, 1, 0, 3226, 0 }, { 0, 1, 0, 3227, 0 }, { 0, 1, 0, 3228, 0 }, { 0, 1, 0, 3229, 0 },
+        { 0, 1, 0, 3230, 0 }, { 0, 1, 0, 3231, 0 }, { 0, 1, 0, 3232, 0 }, { 0, 1, 0, 3233, 0 },
+        { 0, 1, 0, 3234, 0 }, { 0, 1, 0, 3235, 0 }, { 0, 1, 0, 3236, 0 }, { 0, 1, 0, 3237, 0 },
+        { 0, 1, 0, 3238, 0 }, { 0, 1, 0, 3239, 0 }, { 0, 1, 0, 3240, 0 }, { 0, 1, 0, 3241, 0 },
+        { 0, 1, 0, 3242, 0 }, { 0, 1, 0, 3243, 0 }, { 0, 1, 0, 3244, 0 }, { 0, 1, 0, 3245, 0 },
+        { 0, 1, 0, 3246, 0 }, { 0, 1, 0, 3247, 0 }, { 0, 1, 0, 3248, 0 }, { 0, 1, 0, 3249, 0 },
+        { 0, 1, 0, 3250, 0 }, { 0, 1, 0, 3251, 0 }, { 0, 1, 0, 3252, 0 }, { 0, 1, 0, 3253, 0 },
+        { 0, 1, 0, 3254, 0 }, { 0, 1, 0, 3255, 0 }, { 0, 1, 0, 3256, 0 }, { 0, 1, 0, 3257, 0 },
+        { 0, 1, 0, 3258, 0 }, { 0, 1, 0, 3259, 0 }, { 0, 1, 0, 3260, 0 }, { 0, 1, 0, 3261, 0 },
+        { 0, 1, 0, 3262, 0 }, { 0, 1, 0, 3263, 0 }, { 0, 1, 0, 3264, 0 }, { 0, 1, 0, 3265, 0 },
+        { 0, 1, 0, 3266, 0 }, { 0, 1, 0, 3267, 0 }, { 0, 1, 0, 3268, 0 }, { 0, 1, 0, 3269, 0 },
+        { 0, 1, 0, 3270, 0 }, { 0, 1, 0, 3271, 0 }, { 0, 1, 0, 3272, 0 }, { 0, 1, 0, 3273, 0 },
+        { 0, 1, 0, 3274, 0 }, { 0, 1, 0, 3275, 0 }, { 0, 1, 0, 3276, 0 }, { 0, 1, 0, 3277, 0 },
+        { 0, 1, 0, 3278, 0 }, { 0, 1, 0, 3279, 0 }, { 0, 1, 0, 3280, 0 }, { 0, 1, 0, 3281, 0 },
+        { 0, 1, 0, 3282, 0 }, { 0, 1, 0, 3283, 0 }, { 0, 1, 0, 3284, 0 }, { 0, 1, 0, 3285, 0 },
+        { 0, 1, 0, 3286, 0 }, { 0, 1, 0, 3287, 0 }, { 0, 1, 0, 3288, 0 }, { 0, 1, 0, 3289, 0 },
+        { 0, 1, 0, 3290, 0 }, { 0, 1, 0, 3291, 0 }, { 0, 1, 0, 3292, 0 }, { 0, 1, 0, 3293, 0 },
+        { 0, 1, 0, 3294, 0 }, { 0, 1, 0, 3295, 0 }, { 0, 1, 0, 3296, 0 }, { 0, 1, 0, 3297, 0 },
+        { 0, 1, 0, 3298, 0 }, { 0, 1, 0, 3299, 0 }, { 0, 1, 0, 3300, 0 }, { 0, 1, 0, 3301, 0 },
+        { 0, 1, 0, 3302, 0 }, { 0, 1, 0, 3303, 0 }, { 0, 1, 0, 3304, 0 }, { 0, 1, 0, 3305, 0 },
+        { 0, 1, 0, 3306, 0 }, { 0, 1, 0, 3307, 0 }, { 0, 1, 0, 3308, 0 }, { 0, 1, 0, 3309, 0 },
+        { 0, 1, 0, 3310, 0 }, { 0, 1, 0, 3311, 0 }, { 0, 1, 0, 3312, 0 }, { 0, 1, 0, 3313, 0 },
+        { 0, 1, 0, 3314, 0 }, { 0, 1, 0, 3315, 0 }, { 0, 1, 0, 3316, 0 }, { 0, 1, 0, 3317, 0 },
+        { 0, 1, 0, 3318, 0 }, { 0, 1, 0, 3319, 0 }, { 0, 1, 0, 3320, 0 }, { 0, 1, 0, 3321, 0 },
+        { 0, 1, 0, 3322, 0 }, { 0, 1, 0, 3323, 0 }, { 0, 1, 0, 3324, 0 }, { 0, 1, 0, 3325, 0 },
+        { 0, 1, 0, 3326, 0 }, { 0, 1, 0, 3327, 0 }, { 0, 1, 0, 3328, 0 }, { 0, 1, 0, 3329, 0 },
+        { 0, 1, 0, 3330, 0 }, { 0, 1, 0, 3331, 0 }, { 0, 1, 0, 3332, 0 }, { 0, 1, 0, 3333, 0 },
+        { 0, 1, 0, 3334, 0 }, { 0, 1, 0, 3335, 0 }, { 0, 1, 0, 3336, 0 }, { 0, 1, 0, 3337, 0 },
+        { 0, 1, 0, 3338, 0 }, { 0, 1, 0, 3339, 0 }, { 0, 1, 0, 3340, 0 }, { 0, 1, 0, 3341, 0 },
+        { 0, 1, 0, 3342, 0 }, { 0, 1, 0, 3343, 0 }, { 0, 1, 0, 3344, 0 }, { 0, 1, 0, 3345, 0 },
+        { 0, 1, 0, 3346, 0 }, { 0, 1, 0, 3347, 0 }, { 0, 1, 0, 3348, 0 }, { 0, 1, 0, 3349, 0 },
+        { 0, 1, 0, 3350, 0 }, { 0, 1, 0, 3351, 0 }, { 0, 1, 0, 3352, 0 }, { 0, 1, 0, 3353, 0 },
+        { 0, 1, 0, 3354, 0 }, { 0, 1, 0, 3355, 0 }, { 0, 1, 0, 3356, 0 }, { 0, 1, 0, 3357, 0 },
+        { 0, 1, 0, 3358, 0 }, { 0, 1, 0, 3359, 0 }, { 0, 1, 0, 3360, 0 }, { 0, 1, 0, 3361, 0 },
+        { 0, 1, 0, 3362, 0 }, { 0, 1, 0, 3363, 0 }, { 0, 1, 0, 3364, 0 }, { 0, 1, 0, 3365, 0 },
+        { 0, 1, 0, 3366, 0 }, { 0, 1, 0, 3367, 0 }, { 0, 1, 0, 3368, 0 }, { 0, 1, 0, 3369, 0 },
+        { 0, 1, 0, 3370, 0 }, { 0, 1, 0, 3371, 0 }, { 0, 1, 0, 3372, 0 }, { 0, 1, 0, 3373, 0 },
+        { 0, 1, 0, 3374, 0 }, { 0, 1, 0, 3375, 0 }, { 0, 1, 0, 3376, 0 }, { 0, 1, 0, 3377, 0 },
+        { 0, 1, 0, 3378, 0 }, { 0, 1, 0, 3379, 0 }, { 0, 1, 0, 3380, 0 }, { 0, 1, 0, 3381, 0 },
+        { 0, 1, 0, 3382, 0 }, { 0, 1, 0, 3383, 0 }, { 0, 1, 0, 3384, 0 }, { 0, 1, 0, 3385, 0 },
+        { 0, 1, 0, 3386, 0 }, { 0, 1, 0, 3387, 0 }, { 0, 1, 0, 3388, 0 }, { 0, 1, 0, 3389, 0 },
+        { 0, 1, 0, 3390, 0 }, { 0, 1, 0, 3391, 0 }, { 0, 1, 0, 3392, 0 }, { 0, 1, 0, 3393, 0 },
+        { 0, 1, 0, 3394, 0 }, { 0, 1, 0, 3395, 0 }, { 0, 1, 0, 3396, 0 }, { 0, 1, 0, 3397, 0 },
+        { 0, 1, 0, 3398, 0 }, { 0, 1, 0, 3399, 0 }, { 0, 1, 0, 3400, 0 }, { 0, 1, 0, 3401, 0 },
+        { 0, 1, 0, 3402, 0 }, { 0, 1, 0, 3403, 0 }, { 0, 1, 0, 3404, 0 }, { 0, 1, 0, 3405, 0 },
+        { 0, 1, 0, 3406, 0 }, { 0, 1, 0, 3407, 0 }, { 0, 1, 0, 3408, 0 }, { 0, 1, 0, 3409, 0 },
+        { 0, 1, 0, 3410, 0 }, { 0, 1, 0, 3411, 0 }, { 0, 1, 0, 3412, 0 }, { 0, 1, 0, 3413, 0 },
+        { 0, 1, 0, 3414, 0 }, { 0, 1, 0, 3415, 0 }, { 0, 1, 0, 3416, 0 }, { 0, 1, 0, 3417, 0 },
+        { 0, 1, 0, 3418, 0 }, { 0, 1, 0, 3419, 0 }, { 0, 1, 0, 3420, 0 }, { 0, 1, 0, 3421, 0 },
+        { 0, 1, 0, 3422, 0 }, { 0, 1, 0, 3423, 0 }, { 0, 1, 0, 3424, 0 }, { 0, 1, 0, 3425, 0 },
+        { 0, 1, 0, 3426, 0 }, { 0, 1, 0, 3427, 0 }, { 0, 1, 0, 3428, 0 }, { 0, 1, 0, 3429, 0 },
+        { 0, 0, 2, 0, 3430 }, { 0, 0, 2, 0, 3432 }, { 0, 0, 2, 0, 3434 }, { 0, 0, 3, 0, 3436 },
+        { 0, 0, 3, 0, 3439 }, { 0, 0, 2, 0, 3442 }, { 0, 0, 2, 0, 3444 }, { 0, 0, 2, 0, 3446 },
+        { 0, 0, 2, 0, 3448 }, { 0, 0, 2, 0, 3450 }, { 0, 0, 2, 0, 3452 }, { 0, 2, 0, 3454, 0 },
+        { 26, 0, 0, 0, 0 }, { 0, 2, 0, 3456, 0 }, { 0, 2, 0, 3458, 0 }, { 0, 2, 0, 3460, 0 },
+        { 0, 3, 0, 3462, 0 }, { 0, 3, 0, 3465, 0 }, { 0, 2, 0, 3468, 0 }, { 0, 2, 0, 3470, 0 },
+        { 0, 2, 0, 3472, 0 }, { 0, 2, 0, 3474, 0 }, { 0, 2, 0, 3476, 0 }, { 0, 2, 0, 3478, 0 },
+        { 0, 2, 0, 3480, 0 }, { 0, 2, 0, 3482, 0 }, { 0, 2, 0, 3484, 0 }, { 0, 2, 0, 3486, 0 },
+        { 0, 2, 0, 3488, 0 }, { 0, 2, 0, 3490, 0 }, { 0, 2, 0, 3492, 0 }, { 0, 2, 0, 3494, 0 },
+        { 0, 2, 0, 3496, 0 }, { 0, 2, 0, 3498, 0 }, { 0, 2, 0, 3500, 0 }, { 0, 2, 0, 3502, 0 },
+        { 0, 2, 0, 3504, 0 }, { 0, 2, 0, 3506, 0 }, { 0, 2, 0, 3508, 0 }, { 0, 2, 0, 3510, 0 },
+        { 0, 2, 0, 3512, 0 }, { 0, 2, 0, 3514, 0 }, { 0, 2, 0, 3516, 0 }, { 0, 2, 0, 3518, 0 },
+        { 0, 2, 0, 3520, 0 }, { 0, 2, 0, 3522, 0 }, { 0, 0, 1, 0, 3524 }, { 0, 0, 1, 0, 3525 },
+        { 0, 0, 1, 0, 3526 }, { 0, 0, 1, 0, 3527 }, { 0, 0, 1, 0, 3528 }, { 0, 0, 1, 0, 3529 },
+        { 0, 0, 1, 0, 3530 }, { 0, 0, 1, 0, 3531 }, { 0, 0, 1, 0, 3532 }, { 0, 0, 1, 0, 3533 },
+        { 0, 0, 1, 0, 3534 }, { 0, 0, 1, 0, 3535 }, { 0, 0, 1, 0, 3536 }, { 0, 0, 1, 0, 3537 },
+        { 0, 0, 1, 0, 3538 }, { 0, 0, 1, 0, 3539 }, { 0, 0, 1, 0, 3540 }, { 0, 0, 1, 0, 3541 },
+        { 0, 0, 1, 0, 3542 }, { 0, 0, 1, 0, 3543 }, { 0, 0, 1, 0, 3544 }, { 0, 0, 1, 0, 3545 },
+        { 0, 0, 1, 0, 3546 }, { 0, 0, 1, 0, 3547 }, { 0, 0, 1, 0, 3548 }, { 0, 0, 1, 0, 3549 },
+        { 0, 0, 1, 0, 3550 }, { 0, 0, 1, 0, 3551 }, { 0, 0, 1, 0, 3552 }, { 0, 0, 1, 0, 3553 },
+        { 0, 0, 1, 0, 3554 }, { 0, 0, 1, 0, 3555 }, { 0, 0, 1, 0, 3556 }, { 0, 0, 1, 0, 3557 },
+        { 0, 0, 1, 0, 3558 }, { 0, 0, 1, 0, 3559 }, { 0, 0, 1, 0, 3560 }, { 0, 0, 1, 0, 3561 },
+        { 0, 0, 1, 0, 3562 }, { 0, 0, 1, 0, 3563 }, { 0, 0, 1, 0, 3564 }, { 0, 0, 1, 0, 3565 },
+        { 0, 0, 1, 0, 3566 }, { 0, 0, 1, 0, 3567 }, { 0, 0, 1, 0, 3568 }, { 0, 0, 1, 0, 3569 },
+        { 0, 0, 1, 0, 3570 }, { 0, 0, 1, 0, 3571 }, { 0, 0, 1, 0, 3572 }, { 0, 0, 1, 0, 3573 },
+        { 0, 0, 1, 0, 3574 }, { 0, 0, 1, 0, 3575 }, { 0, 0, 1, 0, 3576 }, { 0, 0, 1, 0, 3577 },
+        { 0, 0, 1, 0, 3578 }, { 0, 0, 1, 0, 3579 }, { 0, 0, 1, 0, 3580 }, { 0, 0, 1, 0, 3581 },
+        { 0, 0, 1, 0, 3582 }, { 0, 0, 1, 0, 3583 }, { 0, 0, 1, 0, 3584 }, { 0, 0, 1, 0, 3585 },
+        { 0, 0, 1, 0, 3586 }, { 0, 0, 1, 0, 3587 }, { 0, 0, 1, 0, 3588 }, { 0, 0, 1, 0, 3589 },
+        { 0, 0, 1, 0, 3590 }, { 0, 0, 1, 0, 3591 }, { 0, 0, 1, 0, 3592 }, { 0, 0, 1, 0, 3593 },
+        { 0, 0, 1, 0, 3594 }, { 0, 0, 1, 0, 3595 }, { 0, 0, 1, 0, 3596 }, { 0, 0, 1, 0, 3597 },
+        { 0, 0, 1, 0, 3598 }, { 0, 0, 1, 0, 3599 }, { 0, 0, 1, 0, 3600 }, { 0, 0, 1, 0, 3601 },
+        { 0, 0, 1, 0, 3602 }, { 0, 0, 1, 0, 3603 }, { 0, 0, 1, 0, 3604 }, { 0, 0, 1, 0, 3605 },
+        { 0, 0, 1, 0, 3606 }, { 0, 0, 1, 0, 3607 }, { 0, 0, 1, 0, 3608 }, { 0, 0, 1, 0, 3609 },
+        { 0, 0, 1, 0, 3610 }, { 0, 0, 1, 0, 3611 }, { 0, 0, 1, 0, 3612 }, { 0, 0, 1, 0, 3613 },
+        { 0, 0, 1, 0, 3614 }, { 0, 0, 1, 0, 3615 }, { 0, 0, 1, 0, 3616 }, { 0, 0, 1, 0, 3617 },
+        { 0, 0, 1, 0, 3618 }, { 0, 0, 1, 0, 3619 }, { 0, 0, 1, 0, 3620 }, { 0, 0, 1, 0, 3621 },
+        { 0, 0, 1, 0, 3622 }, { 0, 0, 1, 0, 3623 }, { 0, 0, 1, 0, 3624 }, { 0, 0, 1, 0, 3625 },
+        { 0, 0, 1, 0, 3626 }, { 0, 0, 1, 0, 3627 }, { 0, 0, 1, 0, 3628 }, { 0, 0, 1, 0, 3629 },
+        { 0, 0, 1, 0, 3630 }, { 0, 0, 1, 0, 3631 }, { 0, 0, 1, 0, 3632 }, { 0, 0, 1, 0, 3633 },
+        { 0, 0, 1, 0, 3634 }, { 0, 0, 1, 0, 3635 }, { 0, 0, 1, 0, 3636 }, { 0, 0, 1, 0, 3637 },
+        { 0, 0, 1, 0, 3638 }, { 0, 0, 1, 0, 3639 }, { 0, 0, 1, 0, 3640 }, { 0, 0, 1, 0, 3641 },
+        { 0, 0, 1, 0, 3642 }, { 0, 0, 1, 0, 3643 }, { 0, 0, 1, 0, 3644 }, { 0, 0, 1, 0, 3645 },
+        { 0, 0, 1, 0, 3646 }, { 0, 0, 1, 0, 3647 }, { 0, 0, 1, 0, 3648 }, { 0, 0, 1, 0, 3649 },
+        { 0, 0, 1, 0, 3650 }, { 0, 0, 1, 0, 3651 }, { 0, 0, 1, 0, 3652 }, { 0, 0, 1, 0, 3653 },
+        { 0, 0, 1, 0, 3654 }, { 0, 0, 1, 0, 3655 }, { 0, 0, 1, 0, 3656 }, { 0, 0, 1, 0, 3657 },
+        { 0, 0, 1, 0, 3658 }, { 0, 0, 1, 0, 3659 }, { 0, 0, 1, 0, 3660 }, { 0, 0, 1, 0, 3661 },
+        { 0, 0, 1, 0, 3662 }, { 0, 0, 1, 0, 3663 }, { 0, 0, 1, 0, 3664 }, { 0, 0, 1, 0, 3665 },
+        { 0, 0, 1, 0, 3666 }, { 0, 0, 1, 0, 3667 }, { 0, 0, 1, 0, 3668 }, { 0, 0, 1, 0, 3669 },
+        { 0, 0, 1, 0, 3670 }, { 0, 0, 1, 0, 3671 }, { 0, 0, 1, 0, 3672 }, { 0, 0, 1, 0, 3673 },
+        { 0, 0, 1, 0, 3674 }, { 0, 0, 1, 0, 3675 }, { 0, 0, 1, 0, 3676 }, { 0, 0, 1, 0, 3677 },
+        { 0, 0, 1, 0, 3678 }, { 0, 0, 1, 0, 3679 }, { 0, 0, 1, 0, 3680 }, { 0, 0, 1, 0, 3681 },
+        { 0, 0, 1, 0, 3682 }, { 0, 0, 1, 0, 3683 }, { 0, 0, 1, 0, 3684 }, { 0, 0, 1, 0, 3685 },
+        { 0, 0, 1, 0, 3686 }, { 0, 0, 1, 0, 3687 }, { 0, 0, 1, 0, 3688 }, { 0, 0, 1, 0, 3689 },
+        { 0, 0, 1, 0, 3690 }, { 0, 0, 1, 0, 3691 }, { 0, 0, 1, 0, 3692 }, { 0, 0, 1, 0, 3693 },
+        { 0, 0, 1, 0, 3694 }, { 0, 0, 1, 0, 3695 }, { 0, 0, 1, 0, 3696 }, { 0, 0, 1, 0, 3697 },
+        { 0, 0, 1, 0, 3698 }, { 0, 0, 1, 0, 3699 }, { 0, 0, 1, 0, 3700 }, { 0, 0, 1, 0, 3701 },
+        { 0, 0, 1, 0, 3702 }, { 0, 0, 1, 0, 3703 }, { 0, 0, 1, 0, 3704 }, { 0, 0, 1, 0, 3705 },
+        { 0, 0, 1, 0, 3706 }, { 0, 0, 1, 0, 3707 }, { 0, 0, 1, 0, 3708 }, { 0, 0, 1, 0, 3709 },
+        { 0, 0, 1, 0, 3710 }, { 0, 0, 1, 0, 3711 }, { 0, 2, 0, 3712, 0 }, { 0, 2, 0, 3714, 0 },
+        { 0, 2, 0, 3716, 0 }, { 0, 2, 0, 3718, 0 }, { 0, 2, 0, 3720, 0 }, { 0, 2, 0, 3722, 0 },
+        { 0, 2, 0, 3724, 0 }, { 0, 2, 0, 3726, 0 }, { 0, 2, 0, 3728, 0 }, { 0, 2, 0, 3730, 0 },
+        { 0, 2, 0, 3732, 0 }, { 0, 2, 0, 3734, 0 }, { 0, 0, 1, 0, 3736 }, { 0, 0, 1, 0, 3737 },
+        { 0, 0, 1, 0, 3738 }, { 0, 0, 1, 0, 3739 }, { 0, 0, 1, 0, 3740 }, { 0, 0, 1, 0, 3741 },
+        { 0, 0, 1, 0, 3742 }, { 0, 0, 1, 0, 3743 }, { 0, 0, 1, 0, 3744 }, { 0, 0, 1, 0, 3745 },
+        { 0, 0, 1, 0, 3746 }, { 0, 0, 1, 0, 3747 }, { 0, 0, 1, 0, 3748 }, { 0, 0, 1, 0, 3749 },
+        { 0, 0, 1, 0, 3750 }, { 0, 0, 1, 0, 3751 }, { 0, 0, 1, 0, 3752 }, { 0, 0, 1, 0, 3753 },
+        { 0, 0, 1, 0, 3754 }, { 0, 0, 1, 0, 3755 }, { 0, 0, 1, 0, 3756 }, { 0, 0, 1, 0, 3757 },
+        { 0, 0, 1, 0, 3758 }, { 0, 0, 1, 0, 3759 }, { 0, 0, 1, 0, 3760 }, { 0, 0, 1, 0, 3761 },
+        { 0, 0, 1, 0, 3762 }, { 0, 0, 1, 0, 3763 }, { 0, 0, 1, 0, 3764 }, { 0, 0, 1, 0, 3765 },
+        { 0, 0, 1, 0, 3766 }, { 0, 0, 1, 0, 3767 }, { 0, 2, 0, 3768, 0 }, { 0, 0, 1, 0, 3770 },
+        { 0, 0, 1, 0, 3771 }, { 0, 0, 1, 0, 3772 }, { 0, 0, 1, 0, 3773 }, { 0, 0, 1, 0, 3774 },
+        { 0, 0, 1, 0, 3775 }, { 0, 0, 1, 0, 3776 }, { 0, 0, 1, 0, 3777 }, { 0, 0, 1, 0, 3778 },
+        { 0, 0, 1, 0, 3779 }, { 0, 0, 1, 0, 3780 }, { 0, 0, 1, 0, 3781 }, { 0, 0, 1, 0, 3782 },
+        { 0, 0, 1, 0, 3783 }, { 0, 0, 1, 0, 3784 }, { 0, 0, 1, 0, 3785 }, { 0, 0, 1, 0, 3786 },
+        { 0, 0, 1, 0, 3787 }, { 0, 0, 1, 0, 3788 }, { 0, 0, 1, 0, 3789 }, { 0, 0, 1, 0, 3790 },
+        { 0, 0, 1, 0, 3791 }, { 0, 0, 1, 0, 3792 }, { 0, 0, 1, 0, 3793 }, { 0, 0, 1, 0, 3794 },
+        { 0, 0, 1, 0, 3795 }, { 0, 0, 1, 0, 3796 }, { 0, 0, 1, 0, 3797 }, { 0, 0, 1, 0, 3798 },
+        { 0, 0, 1, 0, 3799 }, { 0, 0, 1, 0, 3800 }, { 0, 0, 1, 0, 3801 }, { 6, 0, 0, 0, 0 },
+        { 0, 2, 0, 3802, 0 }, { 0, 2, 0, 3804, 0 }, { 0, 3, 0, 3806, 0 }, { 0, 3, 0, 3809, 0 },
+        { 0, 3, 0, 3812, 0 }, { 0, 3, 0, 3815, 0 }, { 0, 3, 0, 3818, 0 }, { 226, 0, 0, 0, 0 },
+        { 0, 2, 0, 3821, 0 }, { 0, 2, 0, 3823, 0 }, { 0, 3, 0, 3825, 0 }, { 0, 3, 0, 3828, 0 },
+        { 0, 3, 0, 3831, 0 }, { 0, 3, 0, 3834, 0 }, { 0, 0, 1, 0, 3837 }, { 0, 0, 1, 0, 3838 },
+        { 0, 0, 1, 0, 3839 }, { 0, 0, 1, 0, 3840 }, { 0, 0, 1, 0, 3841 }, { 0, 0, 1, 0, 3842 },
+        { 0, 0, 1, 0, 3843 }, { 0, 0, 1, 0, 3844 }, { 0, 0, 1, 0, 3845 }, { 0, 0, 1, 0, 3846 },
+        { 0, 0, 1, 0, 3847 }, { 0, 0, 1, 0, 3848 }, { 0, 0, 1, 0, 3849 }, { 0, 0, 1, 0, 3850 },
+        { 0, 0, 1, 0, 3851 }, { 0, 0, 1, 0, 3852 }, { 0, 0, 1, 0, 3853 }, { 0, 0, 1, 0, 3854 },
+        { 0, 0, 1, 0, 3855 }, { 0, 0, 1, 0, 3856 }, { 0, 0, 1, 0, 3857 }, { 0, 0, 1, 0, 3858 },
+        { 0, 0, 1, 0, 3859 }, { 0, 0, 1, 0, 3860 }, { 0, 0, 1, 0, 3861 }, { 0, 0, 1, 0, 3862 },
+        { 0, 0, 1, 0, 3863 }, { 0, 0, 1, 0, 3864 }, { 0, 0, 1, 0, 3865 }, { 0, 0, 1, 0, 3866 },
+        { 0, 0, 1, 0, 3867 }, { 0, 0, 1, 0, 3868 }, { 0, 0, 1, 0, 3869 }, { 0, 0, 1, 0, 3870 },
+        { 0, 1, 0, 3871, 0 }, { 0, 1, 0, 3872, 0 }, { 0, 1, 0, 3873, 0 }, { 0, 1, 0, 3874, 0 },
+        { 0, 1, 0, 3875, 0 }, { 0, 1, 0, 3876, 0 }, { 0, 1, 0, 3877, 0 }, { 0, 1, 0, 3878, 0 },
+        { 0, 1, 0, 3879, 0 }, { 0, 1, 0, 3880, 0 }, { 0, 1, 0, 3881, 0 }, { 0, 1, 0, 3882, 0 },
+        { 0, 1, 0, 3883, 0 }, { 0, 1, 0, 3884, 0 }, { 0, 1, 0, 3885, 0 }, { 0, 1, 0, 3886, 0 },
+        { 0, 1, 0, 3887, 0 }, { 0, 1, 0, 3888, 0 }, { 0, 1, 0, 3889, 0 }, { 0, 1, 0, 3890, 0 },
+        { 0, 1, 0, 3891, 0 }, { 0, 1, 0, 3892, 0 }, { 0, 1, 0, 3893, 0 }, { 0, 1, 0, 3894, 0 },
+        { 0, 1, 0, 3895, 0 }, { 0, 1, 0, 3896, 0 }, { 0, 1, 0, 3897, 0 }, { 0, 1, 0, 3898, 0 },
+        { 0, 1, 0, 3899, 0 }, { 0, 1, 0, 3900, 0 }, { 0, 1, 0, 3901, 0 }, { 0, 1, 0, 3902, 0 },
+        { 0, 1, 0, 3903, 0 }, { 0, 1, 0, 3904, 0 }, { 0, 1, 0, 3905, 0 }, { 0, 1, 0, 3906, 0 },
+        { 0, 1, 0, 3907, 0 }, { 0, 1, 0, 3908, 0 }, { 0, 1, 0, 3909, 0 }, { 0, 1, 0, 3910, 0 },
+        { 0, 1, 0, 3911, 0 }, { 0, 1, 0, 3912, 0 }, { 0, 1, 0, 3913, 0 }, { 0, 1, 0, 3914, 0 },
+        { 0, 1, 0, 3915, 0 }, { 0, 1, 0, 3916, 0 }, { 0, 1, 0, 3917, 0 }, { 0, 1, 0, 3918, 0 },
+        { 0, 1, 0, 3919, 0 }, { 0, 1, 0, 3920, 0 }, { 0, 1, 0, 3921, 0 }, { 0, 1, 0, 3922, 0 },
+        { 0, 1, 0, 3923, 0 }, { 0, 1, 0, 3924, 0 }, { 0, 1, 0, 3925, 0 }, { 0, 1, 0, 3926, 0 },
+        { 0, 1, 0, 3927, 0 }, { 0, 1, 0, 3928, 0 }, { 0, 1, 0, 3929, 0 }, { 0, 1, 0, 3930, 0 },
+        { 0, 1, 0, 3931, 0 }, { 0, 1, 0, 3932, 0 }, { 0, 1, 0, 3933, 0 }, { 0, 1, 0, 3934, 0 },
+        { 0, 1, 0, 3935, 0 }, { 0, 1, 0, 3936, 0 }, { 0, 1, 0, 3937, 0 }, { 0, 1, 0, 3938, 0 },
+        { 0, 1, 0, 3939, 0 }, { 0, 1, 0, 3940, 0 }, { 0, 1, 0, 3941, 0 }, { 0, 1, 0, 3942, 0 },
+        { 0, 1, 0, 3943, 0 }, { 0, 1, 0, 3944, 0 }, { 0, 1, 0, 3945, 0 }, { 0, 1, 0, 3946, 0 },
+        { 0, 1, 0, 3947, 0 }, { 0, 1, 0, 3948, 0 }, { 0, 1, 0, 3949, 0 }, { 0, 1, 0, 3950, 0 },
+        { 0, 1, 0, 3951, 0 }, { 0, 1, 0, 3952, 0 }, { 0, 1, 0, 3953, 0 }, { 0, 1, 0, 3954, 0 },
+        { 0, 1, 0, 3955, 0 }, { 0, 1, 0, 3956, 0 }, { 0, 1, 0, 3957, 0 }, { 0, 1, 0, 3958, 0 },
+        { 0, 1, 0, 3959, 0 }, { 0, 1, 0, 3960, 0 }, { 0, 1, 0, 3961, 0 }, { 0, 1, 0, 3962, 0 },
+        { 0, 1, 0, 3963, 0 }, { 0, 1, 0, 3964, 0 }, { 0, 1, 0, 3965, 0 }, { 0, 1, 0, 3966, 0 },
+        { 0, 1, 0, 3967, 0 }, { 0, 1, 0, 3968, 0 }, { 0, 1, 0, 3969, 0 }, { 0, 1, 0, 3970, 0 },
+        { 0, 1, 0, 3971, 0 }, { 0, 1, 0, 3972, 0 }, { 0, 1, 0, 3973, 0 }, { 0, 1, 0, 3974, 0 },
+        { 0, 1, 0, 3975, 0 }, { 0, 1, 0, 3976, 0 }, { 0, 1, 0, 3977, 0 }, { 0, 1, 0, 3978, 0 },
+        { 0, 1, 0, 3979, 0 }, { 0, 1, 0, 3980, 0 }, { 0, 1, 0, 3981, 0 }, { 0, 1, 0, 3982, 0 },
+        { 0, 1, 0, 3983, 0 }, { 0, 1, 0, 3984, 0 }, { 0, 1, 0, 3985, 0 }, { 0, 1, 0, 3986, 0 },
+        { 0, 1, 0, 3987, 0 }, { 0, 1, 0, 3988, 0 }, { 0, 1, 0, 3989, 0 }, { 0, 1, 0, 3990, 0 },
+        { 0, 1, 0, 3991, 0 }, { 0, 1, 0, 3992, 0 }, { 0, 1, 0, 3993, 0 }, { 0, 1, 0, 3994, 0 },
+        { 0, 1, 0, 3995, 0 }, { 0, 1, 0, 3996, 0 }, { 0, 1, 0, 3997, 0 }, { 0, 1, 0, 3998, 0 },
+        { 0, 1, 0, 3999, 0 }, { 0, 1, 0, 4000, 0 }, { 0, 1, 0, 4001, 0 }, { 0, 1, 0, 4002, 0 },
+        { 0, 1, 0, 4003, 0 }, { 0, 1, 0, 4004, 0 }, { 0, 1, 0, 4005, 0 }, { 0, 1, 0, 4006, 0 },
+        { 0, 1, 0, 4007, 0 }, { 0, 1, 0, 4008, 0 }, { 0, 1, 0, 4009, 0 }, { 0, 1, 0, 4010, 0 },
+        { 0, 1, 0, 4011, 0 }, { 0, 1, 0, 4012, 0 }, { 0, 1, 0, 4013, 0 }, { 0, 1, 0, 4014, 0 },
+        { 0, 1, 0, 4015, 0 }, { 0, 1, 0, 4016, 0 }, { 0, 1, 0, 4017, 0 }, { 0, 1, 0, 4018, 0 },
+        { 0, 1, 0, 4019, 0 }, { 0, 1, 0, 4020, 0 }, { 0, 1, 0, 4021, 0 }, { 0, 1, 0, 4022, 0 },
+        { 0, 1, 0, 4023, 0 }, { 0, 1, 0, 4024, 0 }, { 0, 1, 0, 4025, 0 }, { 0, 1, 0, 4026, 0 },
+        { 0, 1, 0, 4027, 0 }, { 0, 1, 0, 4028, 0 }, { 0, 1, 0, 4029, 0 }, { 0, 1, 0, 4030, 0 },
+        { 0, 1, 0, 4031, 0 }, { 0, 1, 0, 4032, 0 }, { 0, 1, 0, 4033, 0 }, { 0, 1, 0, 4034, 0 },
+        { 0, 1, 0, 4035, 0 }, { 0, 1, 0, 4036, 0 }, { 0, 1, 0, 4037, 0 }, { 0, 1, 0, 4038, 0 },
+        { 0, 1, 0, 4039, 0 }, { 0, 1, 0, 4040, 0 }, { 0, 1, 0, 4041, 0 }, { 0, 1, 0, 4042, 0 },
+        { 0, 1, 0, 4043, 0 }, { 0, 1, 0, 4044, 0 }, { 0, 1, 0, 4045, 0 }, { 0, 1, 0, 4046, 0 },
+        { 0, 1, 0, 4047, 0 }, { 0, 1, 0, 4048, 0 }, { 0, 1, 0, 4049, 0 }, { 0, 1, 0, 4050, 0 },
+        { 0, 1, 0, 4051, 0 }, { 0, 1, 0, 4052, 0 }, { 0, 1, 0, 4053, 0 }, { 0, 1, 0, 4054, 0 },
+        { 0, 1, 0, 4055, 0 }, { 0, 1, 0, 4056, 0 }, { 0, 1, 0, 4057, 0 }, { 0, 1, 0, 4058, 0 },
+        { 0, 1, 0, 4059, 0 }, { 0, 1, 0, 4060, 0 }, { 0, 1, 0, 4061, 0 }, { 0, 1, 0, 4062, 0 },
+        { 0, 1, 0, 4063, 0 }, { 0, 1, 0, 4064, 0 }, { 0, 1, 0, 4065, 0 }, { 0, 1, 0, 4066, 0 },
+        { 0, 1, 0, 4067, 0 }, { 0, 1, 0, 4068, 0 }, { 0, 1, 0, 4069, 0 }, { 0, 1, 0, 4070, 0 },
+        { 0, 1, 0, 4071, 0 }, { 0, 1, 0, 4072, 0 }, { 0, 1, 0, 4073, 0 }, { 0, 1, 0, 4074, 0 },
+        { 0, 1, 0, 4075, 0 }, { 0, 1, 0, 4076, 0 }, { 0, 1, 0, 4077, 0 }, { 0, 1, 0, 4078, 0 },
+        { 0, 1, 0, 4079, 0 }, { 0, 1, 0, 4080, 0 }, { 0, 1, 0, 4081, 0 }, { 0, 1, 0, 4082, 0 },
+        { 0, 1, 0, 4083, 0 }, { 0, 1, 0, 4084, 0 }, { 0, 1, 0, 4085, 0 }, { 0, 1, 0, 4086, 0 },
+        { 0, 1, 0, 4087, 0 }, { 0, 1, 0, 4088, 0 }, { 0, 1, 0, 4089, 0 }, { 0, 1, 0, 4090, 0 },
+        { 0, 1, 0, 4091, 0 }, { 0, 1, 0, 4092, 0 }, { 0, 1, 0, 4093, 0 }, { 0, 1, 0, 4094, 0 },
+        { 0, 1, 0, 4095, 0 }, { 0, 1, 0, 4096, 0 }, { 0, 1, 0, 4097, 0 }, { 0, 1, 0, 4098, 0 },
+        { 0, 1, 0, 4099, 0 }, { 0, 1, 0, 4100, 0 }, { 0, 1, 0, 4101, 0 }, { 0, 1, 0, 4102, 0 },
+        { 0, 1, 0, 4103, 0 }, { 0, 1, 0, 4104, 0 }, { 0, 1, 0, 4105, 0 }, { 0, 1, 0, 4106, 0 },
+        { 0, 1, 0, 4107, 0 }, { 0, 1, 0, 4108, 0 }, { 0, 1, 0, 4109, 0 }, { 0, 1, 0, 4110, 0 },
+        { 0, 1, 0, 4111, 0 }, { 0, 1, 0, 4112, 0 }, { 0, 1, 0, 4113, 0 }, { 0, 1, 0, 4114, 0 },
+        { 0, 1, 0, 4115, 0 }, { 0, 1, 0, 4116, 0 }, { 0, 1, 0, 4117, 0 }, { 0, 1, 0, 4118, 0 },
+        { 0, 1, 0, 4119, 0 }, { 0, 1, 0, 4120, 0 }, { 0, 1, 0, 4121, 0 }, { 0, 1, 0, 4122, 0 },
+        { 0, 1, 0, 4123, 0 }, { 0, 1, 0, 4124, 0 }, { 0, 1, 0, 4125, 0 }, { 0, 1, 0, 4126, 0 },
+        { 0, 1, 0, 4127, 0 }, { 0, 1, 0, 4128, 0 }, { 0, 1, 0, 4129, 0 }, { 0, 1, 0, 4130, 0 },
+        { 0, 1, 0, 4131, 0 }, { 0, 1, 0, 4132, 0 }, { 0, 1, 0, 4133, 0 }, { 0, 1, 0, 4134, 0 },
+        { 0, 1, 0, 4135, 0 }, { 0, 1, 0, 4136, 0 }, { 0, 1, 0, 4137, 0 }, { 0, 1, 0, 4138, 0 },
+        { 0, 1, 0, 4139, 0 }, { 0, 1, 0, 4140, 0 }, { 0, 1, 0, 4141, 0 }, { 0, 1, 0, 4142, 0 },
+        { 0, 1, 0, 4143, 0 }, { 0, 1, 0, 4144, 0 }, { 0, 1, 0, 4145, 0 }, { 0, 1, 0, 4146, 0 },
+        { 0, 1, 0, 4147, 0 }, { 0, 1, 0, 4148, 0 }, { 0, 1, 0, 4149, 0 }, { 0, 1, 0, 4150, 0 },
+        { 0, 1, 0, 4151, 0 }, { 0, 1, 0, 4152, 0 }, { 0, 1, 0, 4153, 0 }, { 0, 1, 0, 4154, 0 },
+        { 0, 1, 0, 4155, 0 }, { 0, 1, 0, 4156, 0 }, { 0, 1, 0, 4157, 0 }, { 0, 1, 0, 4158, 0 },
+        { 0, 1, 0, 4159, 0 }, { 0, 1, 0, 4160, 0 }, { 0, 1, 0, 4161, 0 }, { 0, 1, 0, 4162, 0 },
+        { 0, 1, 0, 4163, 0 }, { 0, 1, 0, 4164, 0 }, { 0, 1, 0, 4165, 0 }, { 0, 1, 0, 4166, 0 },
+        { 0, 1, 0, 4167, 0 }, { 0, 1, 0, 4168, 0 }, { 0, 1, 0, 4169, 0 }, { 0, 1, 0, 4170, 0 },
+        { 0, 1, 0, 4171, 0 }, { 0, 1, 0, 4172, 0 }, { 0, 1, 0, 4173, 0 }, { 0, 1, 0, 4174, 0 },
+        { 0, 1, 0, 4175, 0 }, { 0, 1, 0, 4176, 0 }, { 0, 1, 0, 4177, 0 }, { 0, 1, 0, 4178, 0 },
+        { 0, 1, 0, 4179, 0 }, { 0, 1, 0, 4180, 0 }, { 0, 1, 0, 4181, 0 }, { 0, 1, 0, 4182, 0 },
+        { 0, 1, 0, 4183, 0 }, { 0, 1, 0, 4184, 0 }, { 0, 1, 0, 4185, 0 }, { 0, 1, 0, 4186, 0 },
+        { 0, 1, 0, 4187, 0 }, { 0, 1, 0, 4188, 0 }, { 0, 1, 0, 4189, 0 }, { 0, 1, 0, 4190, 0 },
+        { 0, 1, 0, 4191, 0 }, { 0, 1, 0, 4192, 0 }, { 0, 1, 0, 4193, 0 }, { 0, 1, 0, 4194, 0 },
+        { 0, 1, 0, 4195, 0 }, { 0, 1, 0, 4196, 0 }, { 0, 1, 0, 4197, 0 }, { 0, 1, 0, 4198, 0 },
+        { 0, 1, 0, 4199, 0 }, { 0, 1, 0, 4200, 0 }, { 0, 1, 0, 4201, 0 }, { 0, 1, 0, 4202, 0 },
+        { 0, 1, 0, 4203, 0 }, { 0, 1, 0, 4204, 0 }, { 0, 1, 0, 4205, 0 }, { 0, 1, 0, 4206, 0 },
+        { 0, 1, 0, 4207, 0 }, { 0, 1, 0, 4208, 0 }, { 0, 1, 0, 4209, 0 }, { 0, 1, 0, 4210, 0 },
+        { 0, 1, 0, 4211, 0 }, { 0, 1, 0, 4212, 0 }, { 0, 1, 0, 4213, 0 }, { 0, 1, 0, 4214, 0 },
+        { 0, 1, 0, 4215, 0 }, { 0, 1, 0, 4216, 0 }, { 0, 1, 0, 4217, 0 }, { 0, 1, 0, 4218, 0 },
+        { 0, 1, 0, 4219, 0 }, { 0, 1, 0, 4220, 0 }, { 0, 1, 0, 4221, 0 }, { 0, 1, 0, 4222, 0 },
+        { 0, 1, 0, 4223, 0 }, { 0, 1, 0, 4224, 0 }, { 0, 1, 0, 4225, 0 }, { 0, 1, 0, 4226, 0 },
+        { 0, 1, 0, 4227, 0 }, { 0, 1, 0, 4228, 0 }, { 0, 1, 0, 4229, 0 }, { 0, 1, 0, 4230, 0 },
+        { 0, 1, 0, 4231, 0 }, { 0, 1, 0, 4232, 0 }, { 0, 1, 0, 4233, 0 }, { 0, 1, 0, 4234, 0 },
+        { 0, 1, 0, 4235, 0 }, { 0, 1, 0, 4236, 0 }, { 0, 1, 0, 4237, 0 }, { 0, 1, 0, 4238, 0 },
+        { 0, 1, 0, 4239, 0 }, { 0, 1, 0, 4240, 0 }, { 0, 1, 0, 4241, 0 }, { 0, 1, 0, 4242, 0 },
+        { 0, 1, 0, 4243, 0 }, { 0, 1, 0, 4244, 0 }, { 0, 1, 0, 4245, 0 }, { 0, 1, 0, 4246, 0 },
+        { 0, 1, 0, 4247, 0 }, { 0, 1, 0, 4248, 0 }, { 0, 1, 0, 4249, 0 }, { 0, 1, 0, 4250, 0 },
+        { 0, 1, 0, 4251, 0 }, { 0, 1, 0, 4252, 0 }, { 0, 1, 0, 4253, 0 }, { 0, 1, 0, 4254, 0 },
+        { 0, 1, 0, 4255, 0 }, { 0, 1, 0, 4256, 0 }, { 0, 1, 0, 4257, 0 }, { 0, 1, 0, 4258, 0 },
+        { 0, 1, 0, 4259, 0 }, { 0, 1, 0, 4260, 0 }, { 0, 1, 0, 4261, 0 }, { 0, 1, 0, 4262, 0 },
+        { 0, 1, 0, 4263, 0 }, { 0, 1, 0, 4264, 0 }, { 0, 1, 0, 4265, 0 }, { 0, 1, 0, 4266, 0 },
+        { 0, 1, 0, 4267, 0 }, { 0, 1, 0, 4268, 0 }, { 0, 1, 0, 4269, 0 }, { 0, 1, 0, 4270, 0 },
+        { 0, 1, 0, 4271, 0 }, { 0, 1, 0, 4272, 0 }, { 0, 1, 0, 4273, 0 }, { 0, 1, 0, 4274, 0 },
+        { 0, 1, 0, 4275, 0 }, { 0, 1, 0, 4276, 0 }, { 0, 1, 0, 4277, 0 }, { 0, 1, 0, 4278, 0 },
+        { 0, 1, 0, 4279, 0 }, { 0, 1, 0, 4280, 0 }, { 0, 1, 0, 4281, 0 }, { 0, 1, 0, 4282, 0 },
+        { 0, 1, 0, 4283, 0 }, { 0, 1, 0, 4284, 0 }, { 0, 1, 0, 4285, 0 }, { 0, 1, 0, 4286, 0 },
+        { 0, 1, 0, 4287, 0 }, { 0, 1, 0, 4288, 0 }, { 0, 1, 0, 4289, 0 }, { 0, 1, 0, 4290, 0 },
+        { 0, 1, 0, 4291, 0 }, { 0, 1, 0, 4292, 0 }, { 0, 1, 0, 4293, 0 }, { 0, 1, 0, 4294, 0 },
+        { 0, 1, 0, 4295, 0 }, { 0, 1, 0, 4296, 0 }, { 0, 1, 0, 4297, 0 }, { 0, 1, 0, 4298, 0 },
+        { 0, 1, 0, 4299, 0 }, { 0, 1, 0, 4300, 0 }, { 0, 1, 0, 4301, 0 }, { 0, 1, 0, 4302, 0 },
+        { 0, 1, 0, 4303, 0 }, { 0, 1, 0, 4304, 0 }, { 0, 1, 0, 4305, 0 }, { 0, 1, 0, 4306, 0 },
+        { 0, 1, 0, 4307, 0 }, { 0, 1, 0, 4308, 0 }, { 0, 1, 0, 4309, 0 }, { 0, 1, 0, 4310, 0 },
+        { 0, 1, 0, 4311, 0 }, { 0, 1, 0, 4312, 0 }, { 0, 1, 0, 4313, 0 }, { 0, 1, 0, 4314, 0 },
+        { 0, 1, 0, 4315, 0 }, { 0, 1, 0, 4316, 0 }, { 0, 1, 0, 4317, 0 }, { 0, 1, 0, 4318, 0 },
+        { 0, 1, 0, 4319, 0 }, { 0, 1, 0, 4320, 0 }, { 0, 1, 0, 4321, 0 }, { 0, 1, 0, 4322, 0 },
+        { 0, 1, 0, 4323, 0 }, { 0, 1, 0, 4324, 0 }, { 0, 1, 0, 4325, 0 }, { 0, 1, 0, 4326, 0 },
+        { 0, 1, 0, 4327, 0 }, { 0, 1, 0, 4328, 0 }, { 0, 1, 0, 4329, 0 }, { 0, 1, 0, 4330, 0 },
+        { 0, 1, 0, 4331, 0 }, { 0, 1, 0, 4332, 0 }, { 0, 1, 0, 4333, 0 }, { 0, 1, 0, 4334, 0 },
+        { 0, 1, 0, 4335, 0 }, { 0, 1, 0, 4336, 0 }, { 0, 1, 0, 4337, 0 }, { 0, 1, 0, 4338, 0 },
+        { 0, 1, 0, 4339, 0 }, { 0, 1, 0, 4340, 0 }, { 0, 1, 0, 4341, 0 }, { 0, 1, 0, 4342, 0 },
+        { 0, 1, 0, 4343, 0 }, { 0, 1, 0, 4344, 0 }, { 0, 1, 0, 4345, 0 }, { 0, 1, 0, 4346, 0 },
+        { 0, 1, 0, 4347, 0 },
+};
+
+static const uint32_t unicodePool[4348] = {
+        0x00061, 0x00062, 0x00063, 0x00064, 0x00065, 0x00066, 0x00067, 0x00068,
+        0x00069, 0x0006a, 0x0006b, 0x0006c, 0x0006d, 0x0006e, 0x0006f, 0x00070,
+        0x00071, 0x00072, 0x00073, 0x00074, 0x00075, 0x00076, 0x00077, 0x00078,
+        0x00079, 0x0007a, 0x003bc, 0x00041, 0x00300, 0x00061, 0x00300, 0x00041,
+        0x00301, 0x00061, 0x00301, 0x00041, 0x00302, 0x00061, 0x00302, 0x00041,
+        0x00303, 0x00061, 0x00303, 0x00041, 0x00308, 0x00061, 0x00308, 0x00041,
+        0x0030a, 0x00061, 0x0030a, 0x000e6, 0x00043, 0x00327, 0x00063, 0x00327,
+        0x00045, 0x00300, 0x00065, 0x00300, 0x00045, 0x00301, 0x00065, 0x00301,
+        0x00045, 0x00302, 0x00065, 0x00302, 0x00045, 0x00308, 0x00065, 0x00308,
+        0x00049, 0x00300, 0x00069, 0x00300, 0x00049, 0x00301, 0x00069, 0x00301,
+        0x00049, 0x00302, 0x00069, 0x00302, 0x00049, 0x00308, 0x00069, 0x00308,
+        0x000f0, 0x0004e, 0x00303, 0x0006e, 0x00303, 0x0004f, 0x00300, 0x0006f,
+        0x00300, 0x0004f, 0x00301, 0x0006f, 0x00301, 0x0004f, 0x00302, 0x0006f,
+        0x00302, 0x0004f, 0x00303, 0x0006f, 0x00303, 0x0004f, 0x00308, 0x0006f,
+        0x00308, 0x000f8, 0x00055, 0x00300, 0x00075, 0x00300, 0x00055, 0x00301,
+        0x00075, 0x00301, 0x00055, 0x00302, 0x00075, 0x00302, 0x00055, 0x00308,
+        0x00075, 0x00308, 0x00059, 0x00301, 0x00079, 0x00301, 0x000fe, 0x00073,
+        0x00073, 0x00079, 0x00308, 0x00041, 0x00304, 0x00061, 0x00304, 0x00041,
+        0x00306, 0x00061, 0x00306, 0x00041, 0x00328, 0x00061, 0x00328, 0x00043,
+        0x00301, 0x00063, 0x00301, 0x00043, 0x00302, 0x00063, 0x00302, 0x00043,
+        0x00307, 0x00063, 0x00307, 0x00043, 0x0030c, 0x00063, 0x0030c, 0x00044,
+        0x0030c, 0x00064, 0x0030c, 0x00111, 0x00045, 0x00304, 0x00065, 0x00304,
+        0x00045, 0x00306, 0x00065, 0x00306, 0x00045, 0x00307, 0x00065, 0x00307,
+        0x00045, 0x00328, 0x00065, 0x00328, 0x00045, 0x0030c, 0x00065, 0x0030c,
+        0x00047, 0x00302, 0x00067, 0x00302, 0x00047, 0x00306, 0x00067, 0x00306,
+        0x00047, 0x00307, 0x00067, 0x00307, 0x00047, 0x00327, 0x00067, 0x00327,
+        0x00048, 0x00302, 0x00068, 0x00302, 0x00127, 0x00049, 0x00303, 0x00069,
+        0x00303, 0x00049, 0x00304, 0x00069, 0x00304, 0x00049, 0x00306, 0x00069,
+        0x00306, 0x00049, 0x00328, 0x00069, 0x00328, 0x00049, 0x00307, 0x00069,
+        0x00307, 0x00133, 0x0004a, 0x00302, 0x0006a, 0x00302, 0x0004b, 0x00327,
+        0x0006b, 0x00327, 0x0004c, 0x00301, 0x0006c, 0x00301, 0x0004c, 0x00327,
+        0x0006c, 0x00327, 0x0004c, 0x0030c, 0x0006c, 0x0030c, 0x00140, 0x00142,
+        0x0004e, 0x00301, 0x0006e, 0x00301, 0x0004e, 0x00327, 0x0006e, 0x00327,
+        0x0004e, 0x0030c, 0x0006e, 0x0030c, 0x002bc, 0x0006e, 0x0014b, 0x0004f,
+        0x00304, 0x0006f, 0x00304, 0x0004f, 0x00306, 0x0006f, 0x00306, 0x0004f,
+        0x0030b, 0x0006f, 0x0030b, 0x00153, 0x00052, 0x00301, 0x00072, 0x00301,
+        0x00052, 0x00327, 0x00072, 0x00327, 0x00052, 0x0030c, 0x00072, 0x0030c,
+        0x00053, 0x00301, 0x00073, 0x00301, 0x00053, 0x00302, 0x00073, 0x00302,
+        0x00053, 0x00327, 0x00073, 0x00327, 0x00053, 0x0030c, 0x00073, 0x0030c,
+        0x00054, 0x00327, 0x00074, 0x00327, 0x00054, 0x0030c, 0x00074, 0x0030c,
+        0x00167, 0x00055, 0x00303, 0x00075, 0x00303, 0x00055, 0x00304, 0x00075,
+        0x00304, 0x00055, 0x00306, 0x00075, 0x00306, 0x00055, 0x0030a, 0x00075,
+        0x0030a, 0x00055, 0x0030b, 0x00075, 0x0030b, 0x00055, 0x00328, 0x00075,
+        0x00328, 0x00057, 0x00302, 0x00077, 0x00302, 0x00059, 0x00302, 0x00079,
+        0x00302, 0x00059, 0x00308, 0x0005a, 0x00301, 0x0007a, 0x00301, 0x0005a,
+        0x00307, 0x0007a, 0x00307, 0x0005a, 0x0030c, 0x0007a, 0x0030c, 0x00253,
+        0x00183, 0x00185, 0x00254, 0x00188, 0x00256, 0x00257, 0x0018c, 0x001dd,
+        0x00259, 0x0025b, 0x00192, 0x00260, 0x00263, 0x00269, 0x00268, 0x00199,
+        0x0026f, 0x00272, 0x00275, 0x0004f, 0x0031b, 0x0006f, 0x0031b, 0x001a3,
+        0x001a5, 0x00280, 0x001a8, 0x00283, 0x001ad, 0x00288, 0x00055, 0x0031b,
+        0x00075, 0x0031b, 0x0028a, 0x0028b, 0x001b4, 0x001b6, 0x00292, 0x001b9,
+        0x001bd, 0x001c6, 0x001c9, 0x001cc, 0x00041, 0x0030c, 0x00061, 0x0030c,
+        0x00049, 0x0030c, 0x00069, 0x0030c, 0x0004f, 0x0030c, 0x0006f, 0x0030c,
+        0x00055, 0x0030c, 0x00075, 0x0030c, 0x00055, 0x00308, 0x00304, 0x00075,
+        0x00308, 0x00304, 0x00055, 0x00308, 0x00301, 0x00075, 0x00308, 0x00301,
+        0x00055, 0x00308, 0x0030c, 0x00075, 0x00308, 0x0030c, 0x00055, 0x00308,
+        0x00300, 0x00075, 0x00308, 0x00300, 0x00041, 0x00308, 0x00304, 0x00061,
+        0x00308, 0x00304, 0x00041, 0x00307, 0x00304, 0x00061, 0x00307, 0x00304,
+        0x000c6, 0x00304, 0x000e6, 0x00304, 0x001e5, 0x00047, 0x0030c, 0x00067,
+        0x0030c, 0x0004b, 0x0030c, 0x0006b, 0x0030c, 0x0004f, 0x00328, 0x0006f,
+        0x00328, 0x0004f, 0x00328, 0x00304, 0x0006f, 0x00328, 0x00304, 0x001b7,
+        0x0030c, 0x00292, 0x0030c, 0x0006a, 0x0030c, 0x001f3, 0x00047, 0x00301,
+        0x00067, 0x00301, 0x00195, 0x001bf, 0x0004e, 0x00300, 0x0006e, 0x00300,
+        0x00041, 0x0030a, 0x00301, 0x00061, 0x0030a, 0x00301, 0x000c6, 0x00301,
+        0x000e6, 0x00301, 0x000d8, 0x00301, 0x000f8, 0x00301, 0x00041, 0x0030f,
+        0x00061, 0x0030f, 0x00041, 0x00311, 0x00061, 0x00311, 0x00045, 0x0030f,
+        0x00065, 0x0030f, 0x00045, 0x00311, 0x00065, 0x00311, 0x00049, 0x0030f,
+        0x00069, 0x0030f, 0x00049, 0x00311, 0x00069, 0x00311, 0x0004f, 0x0030f,
+        0x0006f, 0x0030f, 0x0004f, 0x00311, 0x0006f, 0x00311, 0x00052, 0x0030f,
+        0x00072, 0x0030f, 0x00052, 0x00311, 0x00072, 0x00311, 0x00055, 0x0030f,
+        0x00075, 0x0030f, 0x00055, 0x00311, 0x00075, 0x00311, 0x00053, 0x00326,
+        0x00073, 0x00326, 0x00054, 0x00326, 0x00074, 0x00326, 0x0021d, 0x00048,
+        0x0030c, 0x00068, 0x0030c, 0x0019e, 0x00223, 0x00225, 0x00041, 0x00307,
+        0x00061, 0x00307, 0x00045, 0x00327, 0x00065, 0x00327, 0x0004f, 0x00308,
+        0x00304, 0x0006f, 0x00308, 0x00304, 0x0004f, 0x00303, 0x00304, 0x0006f,
+        0x00303, 0x00304, 0x0004f, 0x00307, 0x0006f, 0x00307, 0x0004f, 0x00307,
+        0x00304, 0x0006f, 0x00307, 0x00304, 0x00059, 0x00304, 0x00079, 0x00304,
+        0x02c65, 0x0023c, 0x0019a, 0x02c66, 0x00242, 0x00180, 0x00289, 0x0028c,
+        0x00247, 0x00249, 0x0024b, 0x0024d, 0x0024f, 0x00300, 0x00301, 0x00313,
+        0x00308, 0x00301, 0x00371, 0x00373, 0x002b9, 0x00377, 0x0003b, 0x003f3,
+        0x000a8, 0x00301, 0x00391, 0x00301, 0x003b1, 0x00301, 0x000b7, 0x00395,
+        0x00301, 0x003b5, 0x00301, 0x00397, 0x00301, 0x003b7, 0x00301, 0x00399,
+        0x00301, 0x003b9, 0x00301, 0x0039f, 0x00301, 0x003bf, 0x00301, 0x003a5,
+        0x00301, 0x003c5, 0x00301, 0x003a9, 0x00301, 0x003c9, 0x00301, 0x003b9,
+        0x00308, 0x00301, 0x003b1, 0x003b2, 0x003b3, 0x003b4, 0x003b5, 0x003b6,
+        0x003b7, 0x003b8, 0x003b9, 0x003ba, 0x003bb, 0x003bd, 0x003be, 0x003bf,
+        0x003c0, 0x003c1, 0x003c3, 0x003c4, 0x003c5, 0x003c6, 0x003c7, 0x003c8,
+        0x003c9, 0x00399, 0x00308, 0x003b9, 0x00308, 0x003a5, 0x00308, 0x003c5,
+        0x00308, 0x003c5, 0x00308, 0x00301, 0x003d7, 0x003d2, 0x00301, 0x003d2,
+        0x00308, 0x003d9, 0x003db, 0x003dd, 0x003df, 0x003e1, 0x003e3, 0x003e5,
+        0x003e7, 0x003e9, 0x003eb, 0x003ed, 0x003ef, 0x003f8, 0x003f2, 0x003fb,
+        0x0037b, 0x0037c, 0x0037d, 0x00415, 0x00300, 0x00435, 0x00300, 0x00415,
+        0x00308, 0x00435, 0x00308, 0x00452, 0x00413, 0x00301, 0x00433, 0x00301,
+        0x00454, 0x00455, 0x00456, 0x00406, 0x00308, 0x00456, 0x00308, 0x00458,
+        0x00459, 0x0045a, 0x0045b, 0x0041a, 0x00301, 0x0043a, 0x00301, 0x00418,
+        0x00300, 0x00438, 0x00300, 0x00423, 0x00306, 0x00443, 0x00306, 0x0045f,
+        0x00430, 0x00431, 0x00432, 0x00433, 0x00434, 0x00435, 0x00436, 0x00437,
+        0x00438, 0x00418, 0x00306, 0x00438, 0x00306, 0x0043a, 0x0043b, 0x0043c,
+        0x0043d, 0x0043e, 0x0043f, 0x00440, 0x00441, 0x00442, 0x00443, 0x00444,
+        0x00445, 0x00446, 0x00447, 0x00448, 0x00449, 0x0044a, 0x0044b, 0x0044c,
+        0x0044d, 0x0044e, 0x0044f, 0x00461, 0x00463, 0x00465, 0x00467, 0x00469,
+        0x0046b, 0x0046d, 0x0046f, 0x00471, 0x00473, 0x00475, 0x00474, 0x0030f,
+        0x00475, 0x0030f, 0x00479, 0x0047b, 0x0047d, 0x0047f, 0x00481, 0x0048b,
+        0x0048d, 0x0048f, 0x00491, 0x00493, 0x00495, 0x00497, 0x00499, 0x0049b,
+        0x0049d, 0x0049f, 0x004a1, 0x004a3, 0x004a5, 0x004a7, 0x004a9, 0x004ab,
+        0x004ad, 0x004af, 0x004b1, 0x004b3, 0x004b5, 0x004b7, 0x004b9, 0x004bb,
+        0x004bd, 0x004bf, 0x004cf, 0x00416, 0x00306, 0x00436, 0x00306, 0x004c4,
+        0x004c6, 0x004c8, 0x004ca, 0x004cc, 0x004ce, 0x00410, 0x00306, 0x00430,
+        0x00306, 0x00410, 0x00308, 0x00430, 0x00308, 0x004d5, 0x00415, 0x00306,
+        0x00435, 0x00306, 0x004d9, 0x004d8, 0x00308, 0x004d9, 0x00308, 0x00416,
+        0x00308, 0x00436, 0x00308, 0x00417, 0x00308, 0x00437, 0x00308, 0x004e1,
+        0x00418, 0x00304, 0x00438, 0x00304, 0x00418, 0x00308, 0x00438, 0x00308,
+        0x0041e, 0x00308, 0x0043e, 0x00308, 0x004e9, 0x004e8, 0x00308, 0x004e9,
+        0x00308, 0x0042d, 0x00308, 0x0044d, 0x00308, 0x00423, 0x00304, 0x00443,
+        0x00304, 0x00423, 0x00308, 0x00443, 0x00308, 0x00423, 0x0030b, 0x00443,
+        0x0030b, 0x00427, 0x00308, 0x00447, 0x00308, 0x004f7, 0x0042b, 0x00308,
+        0x0044b, 0x00308, 0x004fb, 0x004fd, 0x004ff, 0x00501, 0x00503, 0x00505,
+        0x00507, 0x00509, 0x0050b, 0x0050d, 0x0050f, 0x00511, 0x00513, 0x00515,
+        0x00517, 0x00519, 0x0051b, 0x0051d, 0x0051f, 0x00521, 0x00523, 0x00525,
+        0x00527, 0x00529, 0x0052b, 0x0052d, 0x0052f, 0x00561, 0x00562, 0x00563,
+        0x00564, 0x00565, 0x00566, 0x00567, 0x00568, 0x00569, 0x0056a, 0x0056b,
+        0x0056c, 0x0056d, 0x0056e, 0x0056f, 0x00570, 0x00571, 0x00572, 0x00573,
+        0x00574, 0x00575, 0x00576, 0x00577, 0x00578, 0x00579, 0x0057a, 0x0057b,
+        0x0057c, 0x0057d, 0x0057e, 0x0057f, 0x00580, 0x00581, 0x00582, 0x00583,
+        0x00584, 0x00585, 0x00586, 0x00565, 0x00582, 0x00627, 0x00653, 0x00627,
+        0x00654, 0x00648, 0x00654, 0x00627, 0x00655, 0x0064a, 0x00654, 0x006d5,
+        0x00654, 0x006c1, 0x00654, 0x006d2, 0x00654, 0x00928, 0x0093c, 0x00930,
+        0x0093c, 0x00933, 0x0093c, 0x00915, 0x0093c, 0x00916, 0x0093c, 0x00917,
+        0x0093c, 0x0091c, 0x0093c, 0x00921, 0x0093c, 0x00922, 0x0093c, 0x0092b,
+        0x0093c, 0x0092f, 0x0093c, 0x009c7, 0x009be, 0x009c7, 0x009d7, 0x009a1,
+        0x009bc, 0x009a2, 0x009bc, 0x009af, 0x009bc, 0x00a32, 0x00a3c, 0x00a38,
+        0x00a3c, 0x00a16, 0x00a3c, 0x00a17, 0x00a3c, 0x00a1c, 0x00a3c, 0x00a2b,
+        0x00a3c, 0x00b47, 0x00b56, 0x00b47, 0x00b3e, 0x00b47, 0x00b57, 0x00b21,
+        0x00b3c, 0x00b22, 0x00b3c, 0x00b92, 0x00bd7, 0x00bc6, 0x00bbe, 0x00bc7,
+        0x00bbe, 0x00bc6, 0x00bd7, 0x00c46, 0x00c56, 0x00cbf, 0x00cd5, 0x00cc6,
+        0x00cd5, 0x00cc6, 0x00cd6, 0x00cc6, 0x00cc2, 0x00cc6, 0x00cc2, 0x00cd5,
+        0x00d46, 0x00d3e, 0x00d47, 0x00d3e, 0x00d46, 0x00d57, 0x00dd9, 0x00dca,
+        0x00dd9, 0x00dcf, 0x00dd9, 0x00dcf, 0x00dca, 0x00dd9, 0x00ddf, 0x00f42,
+        0x00fb7, 0x00f4c, 0x00fb7, 0x00f51, 0x00fb7, 0x00f56, 0x00fb7, 0x00f5b,
+        0x00fb7, 0x00f40, 0x00fb5, 0x00f71, 0x00f72, 0x00f71, 0x00f74, 0x00fb2,
+        0x00f80, 0x00fb3, 0x00f80, 0x00f71, 0x00f80, 0x00f92, 0x00fb7, 0x00f9c,
+        0x00fb7, 0x00fa1, 0x00fb7, 0x00fa6, 0x00fb7, 0x00fab, 0x00fb7, 0x00f90,
+        0x00fb5, 0x01025, 0x0102e, 0x02d00, 0x02d01, 0x02d02, 0x02d03, 0x02d04,
+        0x02d05, 0x02d06, 0x02d07, 0x02d08, 0x02d09, 0x02d0a, 0x02d0b, 0x02d0c,
+        0x02d0d, 0x02d0e, 0x02d0f, 0x02d10, 0x02d11, 0x02d12, 0x02d13, 0x02d14,
+        0x02d15, 0x02d16, 0x02d17, 0x02d18, 0x02d19, 0x02d1a, 0x02d1b, 0x02d1c,
+        0x02d1d, 0x02d1e, 0x02d1f, 0x02d20, 0x02d21, 0x02d22, 0x02d23, 0x02d24,
+        0x02d25, 0x02d27, 0x02d2d, 0x013f0, 0x013f1, 0x013f2, 0x013f3, 0x013f4,
+        0x013f5, 0x01b05, 0x01b35, 0x01b07, 0x01b35, 0x01b09, 0x01b35, 0x01b0b,
+        0x01b35, 0x01b0d, 0x01b35, 0x01b11, 0x01b35, 0x01b3a, 0x01b35, 0x01b3c,
+        0x01b35, 0x01b3e, 0x01b35, 0x01b3f, 0x01b35, 0x01b42, 0x01b35, 0x0a64b,
+        0x010d0, 0x010d1, 0x010d2, 0x010d3, 0x010d4, 0x010d5, 0x010d6, 0x010d7,
+        0x010d8, 0x010d9, 0x010da, 0x010db, 0x010dc, 0x010dd, 0x010de, 0x010df,
+        0x010e0, 0x010e1, 0x010e2, 0x010e3, 0x010e4, 0x010e5, 0x010e6, 0x010e7,
+        0x010e8, 0x010e9, 0x010ea, 0x010eb, 0x010ec, 0x010ed, 0x010ee, 0x010ef,
+        0x010f0, 0x010f1, 0x010f2, 0x010f3, 0x010f4, 0x010f5, 0x010f6, 0x010f7,
+        0x010f8, 0x010f9, 0x010fa, 0x010fd, 0x010fe, 0x010ff, 0x00041, 0x00325,
+        0x00061, 0x00325, 0x00042, 0x00307, 0x00062, 0x00307, 0x00042, 0x00323,
+        0x00062, 0x00323, 0x00042, 0x00331, 0x00062, 0x00331, 0x00043, 0x00327,
+        0x00301, 0x00063, 0x00327, 0x00301, 0x00044, 0x00307, 0x00064, 0x00307,
+        0x00044, 0x00323, 0x00064, 0x00323, 0x00044, 0x00331, 0x00064, 0x00331,
+        0x00044, 0x00327, 0x00064, 0x00327, 0x00044, 0x0032d, 0x00064, 0x0032d,
+        0x00045, 0x00304, 0x00300, 0x00065, 0x00304, 0x00300, 0x00045, 0x00304,
+        0x00301, 0x00065, 0x00304, 0x00301, 0x00045, 0x0032d, 0x00065, 0x0032d,
+        0x00045, 0x00330, 0x00065, 0x00330, 0x00045, 0x00327, 0x00306, 0x00065,
+        0x00327, 0x00306, 0x00046, 0x00307, 0x00066, 0x00307, 0x00047, 0x00304,
+        0x00067, 0x00304, 0x00048, 0x00307, 0x00068, 0x00307, 0x00048, 0x00323,
+        0x00068, 0x00323, 0x00048, 0x00308, 0x00068, 0x00308, 0x00048, 0x00327,
+        0x00068, 0x00327, 0x00048, 0x0032e, 0x00068, 0x0032e, 0x00049, 0x00330,
+        0x00069, 0x00330, 0x00049, 0x00308, 0x00301, 0x00069, 0x00308, 0x00301,
+        0x0004b, 0x00301, 0x0006b, 0x00301, 0x0004b, 0x00323, 0x0006b, 0x00323,
+        0x0004b, 0x00331, 0x0006b, 0x00331, 0x0004c, 0x00323, 0x0006c, 0x00323,
+        0x0004c, 0x00323, 0x00304, 0x0006c, 0x00323, 0x00304, 0x0004c, 0x00331,
+        0x0006c, 0x00331, 0x0004c, 0x0032d, 0x0006c, 0x0032d, 0x0004d, 0x00301,
+        0x0006d, 0x00301, 0x0004d, 0x00307, 0x0006d, 0x00307, 0x0004d, 0x00323,
+        0x0006d, 0x00323, 0x0004e, 0x00307, 0x0006e, 0x00307, 0x0004e, 0x00323,
+        0x0006e, 0x00323, 0x0004e, 0x00331, 0x0006e, 0x00331, 0x0004e, 0x0032d,
+        0x0006e, 0x0032d, 0x0004f, 0x00303, 0x00301, 0x0006f, 0x00303, 0x00301,
+        0x0004f, 0x00303, 0x00308, 0x0006f, 0x00303, 0x00308, 0x0004f, 0x00304,
+        0x00300, 0x0006f, 0x00304, 0x00300, 0x0004f, 0x00304, 0x00301, 0x0006f,
+        0x00304, 0x00301, 0x00050, 0x00301, 0x00070, 0x00301, 0x00050, 0x00307,
+        0x00070, 0x00307, 0x00052, 0x00307, 0x00072, 0x00307, 0x00052, 0x00323,
+        0x00072, 0x00323, 0x00052, 0x00323, 0x00304, 0x00072, 0x00323, 0x00304,
+        0x00052, 0x00331, 0x00072, 0x00331, 0x00053, 0x00307, 0x00073, 0x00307,
+        0x00053, 0x00323, 0x00073, 0x00323, 0x00053, 0x00301, 0x00307, 0x00073,
+        0x00301, 0x00307, 0x00053, 0x0030c, 0x00307, 0x00073, 0x0030c, 0x00307,
+        0x00053, 0x00323, 0x00307, 0x00073, 0x00323, 0x00307, 0x00054, 0x00307,
+        0x00074, 0x00307, 0x00054, 0x00323, 0x00074, 0x00323, 0x00054, 0x00331,
+        0x00074, 0x00331, 0x00054, 0x0032d, 0x00074, 0x0032d, 0x00055, 0x00324,
+        0x00075, 0x00324, 0x00055, 0x00330, 0x00075, 0x00330, 0x00055, 0x0032d,
+        0x00075, 0x0032d, 0x00055, 0x00303, 0x00301, 0x00075, 0x00303, 0x00301,
+        0x00055, 0x00304, 0x00308, 0x00075, 0x00304, 0x00308, 0x00056, 0x00303,
+        0x00076, 0x00303, 0x00056, 0x00323, 0x00076, 0x00323, 0x00057, 0x00300,
+        0x00077, 0x00300, 0x00057, 0x00301, 0x00077, 0x00301, 0x00057, 0x00308,
+        0x00077, 0x00308, 0x00057, 0x00307, 0x00077, 0x00307, 0x00057, 0x00323,
+        0x00077, 0x00323, 0x00058, 0x00307, 0x00078, 0x00307, 0x00058, 0x00308,
+        0x00078, 0x00308, 0x00059, 0x00307, 0x00079, 0x00307, 0x0005a, 0x00302,
+        0x0007a, 0x00302, 0x0005a, 0x00323, 0x0007a, 0x00323, 0x0005a, 0x00331,
+        0x0007a, 0x00331, 0x00068, 0x00331, 0x00074, 0x00308, 0x00077, 0x0030a,
+        0x00079, 0x0030a, 0x00061, 0x002be, 0x0017f, 0x00307, 0x00041, 0x00323,
+        0x00061, 0x00323, 0x00041, 0x00309, 0x00061, 0x00309, 0x00041, 0x00302,
+        0x00301, 0x00061, 0x00302, 0x00301, 0x00041, 0x00302, 0x00300, 0x00061,
+        0x00302, 0x00300, 0x00041, 0x00302, 0x00309, 0x00061, 0x00302, 0x00309,
+        0x00041, 0x00302, 0x00303, 0x00061, 0x00302, 0x00303, 0x00041, 0x00323,
+        0x00302, 0x00061, 0x00323, 0x00302, 0x00041, 0x00306, 0x00301, 0x00061,
+        0x00306, 0x00301, 0x00041, 0x00306, 0x00300, 0x00061, 0x00306, 0x00300,
+        0x00041, 0x00306, 0x00309, 0x00061, 0x00306, 0x00309, 0x00041, 0x00306,
+        0x00303, 0x00061, 0x00306, 0x00303, 0x00041, 0x00323, 0x00306, 0x00061,
+        0x00323, 0x00306, 0x00045, 0x00323, 0x00065, 0x00323, 0x00045, 0x00309,
+        0x00065, 0x00309, 0x00045, 0x00303, 0x00065, 0x00303, 0x00045, 0x00302,
+        0x00301, 0x00065, 0x00302, 0x00301, 0x00045, 0x00302, 0x00300, 0x00065,
+        0x00302, 0x00300, 0x00045, 0x00302, 0x00309, 0x00065, 0x00302, 0x00309,
+        0x00045, 0x00302, 0x00303, 0x00065, 0x00302, 0x00303, 0x00045, 0x00323,
+        0x00302, 0x00065, 0x00323, 0x00302, 0x00049, 0x00309, 0x00069, 0x00309,
+        0x00049, 0x00323, 0x00069, 0x00323, 0x0004f, 0x00323, 0x0006f, 0x00323,
+        0x0004f, 0x00309, 0x0006f, 0x00309, 0x0004f, 0x00302, 0x00301, 0x0006f,
+        0x00302, 0x00301, 0x0004f, 0x00302, 0x00300, 0x0006f, 0x00302, 0x00300,
+        0x0004f, 0x00302, 0x00309, 0x0006f, 0x00302, 0x00309, 0x0004f, 0x00302,
+        0x00303, 0x0006f, 0x00302, 0x00303, 0x0004f, 0x00323, 0x00302, 0x0006f,
+        0x00323, 0x00302, 0x0004f, 0x0031b, 0x00301, 0x0006f, 0x0031b, 0x00301,
+        0x0004f, 0x0031b, 0x00300, 0x0006f, 0x0031b, 0x00300, 0x0004f, 0x0031b,
+        0x00309, 0x0006f, 0x0031b, 0x00309, 0x0004f, 0x0031b, 0x00303, 0x0006f,
+        0x0031b, 0x00303, 0x0004f, 0x0031b, 0x00323, 0x0006f, 0x0031b, 0x00323,
+        0x00055, 0x00323, 0x00075, 0x00323, 0x00055, 0x00309, 0x00075, 0x00309,
+        0x00055, 0x0031b, 0x00301, 0x00075, 0x0031b, 0x00301, 0x00055, 0x0031b,
+        0x00300, 0x00075, 0x0031b, 0x00300, 0x00055, 0x0031b, 0x00309, 0x00075,
+        0x0031b, 0x00309, 0x00055, 0x0031b, 0x00303, 0x00075, 0x0031b, 0x00303,
+        0x00055, 0x0031b, 0x00323, 0x00075, 0x0031b, 0x00323, 0x00059, 0x00300,
+        0x00079, 0x00300, 0x00059, 0x00323, 0x00079, 0x00323, 0x00059, 0x00309,
+        0x00079, 0x00309, 0x00059, 0x00303, 0x00079, 0x00303, 0x01efb, 0x01efd,
+        0x01eff, 0x003b1, 0x00313, 0x003b1, 0x00314, 0x003b1, 0x00313, 0x00300,
+        0x003b1, 0x00314, 0x00300, 0x003b1, 0x00313, 0x00301, 0x003b1, 0x00314,
+        0x00301, 0x003b1, 0x00313, 0x00342, 0x003b1, 0x00314, 0x00342, 0x00391,
+        0x00313, 0x00391, 0x00314, 0x00391, 0x00313, 0x00300, 0x00391, 0x00314,
+        0x00300, 0x00391, 0x00313, 0x00301, 0x00391, 0x00314, 0x00301, 0x00391,
+        0x00313, 0x00342, 0x00391, 0x00314, 0x00342, 0x003b5, 0x00313, 0x003b5,
+        0x00314, 0x003b5, 0x00313, 0x00300, 0x003b5, 0x00314, 0x00300, 0x003b5,
+        0x00313, 0x00301, 0x003b5, 0x00314, 0x00301, 0x00395, 0x00313, 0x00395,
+        0x00314, 0x00395, 0x00313, 0x00300, 0x00395, 0x00314, 0x00300, 0x00395,
+        0x00313, 0x00301, 0x00395, 0x00314, 0x00301, 0x003b7, 0x00313, 0x003b7,
+        0x00314, 0x003b7, 0x00313, 0x00300, 0x003b7, 0x00314, 0x00300, 0x003b7,
+        0x00313, 0x00301, 0x003b7, 0x00314, 0x00301, 0x003b7, 0x00313, 0x00342,
+        0x003b7, 0x00314, 0x00342, 0x00397, 0x00313, 0x00397, 0x00314, 0x00397,
+        0x00313, 0x00300, 0x00397, 0x00314, 0x00300, 0x00397, 0x00313, 0x00301,
+        0x00397, 0x00314, 0x00301, 0x00397, 0x00313, 0x00342, 0x00397, 0x00314,
+        0x00342, 0x003b9, 0x00313, 0x003b9, 0x00314, 0x003b9, 0x00313, 0x00300,
+        0x003b9, 0x00314, 0x00300, 0x003b9, 0x00313, 0x00301, 0x003b9, 0x00314,
+        0x00301, 0x003b9, 0x00313, 0x00342, 0x003b9, 0x00314, 0x00342, 0x00399,
+        0x00313, 0x00399, 0x00314, 0x00399, 0x00313, 0x00300, 0x00399, 0x00314,
+        0x00300, 0x00399, 0x00313, 0x00301, 0x00399, 0x00314, 0x00301, 0x00399,
+        0x00313, 0x00342, 0x00399, 0x00314, 0x00342, 0x003bf, 0x00313, 0x003bf,
+        0x00314, 0x003bf, 0x00313, 0x00300, 0x003bf, 0x00314, 0x00300, 0x003bf,
+        0x00313, 0x00301, 0x003bf, 0x00314, 0x00301, 0x0039f, 0x00313, 0x0039f,
+        0x00314, 0x0039f, 0x00313, 0x00300, 0x0039f, 0x00314, 0x00300, 0x0039f,
+        0x00313, 0x00301, 0x0039f, 0x00314, 0x00301, 0x003c5, 0x00313, 0x003c5,
+        0x00314, 0x003c5, 0x00313, 0x00300, 0x003c5, 0x00314, 0x00300, 0x003c5,
+        0x00313, 0x00301, 0x003c5, 0x00314, 0x00301, 0x003c5, 0x00313, 0x00342,
+        0x003c5, 0x00314, 0x00342, 0x003a5, 0x00314, 0x003a5, 0x00314, 0x00300,
+        0x003a5, 0x00314, 0x00301, 0x003a5, 0x00314, 0x00342, 0x003c9, 0x00313,
+        0x003c9, 0x00314, 0x003c9, 0x00313, 0x00300, 0x003c9, 0x00314, 0x00300,
+        0x003c9, 0x00313, 0x00301, 0x003c9, 0x00314, 0x00301, 0x003c9, 0x00313,
+        0x00342, 0x003c9, 0x00314, 0x00342, 0x003a9, 0x00313, 0x003a9, 0x00314,
+        0x003a9, 0x00313, 0x00300, 0x003a9, 0x00314, 0x00300, 0x003a9, 0x00313,
+        0x00301, 0x003a9, 0x00314, 0x00301, 0x003a9, 0x00313, 0x00342, 0x003a9,
+        0x00314, 0x00342, 0x003b1, 0x00300, 0x003b5, 0x00300, 0x003b7, 0x00300,
+        0x003b9, 0x00300, 0x003bf, 0x00300, 0x003c5, 0x00300, 0x003c9, 0x00300,
+        0x003b1, 0x00313, 0x00345, 0x003b1, 0x00314, 0x00345, 0x003b1, 0x00313,
+        0x00300, 0x00345, 0x003b1, 0x00314, 0x00300, 0x00345, 0x003b1, 0x00313,
+        0x00301, 0x00345, 0x003b1, 0x00314, 0x00301, 0x00345, 0x003b1, 0x00313,
+        0x00342, 0x00345, 0x003b1, 0x00314, 0x00342, 0x00345, 0x00391, 0x00313,
+        0x00345, 0x00391, 0x00314, 0x00345, 0x00391, 0x00313, 0x00300, 0x00345,
+        0x00391, 0x00314, 0x00300, 0x00345, 0x00391, 0x00313, 0x00301, 0x00345,
+        0x00391, 0x00314, 0x00301, 0x00345, 0x00391, 0x00313, 0x00342, 0x00345,
+        0x00391, 0x00314, 0x00342, 0x00345, 0x003b7, 0x00313, 0x00345, 0x003b7,
+        0x00314, 0x00345, 0x003b7, 0x00313, 0x00300, 0x00345, 0x003b7, 0x00314,
+        0x00300, 0x00345, 0x003b7, 0x00313, 0x00301, 0x00345, 0x003b7, 0x00314,
+        0x00301, 0x00345, 0x003b7, 0x00313, 0x00342, 0x00345, 0x003b7, 0x00314,
+        0x00342, 0x00345, 0x00397, 0x00313, 0x00345, 0x00397, 0x00314, 0x00345,
+        0x00397, 0x00313, 0x00300, 0x00345, 0x00397, 0x00314, 0x00300, 0x00345,
+        0x00397, 0x00313, 0x00301, 0x00345, 0x00397, 0x00314, 0x00301, 0x00345,
+        0x00397, 0x00313, 0x00342, 0x00345, 0x00397, 0x00314, 0x00342, 0x00345,
+        0x003c9, 0x00313, 0x00345, 0x003c9, 0x00314, 0x00345, 0x003c9, 0x00313,
+        0x00300, 0x00345, 0x003c9, 0x00314, 0x00300, 0x00345, 0x003c9, 0x00313,
+        0x00301, 0x00345, 0x003c9, 0x00314, 0x00301, 0x00345, 0x003c9, 0x00313,
+        0x00342, 0x00345, 0x003c9, 0x00314, 0x00342, 0x00345, 0x003a9, 0x00313,
+        0x00345, 0x003a9, 0x00314, 0x00345, 0x003a9, 0x00313, 0x00300, 0x00345,
+        0x003a9, 0x00314, 0x00300, 0x00345, 0x003a9, 0x00313, 0x00301, 0x00345,
+        0x003a9, 0x00314, 0x00301, 0x00345, 0x003a9, 0x00313, 0x00342, 0x00345,
+        0x003a9, 0x00314, 0x00342, 0x00345, 0x003b1, 0x00306, 0x003b1, 0x00304,
+        0x003b1, 0x00300, 0x00345, 0x003b1, 0x00345, 0x003b1, 0x00301, 0x00345,
+        0x003b1, 0x00342, 0x003b1, 0x00342, 0x00345, 0x00391, 0x00306, 0x00391,
+        0x00304, 0x00391, 0x00300, 0x00391, 0x00345, 0x000a8, 0x00342, 0x003b7,
+        0x00300, 0x00345, 0x003b7, 0x00345, 0x003b7, 0x00301, 0x00345, 0x003b7,
+        0x00342, 0x003b7, 0x00342, 0x00345, 0x00395, 0x00300, 0x00397, 0x00300,
+        0x00397, 0x00345, 0x01fbf, 0x00300, 0x01fbf, 0x00301, 0x01fbf, 0x00342,
+        0x003b9, 0x00306, 0x003b9, 0x00304, 0x003b9, 0x00308, 0x00300, 0x003b9,
+        0x00342, 0x003b9, 0x00308, 0x00342, 0x00399, 0x00306, 0x00399, 0x00304,
+        0x00399, 0x00300, 0x01ffe, 0x00300, 0x01ffe, 0x00301, 0x01ffe, 0x00342,
+        0x003c5, 0x00306, 0x003c5, 0x00304, 0x003c5, 0x00308, 0x00300, 0x003c1,
+        0x00313, 0x003c1, 0x00314, 0x003c5, 0x00342, 0x003c5, 0x00308, 0x00342,
+        0x003a5, 0x00306, 0x003a5, 0x00304, 0x003a5, 0x00300, 0x003a1, 0x00314,
+        0x000a8, 0x00300, 0x00060, 0x003c9, 0x00300, 0x00345, 0x003c9, 0x00345,
+        0x003c9, 0x00301, 0x00345, 0x003c9, 0x00342, 0x003c9, 0x00342, 0x00345,
+        0x0039f, 0x00300, 0x003a9, 0x00300, 0x003a9, 0x00345, 0x000b4, 0x02002,
+        0x02003, 0x003a9, 0x0004b, 0x0214e, 0x02170, 0x02171, 0x02172, 0x02173,
+        0x02174, 0x02175, 0x02176, 0x02177, 0x02178, 0x02179, 0x0217a, 0x0217b,
+        0x0217c, 0x0217d, 0x0217e, 0x0217f, 0x02184, 0x02190, 0x00338, 0x02192,
+        0x00338, 0x02194, 0x00338, 0x021d0, 0x00338, 0x021d4, 0x00338, 0x021d2,
+        0x00338, 0x02203, 0x00338, 0x02208, 0x00338, 0x0220b, 0x00338, 0x02223,
+        0x00338, 0x02225, 0x00338, 0x0223c, 0x00338, 0x02243, 0x00338, 0x02245,
+        0x00338, 0x02248, 0x00338, 0x0003d, 0x00338, 0x02261, 0x00338, 0x0224d,
+        0x00338, 0x0003c, 0x00338, 0x0003e, 0x00338, 0x02264, 0x00338, 0x02265,
+        0x00338, 0x02272, 0x00338, 0x02273, 0x00338, 0x02276, 0x00338, 0x02277,
+        0x00338, 0x0227a, 0x00338, 0x0227b, 0x00338, 0x02282, 0x00338, 0x02283,
+        0x00338, 0x02286, 0x00338, 0x02287, 0x00338, 0x022a2, 0x00338, 0x022a8,
+        0x00338, 0x022a9, 0x00338, 0x022ab, 0x00338, 0x0227c, 0x00338, 0x0227d,
+        0x00338, 0x02291, 0x00338, 0x02292, 0x00338, 0x022b2, 0x00338, 0x022b3,
+        0x00338, 0x022b4, 0x00338, 0x022b5, 0x00338, 0x03008, 0x03009, 0x024d0,
+        0x024d1, 0x024d2, 0x024d3, 0x024d4, 0x024d5, 0x024d6, 0x024d7, 0x024d8,
+        0x024d9, 0x024da, 0x024db, 0x024dc, 0x024dd, 0x024de, 0x024df, 0x024e0,
+        0x024e1, 0x024e2, 0x024e3, 0x024e4, 0x024e5, 0x024e6, 0x024e7, 0x024e8,
+        0x024e9, 0x02add, 0x00338, 0x02c30, 0x02c31, 0x02c32, 0x02c33, 0x02c34,
+        0x02c35, 0x02c36, 0x02c37, 0x02c38, 0x02c39, 0x02c3a, 0x02c3b, 0x02c3c,
+        0x02c3d, 0x02c3e, 0x02c3f, 0x02c40, 0x02c41, 0x02c42, 0x02c43, 0x02c44,
+        0x02c45, 0x02c46, 0x02c47, 0x02c48, 0x02c49, 0x02c4a, 0x02c4b, 0x02c4c,
+        0x02c4d, 0x02c4e, 0x02c4f, 0x02c50, 0x02c51, 0x02c52, 0x02c53, 0x02c54,
+        0x02c55, 0x02c56, 0x02c57, 0x02c58, 0x02c59, 0x02c5a, 0x02c5b, 0x02c5c,
+        0x02c5d, 0x02c5e, 0x02c5f, 0x02c61, 0x0026b, 0x01d7d, 0x0027d, 0x02c68,
+        0x02c6a, 0x02c6c, 0x00251, 0x00271, 0x00250, 0x00252, 0x02c73, 0x02c76,
+        0x0023f, 0x00240, 0x02c81, 0x02c83, 0x02c85, 0x02c87, 0x02c89, 0x02c8b,
+        0x02c8d, 0x02c8f, 0x02c91, 0x02c93, 0x02c95, 0x02c97, 0x02c99, 0x02c9b,
+        0x02c9d, 0x02c9f, 0x02ca1, 0x02ca3, 0x02ca5, 0x02ca7, 0x02ca9, 0x02cab,
+        0x02cad, 0x02caf, 0x02cb1, 0x02cb3, 0x02cb5, 0x02cb7, 0x02cb9, 0x02cbb,
+        0x02cbd, 0x02cbf, 0x02cc1, 0x02cc3, 0x02cc5, 0x02cc7, 0x02cc9, 0x02ccb,
+        0x02ccd, 0x02ccf, 0x02cd1, 0x02cd3, 0x02cd5, 0x02cd7, 0x02cd9, 0x02cdb,
+        0x02cdd, 0x02cdf, 0x02ce1, 0x02ce3, 0x02cec, 0x02cee, 0x02cf3, 0x0304b,
+        0x03099, 0x0304d, 0x03099, 0x0304f, 0x03099, 0x03051, 0x03099, 0x03053,
+        0x03099, 0x03055, 0x03099, 0x03057, 0x03099, 0x03059, 0x03099, 0x0305b,
+        0x03099, 0x0305d, 0x03099, 0x0305f, 0x03099, 0x03061, 0x03099, 0x03064,
+        0x03099, 0x03066, 0x03099, 0x03068, 0x03099, 0x0306f, 0x03099, 0x0306f,
+        0x0309a, 0x03072, 0x03099, 0x03072, 0x0309a, 0x03075, 0x03099, 0x03075,
+        0x0309a, 0x03078, 0x03099, 0x03078, 0x0309a, 0x0307b, 0x03099, 0x0307b,
+        0x0309a, 0x03046, 0x03099, 0x0309d, 0x03099, 0x030ab, 0x03099, 0x030ad,
+        0x03099, 0x030af, 0x03099, 0x030b1, 0x03099, 0x030b3, 0x03099, 0x030b5,
+        0x03099, 0x030b7, 0x03099, 0x030b9, 0x03099, 0x030bb, 0x03099, 0x030bd,
+        0x03099, 0x030bf, 0x03099, 0x030c1, 0x03099, 0x030c4, 0x03099, 0x030c6,
+        0x03099, 0x030c8, 0x03099, 0x030cf, 0x03099, 0x030cf, 0x0309a, 0x030d2,
+        0x03099, 0x030d2, 0x0309a, 0x030d5, 0x03099, 0x030d5, 0x0309a, 0x030d8,
+        0x03099, 0x030d8, 0x0309a, 0x030db, 0x03099, 0x030db, 0x0309a, 0x030a6,
+        0x03099, 0x030ef, 0x03099, 0x030f0, 0x03099, 0x030f1, 0x03099, 0x030f2,
+        0x03099, 0x030fd, 0x03099, 0x0a641, 0x0a643, 0x0a645, 0x0a647, 0x0a649,
+        0x0a64d, 0x0a64f, 0x0a651, 0x0a653, 0x0a655, 0x0a657, 0x0a659, 0x0a65b,
+        0x0a65d, 0x0a65f, 0x0a661, 0x0a663, 0x0a665, 0x0a667, 0x0a669, 0x0a66b,
+        0x0a66d, 0x0a681, 0x0a683, 0x0a685, 0x0a687, 0x0a689, 0x0a68b, 0x0a68d,
+        0x0a68f, 0x0a691, 0x0a693, 0x0a695, 0x0a697, 0x0a699, 0x0a69b, 0x0a723,
+        0x0a725, 0x0a727, 0x0a729, 0x0a72b, 0x0a72d, 0x0a72f, 0x0a733, 0x0a735,
+        0x0a737, 0x0a739, 0x0a73b, 0x0a73d, 0x0a73f, 0x0a741, 0x0a743, 0x0a745,
+        0x0a747, 0x0a749, 0x0a74b, 0x0a74d, 0x0a74f, 0x0a751, 0x0a753, 0x0a755,
+        0x0a757, 0x0a759, 0x0a75b, 0x0a75d, 0x0a75f, 0x0a761, 0x0a763, 0x0a765,
+        0x0a767, 0x0a769, 0x0a76b, 0x0a76d, 0x0a76f, 0x0a77a, 0x0a77c, 0x01d79,
+        0x0a77f, 0x0a781, 0x0a783, 0x0a785, 0x0a787, 0x0a78c, 0x00265, 0x0a791,
+        0x0a793, 0x0a797, 0x0a799, 0x0a79b, 0x0a79d, 0x0a79f, 0x0a7a1, 0x0a7a3,
+        0x0a7a5, 0x0a7a7, 0x0a7a9, 0x00266, 0x0025c, 0x00261, 0x0026c, 0x0026a,
+        0x0029e, 0x00287, 0x0029d, 0x0ab53, 0x0a7b5, 0x0a7b7, 0x0a7b9, 0x0a7bb,
+        0x0a7bd, 0x0a7bf, 0x0a7c1, 0x0a7c3, 0x0a794, 0x00282, 0x01d8e, 0x0a7c8,
+        0x0a7ca, 0x0a7d1, 0x0a7d7, 0x0a7d9, 0x0a7f6, 0x013a0, 0x013a1, 0x013a2,
+        0x013a3, 0x013a4, 0x013a5, 0x013a6, 0x013a7, 0x013a8, 0x013a9, 0x013aa,
+        0x013ab, 0x013ac, 0x013ad, 0x013ae, 0x013af, 0x013b0, 0x013b1, 0x013b2,
+        0x013b3, 0x013b4, 0x013b5, 0x013b6, 0x013b7, 0x013b8, 0x013b9, 0x013ba,
+        0x013bb, 0x013bc, 0x013bd, 0x013be, 0x013bf, 0x013c0, 0x013c1, 0x013c2,
+        0x013c3, 0x013c4, 0x013c5, 0x013c6, 0x013c7, 0x013c8, 0x013c9, 0x013ca,
+        0x013cb, 0x013cc, 0x013cd, 0x013ce, 0x013cf, 0x013d0, 0x013d1, 0x013d2,
+        0x013d3, 0x013d4, 0x013d5, 0x013d6, 0x013d7, 0x013d8, 0x013d9, 0x013da,
+        0x013db, 0x013dc, 0x013dd, 0x013de, 0x013df, 0x013e0, 0x013e1, 0x013e2,
+        0x013e3, 0x013e4, 0x013e5, 0x013e6, 0x013e7, 0x013e8, 0x013e9, 0x013ea,
+        0x013eb, 0x013ec, 0x013ed, 0x013ee, 0x013ef, 0x08c48, 0x066f4, 0x08eca,
+        0x08cc8, 0x06ed1, 0x04e32, 0x053e5, 0x09f9c, 0x05951, 0x091d1, 0x05587,
+        0x05948, 0x061f6, 0x07669, 0x07f85, 0x0863f, 0x087ba, 0x088f8, 0x0908f,
+        0x06a02, 0x06d1b, 0x070d9, 0x073de, 0x0843d, 0x0916a, 0x099f1, 0x04e82,
+        0x05375, 0x06b04, 0x0721b, 0x0862d, 0x09e1e, 0x05d50, 0x06feb, 0x085cd,
+        0x08964, 0x062c9, 0x081d8, 0x0881f, 0x05eca, 0x06717, 0x06d6a, 0x072fc,
+        0x090ce, 0x04f86, 0x051b7, 0x052de, 0x064c4, 0x06ad3, 0x07210, 0x076e7,
+        0x08001, 0x08606, 0x0865c, 0x08def, 0x09732, 0x09b6f, 0x09dfa, 0x0788c,
+        0x0797f, 0x07da0, 0x083c9, 0x09304, 0x09e7f, 0x08ad6, 0x058df, 0x05f04,
+        0x07c60, 0x0807e, 0x07262, 0x078ca, 0x08cc2, 0x096f7, 0x058d8, 0x05c62,
+        0x06a13, 0x06dda, 0x06f0f, 0x07d2f, 0x07e37, 0x0964b, 0x052d2, 0x0808b,
+        0x051dc, 0x051cc, 0x07a1c, 0x07dbe, 0x083f1, 0x09675, 0x08b80, 0x062cf,
+        0x08afe, 0x04e39, 0x05be7, 0x06012, 0x07387, 0x07570, 0x05317, 0x078fb,
+        0x04fbf, 0x05fa9, 0x04e0d, 0x06ccc, 0x06578, 0x07d22, 0x053c3, 0x0585e,
+        0x07701, 0x08449, 0x08aaa, 0x06bba, 0x08fb0, 0x06c88, 0x062fe, 0x082e5,
+        0x063a0, 0x07565, 0x04eae, 0x05169, 0x051c9, 0x06881, 0x07ce7, 0x0826f,
+        0x08ad2, 0x091cf, 0x052f5, 0x05442, 0x05973, 0x05eec, 0x065c5, 0x06ffe,
+        0x0792a, 0x095ad, 0x09a6a, 0x09e97, 0x09ece, 0x0529b, 0x066c6, 0x06b77,
+        0x08f62, 0x05e74, 0x06190, 0x06200, 0x0649a, 0x06f23, 0x07149, 0x07489,
+        0x079ca, 0x07df4, 0x0806f, 0x08f26, 0x084ee, 0x09023, 0x0934a, 0x05217,
+        0x052a3, 0x054bd, 0x070c8, 0x088c2, 0x05ec9, 0x05ff5, 0x0637b, 0x06bae,
+        0x07c3e, 0x07375, 0x04ee4, 0x056f9, 0x05dba, 0x0601c, 0x073b2, 0x07469,
+        0x07f9a, 0x08046, 0x09234, 0x096f6, 0x09748, 0x09818, 0x04f8b, 0x079ae,
+        0x091b4, 0x096b8, 0x060e1, 0x04e86, 0x050da, 0x05bee, 0x05c3f, 0x06599,
+        0x071ce, 0x07642, 0x084fc, 0x0907c, 0x09f8d, 0x06688, 0x0962e, 0x05289,
+        0x0677b, 0x067f3, 0x06d41, 0x06e9c, 0x07409, 0x07559, 0x0786b, 0x07d10,
+        0x0985e, 0x0516d, 0x0622e, 0x09678, 0x0502b, 0x05d19, 0x06dea, 0x08f2a,
+        0x05f8b, 0x06144, 0x06817, 0x09686, 0x05229, 0x0540f, 0x05c65, 0x06613,
+        0x0674e, 0x068a8, 0x06ce5, 0x07406, 0x075e2, 0x07f79, 0x088cf, 0x088e1,
+        0x091cc, 0x096e2, 0x0533f, 0x06eba, 0x0541d, 0x071d0, 0x07498, 0x085fa,
+        0x096a3, 0x09c57, 0x09e9f, 0x06797, 0x06dcb, 0x081e8, 0x07acb, 0x07b20,
+        0x07c92, 0x072c0, 0x07099, 0x08b58, 0x04ec0, 0x08336, 0x0523a, 0x05207,
+        0x05ea6, 0x062d3, 0x07cd6, 0x05b85, 0x06d1e, 0x066b4, 0x08f3b, 0x0884c,
+        0x0964d, 0x0898b, 0x05ed3, 0x05140, 0x055c0, 0x0585a, 0x06674, 0x051de,
+        0x0732a, 0x076ca, 0x0793c, 0x0795e, 0x07965, 0x0798f, 0x09756, 0x07cbe,
+        0x07fbd, 0x08612, 0x08af8, 0x09038, 0x090fd, 0x098ef, 0x098fc, 0x09928,
+        0x09db4, 0x090de, 0x096b7, 0x04fae, 0x050e7, 0x0514d, 0x052c9, 0x052e4,
+        0x05351, 0x0559d, 0x05606, 0x05668, 0x05840, 0x058a8, 0x05c64, 0x05c6e,
+        0x06094, 0x06168, 0x0618e, 0x061f2, 0x0654f, 0x065e2, 0x06691, 0x06885,
+        0x06d77, 0x06e1a, 0x06f22, 0x0716e, 0x0722b, 0x07422, 0x07891, 0x0793e,
+        0x07949, 0x07948, 0x07950, 0x07956, 0x0795d, 0x0798d, 0x0798e, 0x07a40,
+        0x07a81, 0x07bc0, 0x07e09, 0x07e41, 0x07f72, 0x08005, 0x081ed, 0x08279,
+        0x08457, 0x08910, 0x08996, 0x08b01, 0x08b39, 0x08cd3, 0x08d08, 0x08fb6,
+        0x096e3, 0x097ff, 0x0983b, 0x06075, 0x242ee, 0x08218, 0x04e26, 0x051b5,
+        0x05168, 0x04f80, 0x05145, 0x05180, 0x052c7, 0x052fa, 0x05555, 0x05599,
+        0x055e2, 0x058b3, 0x05944, 0x05954, 0x05a62, 0x05b28, 0x05ed2, 0x05ed9,
+        0x05f69, 0x05fad, 0x060d8, 0x0614e, 0x06108, 0x06160, 0x06234, 0x063c4,
+        0x0641c, 0x06452, 0x06556, 0x0671b, 0x06756, 0x06b79, 0x06edb, 0x06ecb,
+        0x0701e, 0x077a7, 0x07235, 0x072af, 0x07471, 0x07506, 0x0753b, 0x0761d,
+        0x0761f, 0x076db, 0x076f4, 0x0774a, 0x07740, 0x078cc, 0x07ab1, 0x07c7b,
+        0x07d5b, 0x07f3e, 0x08352, 0x083ef, 0x08779, 0x08941, 0x08986, 0x08abf,
+        0x08acb, 0x08aed, 0x08b8a, 0x08f38, 0x09072, 0x09199, 0x09276, 0x0967c,
+        0x097db, 0x0980b, 0x09b12, 0x2284a, 0x22844, 0x233d5, 0x03b9d, 0x04018,
+        0x04039, 0x25249, 0x25cd0, 0x27ed3, 0x09f43, 0x09f8e, 0x00066, 0x00066,
+        0x00066, 0x00069, 0x00066, 0x0006c, 0x00066, 0x00066, 0x00069, 0x00066,
+        0x00066, 0x0006c, 0x00073, 0x00074, 0x00574, 0x00576, 0x00574, 0x00565,
+        0x00574, 0x0056b, 0x0057e, 0x00576, 0x00574, 0x0056d, 0x005d9, 0x005b4,
+        0x005f2, 0x005b7, 0x005e9, 0x005c1, 0x005e9, 0x005c2, 0x005e9, 0x005bc,
+        0x005c1, 0x005e9, 0x005bc, 0x005c2, 0x005d0, 0x005b7, 0x005d0, 0x005b8,
+        0x005d0, 0x005bc, 0x005d1, 0x005bc, 0x005d2, 0x005bc, 0x005d3, 0x005bc,
+        0x005d4, 0x005bc, 0x005d5, 0x005bc, 0x005d6, 0x005bc, 0x005d8, 0x005bc,
+        0x005d9, 0x005bc, 0x005da, 0x005bc, 0x005db, 0x005bc, 0x005dc, 0x005bc,
+        0x005de, 0x005bc, 0x005e0, 0x005bc, 0x005e1, 0x005bc, 0x005e3, 0x005bc,
+        0x005e4, 0x005bc, 0x005e6, 0x005bc, 0x005e7, 0x005bc, 0x005e8, 0x005bc,
+        0x005e9, 0x005bc, 0x005ea, 0x005bc, 0x005d5, 0x005b9, 0x005d1, 0x005bf,
+        0x005db, 0x005bf, 0x005e4, 0x005bf, 0x0ff41, 0x0ff42, 0x0ff43, 0x0ff44,
+        0x0ff45, 0x0ff46, 0x0ff47, 0x0ff48, 0x0ff49, 0x0ff4a, 0x0ff4b, 0x0ff4c,
+        0x0ff4d, 0x0ff4e, 0x0ff4f, 0x0ff50, 0x0ff51, 0x0ff52, 0x0ff53, 0x0ff54,
+        0x0ff55, 0x0ff56, 0x0ff57, 0x0ff58, 0x0ff59, 0x0ff5a, 0x10428, 0x10429,
+        0x1042a, 0x1042b, 0x1042c, 0x1042d, 0x1042e, 0x1042f, 0x10430, 0x10431,
+        0x10432, 0x10433, 0x10434, 0x10435, 0x10436, 0x10437, 0x10438, 0x10439,
+        0x1043a, 0x1043b, 0x1043c, 0x1043d, 0x1043e, 0x1043f, 0x10440, 0x10441,
+        0x10442, 0x10443, 0x10444, 0x10445, 0x10446, 0x10447, 0x10448, 0x10449,
+        0x1044a, 0x1044b, 0x1044c, 0x1044d, 0x1044e, 0x1044f, 0x104d8, 0x104d9,
+        0x104da, 0x104db, 0x104dc, 0x104dd, 0x104de, 0x104df, 0x104e0, 0x104e1,
+        0x104e2, 0x104e3, 0x104e4, 0x104e5, 0x104e6, 0x104e7, 0x104e8, 0x104e9,
+        0x104ea, 0x104eb, 0x104ec, 0x104ed, 0x104ee, 0x104ef, 0x104f0, 0x104f1,
+        0x104f2, 0x104f3, 0x104f4, 0x104f5, 0x104f6, 0x104f7, 0x104f8, 0x104f9,
+        0x104fa, 0x104fb, 0x10597, 0x10598, 0x10599, 0x1059a, 0x1059b, 0x1059c,
+        0x1059d, 0x1059e, 0x1059f, 0x105a0, 0x105a1, 0x105a3, 0x105a4, 0x105a5,
+        0x105a6, 0x105a7, 0x105a8, 0x105a9, 0x105aa, 0x105ab, 0x105ac, 0x105ad,
+        0x105ae, 0x105af, 0x105b0, 0x105b1, 0x105b3, 0x105b4, 0x105b5, 0x105b6,
+        0x105b7, 0x105b8, 0x105b9, 0x105bb, 0x105bc, 0x10cc0, 0x10cc1, 0x10cc2,
+        0x10cc3, 0x10cc4, 0x10cc5, 0x10cc6, 0x10cc7, 0x10cc8, 0x10cc9, 0x10cca,
+        0x10ccb, 0x10ccc, 0x10ccd, 0x10cce, 0x10ccf, 0x10cd0, 0x10cd1, 0x10cd2,
+        0x10cd3, 0x10cd4, 0x10cd5, 0x10cd6, 0x10cd7, 0x10cd8, 0x10cd9, 0x10cda,
+        0x10cdb, 0x10cdc, 0x10cdd, 0x10cde, 0x10cdf, 0x10ce0, 0x10ce1, 0x10ce2,
+        0x10ce3, 0x10ce4, 0x10ce5, 0x10ce6, 0x10ce7, 0x10ce8, 0x10ce9, 0x10cea,
+        0x10ceb, 0x10cec, 0x10ced, 0x10cee, 0x10cef, 0x10cf0, 0x10cf1, 0x10cf2,
+        0x11099, 0x110ba, 0x1109b, 0x110ba, 0x110a5, 0x110ba, 0x11131, 0x11127,
+        0x11132, 0x11127, 0x11347, 0x1133e, 0x11347, 0x11357, 0x114b9, 0x114ba,
+        0x114b9, 0x114b0, 0x114b9, 0x114bd, 0x115b8, 0x115af, 0x115b9, 0x115af,
+        0x118c0, 0x118c1, 0x118c2, 0x118c3, 0x118c4, 0x118c5, 0x118c6, 0x118c7,
+        0x118c8, 0x118c9, 0x118ca, 0x118cb, 0x118cc, 0x118cd, 0x118ce, 0x118cf,
+        0x118d0, 0x118d1, 0x118d2, 0x118d3, 0x118d4, 0x118d5, 0x118d6, 0x118d7,
+        0x118d8, 0x118d9, 0x118da, 0x118db, 0x118dc, 0x118dd, 0x118de, 0x118df,
+        0x11935, 0x11930, 0x16e60, 0x16e61, 0x16e62, 0x16e63, 0x16e64, 0x16e65,
+        0x16e66, 0x16e67, 0x16e68, 0x16e69, 0x16e6a, 0x16e6b, 0x16e6c, 0x16e6d,
+        0x16e6e, 0x16e6f, 0x16e70, 0x16e71, 0x16e72, 0x16e73, 0x16e74, 0x16e75,
+        0x16e76, 0x16e77, 0x16e78, 0x16e79, 0x16e7a, 0x16e7b, 0x16e7c, 0x16e7d,
+        0x16e7e, 0x16e7f, 0x1d157, 0x1d165, 0x1d158, 0x1d165, 0x1d158, 0x1d165,
+        0x1d16e, 0x1d158, 0x1d165, 0x1d16f, 0x1d158, 0x1d165, 0x1d170, 0x1d158,
+        0x1d165, 0x1d171, 0x1d158, 0x1d165, 0x1d172, 0x1d1b9, 0x1d165, 0x1d1ba,
+        0x1d165, 0x1d1b9, 0x1d165, 0x1d16e, 0x1d1ba, 0x1d165, 0x1d16e, 0x1d1b9,
+        0x1d165, 0x1d16f, 0x1d1ba, 0x1d165, 0x1d16f, 0x1e922, 0x1e923, 0x1e924,
+        0x1e925, 0x1e926, 0x1e927, 0x1e928, 0x1e929, 0x1e92a, 0x1e92b, 0x1e92c,
+        0x1e92d, 0x1e92e, 0x1e92f, 0x1e930, 0x1e931, 0x1e932, 0x1e933, 0x1e934,
+        0x1e935, 0x1e936, 0x1e937, 0x1e938, 0x1e939, 0x1e93a, 0x1e93b, 0x1e93c,
+        0x1e93d, 0x1e93e, 0x1e93f, 0x1e940, 0x1e941, 0x1e942, 0x1e943, 0x04e3d,
+        0x04e38, 0x04e41, 0x20122, 0x04f60, 0x04fbb, 0x05002, 0x0507a, 0x05099,
+        0x050cf, 0x0349e, 0x2063a, 0x05154, 0x05164, 0x05177, 0x2051c, 0x034b9,
+        0x05167, 0x0518d, 0x2054b, 0x05197, 0x051a4, 0x04ecc, 0x051ac, 0x291df,
+        0x051f5, 0x05203, 0x034df, 0x0523b, 0x05246, 0x05272, 0x05277, 0x03515,
+        0x05305, 0x05306, 0x05349, 0x0535a, 0x05373, 0x0537d, 0x0537f, 0x20a2c,
+        0x07070, 0x053ca, 0x053df, 0x20b63, 0x053eb, 0x053f1, 0x05406, 0x0549e,
+        0x05438, 0x05448, 0x05468, 0x054a2, 0x054f6, 0x05510, 0x05553, 0x05563,
+        0x05584, 0x055ab, 0x055b3, 0x055c2, 0x05716, 0x05717, 0x05651, 0x05674,
+        0x058ee, 0x057ce, 0x057f4, 0x0580d, 0x0578b, 0x05832, 0x05831, 0x058ac,
+        0x214e4, 0x058f2, 0x058f7, 0x05906, 0x0591a, 0x05922, 0x05962, 0x216a8,
+        0x216ea, 0x059ec, 0x05a1b, 0x05a27, 0x059d8, 0x05a66, 0x036ee, 0x036fc,
+        0x05b08, 0x05b3e, 0x219c8, 0x05bc3, 0x05bd8, 0x05bf3, 0x21b18, 0x05bff,
+        0x05c06, 0x05f53, 0x05c22, 0x03781, 0x05c60, 0x05cc0, 0x05c8d, 0x21de4,
+        0x05d43, 0x21de6, 0x05d6e, 0x05d6b, 0x05d7c, 0x05de1, 0x05de2, 0x0382f,
+        0x05dfd, 0x05e28, 0x05e3d, 0x05e69, 0x03862, 0x22183, 0x0387c, 0x05eb0,
+        0x05eb3, 0x05eb6, 0x2a392, 0x05efe, 0x22331, 0x08201, 0x05f22, 0x038c7,
+        0x232b8, 0x261da, 0x05f62, 0x05f6b, 0x038e3, 0x05f9a, 0x05fcd, 0x05fd7,
+        0x05ff9, 0x06081, 0x0393a, 0x0391c, 0x226d4, 0x060c7, 0x06148, 0x0614c,
+        0x0617a, 0x061b2, 0x061a4, 0x061af, 0x061de, 0x06210, 0x0621b, 0x0625d,
+        0x062b1, 0x062d4, 0x06350, 0x22b0c, 0x0633d, 0x062fc, 0x06368, 0x06383,
+        0x063e4, 0x22bf1, 0x06422, 0x063c5, 0x063a9, 0x03a2e, 0x06469, 0x0647e,
+        0x0649d, 0x06477, 0x03a6c, 0x0656c, 0x2300a, 0x065e3, 0x066f8, 0x06649,
+        0x03b19, 0x03b08, 0x03ae4, 0x05192, 0x05195, 0x06700, 0x0669c, 0x080ad,
+        0x043d9, 0x06721, 0x0675e, 0x06753, 0x233c3, 0x03b49, 0x067fa, 0x06785,
+        0x06852, 0x2346d, 0x0688e, 0x0681f, 0x06914, 0x06942, 0x069a3, 0x069ea,
+        0x06aa8, 0x236a3, 0x06adb, 0x03c18, 0x06b21, 0x238a7, 0x06b54, 0x03c4e,
+        0x06b72, 0x06b9f, 0x06bbb, 0x23a8d, 0x21d0b, 0x23afa, 0x06c4e, 0x23cbc,
+        0x06cbf, 0x06ccd, 0x06c67, 0x06d16, 0x06d3e, 0x06d69, 0x06d78, 0x06d85,
+        0x23d1e, 0x06d34, 0x06e2f, 0x06e6e, 0x03d33, 0x06ec7, 0x23ed1, 0x06df9,
+        0x06f6e, 0x23f5e, 0x23f8e, 0x06fc6, 0x07039, 0x0701b, 0x03d96, 0x0704a,
+        0x0707d, 0x07077, 0x070ad, 0x20525, 0x07145, 0x24263, 0x0719c, 0x243ab,
+        0x07228, 0x07250, 0x24608, 0x07280, 0x07295, 0x24735, 0x24814, 0x0737a,
+        0x0738b, 0x03eac, 0x073a5, 0x03eb8, 0x07447, 0x0745c, 0x07485, 0x074ca,
+        0x03f1b, 0x07524, 0x24c36, 0x0753e, 0x24c92, 0x2219f, 0x07610, 0x24fa1,
+        0x24fb8, 0x25044, 0x03ffc, 0x04008, 0x250f3, 0x250f2, 0x25119, 0x25133,
+        0x0771e, 0x0771f, 0x0778b, 0x04046, 0x04096, 0x2541d, 0x0784e, 0x040e3,
+        0x25626, 0x2569a, 0x256c5, 0x079eb, 0x0412f, 0x07a4a, 0x07a4f, 0x2597c,
+        0x25aa7, 0x07aee, 0x04202, 0x25bab, 0x07bc6, 0x07bc9, 0x04227, 0x25c80,
+        0x07cd2, 0x042a0, 0x07ce8, 0x07ce3, 0x07d00, 0x25f86, 0x07d63, 0x04301,
+        0x07dc7, 0x07e02, 0x07e45, 0x04334, 0x26228, 0x26247, 0x04359, 0x262d9,
+        0x07f7a, 0x2633e, 0x07f95, 0x07ffa, 0x264da, 0x26523, 0x08060, 0x265a8,
+        0x08070, 0x2335f, 0x043d5, 0x080b2, 0x08103, 0x0440b, 0x0813e, 0x05ab5,
+        0x267a7, 0x267b5, 0x23393, 0x2339c, 0x08204, 0x08f9e, 0x0446b, 0x08291,
+        0x0828b, 0x0829d, 0x052b3, 0x082b1, 0x082b3, 0x082bd, 0x082e6, 0x26b3c,
+        0x0831d, 0x08363, 0x083ad, 0x08323, 0x083bd, 0x083e7, 0x08353, 0x083ca,
+        0x083cc, 0x083dc, 0x26c36, 0x26d6b, 0x26cd5, 0x0452b, 0x084f1, 0x084f3,
+        0x08516, 0x273ca, 0x08564, 0x26f2c, 0x0455d, 0x04561, 0x26fb1, 0x270d2,
+        0x0456b, 0x08650, 0x08667, 0x08669, 0x086a9, 0x08688, 0x0870e, 0x086e2,
+        0x08728, 0x0876b, 0x08786, 0x045d7, 0x087e1, 0x08801, 0x045f9, 0x08860,
+        0x08863, 0x27667, 0x088d7, 0x088de, 0x04635, 0x088fa, 0x034bb, 0x278ae,
+        0x27966, 0x046be, 0x046c7, 0x08aa0, 0x08c55, 0x27ca8, 0x08cab, 0x08cc1,
+        0x08d1b, 0x08d77, 0x27f2f, 0x20804, 0x08dcb, 0x08dbc, 0x08df0, 0x208de,
+        0x08ed4, 0x285d2, 0x285ed, 0x09094, 0x090f1, 0x09111, 0x2872e, 0x0911b,
+        0x09238, 0x092d7, 0x092d8, 0x0927c, 0x093f9, 0x09415, 0x28bfa, 0x0958b,
+        0x04995, 0x095b7, 0x28d77, 0x049e6, 0x096c3, 0x05db2, 0x09723, 0x29145,
+        0x2921a, 0x04a6e, 0x04a76, 0x097e0, 0x2940a, 0x04ab2, 0x29496, 0x09829,
+        0x295b6, 0x098e2, 0x04b33, 0x09929, 0x099a7, 0x099c2, 0x099fe, 0x04bce,
+        0x29b30, 0x09c40, 0x09cfd, 0x04cce, 0x04ced, 0x09d67, 0x2a0ce, 0x04cf8,
+        0x2a105, 0x2a20e, 0x2a291, 0x09ebb, 0x04d56, 0x09ef9, 0x09efe, 0x09f05,
+        0x09f0f, 0x09f16, 0x09f3b, 0x2a600,
+};
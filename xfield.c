@@ -0,0 +1,148 @@
+// xfield.c : Extended fields of inode records, without copies.
+//
+//   The iterator checks every header and value against the end of the
+//   record and stops at the first one that does not fit, so a damaged
+//   record yields the fields before the damage. Scalars are copied out with
+//   memcpy as the values are only 8-byte aligned relative to the record.
+
+#include <string.h>
+#include "xfield.h"
+
+/*
+   Input Parameters: xf_iter*, uint8_t* blob, size_t
+   Return Type:      void
+Description: Starts an iteration over the xf_blob_t at blob, len bytes long
+(the rest of the record value after its fixed part). A blob too short for
+its header yields no fields.
+
+ */
+void xfIterInit(xf_iter *it, const uint8_t *blob, size_t len)
+{
+        xf_blob_t header;
+
+        it->remaining = 0;
+        it->end = blob + len;
+        if (len < sizeof(header))
+                return;
+
+        memcpy(&header, blob, sizeof(header));
+        it->field = blob + sizeof(header);
+        it->data = it->field + (size_t)header.xf_num_exts * sizeof(x_field_t);
+        if (it->data <= it->end)
+                it->remaining = header.xf_num_exts;
+}
+
+// Fills view with the next field; 1 while there is one, 0 at the end
+int xfNext(xf_iter *it, xf_view *view)
+{
+        x_field_t field;
+
+        if (it->remaining == 0)
+                return 0;
+
+        memcpy(&field, it->field, sizeof(field));
+        if (field.x_size > it->end - it->data) {
+                it->remaining = 0;
+                return 0;
+        }
+
+        view->type = field.x_type;
+        view->flags = field.x_flags;
+        view->size = field.x_size;
+        view->data = it->data;
+
+        it->field += sizeof(field);
+        it->remaining--;
+        // The padding of the last value may be missing
+        if ((size_t)((field.x_size + 7) & ~7) <= (size_t)(it->end - it->data))
+                it->data += (field.x_size + 7) & ~7;
+        else
+                it->data = it->end;
+        return 1;
+}
+
+// Copies a scalar value that is at least size bytes long; 0 when it is shorter
+static int scalar(const xf_view *view, void *out, size_t size)
+{
+        if (view->size < size)
+                return 0;
+        memcpy(out, view->data, size);
+        return 1;
+}
+
+/*
+   Input Parameters: uint8_t* val, size_t, xf_inode*
+   Return Type:      int
+Description: Decodes the extended fields of an inode record's value into
+xf. Fields too short for their type are left out of present. Returns 0,
+or -1 when the value is shorter than j_inode_val_t.
+
+ */
+int xfInodeDecode(const uint8_t *val, size_t valLen, xf_inode *xf)
+{
+        xf_iter it;
+        xf_view view;
+
+        memset(xf, 0, sizeof(*xf));
+        if (valLen < sizeof(j_inode_val_t))
+                return -1;
+
+        xfIterInit(&it, val + sizeof(j_inode_val_t), valLen - sizeof(j_inode_val_t));
+        while (xfNext(&it, &view)) {
+                int found;
+
+                switch (view.type) {
+                case INO_EXT_TYPE_NAME:
+                        xf->name = (const char*)view.data;
+                        xf->nameLen = view.size;
+                        if (xf->nameLen && xf->name[xf->nameLen - 1] == '\0')
+                                xf->nameLen--;
+                        found = 1;
+                        break;
+                case INO_EXT_TYPE_DSTREAM:
+                        found = scalar(&view, &xf->dstream, sizeof(xf->dstream));
+                        break;
+                case INO_EXT_TYPE_SNAP_XID:
+                        found = scalar(&view, &xf->snapXid, sizeof(xf->snapXid));
+                        break;
+                case INO_EXT_TYPE_DELTA_TREE_OID:
+                        found = scalar(&view, &xf->deltaTreeOid, sizeof(xf->deltaTreeOid));
+                        break;
+                case INO_EXT_TYPE_DOCUMENT_ID:
+                        found = scalar(&view, &xf->documentId, sizeof(xf->documentId));
+                        break;
+                case INO_EXT_TYPE_PREV_FSIZE:
+                        found = scalar(&view, &xf->prevFsize, sizeof(xf->prevFsize));
+                        break;
+                case INO_EXT_TYPE_DIR_STATS_KEY:
+                        found = scalar(&view, &xf->dirStatsKey, sizeof(xf->dirStatsKey));
+                        break;
+                case INO_EXT_TYPE_SPARSE_BYTES:
+                        found = scalar(&view, &xf->sparseBytes, sizeof(xf->sparseBytes));
+                        break;
+                case INO_EXT_TYPE_RDEV:
+                        found = scalar(&view, &xf->rdev, sizeof(xf->rdev));
+                        break;
+                case INO_EXT_TYPE_PURGEABLE_FLAGS:
+                        found = scalar(&view, &xf->purgeableFlags, sizeof(xf->purgeableFlags));
+                        break;
+                case INO_EXT_TYPE_ORIG_SYNC_ROOT_ID:
+                        found = scalar(&view, &xf->origSyncRootId, sizeof(xf->origSyncRootId));
+                        break;
+                case INO_EXT_TYPE_FS_UUID:
+                        found = scalar(&view, xf->fsUuid, sizeof(xf->fsUuid));
+                        break;
+                case INO_EXT_TYPE_FINDER_INFO:
+                        found = scalar(&view, xf->finderInfo, view.size < sizeof(xf->finderInfo) ? view.size : sizeof(xf->finderInfo));
+                        break;
+                default:
+                        found = 0;
+                        break;
+                }
+
+                if (found && view.type < 32)
+                        xf->present |= 1u << view.type;
+        }
+
+        return 0;
+}
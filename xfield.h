@@ -0,0 +1,50 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+#include "apfs.h"
+
+/*
+ * Extended fields of inode and directory records, read in place from the
+ * record value. The x_field_t headers come first, then the values in the
+ * same order, each padded to 8 bytes. Nothing is allocated: a view points
+ * into the value it was decoded from.
+ */
+
+typedef struct {
+        const uint8_t *field;           // Next x_field_t header
+        const uint8_t *data;            // Its value
+        const uint8_t *end;
+        uint16_t remaining;
+} xf_iter;
+
+typedef struct {
+        uint8_t type;                   // INO_EXT_TYPE_*
+        uint8_t flags;
+        uint16_t size;
+        const uint8_t *data;            // size bytes, not aligned
+} xf_view;
+
+// The fields an inode can carry, decoded in one pass
+typedef struct {
+        uint32_t present;               // 1 << INO_EXT_TYPE_* for every field found
+        const char *name;               // Points into the record, nameLen excludes the NUL
+        uint16_t nameLen;
+        j_dstream_t dstream;
+        uint64_t snapXid;
+        uint64_t deltaTreeOid;
+        uint32_t documentId;
+        uint64_t prevFsize;
+        uint64_t dirStatsKey;
+        uint64_t sparseBytes;
+        uint32_t rdev;
+        uint64_t purgeableFlags;
+        uint64_t origSyncRootId;
+        uint8_t fsUuid[16];
+        uint8_t finderInfo[32];
+} xf_inode;
+
+#define XF_HAS(xf, type)        (((xf)->present >> (type)) & 1)
+
+void xfIterInit(xf_iter*, const uint8_t*, size_t);
+int xfNext(xf_iter*, xf_view*);
+int xfInodeDecode(const uint8_t*, size_t, xf_inode*);